@@ -121,6 +121,45 @@
 
 #endif // CLOCK_CYCLES
 
+#ifdef CLOCK_PERF
+
+#include <unistd.h>
+
+// stev: 'fd' is the file descriptor of the leader of
+// the group of performance counters opened by the
+// function 'clocks_perf_init', or -1 if none; the
+// counters are read in the order in which they got
+// opened: 'index[k]' is the index of the k-th such
+// counter among the 'clock_perf_n_counters' ones;
+// note that 'clocks_perf' is to be shared between
+// the main program and its parser modules, just as
+// 'clocks' is
+
+struct clocks_perf_t
+{
+    int    fd;
+    size_t n_counters;
+    size_t index[clock_perf_n_counters];
+};
+
+extern MODULE_API struct clocks_perf_t clocks_perf;
+
+#define CLOCK_GET_PERF_COUNTERS(c)                \
+    ({                                            \
+        uint64_t __b[clock_perf_n_counters + 1];  \
+        size_t __i, __n = clocks_perf.n_counters; \
+        STATIC(TYPEOF_IS(c[0], clock_counter_t)); \
+        ASSERT(__n <= clock_perf_n_counters);     \
+        if (read(clocks_perf.fd, __b,             \
+                (__n + 1) * sizeof(*__b)) < 0)    \
+            __b[0] = 0;                           \
+        for (__i = 0; __i < __n; __i ++)          \
+            c[clocks_perf.index[__i]] =           \
+                __i < __b[0] ? __b[__i + 1] : 0;  \
+    })
+
+#endif // CLOCK_PERF
+
 struct ntime_t
 {
     clock_types_t   types;
@@ -130,15 +169,30 @@ struct ntime_t
 #ifdef CLOCK_CYCLES
     clock_cycles_t  cycles;
 #endif
+#ifdef CLOCK_PERF
+    clock_counter_t counters[clock_perf_n_counters];
+#endif
 };
 
 #ifdef CLOCK_CYCLES
 #define CLOCKS_INIT_CYCLES(c, n) \
-    (c).cycles = (n)->cycles
+    (c).cycles = CLOCK_TYPES_HAS(cycles) ? (n)->cycles : 0
 #else
 #define CLOCKS_INIT_CYCLES(c, n)
 #endif
 
+#ifdef CLOCK_PERF
+#define CLOCKS_INIT_COUNTERS(c, n)                       \
+    do {                                                 \
+        (c).instructions = (n)->counters[0];             \
+        (c).branch_misses = (n)->counters[1];            \
+        (c).icache_misses = (n)->counters[2];            \
+        (c).cache_misses = (n)->counters[3];             \
+    } while (0)
+#else
+#define CLOCKS_INIT_COUNTERS(c, n)
+#endif
+
 #define CLOCKS_INIT(c, n)                                \
     do {                                                 \
         STATIC(TYPEOF_IS(c, struct clocks_t));           \
@@ -146,14 +200,44 @@ struct ntime_t
                TYPEOF_IS(n, const struct ntime_t*));     \
         if (CLOCK_TYPES_HAS(thread))                     \
             CLOCKS_TIME_INIT((c).thread, (n)->thread);   \
+        else                                             \
+            (c).thread = 0;                              \
         if (CLOCK_TYPES_HAS(process))                    \
             CLOCKS_TIME_INIT((c).process, (n)->process); \
+        else                                             \
+            (c).process = 0;                             \
         if (CLOCK_TYPES_HAS(real))                       \
             CLOCKS_TIME_INIT((c).real, (n)->real);       \
+        else                                             \
+            (c).real = 0;                                \
         CLOCKS_INIT_CYCLES(c, n);                        \
+        CLOCKS_INIT_COUNTERS(c, n);                      \
         (c).types = (n)->types;                          \
     } while (0)
 
+#define CLOCKS_TIME_CLAMP(x, y) \
+    do {                        \
+        if ((x) < (y))          \
+            (x) = (y);          \
+    } while (0)
+
+#ifdef CLOCK_CYCLES
+#define CLOCKS_CLAMP_CYCLES(c, d) \
+    CLOCKS_TIME_CLAMP((c).cycles, (d).cycles)
+#else
+#define CLOCKS_CLAMP_CYCLES(c, d)
+#endif
+
+#define CLOCKS_CLAMP(c, d)                               \
+    do {                                                 \
+        STATIC(TYPEOF_IS(c, struct clocks_t));           \
+        STATIC(TYPEOF_IS(d, struct clocks_t));           \
+        CLOCKS_TIME_CLAMP((c).real, (d).real);           \
+        CLOCKS_TIME_CLAMP((c).process, (d).process);     \
+        CLOCKS_TIME_CLAMP((c).thread, (d).thread);       \
+        CLOCKS_CLAMP_CYCLES(c, d);                       \
+    } while (0)
+
 #define CLOCK_TYPES_HAS(n) \
     CLOCK_TYPES_HAS_(ntime->types, clock_type_ ## n)
 
@@ -164,6 +248,13 @@ static ALWAYS_INLINE
 {
     ntime->types = types;
 
+#ifdef CLOCK_PERF
+    // stev: only the counters that got opened are
+    // read by 'CLOCK_GET_PERF_COUNTERS' -- possibly
+    // none of them --, yet 'CLOCKS_INIT' copies all
+    memset(ntime->counters, 0, sizeof(ntime->counters));
+#endif
+
     if (CLOCK_TYPES_HAS(real))
         clock_gettime(CLOCK_REALTIME, &ntime->real);
     if (CLOCK_TYPES_HAS(process))
@@ -174,6 +265,10 @@ static ALWAYS_INLINE
     if (CLOCK_TYPES_HAS(cycles))
         CLOCK_GET_RDTSC_CYCLES(ntime->cycles);
 #endif
+#ifdef CLOCK_PERF
+    if (ntime->types & clock_types_perf)
+        CLOCK_GET_PERF_COUNTERS(ntime->counters);
+#endif
 }
 
 static ALWAYS_INLINE
@@ -183,6 +278,11 @@ static ALWAYS_INLINE
     struct clocks_t p, r;
     struct ntime_t t;
 
+#ifdef CLOCK_PERF
+    memset(t.counters, 0, sizeof(t.counters));
+    if (ntime->types & clock_types_perf)
+        CLOCK_GET_PERF_COUNTERS(t.counters);
+#endif
 #ifdef CLOCK_CYCLES
     if (CLOCK_TYPES_HAS(cycles))
         CLOCK_GET_RDTSCP_CYCLES(t.cycles);
@@ -198,11 +298,98 @@ static ALWAYS_INLINE
 
     CLOCKS_INIT(p, ntime);
     CLOCKS_INIT(r, &t);
+    // stev: the clocks may step backwards -- e.g.
+    // upon a migration of the thread to another CPU
+    // of a virtual machine --; such a reading counts
+    // as no time elapsed
+    CLOCKS_CLAMP(r, p);
     clocks_sub(&r, &p);
 
     return r;
 }
 
+// stev: the pseudo-random gaps between sampled calls
+// are drawn uniformly from the range [1, 2*period-1]
+// by Marsaglia's xorshift64 generator; the seed is
+// fixed, for the runs to be reproducible
+
+#define CLOCKS_SAMPLER_SEED UINT64_C(88172645463325252)
+
+static ALWAYS_INLINE
+    size_t clocks_sampler_gap(
+        struct clocks_sampler_t* sampler)
+{
+    uint64_t x = sampler->state;
+
+    if (!sampler->random)
+        return sampler->period;
+
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+    sampler->state = x;
+
+    return 1 + x % (2 * sampler->period - 1);
+}
+
+// stev: returns true iff the current call is to be
+// timed; the untimed calls pay only for decrementing
+// the counter 'countdown'
+
+static ALWAYS_INLINE
+    bool clocks_sampler_next(
+        struct clocks_sampler_t* sampler)
+{
+    sampler->n_calls ++;
+
+    if (sampler->period <= 1)
+        return true;
+    if (-- sampler->countdown)
+        return false;
+
+    sampler->countdown =
+        clocks_sampler_gap(sampler);
+    return true;
+}
+
+#ifdef CLOCK_CYCLES
+
+static ALWAYS_INLINE
+    size_t clocks_hist_index(
+        clock_cycles_t v)
+{
+    const size_t h = clocks_hist_n_subs / 2;
+    size_t e;
+
+    STATIC(sizeof(v) == sizeof(unsigned long long));
+
+    if (v < clocks_hist_n_subs)
+        return v;
+
+    // stev: 'v >> e' is in [h, 2*h)
+    e = 63 - __builtin_clzll(v) -
+        (clocks_hist_sub_bits - 1);
+    return clocks_hist_n_subs +
+        (e - 1) * h + (v >> e) - h;
+}
+
+static ALWAYS_INLINE
+    void clocks_hist_add(
+        struct clocks_hist_t* hist,
+        size_t row, clock_cycles_t v)
+{
+    size_t i = clocks_hist_index(v);
+
+    ASSERT(row < hist->n_rows);
+    ASSERT(i < clocks_hist_n_buckets);
+
+    hist->counts[row * clocks_hist_n_buckets + i] ++;
+    if (hist->maxes[row] < v)
+        hist->maxes[row] = v;
+}
+
+#endif // CLOCK_CYCLES
+
 #endif // __CLOCKS_IMPL_H
 
 
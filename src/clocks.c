@@ -23,6 +23,13 @@
 #include <stdio.h>
 #include <inttypes.h>
 
+#ifdef CLOCK_PERF
+#include <errno.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+#endif
+
 #include "common.h"
 #include "clocks.h"
 #include "clocks-impl.h"
@@ -38,6 +45,26 @@ void clocks_init(
 #ifdef CLOCK_CYCLES
     clocks->cycles = 0;
 #endif
+#ifdef CLOCK_PERF
+    clocks->instructions = 0;
+    clocks->branch_misses = 0;
+    clocks->icache_misses = 0;
+    clocks->cache_misses = 0;
+#endif
+}
+
+void clocks_sampler_init(
+    struct clocks_sampler_t* sampler,
+    size_t period, bool random)
+{
+    ASSERT(period > 0);
+
+    memset(sampler, 0, sizeof(*sampler));
+    sampler->period = period;
+    sampler->random = random;
+    sampler->state = CLOCKS_SAMPLER_SEED;
+    sampler->countdown =
+        clocks_sampler_gap(sampler);
 }
 
 #undef  CLOCK_TYPES_HAS
@@ -60,6 +87,16 @@ void clocks_add(
     if (CLOCK_TYPES_HAS(cycles))
         CLOCKS_TIME_ADD(clocks->cycles, clocks2->cycles);
 #endif
+#ifdef CLOCK_PERF
+    if (CLOCK_TYPES_HAS(instructions))
+        CLOCKS_TIME_ADD(clocks->instructions, clocks2->instructions);
+    if (CLOCK_TYPES_HAS(branch_misses))
+        CLOCKS_TIME_ADD(clocks->branch_misses, clocks2->branch_misses);
+    if (CLOCK_TYPES_HAS(icache_misses))
+        CLOCKS_TIME_ADD(clocks->icache_misses, clocks2->icache_misses);
+    if (CLOCK_TYPES_HAS(cache_misses))
+        CLOCKS_TIME_ADD(clocks->cache_misses, clocks2->cache_misses);
+#endif
 }
 
 void clocks_sub(
@@ -78,6 +115,16 @@ void clocks_sub(
     if (CLOCK_TYPES_HAS(cycles))
         CLOCKS_TIME_SUB(clocks->cycles, clocks2->cycles);
 #endif
+#ifdef CLOCK_PERF
+    if (CLOCK_TYPES_HAS(instructions))
+        CLOCKS_TIME_SUB(clocks->instructions, clocks2->instructions);
+    if (CLOCK_TYPES_HAS(branch_misses))
+        CLOCKS_TIME_SUB(clocks->branch_misses, clocks2->branch_misses);
+    if (CLOCK_TYPES_HAS(icache_misses))
+        CLOCKS_TIME_SUB(clocks->icache_misses, clocks2->icache_misses);
+    if (CLOCK_TYPES_HAS(cache_misses))
+        CLOCKS_TIME_SUB(clocks->cache_misses, clocks2->cache_misses);
+#endif
 }
 
 struct clocks_def_t
@@ -92,19 +139,27 @@ struct clocks_def_t
         (((char*) c) + p->offset) \
     )
 
-#undef  CASE
-#define CASE(n)                  \
+#undef  CASE2
+#define CASE2(n, s)              \
     {                            \
         .offset = offsetof(      \
             struct clocks_t, n), \
-        .name = #n               \
+        .name = s                \
     }
+#undef  CASE
+#define CASE(n) CASE2(n, #n)
 static const struct clocks_def_t clocks_defs[] = {
     CASE(real),
     CASE(process),
     CASE(thread),
 #ifdef CLOCK_CYCLES
-    CASE(cycles)
+    CASE(cycles),
+#endif
+#ifdef CLOCK_PERF
+    CASE(instructions),
+    CASE2(branch_misses, "branch-misses"),
+    CASE2(icache_misses, "icache-misses"),
+    CASE2(cache_misses, "cache-misses"),
 #endif
 };
 
@@ -156,6 +211,23 @@ enum { clocks_n_defs = ARRAY_SIZE(clocks_defs) };
 //    
 // => a[k] = 2 * sum{t[i], i=1..k-1} + t[k], k > 1,
 //    a[1] = t[1].
+//
+// The performance counters are all read at once by
+// one and the same system call; their adjustments
+// are therefore not nested: a[k] = t[k]. Moreover,
+// these adjustments are capped by the values of the
+// counters, since counters like 'branch-misses' do
+// not have a constant overhead per call.
+//
+// The overheads calibrated in-process are measured
+// exactly the way the timings are: by reading all
+// the clocks of the run, in their nesting order,
+// around an empty sequence of code (m[1] = 0). The
+// calibrated values are thus a[k] themselves, not
+// t[k]; for the clocks nesting these ones, t[k] is
+// recovered as a[k] - 2 * sum{t[i], i=1..k-1}. All
+// adjustments are capped by the measured timings,
+// since the calibrated values are only medians.
 
 #undef  CLOCK_TYPES_HAS
 #define CLOCK_TYPES_HAS(t) \
@@ -167,12 +239,13 @@ enum { clocks_n_defs = ARRAY_SIZE(clocks_defs) };
 void clocks_adjust(
     struct clocks_t* clocks,
     const struct clocks_t* overhead,
+    clock_types_t calibrated,
     size_t count)
 {
     const struct clocks_def_t *b, *p;
     const clocks_time_t c = count;
     size_t i = clocks_n_defs - 1;
-    clocks_time_t s = 0, t;
+    clocks_time_t s = 0, t, u, v;
     struct clocks_t a;
 
     ASSERT(clocks->types == overhead->types);
@@ -182,6 +255,10 @@ void clocks_adjust(
     if (CLOCK_TYPES_HAS(clock_type_cycles))
         ASSERT(!(clocks->types & clock_types_all));
 #endif
+#ifdef CLOCK_PERF
+    if (clocks->types & clock_types_perf)
+        ASSERT(!(clocks->types & ~clock_types_perf));
+#endif
 
     for (b = clocks_defs,
          p = clocks_defs + clocks_n_defs;
@@ -191,22 +268,179 @@ void clocks_adjust(
             continue;
 
         t = *OVERHEAD_TIME(p);
-        CLOCKS_TIME_MUL(t, c);
+        v = *CLOCKS_TIME_(clocks, p, );
+
+#ifdef CLOCK_PERF
+        if (CLOCK_BIT(i) & clock_types_perf) {
+            CLOCKS_TIME_MUL(t, c);
+            *CLOCKS_TIME(p) = t < v ? t : v;
+            continue;
+        }
+#endif
 
-        *CLOCKS_TIME(p) =
-        CLOCKS_TIME_ADD(s, t);
-        CLOCKS_TIME_ADD(s, t);
+        // stev: 't' becomes a[k] and 'u' t[k],
+        // both per call; 's' becomes the sum of
+        // 2 * t[i], i=1..k
+        if (!(CLOCK_BIT(i) & calibrated))
+            CLOCKS_TIME_ADD(t, s);
+        u = t > s ? t - s : 0;
+        CLOCKS_TIME_ADD(s, u);
+        CLOCKS_TIME_ADD(s, u);
+
+        CLOCKS_TIME_MUL(t, c);
+        *CLOCKS_TIME(p) = t < v ? t : v;
     }
 
     clocks_sub(clocks, &a);
 }
 
+#define SAMPLE_TIME(p) (*CLOCKS_TIME_(clocks2, p, const))
+
+void clocks_add_sample(
+    struct clocks_t* clocks,
+    struct clocks_sampler_t* sampler,
+    const struct clocks_t* clocks2)
+{
+    const struct clocks_def_t *p, *e;
+    size_t i = 0;
+    double v;
+
+    STATIC(ARRAY_SIZE(clocks_defs) == clock_n_types);
+
+    clocks_add(clocks, clocks2);
+    sampler->n_samples ++;
+
+    // stev: the squares are of use only
+    // when not timing each and every call
+    if (sampler->period <= 1)
+        return;
+
+    for (p = clocks_defs,
+         e = clocks_defs + clocks_n_defs;
+         p < e;
+         p ++,
+         i ++) {
+        if (!CLOCK_TYPES_HAS(i))
+            continue;
+        v = SAMPLE_TIME(p);
+        sampler->squares[i] += v * v;
+    }
+}
+
+static double clocks_sqrt(double x)
+{
+    double r, s;
+
+    if (x <= 0)
+        return 0;
+
+    // stev: Newton's iteration starting from
+    // above the root is decreasing strictly
+    // until reaching the limit of precision
+    r = x > 1 ? x : 1;
+    do {
+        s = r;
+        r = (r + x / r) / 2;
+    } while (r < s);
+
+    return s;
+}
+
+// stev: the total of 'N' calls is estimated from a
+// sample of 'n' of them, of sum 'S' and of sum of
+// squares 'Q', by 'N * S / n'; the standard error of
+// this estimate is 'N * sqrt(v / n * (1 - n / N))',
+// where 'v' is the sample variance, '(Q - S*S/n) /
+// (n - 1)', and '1 - n / N' is the finite population
+// correction -- which makes the error vanish when
+// all calls were timed; since the variance doesn't
+// depend on constant shifts, the errors have to be
+// computed prior to applying 'clocks_adjust'
+
+void clocks_sampler_errors(
+    const struct clocks_sampler_t* sampler,
+    const struct clocks_t* clocks,
+    double* errors)
+{
+    const struct clocks_def_t *p, *e;
+    const double n = sampler->n_samples;
+    const double N = sampler->n_calls;
+    double s, v;
+    size_t i = 0;
+
+    for (p = clocks_defs,
+         e = clocks_defs + clocks_n_defs;
+         p < e;
+         p ++,
+         i ++) {
+        errors[i] = 0;
+
+        if (!CLOCK_TYPES_HAS(i) ||
+            sampler->n_samples < 2 ||
+            sampler->n_samples >= sampler->n_calls)
+            continue;
+
+        s = *CLOCKS_TIME_(clocks, p, const);
+        v = (sampler->squares[i] - s * s / n) / (n - 1);
+        errors[i] = N * clocks_sqrt(v / n * (1 - n / N));
+    }
+}
+
+void clocks_sampler_scale(
+    const struct clocks_sampler_t* sampler,
+    struct clocks_t* clocks)
+{
+    const struct clocks_def_t *p, *e;
+    const double n = sampler->n_samples;
+    const double N = sampler->n_calls;
+    clocks_time_t* t;
+    size_t i = 0;
+
+    if (sampler->n_samples == 0 ||
+        sampler->n_samples >= sampler->n_calls)
+        return;
+
+    for (p = clocks_defs,
+         e = clocks_defs + clocks_n_defs;
+         p < e;
+         p ++,
+         i ++) {
+        if (!CLOCK_TYPES_HAS(i))
+            continue;
+        t = CLOCKS_TIME_(clocks, p, );
+        *t = *t * (N / n) + 0.5;
+    }
+}
+
+// stev: sums up into 'clocks' the adjusted and scaled
+// timings 'clocks2' of another thread; the timings of
+// distinct threads being independent, the errors of
+// the sum are the square roots of the sums of squares
+// of the errors of the terms
+
+void clocks_merge(
+    struct clocks_t* clocks,
+    double* errors,
+    const struct clocks_t* clocks2,
+    const double* errors2)
+{
+    size_t i;
+
+    clocks_add(clocks, clocks2);
+
+    for (i = 0; i < clock_n_types; i ++)
+        errors[i] = clocks_sqrt(
+            errors[i] * errors[i] +
+            errors2[i] * errors2[i]);
+}
+
 #undef  CLOCKS_TIME
 #define CLOCKS_TIME(p) \
     (*CLOCKS_TIME_(clocks, p, const))
 
 void clocks_print(
     const struct clocks_t* clocks,
+    const double* errors,
     const char* name, size_t width,
     FILE* file)
 {
@@ -226,9 +460,12 @@ void clocks_print(
         w = strlen(p->name);
         w = SIZE_ADD(w, l);
         w = w < width ? width - w : 0;
-        fprintf(file, "%s-%s:%-*s %" PRIu64 "\n",
+        fprintf(file, "%s-%s:%-*s %" PRIu64,
             p->name, name, SIZE_AS_INT(w), "",
             CLOCKS_TIME(p));
+        if (errors != NULL)
+            fprintf(file, " +- %.0f", errors[i]);
+        fputc('\n', file);
     }
 }
 
@@ -255,12 +492,479 @@ void clocks_print_names(
     }
 }
 
+#ifndef HTML_CREF_MODULE
+
+extern const char program[];
+
+// stev: the overhead of a clock is calibrated by
+// timing 'clocks_n_calib' times an empty sequence
+// of code, exactly the way the parse functions are
+// timed: by 'ntime_init' and 'ntime_clocks', with
+// all the clocks of the run read at once, in their
+// nesting order; the median of these readings is
+// robust to outliers (preemptions, interrupts, cache
+// misses), unlike their mean; the median absolute
+// deviation (MAD) of the readings is a robust measure
+// of spread; the first 'clocks_n_warmup' readings
+// are discarded, as they are made with cold caches
+// and, possibly, at a lower CPU frequency
+
+enum {
+    clocks_n_calib = SZ(10001),
+    clocks_n_warmup = SZ(1000)
+};
+
+static int clocks_calib_cmp(
+    const void* a, const void* b)
+{
+    const clocks_time_t x = *(const clocks_time_t*) a;
+    const clocks_time_t y = *(const clocks_time_t*) b;
+
+    return x < y ? -1 : x > y;
+}
+
+static void clocks_calib_median(
+    clocks_time_t* vals, size_t n,
+    clocks_time_t* median,
+    clocks_time_t* spread)
+{
+    clocks_time_t m;
+    size_t i;
+
+    ASSERT(n > 0);
+
+    qsort(vals, n, sizeof(*vals), clocks_calib_cmp);
+    m = vals[n / 2];
+
+    for (i = 0; i < n; i ++)
+        vals[i] = vals[i] > m
+            ? vals[i] - m
+            : m - vals[i];
+
+    qsort(vals, n, sizeof(*vals), clocks_calib_cmp);
+
+    *median = m;
+    *spread = vals[n / 2];
+}
+
+void clocks_calibrate(
+    struct clocks_calib_t* calib,
+    clock_types_t types,
+    clock_types_t calibrate)
+{
+    const struct clocks_def_t *p, *e;
+    const size_t n = clocks_n_calib;
+    clocks_time_t* v;
+    struct clocks_t c;
+    struct ntime_t t;
+    size_t i, j;
+
+    ASSERT(!(calibrate & ~types));
+
+    calib->types = calibrate;
+    clocks_init(&calib->median, types);
+    clocks_init(&calib->spread, types);
+
+    v = malloc(SIZE_MUL(SIZE_MUL(n,
+        (size_t) clocks_n_defs), sizeof(*v)));
+    ASSERT(v != NULL);
+
+    for (j = 0; j < clocks_n_warmup; j ++) {
+        ntime_init(&t, types);
+        c = ntime_clocks(&t);
+    }
+
+    for (j = 0; j < n; j ++) {
+        ntime_init(&t, types);
+        c = ntime_clocks(&t);
+
+        for (p = clocks_defs, i = 0,
+             e = clocks_defs + clocks_n_defs;
+             p < e;
+             p ++,
+             i ++) {
+            if (CLOCK_TYPES_HAS_(types, i))
+                v[i * n + j] = *CLOCKS_TIME_(&c, p, const);
+        }
+    }
+
+    for (p = clocks_defs, i = 0,
+         e = clocks_defs + clocks_n_defs;
+         p < e;
+         p ++,
+         i ++) {
+        if (!CLOCK_TYPES_HAS_(types, i))
+            continue;
+
+        clocks_calib_median(v + i * n, n,
+            CLOCKS_TIME_(&calib->median, p, ),
+            CLOCKS_TIME_(&calib->spread, p, ));
+    }
+
+    free(v);
+}
+
+void clocks_calib_apply(
+    const struct clocks_calib_t* calib,
+    struct clocks_t* overhead)
+{
+    const struct clocks_def_t *p, *e;
+    size_t i = 0;
+
+    for (p = clocks_defs,
+         e = clocks_defs + clocks_n_defs;
+         p < e;
+         p ++,
+         i ++) {
+        if (!CLOCK_TYPES_HAS_(calib->types, i) ||
+            !CLOCK_TYPES_HAS_(overhead->types, i))
+            continue;
+        *CLOCKS_TIME_(overhead, p, ) =
+            *CLOCKS_TIME_(&calib->median, p, const);
+    }
+}
+
+// stev: the calibration done at the start of the run
+// is checked against the one done at the end of it:
+// the two medians are considered to agree when they
+// are apart by no more than three times the larger
+// of the two MADs plus a tenth of the larger median
+// (plus one unit, for the granularity of the clock)
+
+#define CALIB_TIME(c, n) \
+    (*CLOCKS_TIME_(&(c)->n, p, const))
+
+void clocks_calib_check(
+    const struct clocks_calib_t* calib,
+    const struct clocks_calib_t* calib2)
+{
+    const struct clocks_def_t *p, *e;
+    clocks_time_t a, b, d, s, t;
+    size_t i = 0;
+
+    ASSERT(calib->types == calib2->types);
+
+    for (p = clocks_defs,
+         e = clocks_defs + clocks_n_defs;
+         p < e;
+         p ++,
+         i ++) {
+        if (!CLOCK_TYPES_HAS_(calib->types, i))
+            continue;
+
+        a = CALIB_TIME(calib, median);
+        b = CALIB_TIME(calib2, median);
+        s = CALIB_TIME(calib, spread);
+        t = CALIB_TIME(calib2, spread);
+
+        d = a > b ? a - b : b - a;
+        s = s > t ? s : t;
+        t = a > b ? a : b;
+
+        if (d > 3 * s + t / 10 + 1)
+            fprintf(stderr,
+                "%s: warning: %s overhead changed "
+                "from %" PRIu64 " to %" PRIu64 " "
+                "during the run\n",
+                program, p->name, a, b);
+    }
+}
+
+void clocks_calib_print(
+    const struct clocks_calib_t* calib,
+    const struct clocks_calib_t* calib2,
+    const char* name, size_t width,
+    FILE* file)
+{
+    const struct clocks_def_t *p, *e;
+    size_t i = 0, l, w;
+
+    ASSERT(name != NULL);
+    l = strlen(name) + 1;
+
+    for (p = clocks_defs,
+         e = clocks_defs + clocks_n_defs;
+         p < e;
+         p ++,
+         i ++) {
+        if (!CLOCK_TYPES_HAS_(calib->types, i))
+            continue;
+        w = strlen(p->name);
+        w = SIZE_ADD(w, l);
+        w = w < width ? width - w : 0;
+        fprintf(file, "%s-%s:%-*s %" PRIu64 " +- %" PRIu64,
+            p->name, name, SIZE_AS_INT(w), "",
+            CALIB_TIME(calib, median),
+            CALIB_TIME(calib, spread));
+        if (calib2 != NULL)
+            fprintf(file, " (at end: %" PRIu64 " +- %" PRIu64 ")",
+                CALIB_TIME(calib2, median),
+                CALIB_TIME(calib2, spread));
+        fputc('\n', file);
+    }
+
+#undef CALIB_TIME
+}
+
+#endif // !HTML_CREF_MODULE
+
+#if defined(CLOCK_CYCLES) && !defined(HTML_CREF_MODULE)
+
+void clocks_hist_init(
+    struct clocks_hist_t* hist,
+    size_t n_rows)
+{
+    ASSERT(n_rows > 0);
+
+    hist->n_rows = n_rows;
+    hist->counts = calloc(
+        SIZE_MUL(n_rows, (size_t) clocks_hist_n_buckets),
+        sizeof(*hist->counts));
+    ASSERT(hist->counts != NULL);
+    hist->maxes = calloc(
+        n_rows, sizeof(*hist->maxes));
+    ASSERT(hist->maxes != NULL);
+}
+
+void clocks_hist_done(
+    struct clocks_hist_t* hist)
+{
+    free(hist->maxes);
+    free(hist->counts);
+    memset(hist, 0, sizeof(*hist));
+}
+
+void clocks_hist_merge(
+    struct clocks_hist_t* hist,
+    const struct clocks_hist_t* hist2)
+{
+    size_t i, n;
+
+    ASSERT(hist->n_rows == hist2->n_rows);
+
+    n = SIZE_MUL(hist->n_rows, (size_t) clocks_hist_n_buckets);
+    for (i = 0; i < n; i ++)
+        hist->counts[i] += hist2->counts[i];
+
+    for (i = 0; i < hist->n_rows; i ++)
+        if (hist->maxes[i] < hist2->maxes[i])
+            hist->maxes[i] = hist2->maxes[i];
+}
+
+// stev: returns the highest value that
+// is counted by the bucket of index 'i'
+
+static clock_cycles_t clocks_hist_bucket_max(
+    size_t i)
+{
+    const size_t h = clocks_hist_n_subs / 2;
+    size_t e;
+
+    ASSERT(i < clocks_hist_n_buckets);
+
+    if (i < clocks_hist_n_subs)
+        return i;
+
+    i -= clocks_hist_n_subs;
+    e = i / h + 1;
+    i = i % h + h + 1;
+
+    // stev: the last bucket ends at 2^64 - 1,
+    // its shift below wrapping around to zero
+    return ((clock_cycles_t) i << e) - 1;
+}
+
+// stev: the percentiles are computed by the nearest
+// rank method; each is the upper bound of the bucket
+// in which the rank falls, capped by the maximum
+// value counted; the overhead is subtracted from all
+// of the values printed out; returns false when the
+// row 'row' is empty
+
+bool clocks_hist_print(
+    const struct clocks_hist_t* hist,
+    size_t row, const char* name,
+    clock_cycles_t overhead,
+    FILE* file)
+{
+    static const struct {
+        size_t      permille;
+        const char* name;
+    } percs[] = {
+        { 500, "p50" },
+        { 900, "p90" },
+        { 990, "p99" },
+        { 999, "p99.9" },
+    };
+    const uint64_t *b, *p, *e;
+    uint64_t n = 0, r, c = 0;
+    clock_cycles_t m, v;
+    size_t k = 0;
+
+    ASSERT(row < hist->n_rows);
+
+    b = hist->counts + row * clocks_hist_n_buckets;
+    e = b + clocks_hist_n_buckets;
+    m = hist->maxes[row];
+
+    for (p = b; p < e; p ++)
+        n += *p;
+    if (n == 0)
+        return false;
+
+#define SUB_OVERHEAD(v) \
+    ((v) > overhead ? (v) - overhead : 0)
+
+    fprintf(file, "%s: count=%" PRIu64, name, n);
+
+    for (p = b; p < e && k < ARRAY_SIZE(percs); p ++) {
+        c += *p;
+        while (k < ARRAY_SIZE(percs)) {
+            // stev: r = ceil(n * permille / 1000)
+            r = (n * percs[k].permille + 999) / 1000;
+            if (r == 0)
+                r = 1;
+            if (c < r)
+                break;
+            v = clocks_hist_bucket_max(PTR_DIFF(p, b));
+            if (v > m)
+                v = m;
+            fprintf(file, " %s=%" PRIu64,
+                percs[k ++].name, SUB_OVERHEAD(v));
+        }
+    }
+    ASSERT(k == ARRAY_SIZE(percs));
+
+    fprintf(file, " max=%" PRIu64 "\n",
+        SUB_OVERHEAD(m));
+
+#undef SUB_OVERHEAD
+
+    return true;
+}
+
+#endif // CLOCK_CYCLES && !HTML_CREF_MODULE
+
+#if defined(CLOCK_PERF) && !defined(HTML_CREF_MODULE)
+
+extern const char program[];
+
+struct clocks_perf_def_t
+{
+    uint32_t type;
+    uint64_t config;
+};
+
+#define CLOCKS_PERF_HW(n)                          \
+    {                                              \
+        .type = PERF_TYPE_HARDWARE,                \
+        .config = PERF_COUNT_HW_ ## n              \
+    }
+#define CLOCKS_PERF_HW_CACHE(n, o, r)              \
+    {                                              \
+        .type = PERF_TYPE_HW_CACHE,                \
+        .config = PERF_COUNT_HW_CACHE_ ## n |      \
+            PERF_COUNT_HW_CACHE_OP_ ## o << 8 |    \
+            PERF_COUNT_HW_CACHE_RESULT_ ## r << 16 \
+    }
+
+static const struct clocks_perf_def_t
+clocks_perf_defs[clock_perf_n_counters] = {
+    CLOCKS_PERF_HW(INSTRUCTIONS),
+    CLOCKS_PERF_HW(BRANCH_MISSES),
+    CLOCKS_PERF_HW_CACHE(L1I, READ, MISS),
+    CLOCKS_PERF_HW(CACHE_MISSES),
+};
+
+static int clocks_perf_fds[clock_perf_n_counters];
+
+// stev: open the performance counters named by 'types'
+// as one group of counters of the calling process, for
+// to be read by 'CLOCK_GET_PERF_COUNTERS'; the counters
+// are counting only in user mode; those counters that
+// cannot be opened -- e.g. when running inside VMs not
+// exposing the hardware performance monitoring unit or
+// when '/proc/sys/kernel/perf_event_paranoid' disallows
+// the usage of the respective counter -- are reported
+// by a warning message and removed from the returned
+// clock types
+
+clock_types_t clocks_perf_init(
+    clock_types_t types)
+{
+    struct perf_event_attr a;
+    size_t i, j;
+    int f, e;
+
+    STATIC(
+        clock_type_instructions + 1 ==
+        clock_type_branch_misses);
+    STATIC(
+        clock_type_instructions + 3 ==
+        clock_type_cache_misses);
+
+    clocks_perf.fd = -1;
+    clocks_perf.n_counters = 0;
+
+    for (i = 0; i < clock_perf_n_counters; i ++) {
+        j = clock_type_instructions + i;
+        if (!CLOCK_TYPES_HAS_(types, j))
+            continue;
+
+        memset(&a, 0, sizeof a);
+        a.size = sizeof a;
+        a.type = clocks_perf_defs[i].type;
+        a.config = clocks_perf_defs[i].config;
+        a.read_format = PERF_FORMAT_GROUP;
+        a.exclude_kernel = 1;
+        a.exclude_hv = 1;
+
+        f = syscall(SYS_perf_event_open, &a, 0, -1,
+                clocks_perf.fd, 0);
+        if (f < 0) {
+            e = errno;
+            fprintf(stderr,
+                "%s: warning: performance counter '%s' "
+                "not available: %s%s\n", program,
+                clocks_defs[j].name, strerror(e),
+                e == EACCES || e == EPERM
+                ? " (see /proc/sys/kernel/perf_event_paranoid)"
+                : "");
+            types &= ~CLOCK_BIT(j);
+            continue;
+        }
+
+        if (clocks_perf.fd < 0)
+            clocks_perf.fd = f;
+        clocks_perf_fds[clocks_perf.n_counters] = f;
+        clocks_perf.index[clocks_perf.n_counters ++] = i;
+    }
+
+    return types;
+}
+
+void clocks_perf_done(void)
+{
+    while (clocks_perf.n_counters)
+        close(clocks_perf_fds[
+            -- clocks_perf.n_counters]);
+    clocks_perf.fd = -1;
+}
+
+#endif // CLOCK_PERF && !HTML_CREF_MODULE
+
 #ifdef MAIN
 
 #define CLOCKS STRINGIFY(PROGRAM)
 
 const char program[] = CLOCKS;
 
+#ifdef CLOCK_PERF
+struct clocks_perf_t clocks_perf = {
+    .fd = -1
+};
+#endif
+
 struct clocks_options_t
 {
     clock_types_t types;
@@ -281,16 +985,45 @@ static bool clocks_lookup_type(
 {
 #ifndef CLOCK_CYCLES
     // pattern: process|real|thread
-#else
+#elif !defined(CLOCK_PERF)
     // pattern: cycles|process|real|thread
+#else
+    // pattern: branch-misses|cache-misses|cycles|icache-misses|
+    //          instructions|process|real|thread
 #endif
     switch (*n ++) {
+#ifdef CLOCK_PERF
+    case 'b':
+        if (!strcmp(n, "ranch-misses")) {
+            *t = CLOCK_TYPE(branch_misses);
+            return true;
+        }
+        return false;
+#endif
 #ifdef CLOCK_CYCLES
     case 'c':
         if (!strcmp(n, "ycles")) {
             *t = CLOCK_TYPE(cycles);
             return true;
         }
+#ifdef CLOCK_PERF
+        if (!strcmp(n, "ache-misses")) {
+            *t = CLOCK_TYPE(cache_misses);
+            return true;
+        }
+#endif
+        return false;
+#endif
+#ifdef CLOCK_PERF
+    case 'i':
+        if (!strcmp(n, "cache-misses")) {
+            *t = CLOCK_TYPE(icache_misses);
+            return true;
+        }
+        if (!strcmp(n, "nstructions")) {
+            *t = CLOCK_TYPE(instructions);
+            return true;
+        }
         return false;
 #endif
     case 'p':
@@ -321,8 +1054,11 @@ static const struct clocks_options_t*
 "usage: ./" CLOCKS " [-?|--help] [-v|--verbose] [NAME...]\n"
 #ifndef CLOCK_CYCLES
 "where NAME is either 'real', 'process' or 'thread'";
-#else
+#elif !defined(CLOCK_PERF)
 "where NAME is either 'real', 'process', 'thread' or 'cycles'";
+#else
+"where NAME is either 'real', 'process', 'thread', 'cycles',\n"
+"'instructions', 'branch-misses', 'icache-misses' or 'cache-misses'";
 #endif
     static struct clocks_options_t opts = {
         .types   = 0,
@@ -424,11 +1160,62 @@ struct clocks_t clocks_rdtsc_overhead(
     return r;
 }
 
+#endif // CLOCK_CYCLES
+
+#ifdef CLOCK_PERF
+
+enum { clocks_n_perf_overhead = SZ(100000) };
+
+// stev: the overhead of reading the performance counter
+// 'clock_type' is the minimum of the differences of two
+// consecutive readings of it; note that it may well be
+// that the counter is not available on the host, case
+// in which the returned clocks have no types at all
+
+struct clocks_t clocks_perf_overhead(
+    size_t clock_type)
+{
+    const struct clocks_def_t* p =
+        clocks_defs + clock_type;
+    clock_counter_t s[clock_perf_n_counters];
+    clock_counter_t e[clock_perf_n_counters];
+    size_t n = clocks_n_perf_overhead, k;
+    struct clocks_t r;
+    clocks_time_t* c;
+
+    ASSERT(clock_type >= clock_type_instructions);
+    k = clock_type - clock_type_instructions;
+    ASSERT(k < clock_perf_n_counters);
+
+    clocks_init(&r, clocks_perf_init(
+        CLOCK_BIT(clock_type)));
+    if (r.types == 0)
+        return r;
+
+    c = CLOCKS_TIME_(&r, p, );
+    *c = CLOCK_COUNTER_MAX;
+
+    while (n --) {
+        CLOCK_GET_PERF_COUNTERS(s);
+        CLOCK_GET_PERF_COUNTERS(e);
+
+        CLOCKS_TIME_SUB(e[k], s[k]);
+        if (*c > e[k])
+            *c = e[k];
+    }
+
+    clocks_perf_done();
+
+    return r;
+}
+
+#endif // CLOCK_PERF
+
+#ifdef CLOCK_CYCLES
 #undef  CLOCK_TYPES_HAS
 #define CLOCK_TYPES_HAS(t) \
     CLOCK_TYPES_HAS_(clock_types, t)
-
-#endif // CLOCK_CYCLES
+#endif
 
 void clocks_print_line(
     const struct clocks_t* clocks,
@@ -495,24 +1282,39 @@ int main(int argc, char* argv[])
         const char* name;
         struct clocks_t (*func)(size_t);
     };
+#undef  CASE2
+#define CASE2(n, t) \
+    { .name = n, .func = clocks_ ## t ## _overhead }
 #undef  CASE
-#define CASE(n, t) \
-    { .name = #n, .func = clocks_ ## t ## _overhead }
+#define CASE(n, t) CASE2(#n, t)
     static const struct clock_def_t clocks[] = {
         CASE(real, gettime),
         CASE(process, gettime),
         CASE(thread, gettime),
 #ifdef CLOCK_CYCLES
         CASE(cycles, rdtsc),
+#endif
+#ifdef CLOCK_PERF
+        CASE(instructions, perf),
+        CASE2("branch-misses", perf),
+        CASE2("icache-misses", perf),
+        CASE2("cache-misses", perf),
 #endif
     };
+#ifndef CLOCK_PERF
+    enum { w = 8 };
+#else
+    enum { w = 14 };
+#endif
     const struct clocks_options_t* opts =
         clocks_options(argc, argv);
     const struct clock_def_t *p, *e;
     struct clocks_t t;
-    size_t i = 0, l;
+    size_t i = 0, l, n;
     bool c;
 
+    clocks_init(&t, 0);
+
     for (p = clocks,
          e = p + ARRAY_SIZE(clocks);
          p < e;
@@ -522,17 +1324,25 @@ int main(int argc, char* argv[])
             t = p->func(i);
 
         l = strlen(p->name) + 1;
-        ASSERT(l <= 8);
-        l = 8 - l;
+        ASSERT(l <= w);
+        l = w - l;
+
+#ifdef CLOCK_PERF
+        n = i > clock_type_cycles
+            ? clocks_n_perf_overhead
+            : clocks_n_overhead;
+#else
+        n = clocks_n_overhead;
+#endif
 
-        fprintf(stdout, "%s:%-*s %8d",
+        fprintf(stdout, "%s:%-*s %8zu",
             p->name, SIZE_AS_INT(l), "",
-            c ? clocks_n_overhead : 0);
+            c ? n : 0);
 
         clocks_print_line(&t,
 #ifdef CLOCK_CYCLES
-            i == clock_type_cycles
-            ? ~clock_types_all
+            i >= clock_type_cycles
+            ? t.types
             : clock_types_all, 
 #endif
             !c, !opts->verbose, stdout);
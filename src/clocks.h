@@ -36,6 +36,16 @@ typedef uint64_t clock_cycles_t;
 #define CLOCK_CYCLES_MAX UINT64_MAX
 #endif
 
+#ifdef CLOCK_PERF
+#ifndef CLOCK_CYCLES
+#error CLOCK_PERF is not defined along with CLOCK_CYCLES
+#endif
+
+typedef uint64_t clock_counter_t;
+
+#define CLOCK_COUNTER_MAX UINT64_MAX
+#endif
+
 enum {
     clock_type_real,
     clock_type_process,
@@ -43,6 +53,13 @@ enum {
 #ifdef CLOCK_CYCLES
     clock_type_cycles,
 #endif
+#ifdef CLOCK_PERF
+    clock_type_instructions,
+    clock_type_branch_misses,
+    clock_type_icache_misses,
+    clock_type_cache_misses,
+#endif
+    clock_n_types
 };
 
 #define CLOCK_BIT(c) \
@@ -67,6 +84,25 @@ enum {
     CLOCK_TYPES(real, process, thread)
 };
 
+#ifdef CLOCK_PERF
+// stev: neither are the hardware performance
+// counters measuring time; these are obtained
+// by 'perf_event_open(2)' and are read all at
+// once, as a group, by one 'read(2)' call
+enum {
+    clock_types_perf =
+    CLOCK_TYPES(
+        instructions,
+        branch_misses,
+        icache_misses,
+        cache_misses)
+};
+
+enum {
+    clock_perf_n_counters = 4
+};
+#endif
+
 struct clocks_t
 {
     clock_types_t types;
@@ -77,12 +113,95 @@ struct clocks_t
 #ifdef CLOCK_CYCLES
     clock_cycles_t cycles;
 #endif
+#ifdef CLOCK_PERF
+    clock_counter_t instructions;
+    clock_counter_t branch_misses;
+    clock_counter_t icache_misses;
+    clock_counter_t cache_misses;
+#endif
+};
+
+// stev: the sampling timing mode is timing only
+// one call out of each 'period' calls -- either
+// every 'period'-th call, or, when 'random' is
+// true, calls separated by pseudo-random gaps of
+// mean 'period'; the timings of the calls sampled
+// are summed up into 'clocks' and their squares
+// into 'squares', such that the function below,
+// 'clocks_sampler_errors', is able to estimate the
+// standard errors of the extrapolated totals; note
+// that 'clocks_sampler' is to be shared between
+// the main program and its parser modules, just as
+// 'clocks' is -- both being local to each thread
+
+struct clocks_sampler_t
+{
+    size_t   period;
+    size_t   countdown;
+    uint64_t state;
+    bool     random;
+    size_t   n_calls;
+    size_t   n_samples;
+    double   squares[clock_n_types];
+};
+
+#ifdef CLOCK_CYCLES
+// stev: 'clocks_hist_t' is a log-linear histogram
+// of per-call CPU cycles, in the manner of Gil Tene's
+// HdrHistogram: the values less than 'n_subs' have
+// buckets of their own; each of the ranges [2^k,
+// 2^(k+1)), k >= 'sub_bits', is split in 'n_subs/2'
+// buckets of equal width, such that the relative
+// error of a value due to bucketing is less than
+// '2/n_subs'; a histogram is made of 'n_rows' rows
+// of buckets, each row counting separately; note
+// that 'clocks_hist' is to be shared between the
+// main program and its parser modules, just as
+// 'clocks' is
+
+enum {
+    clocks_hist_sub_bits = 5,
+    clocks_hist_n_subs = 1 << clocks_hist_sub_bits,
+    clocks_hist_n_buckets = clocks_hist_n_subs +
+        (64 - clocks_hist_sub_bits) *
+        (clocks_hist_n_subs / 2)
+};
+
+struct clocks_hist_t
+{
+    size_t          n_rows;
+    uint64_t*       counts;
+    clock_cycles_t* maxes;
+};
+#endif
+
+// stev: 'clocks_calib_t' holds the results of the
+// in-process calibration of the timing overheads:
+// the medians of many back-to-back readings of the
+// clocks and the median absolute deviations of the
+// same readings; all clocks of 'median.types' are
+// read, but only those of 'types' are calibrated
+
+struct clocks_calib_t
+{
+    clock_types_t   types;
+    struct clocks_t median;
+    struct clocks_t spread;
 };
 
 void clocks_init(
     struct clocks_t* clocks,
     clock_types_t types);
 
+void clocks_sampler_init(
+    struct clocks_sampler_t* sampler,
+    size_t period, bool random);
+
+void clocks_add_sample(
+    struct clocks_t* clocks,
+    struct clocks_sampler_t* sampler,
+    const struct clocks_t* clocks2);
+
 void clocks_add(
     struct clocks_t* clocks,
     const struct clocks_t* clocks2);
@@ -94,10 +213,27 @@ void clocks_sub(
 void clocks_adjust(
     struct clocks_t* clocks,
     const struct clocks_t* overhead,
+    clock_types_t calibrated,
     size_t count);
 
+void clocks_sampler_errors(
+    const struct clocks_sampler_t* sampler,
+    const struct clocks_t* clocks,
+    double* errors);
+
+void clocks_sampler_scale(
+    const struct clocks_sampler_t* sampler,
+    struct clocks_t* clocks);
+
+void clocks_merge(
+    struct clocks_t* clocks,
+    double* errors,
+    const struct clocks_t* clocks2,
+    const double* errors2);
+
 void clocks_print(
     const struct clocks_t* clocks,
+    const double* errors,
     const char* name, size_t width,
     FILE* file);
 
@@ -105,6 +241,51 @@ void clocks_print_names(
     clock_types_t clocks,
     FILE* file);
 
+void clocks_calibrate(
+    struct clocks_calib_t* calib,
+    clock_types_t types,
+    clock_types_t calibrate);
+
+void clocks_calib_apply(
+    const struct clocks_calib_t* calib,
+    struct clocks_t* overhead);
+
+void clocks_calib_check(
+    const struct clocks_calib_t* calib,
+    const struct clocks_calib_t* calib2);
+
+void clocks_calib_print(
+    const struct clocks_calib_t* calib,
+    const struct clocks_calib_t* calib2,
+    const char* name, size_t width,
+    FILE* file);
+
+#ifdef CLOCK_CYCLES
+void clocks_hist_init(
+    struct clocks_hist_t* hist,
+    size_t n_rows);
+
+void clocks_hist_done(
+    struct clocks_hist_t* hist);
+
+void clocks_hist_merge(
+    struct clocks_hist_t* hist,
+    const struct clocks_hist_t* hist2);
+
+bool clocks_hist_print(
+    const struct clocks_hist_t* hist,
+    size_t row, const char* name,
+    clock_cycles_t overhead,
+    FILE* file);
+#endif
+
+#ifdef CLOCK_PERF
+clock_types_t clocks_perf_init(
+    clock_types_t types);
+
+void clocks_perf_done(void);
+#endif
+
 #endif // __CLOCKS_H
 
 
@@ -0,0 +1,74 @@
+// Copyright (C) 2019  Stefan Vargyas
+// 
+// This file is part of Html-Cref.
+// 
+// Html-Cref is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// 
+// Html-Cref is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+// 
+// You should have received a copy of the GNU General Public License
+// along with Html-Cref.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "config.h"
+
+#define _GNU_SOURCE
+#include <stddef.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <stdio.h>
+
+#include "common.h"
+#include "cpu-info.h"
+
+// stev: obtain the model name of the host's CPU from
+// '/proc/cpuinfo' -- the value of the first line that
+// has the key 'model name'; returns false if there is
+// no such line or when the file cannot be read
+
+bool cpu_info_model_name(char* buf, size_t len)
+{
+    static const char key[] = "model name";
+    char* b = NULL;
+    size_t n = 0;
+    ssize_t r;
+    bool f = false;
+    FILE* s;
+
+    ASSERT(buf != NULL);
+    ASSERT(len > 0);
+
+    if (!(s = fopen("/proc/cpuinfo", "r")))
+        return false;
+
+    while ((r = getline(&b, &n, s)) > 0) {
+        char *p, *e;
+
+        if (strncmp(b, key, sizeof(key) - 1) ||
+            !(p = strchr(b, ':')))
+            continue;
+
+        for (p ++; *p == ' ' || *p == '\t'; p ++);
+        for (e = p + strlen(p); e > p && (e[-1] == '\n' ||
+             e[-1] == ' ' || e[-1] == '\t'); e --);
+        if (e == p)
+            continue;
+
+        *e = 0;
+        snprintf(buf, len, "%s", p);
+        f = true;
+        break;
+    }
+
+    free(b);
+    fclose(s);
+
+    return f;
+}
+
@@ -0,0 +1,27 @@
+// Copyright (C) 2019  Stefan Vargyas
+// 
+// This file is part of Html-Cref.
+// 
+// Html-Cref is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// 
+// Html-Cref is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+// 
+// You should have received a copy of the GNU General Public License
+// along with Html-Cref.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef __CPU_INFO_H
+#define __CPU_INFO_H
+
+#include <stddef.h>
+#include <stdbool.h>
+
+bool cpu_info_model_name(char* buf, size_t len);
+
+#endif /* __CPU_INFO_H */
+
@@ -0,0 +1,365 @@
+#!/bin/awk -f
+
+
+# Copyright (C) 2019  Stefan Vargyas
+# 
+# This file is part of Html-Cref.
+# 
+# Html-Cref is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+# 
+# Html-Cref is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+# 
+# You should have received a copy of the GNU General Public License
+# along with Html-Cref.  If not, see <http://www.gnu.org/licenses/>.
+
+# stev: input lines are HTML char reference names; the
+# variable 'freqs' names a file of which lines are of form
+# 'NAME COUNT' (lines starting with '#' are comments), the
+# frequency histogram of the char references of a corpus;
+# the variable 'legacies' names a file of which lines are the
+# names that are allowed to not be terminated by semicolon;
+# the output is a text corpus made of 'refs' char references
+# interspersed with plain text, such that:
+# * the named char references are distributed by Zipf's law
+#   of exponent 'zipf / 100' over the names ranked by their
+#   counts in 'freqs' -- the names not found in 'freqs' are
+#   ranked after those found, in pseudo-random order; zero
+#   'zipf' means a uniform distribution;
+# * 'density' is the number of char references per 1000
+#   chars of output;
+# * 'numeric' is the percentage of numeric char references,
+#   of which 'hex' percents are hexadecimal;
+# * 'invalid' is the percentage of named char references
+#   with names that are not valid;
+# * 'legacy' is the percentage of legacy named references --
+#   i.e. of which names are found in the file 'legacies' --
+#   that are not terminated by semicolon;
+# * 'urls' is the percentage of char references replaced by
+#   links of which URLs contain bare ampersands;
+# * 'seed' is the seed of the pseudo-random generator;
+# when 'adversary' is not empty, the output is instead made
+# of 'refs' pathological inputs of the named kind, separated
+# by single spaces:
+# * 'alnum': '&' followed by long runs of alphanumeric chars;
+# * 'near-miss': '&' followed by the longest names that are
+#   prefixes of valid names without being valid themselves;
+# * 'digits': '&#' and '&#x' followed by long runs of decimal,
+#   respectively hexadecimal digits.
+
+function error(s)
+{
+    printf("error:%d: %s\n", FNR, s) > "/dev/stderr"
+    failed = 1
+    exit 1
+}
+
+function assert(v, m)
+{
+    if (!v) error(sprintf("assertion failed: %s", m))
+}
+
+function check_param(n, v, m)
+{
+    if (v !~ /^[0-9]+$/ || v + 0 > m)
+        error(sprintf("invalid parameter %s='%s'", n, v))
+}
+
+function rand_int(n)
+{ return int(rand() * n) }
+
+function rand_elem(A, n)
+{ return A[1 + rand_int(n)] }
+
+function load_freqs(	l, a, n)
+{
+    while ((getline l < freqs) > 0) {
+        if (l ~ /^#/ || l ~ /^[ \t]*$/)
+            continue
+        n = split(l, a)
+        assert(n == 2, "n == 2")
+        F[a[1]] = a[2] + 0
+    }
+    close(freqs)
+}
+
+function load_legacy(	l)
+{
+    while ((getline l < legacies) > 0)
+        L[l] = 1
+    close(legacies)
+}
+
+# stev: the names found in 'freqs' are ranked first,
+# by their count (descending); the remaining names
+# follow them, in the order of a Fisher-Yates shuffle
+
+function rank_names(	i, j, k, m, t)
+{
+    for (i = 1; i <= n_names; i ++) {
+        if (!(N[i] in F))
+            continue
+        k = N[i]
+        for (j = ++ m - 1; j > 0 && F[k] > F[R[j]]; j --)
+            R[j + 1] = R[j]
+        R[j + 1] = k
+    }
+    t = m
+    for (i = 1; i <= n_names; i ++)
+        if (!(N[i] in F))
+            R[++ t] = N[i]
+    assert(t == n_names, "t == n_names")
+    for (i = n_names; i > m + 1; i --) {
+        j = m + 1 + rand_int(i - m)
+        k = R[i]
+        R[i] = R[j]
+        R[j] = k
+    }
+}
+
+function zipf_init(	i, s)
+{
+    s = 0
+    for (i = 1; i <= n_names; i ++) {
+        s += zipf ? 1 / i ^ (zipf / 100) : 1
+        Z[i] = s
+    }
+}
+
+# stev: binary search for the first rank of which
+# cumulative weight is above a uniform variate
+
+function zipf_name(	u, l, h, m)
+{
+    u = rand() * Z[n_names]
+    l = 1
+    h = n_names
+    while (l < h) {
+        m = int((l + h) / 2)
+        if (Z[m] <= u)
+            l = m + 1
+        else
+            h = m
+    }
+    return R[l]
+}
+
+function out(s)
+{
+    printf("%s", s)
+    col += length(s)
+}
+
+function text(n,	w)
+{
+    while (n > 0) {
+        w = rand_elem(W, n_words)
+        if (col + length(w) >= 78) {
+            printf("\n")
+            col = 0
+        }
+        else
+            out(" ")
+        out(w)
+        n -= length(w) + 1
+    }
+    if (col > 0)
+        out(" ")
+}
+
+function numeric_ref(	r, c)
+{
+    r = rand()
+    if (r < 0.5)
+        c = 32 + rand_int(224)
+    else
+    if (r < 0.9)
+        c = 256 + rand_int(11776)
+    else
+        c = 127744 + rand_int(848)
+    if (rand() * 100 < hex)
+        return sprintf("&#x%X;", c)
+    else
+        return sprintf("&#%d;", c)
+}
+
+function invalid_ref(	n)
+{
+    do {
+        n = rand_elem(N, n_names) \
+            substr("abcdefghijklmnopqrstuvwxyz", 1 + rand_int(26), 1)
+    } while (n in V)
+    return "&" n ";"
+}
+
+function named_ref(	n)
+{
+    n = zipf_name()
+    if ((n in L) && rand() * 100 < legacy)
+        return "&" n " "
+    return "&" n ";"
+}
+
+function rand_chars(c, n,	s, k)
+{
+    k = length(c)
+    s = ""
+    while (n -- > 0)
+        s = s substr(c, 1 + rand_int(k), 1)
+    return s
+}
+
+# stev: the length of the runs of chars of the 'alnum'
+# and 'digits' adversaries is uniformly distributed in
+# the range [run_min, run_max]
+
+function run_len()
+{ return run_min + rand_int(run_max - run_min + 1) }
+
+function alnum_adv()
+{ return "&" rand_chars(A, run_len()) }
+
+function digits_adv()
+{
+    if (rand() < 0.5)
+        return "&#" rand_chars("0123456789", run_len()) ";"
+    else
+        return "&#x" rand_chars("0123456789abcdefABCDEF", run_len()) ";"
+}
+
+# stev: the near-miss prefixes are collected from the
+# names of at least 'near_min' chars, by removing their
+# last chars until obtaining a name that is not valid
+
+function near_miss_init(	i, n)
+{
+    for (i = 1; i <= n_names; i ++) {
+        if (length(N[i]) < near_min)
+            continue
+        n = N[i]
+        do {
+            n = substr(n, 1, length(n) - 1)
+        } while (n in V)
+        if (length(n) && !(n in M))
+            M[n] = M[++ n_nears] = n
+    }
+    assert(n_nears > 0, "n_nears > 0")
+}
+
+function near_miss_adv()
+{ return "&" rand_elem(M, n_nears) }
+
+function url_ref(	s, i, k)
+{
+    s = "<a href=\"http://www.example.org/" rand_elem(W, n_words) "?"
+    k = 2 + rand_int(3)
+    for (i = 1; i <= k; i ++)
+        s = s (i > 1 ? "&" : "") rand_elem(P, n_params) "=" rand_int(1000)
+    return s "\">"
+}
+
+BEGIN {
+    check_param("seed", seed, 2147483647)
+    check_param("refs", refs, 100000000)
+    check_param("zipf", zipf, 1000)
+    check_param("density", density, 1000)
+    check_param("numeric", numeric, 100)
+    check_param("hex", hex, 100)
+    check_param("invalid", invalid, 100)
+    check_param("legacy", legacy, 100)
+    check_param("urls", urls, 100)
+    if (adversary != "" &&
+        adversary != "alnum" &&
+        adversary != "near-miss" &&
+        adversary != "digits")
+        error(sprintf("invalid parameter adversary='%s'", adversary))
+    assert(density > 0, "density > 0")
+    assert(numeric + invalid + urls <= 100,
+        "numeric + invalid + urls <= 100")
+
+    n_words = split("the of and to in is that for it with as was on be by " \
+                    "this are from at or an have which but not all were " \
+                    "when we there can more if will one about up out so " \
+                    "page data text price search home contact news", W)
+    n_params = split("id page lang sort q ref view from to type mode " \
+                     "size start end", P)
+
+    A = "0123456789" \
+        "ABCDEFGHIJKLMNOPQRSTUVWXYZ" \
+        "abcdefghijklmnopqrstuvwxyz"
+    run_min = 32
+    run_max = 512
+    near_min = 8
+
+    srand(seed)
+}
+
+{
+    assert(NF == 1, "NF == 1")
+    N[++ n_names] = $1
+    V[$1] = 1
+}
+
+END {
+    if (failed)
+        exit 1
+
+    assert(n_names > 0, "n_names > 0")
+
+    if (adversary != "") {
+        if (adversary == "near-miss")
+            near_miss_init()
+        for (i = 1; i <= refs; i ++) {
+            if (adversary == "alnum")
+                s = alnum_adv()
+            else
+            if (adversary == "digits")
+                s = digits_adv()
+            else
+                s = near_miss_adv()
+            if (col > 0 && col + length(s) >= 78) {
+                printf("\n")
+                col = 0
+            }
+            else
+            if (col > 0)
+                out(" ")
+            out(s)
+        }
+        printf("\n")
+        exit 0
+    }
+
+    load_freqs()
+    load_legacy()
+    rank_names()
+    zipf_init()
+
+    # stev: the mean length of a char reference
+    # is about eight chars, semicolon included
+    gap = 1000 / density - 8
+
+    for (i = 1; i <= refs; i ++) {
+        if (gap > 0)
+            text(rand_int(2 * gap + 1))
+
+        r = rand() * 100
+        if (r < numeric)
+            out(numeric_ref())
+        else
+        if (r < numeric + urls)
+            out(url_ref())
+        else
+        if (r < numeric + urls + invalid)
+            out(invalid_ref())
+        else
+            out(named_ref())
+    }
+    printf("\n")
+}
+
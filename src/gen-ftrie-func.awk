@@ -0,0 +1,230 @@
+#!/bin/awk -f
+
+
+# Copyright (C) 2019  Stefan Vargyas
+# 
+# This file is part of Html-Cref.
+# 
+# Html-Cref is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+# 
+# Html-Cref is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+# 
+# You should have received a copy of the GNU General Public License
+# along with Html-Cref.  If not, see <http://www.gnu.org/licenses/>.
+
+# stev: input lines are of form 'NAME OFFSET', where OFFSET
+# is the offset of NAME's entry in 'html_cref_table'; the
+# variable 'freqs' names a file of which lines are of form
+# 'NAME COUNT' (lines starting with '#' are comments), the
+# frequency histogram of the char references of a corpus;
+# the output is a trie parse function, of which 'switch'
+# statements have their 'case' labels ordered by the total
+# count of the names below each edge; the hottest edge of
+# a node gets a '__builtin_expect' hint when its count is
+# at least half of the node's total; the edges that have
+# zero count are moved out into 'cold' functions, such that
+# the hot paths of the trie stay compact in the function
+# 'html_cref_ftrie_parse' (placed in the '.text.hot' section)
+
+function error(s)
+{
+    printf("error:%d: %s\n", FNR, s) > "/dev/stderr"
+    exit 1
+}
+
+function assert(v, m)
+{
+    if (!v) error(sprintf("assertion failed: %s", m))
+}
+
+function indent(d)
+{ return sprintf("%*s", 4 * d, "") }
+
+function out(s)
+{ O[++ n_out] = s }
+
+function out_cold(s)
+{ C[++ n_cold] = s }
+
+function emit(c, s)
+{
+    if (c)
+        out_cold(s)
+    else
+        out(s)
+}
+
+function char_lit(c)
+{ return c == "\x27" || c == "\\" ? "'\\" c "'" : "'" c "'" }
+
+# stev: the children of node 'k' compare by their weight
+# (descending), then by their char (ascending)
+
+function less(k, a, b)
+{
+    if (W[k a] != W[k b])
+        return W[k a] > W[k b]
+    return a < b
+}
+
+function children(k, A,	s, i, j, l, c)
+{
+    s = K[k]
+    l = length(s)
+    for (i = 1; i <= l; i ++) {
+        c = substr(s, i, 1)
+        for (j = i - 1; j > 0 && less(k, c, A[j]); j --)
+            A[j + 1] = A[j]
+        A[j + 1] = c
+    }
+    return l
+}
+
+function cold_func_name(k)
+{ return "html_cref_ftrie_cold_" (++ n_funcs) }
+
+# stev: generate the code of node 'k' at indent level
+# 'd'; 'c' tells whether the code goes into a cold
+# function; upon entry, 'p' points to the char that
+# follows the prefix 'k' of the input text and 'r'
+# is the offset of the longest name matched so far
+
+function gen_node(k, d, c,	A, l, i, h, t, e, f, s)
+{
+    t = indent(d)
+
+    l = children(k, A)
+    if (l == 0) {
+        assert(k in V, "k in V")
+        emit(c, t "return " V[k] ";")
+        return
+    }
+    if (k in V)
+        emit(c, t "r = " V[k] ";")
+
+    # stev: the number of hot children of 'k'
+    for (h = 0; !c && h < l && W[k A[h + 1]] > 0; h ++)
+        ;
+
+    if (!c && h == 0) {
+        # stev: all the subtrie of 'k' is cold
+        f = cold_func_name(k)
+        gen_cold_func(f, k)
+        emit(c, t "return " f "(p, r);")
+        return
+    }
+
+    e = !c && W[k A[1]] * 2 >= W[k]
+
+    # stev: a chain of single-child nodes that are not
+    # ends of names collapses into one 'if' statement
+    if (l == 1 && (c || h == 1)) {
+        s = "*p ++ == " char_lit(A[1])
+        for (k = k A[1]; !(k in V) && length(K[k]) == 1; k = k K[k])
+            s = s " &&\n" t "    *p ++ == " char_lit(K[k])
+        if (e)
+            s = "__builtin_expect(" s ", 1)"
+        emit(c, t "if (" s ") {")
+        gen_node(k, d + 1, c)
+        emit(c, t "}")
+        emit(c, t "return r;")
+        return
+    }
+
+    s = "*p ++"
+    if (e)
+        s = "__builtin_expect(" s ", " char_lit(A[1]) ")"
+    emit(c, t "switch (" s ") {")
+    for (i = 1; i <= (c ? l : h); i ++) {
+        emit(c, t "case " char_lit(A[i]) ":")
+        gen_node(k A[i], d + 1, c)
+    }
+    if (!c && h < l) {
+        f = cold_func_name(k)
+        gen_cold_func(f, k, h)
+        emit(c, t "default:")
+        emit(c, t "    return " f "(p - 1, r);")
+    }
+    emit(c, t "}")
+    emit(c, t "return r;")
+}
+
+# stev: generate the cold function 'f' that handles
+# the children of node 'k' starting with the child
+# of rank 'h + 1' (the first 'h' ones being hot)
+
+function gen_cold_func(f, k, h,	A, l, i, t)
+{
+    t = indent(1)
+
+    out_cold("static int " f "(const char* p, int r)")
+    out_cold("    __attribute__ ((cold, noinline));")
+    out_cold("")
+    out_cold("static int " f "(const char* p, int r)")
+    out_cold("{")
+    l = children(k, A)
+    out_cold(t "switch (*p ++) {")
+    for (i = h + 1; i <= l; i ++) {
+        out_cold(t "case " char_lit(A[i]) ":")
+        gen_node(k A[i], 2, 1)
+    }
+    out_cold(t "}")
+    out_cold(t "return r;")
+    out_cold("}")
+    out_cold("")
+}
+
+BEGIN {
+    assert(length(freqs) > 0, "length(freqs) > 0")
+
+    while ((r = (getline l < freqs)) > 0) {
+        if (l ~ /^#/ || l ~ /^[ \t]*$/)
+            continue
+        m = split(l, a)
+        assert(m == 2, sprintf("invalid freqs line: '%s'", l))
+        assert(a[2] ~ /^[0-9]+$/, sprintf("invalid count: '%s'", a[2]))
+        F[a[1]] = a[2] + 0
+    }
+    assert(r == 0, sprintf("failed reading '%s'", freqs))
+    close(freqs)
+}
+
+{
+    assert(NF == 2, "NF == 2")
+    assert($1 ~ /^[0-9A-Za-z]+$/, sprintf("invalid name: '%s'", $1))
+
+    v = $1 in F ? F[$1] : 0
+    V[$1] = $2
+    for (i = 0; i < length($1); i ++) {
+        k = substr($1, 1, i)
+        c = substr($1, i + 1, 1)
+        if (!((k c) in P)) {
+            P[k c] = 1
+            K[k] = K[k] c
+        }
+        W[k] += v
+    }
+    W[$1] += v
+}
+
+END {
+    out("HTML_CREF_FTRIE_HOT")
+    out("int html_cref_ftrie_parse(const char* p)")
+    out("{")
+    out("    int r = -1;")
+    out("")
+    gen_node("", 1, 0)
+    out("}")
+
+    for (i = 1; i <= n_cold; i ++)
+        print C[i]
+    for (i = 1; i <= n_out; i ++)
+        print O[i]
+}
+
@@ -0,0 +1,158 @@
+#!/bin/awk -f
+
+
+# Copyright (C) 2019  Stefan Vargyas
+# 
+# This file is part of Html-Cref.
+# 
+# Html-Cref is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+# 
+# Html-Cref is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+# 
+# You should have received a copy of the GNU General Public License
+# along with Html-Cref.  If not, see <http://www.gnu.org/licenses/>.
+
+# stev: input lines are of form 'NAME OFFSET', where OFFSET
+# is the offset of NAME's entry in 'html_cref_table'; the
+# output is the bucket and candidate tables that are used
+# by 'html-cref-vcmp.c'; the candidates are grouped by the
+# first two chars of their names and, within each bucket,
+# are sorted by length in decreasing order, such that the
+# first match found is the longest one
+
+function error(s)
+{
+    printf("error:%d: %s\n", FNR, s) > "/dev/stderr"
+    exit 1
+}
+
+function assert(v, m)
+{
+    if (!v) error(sprintf("assertion failed: %s", m))
+}
+
+function char_index(c,	i)
+{
+    i = index(C, c)
+    assert(i > 0, sprintf("invalid char '%s'", c))
+    return i - 1
+}
+
+function bucket_index(n)
+{
+    return char_index(substr(n, 1, 1)) * length(C) + \
+           char_index(substr(n, 2, 1))
+}
+
+# stev: candidates compare by bucket index (ascending),
+# then by name length (descending), then by name itself
+
+function less(i, j)
+{
+    if (B[i] != B[j])
+        return B[i] < B[j]
+    if (length(N[i]) != length(N[j]))
+        return length(N[i]) > length(N[j])
+    return N[i] < N[j]
+}
+
+function sort(	i, j, k)
+{
+    for (i = 1; i <= n; i ++)
+        P[i] = i
+    for (i = 2; i <= n; i ++) {
+        k = P[i]
+        for (j = i - 1; j > 0 && less(k, P[j]); j --)
+            P[j + 1] = P[j]
+        P[j + 1] = k
+    }
+}
+
+BEGIN {
+    C = "0123456789" \
+        "ABCDEFGHIJKLMNOPQRSTUVWXYZ" \
+        "abcdefghijklmnopqrstuvwxyz"
+    M = 31
+}
+
+{
+    assert(NF == 2, "NF == 2")
+    assert(length($1) >= 2 && length($1) <= M, \
+        sprintf("invalid name length: '%s'", $1))
+
+    N[++ n] = $1
+    O[n] = $2
+    B[n] = bucket_index($1)
+}
+
+function print_buckets(	i, k, b, s)
+{
+    printf("static const struct html_cref_vcmp_bucket_t\n")
+    printf("html_cref_vcmp_buckets[\n")
+    printf("    html_cref_vcmp_n_chars *\n")
+    printf("    html_cref_vcmp_n_chars] = {\n")
+    for (i = 1; i <= n; i = k) {
+        b = B[P[i]]
+        for (k = i + 1; k <= n && B[P[k]] == b; k ++)
+            ;
+        s = substr(N[P[i]], 1, 2)
+        printf("    [%4d] = { %4d, %2d }, // %s\n", \
+            b, i - 1, k - i, s)
+    }
+    printf("};\n\n")
+}
+
+function print_names(	i, k)
+{
+    printf("static const html_cref_vcmp_name_t\n")
+    printf("html_cref_vcmp_names[] = {\n")
+    for (i = 1; i <= n; i ++) {
+        k = P[i]
+        printf("    \"%s\",\n", N[k])
+    }
+    printf("};\n\n")
+}
+
+function print_cands(	i, k)
+{
+    printf("static const struct html_cref_vcmp_cand_t\n")
+    printf("html_cref_vcmp_cands[] = {\n")
+    for (i = 1; i <= n; i ++) {
+        k = P[i]
+        printf("    { %2d, %5d }, // %s\n", \
+            length(N[k]), O[k], N[k])
+    }
+    printf("};\n")
+}
+
+# stev: the char map stores the index of each char
+# plus one, such that zero stands for invalid chars
+
+function print_chars(	i, c)
+{
+    printf("static const uchar_t\n")
+    printf("html_cref_vcmp_chars[256] = {\n")
+    for (i = 1; i <= length(C); i ++) {
+        c = substr(C, i, 1)
+        printf("    [\x27%s\x27] = %2d,\n", c, i)
+    }
+    printf("};\n\n")
+}
+
+END {
+    sort()
+
+    printf("enum { html_cref_vcmp_n_chars = %d };\n\n", length(C))
+
+    print_chars()
+    print_buckets()
+    print_names()
+    print_cands()
+}
+
@@ -0,0 +1,2549 @@
+// Copyright (C) 2019  Stefan Vargyas
+// 
+// This file is part of Html-Cref.
+// 
+// Html-Cref is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// 
+// Html-Cref is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+// 
+// You should have received a copy of the GNU General Public License
+// along with Html-Cref.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "config.h"
+
+#define _GNU_SOURCE
+#include <getopt.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdio.h>
+#include <errno.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#include <time.h>
+#include <math.h>
+#include <dlfcn.h>
+#include <link.h>
+
+#include "common.h"
+#include "ptr-traits.h"
+#include "char-traits.h"
+#include "pretty-print.h"
+#include "file-buf.h"
+#include "su-size.h"
+#include "dyn-lib.h"
+
+#include "html-cref.h"
+#include "html-cref-refs.h"
+#include "html-cref-table.h"
+#include "html-cref-simd.h"
+#include "html-cref-escape.h"
+#include "html-cref-unicode.h"
+#include "cpu-info.h"
+
+#define ISASCII CHAR_IS_ASCII
+#define ISALNUM CHAR_IS_ALNUM
+#define ISDIGIT CHAR_IS_DIGIT
+
+#ifndef CREF_PARSERS
+#error CREF_PARSERS is not defined
+#endif
+
+#if defined(__x86_64__) || defined(__i386__)
+#define BENCH_CYCLES
+#endif
+
+// stev: the footprint of the parser modules is
+// obtained by single-stepping the parse functions
+// by 'ptrace(2)'; the instruction pointer is taken
+// from the registers of the traced process, thus
+// is architecture dependent
+
+#if defined(__x86_64__) || defined(__i386__)
+#define BENCH_FOOTPRINT
+
+#include <sys/ptrace.h>
+#include <sys/wait.h>
+#include <sys/user.h>
+#include <signal.h>
+
+#ifdef __x86_64__
+#define BENCH_IP(r) ((r).rip)
+#else
+#define BENCH_IP(r) ((r).eip)
+#endif
+#endif
+
+#ifndef BENCH_COMMIT
+#define BENCH_COMMIT ""
+#endif
+
+#ifndef BENCH_BUILD
+#define BENCH_BUILD ""
+#endif
+
+const char program[] = STRINGIFY(PROGRAM);
+const char verdate[] = "0.1 -- 2019-05-05 10:58"; // $ date +'%F %R'
+
+const char license[] =
+"Copyright (C) 2019  Stefan Vargyas.\n"
+"License GPLv3+: GNU GPL version 3 or later <http://gnu.org/licenses/gpl.html>.\n"
+"This is free software: you are free to change and redistribute it.\n"
+"There is NO WARRANTY, to the extent permitted by law.\n";
+
+const char help[] = 
+"usage: %s [OPTION]... [FILE]\n"
+"       %s -u|--unicode[=NUM] [OPTION]...\n"
+"       %s -R|--roofline[=LIST] [OPTION]...\n"
+"       %s -X|--escape [OPTION]... FILE\n"
+"       %s -C|--compare [OPTION]... OLD NEW\n"
+"time the parse functions of the HTML char reference parser\n"
+"modules on the named char references found in FILE -- all\n"
+"modules being loaded into one and the same process -- and\n"
+"print out one table line for each module; the options are:\n"
+"  -f|--input-file=FILE        take input from the named file; the\n"
+"                                input file is mandatory\n"
+"  -p|--cref-parsers=LIST      time only the parser modules of which\n"
+"                                names are in the given comma-separated\n"
+"                                list (the default is all modules built\n"
+"                                along with the program)\n"
+"  -n|--iterations=NUM         the number of timed passes over all the\n"
+"                                char references in the input file made\n"
+"                                by each parser module (default: 31)\n"
+"  -w|--warm-up=NUM            the number of untimed passes made before\n"
+"                                the timed ones (default: 3)\n"
+"  -s|--sponge-max=NUM[KM]     the maximum size of the input buffer (by\n"
+"                                default is 5M; not allowed to be more\n"
+"                                than 10M)\n"
+"  -t|--throughput             time the decoding of the whole input\n"
+"                                text -- the numeric char references\n"
+"                                and the plain text included -- instead\n"
+"                                of the parse function alone; the units\n"
+"                                of the output table become bytes\n"
+"  -b|--baseline=FILE          in throughput mode, time the decoding of\n"
+"                                the named typical input file too and\n"
+"                                print out the ratio of the throughput\n"
+"                                of FILE relative to the baseline one\n"
+"  -r|--min-ratio=NUM          fail when the throughput ratio of any of\n"
+"                                the modules is below NUM percents; the\n"
+"                                option requires '-b|--baseline'\n"
+"  -u|--unicode[=NUM]          time the numeric char reference path --\n"
+"                                i.e. the parsing of the code point and\n"
+"                                its encoding to UTF-8 -- instead of the\n"
+"                                parser modules, on NUM pseudo-random\n"
+"                                decimal and hex references generated\n"
+"                                for each of the code point ranges below\n"
+"                                (the default NUM is 10000); no input\n"
+"                                file is needed; the table lines are of\n"
+"                                the ranges 'ascii' (U+0020-U+007E), 'c1'\n"
+"                                (the overridden U+0080-U+009F), 'utf8-2'\n"
+"                                (U+00A0-U+07FF), 'utf8-3' (U+0800-U+FFFD),\n"
+"                                'utf8-4' (U+10000-U+10FFFD) and 'beyond'\n"
+"                                (U+110000-U+FFFFFF, all invalid), each\n"
+"                                suffixed by '/d' or '/x'\n"
+"  -R|--roofline[=LIST]        time the whole substitution path of each\n"
+"                                parser module -- the output written on\n"
+"                                '/dev/null' included -- on synthetic\n"
+"                                buffers in which the char references\n"
+"                                make up the percents of bytes given in\n"
+"                                the comma-separated LIST (the default is\n"
+"                                '0,1,2,5,10,20,30,40,50'), along with the\n"
+"                                'memcpy' and 'memchr' of same buffers;\n"
+"                                the size of the buffers is the one of\n"
+"                                '-s|--sponge-max'; no input file is\n"
+"                                needed; the table's columns are GB/s\n"
+"  -F|--footprint[=NUM]        instead of timing the parser modules,\n"
+"                                single-step each of their parse funcs\n"
+"                                over NUM of the char references in FILE\n"
+"                                -- picked evenly spaced, the default NUM\n"
+"                                being 1000 -- and print out the number\n"
+"                                of bytes of code of each module along\n"
+"                                with the number of its distinct 64-byte\n"
+"                                cache lines and 4K pages that got run;\n"
+"                                single-stepping costs some microseconds\n"
+"                                per instruction, i.e. about two seconds\n"
+"                                per 1000 refs for each module, thus keep\n"
+"                                NUM small\n"
+"  -K|--cold[=NUM]             time the parser modules on cold caches:\n"
+"                                split the char references in FILE in\n"
+"                                documents of NUM references each (the\n"
+"                                default NUM is 256) and, prior to each\n"
+"                                document, evict the caches by writing\n"
+"                                a 32M buffer and executing 1M of code;\n"
+"                                only the parsing of the documents is\n"
+"                                timed\n"
+"  -X|--escape                 instead of the parser modules, time the\n"
+"                                escaping of the chars `&', `<', `>', `\"'\n"
+"                                and `\'' of the whole input text by the\n"
+"                                library function of the program -- of\n"
+"                                which table line is named by the SIMD\n"
+"                                variant in use -- and, for comparison, by\n"
+"                                a naive byte loop (the 'naive' line); the\n"
+"                                units of the output table are bytes\n"
+"  -J|--json-lines             print out one JSON object per line for\n"
+"                                each module instead of the table; the\n"
+"                                objects record the build's commit and\n"
+"                                flags, the compiler, the CPU and all\n"
+"                                the timed samples of the module\n"
+"  -C|--compare                compare the JSON lines files OLD and NEW\n"
+"                                module by module -- the last record of\n"
+"                                each module in each file -- by applying\n"
+"                                the Mann-Whitney U test on their samples\n"
+"                                and fail when any module regressed\n"
+"  -a|--alpha=NUM              the significance level of the test, as\n"
+"                                percentage (default: 5)\n"
+"  -d|--threshold=NUM          the relative change of the median of the\n"
+"                                samples, as percentage, beyond which a\n"
+"                                significant change is a regression or\n"
+"                                an improvement (default: 3)\n"
+"     --dump-options           print options and exit\n"
+"     --version                print version numbers and exit\n"
+"  -?|--help                   display this help info and exit\n"
+"the columns of the output table are: the average number of\n"
+"nanoseconds spent per char reference, the number of refs\n"
+"processed per second, the average number of CPU cycles spent\n"
+"per char reference (as counted by the CPU's time stamp counter)\n"
+"and the min, median and 99th percentile of the nanoseconds\n"
+"spent per char reference over all the timed passes; the\n"
+"baseline columns are the number of bytes of the baseline\n"
+"file decoded per second and the ratio percentage\n";
+
+struct options_t
+{
+    const char*  input_file;
+    const char*  compare_files[2];
+    const char*  cref_parsers;
+    size_t       iterations;
+    size_t       warm_up;
+    size_t       sponge_max;
+    const char*  baseline;
+    size_t       min_ratio;
+    size_t       alpha;
+    size_t       threshold;
+    size_t       unicode;
+    size_t       densities[16];
+    size_t       n_densities;
+    size_t       cold;
+    bool         roofline;
+    size_t       footprint;
+    bool         escape;
+    bool         throughput;
+    bool         json_lines;
+    bool         compare;
+
+    size_t       argc;
+    char* const *argv;
+};
+
+static void options_version(void)
+{
+    fprintf(stdout,
+        "%s: version %s\n\n%s",
+        program, verdate,
+        license);
+}
+
+static void options_usage(void)
+{
+    fprintf(stdout, help, program, program, program, program,
+        program);
+}
+
+static void options_dump(const struct options_t* opts)
+{
+    static const char* const noyes[] = {
+        [0] "no", [1] "yes"
+    };
+    struct su_size_t sponge_su = su_size(
+        opts->sponge_max);
+    char d[64] = "-", *p = d;
+    size_t i;
+
+    for (i = 0; opts->roofline &&
+            i < opts->n_densities; i ++)
+        p += snprintf(p, sizeof d - PTR_DIFF(p, d),
+                "%s%zu", i ? "," : "",
+                opts->densities[i]);
+
+#define NNUL(x)  (opts->x ? opts->x : "-")
+#define NOYES(x) (noyes[opts->x])
+
+    fprintf(stdout,
+        "input-file:   %s\n"
+        "cref-parsers: %s\n"
+        "iterations:   %zu\n"
+        "warm-up:      %zu\n"
+        "sponge-max:   %zu%s\n"
+        "throughput:   %s\n"
+        "baseline:     %s\n"
+        "min-ratio:    %zu\n"
+        "json-lines:   %s\n"
+        "compare:      %s\n"
+        "alpha:        %zu\n"
+        "threshold:    %zu\n"
+        "unicode:      %zu\n"
+        "roofline:     %s\n"
+        "footprint:    %zu\n"
+        "escape:       %s\n"
+        "cold:         %zu\n"
+        "argc:         %zu\n",
+        NNUL(input_file),
+        opts->cref_parsers,
+        opts->iterations,
+        opts->warm_up,
+        sponge_su.sz,
+        sponge_su.su,
+        NOYES(throughput),
+        NNUL(baseline),
+        opts->min_ratio,
+        NOYES(json_lines),
+        NOYES(compare),
+        opts->alpha,
+        opts->threshold,
+        opts->unicode,
+        d,
+        opts->footprint,
+        NOYES(escape),
+        opts->cold,
+        opts->argc);
+
+    pretty_print_strings(stdout,
+        PTR_CONST_PTR_CAST(opts->argv, char),
+        opts->argc, "argv", 14, 0);
+}
+
+static void options_invalid_opt_arg(
+    const char* opt_name, const char* opt_arg)
+{
+    error("invalid argument for '%s' option: '%s'",
+        opt_name, opt_arg);
+}
+
+static void options_illegal_opt_arg(
+    const char* opt_name, const char* opt_arg)
+{
+    error("illegal argument for '%s' option: '%s'",
+        opt_name, opt_arg);
+}
+
+static void options_invalid_opt_arg2(
+    const char* opt_name, const char* opt_arg,
+    const char* reason)
+{
+    error("invalid argument for '%s' option: '%s': %s",
+        opt_name, opt_arg, reason);
+}
+
+#define SU_SIZE_OPT_NAME options
+#define SU_SIZE_OPT_NEED_PARSE_SIZE
+#define SU_SIZE_OPT_NEED_PARSE_SIZE_SU
+#include "su-size-opt-impl.h"
+
+static const char*
+    options_parse_file_optarg(
+        const char* opt_name, const char* opt_arg)
+{
+    struct stat s;
+    int r, e;
+
+    r = stat(opt_arg, &s);
+    e = errno;
+
+    if (r && e != ENOENT && e != ENOTDIR)
+        error("%s: stat failed: %s",
+            opt_arg, strerror(e));
+    if (r)
+        options_invalid_opt_arg2(
+            opt_name, opt_arg,
+            "file not found");
+
+    return opt_arg;
+}
+
+// stev: the parser names in LIST are separated
+// by commas; the output is the same list having
+// spaces instead of commas, as is CREF_PARSERS
+
+static const char*
+    options_parse_cref_parsers_optarg(
+        const char* opt_name, const char* opt_arg)
+{
+    char *r, *p;
+
+    r = strdup(opt_arg);
+    ASSERT(r != NULL);
+
+    for (p = r; *p; p ++) {
+        if (*p == ',')
+            *p = ' ';
+        else
+        if (!ISALNUM(*p) && *p != '-')
+            options_invalid_opt_arg(
+                opt_name, opt_arg);
+    }
+    if (p == r)
+        options_invalid_opt_arg(
+            opt_name, opt_arg);
+
+    return r;
+}
+
+// stev: the densities in LIST are percents that
+// are separated by commas; a density is not allowed
+// to be more than 90 percents
+
+static void options_parse_densities_optarg(
+    const char* opt_name, const char* opt_arg,
+    struct options_t* opts)
+{
+    const char* p = opt_arg;
+    char* e;
+
+    opts->n_densities = 0;
+    do {
+        unsigned long v;
+
+        if (opts->n_densities ==
+                ARRAY_SIZE(opts->densities) ||
+            !ISDIGIT(*p))
+            options_invalid_opt_arg(
+                opt_name, opt_arg);
+
+        errno = 0;
+        v = strtoul(p, &e, 10);
+        if (errno || v > 90 ||
+            (*e && *e != ','))
+            options_invalid_opt_arg(
+                opt_name, opt_arg);
+
+        opts->densities[opts->n_densities ++] = v;
+        p = e + (*e == ',');
+    } while (*e);
+}
+
+static const struct options_t* options(
+    int argc, char* argv[])
+{
+    static struct options_t opts = {
+        .cref_parsers = CREF_PARSERS,
+        .iterations   = 31,
+        .warm_up      = 3,
+        .sponge_max   = MB(5),
+        .alpha        = 5,
+        .threshold    = 3,
+        .densities    = {
+            0, 1, 2, 5, 10, 20, 30, 40, 50
+        },
+        .n_densities  = 9,
+    };
+
+    enum {
+        // stev: options:
+        input_file_opt   = 'f',
+        cref_parsers_opt = 'p',
+        iterations_opt   = 'n',
+        warm_up_opt      = 'w',
+        sponge_max_opt   = 's',
+        throughput_opt   = 't',
+        baseline_opt     = 'b',
+        min_ratio_opt    = 'r',
+        json_lines_opt   = 'J',
+        compare_opt      = 'C',
+        alpha_opt        = 'a',
+        threshold_opt    = 'd',
+        unicode_opt      = 'u',
+        roofline_opt     = 'R',
+        footprint_opt    = 'F',
+        cold_opt         = 'K',
+        escape_opt       = 'X',
+        help_opt         = '?',
+        dump_opt         = 128,
+        version_opt,
+    };
+
+    static const struct option longs[] = {
+        { "input-file",    1,       0, input_file_opt },
+        { "cref-parsers",  1,       0, cref_parsers_opt },
+        { "iterations",    1,       0, iterations_opt },
+        { "warm-up",       1,       0, warm_up_opt },
+        { "sponge-max",    1,       0, sponge_max_opt },
+        { "throughput",    0,       0, throughput_opt },
+        { "baseline",      1,       0, baseline_opt },
+        { "min-ratio",     1,       0, min_ratio_opt },
+        { "json-lines",    0,       0, json_lines_opt },
+        { "compare",       0,       0, compare_opt },
+        { "alpha",         1,       0, alpha_opt },
+        { "threshold",     1,       0, threshold_opt },
+        { "unicode",       2,       0, unicode_opt },
+        { "roofline",      2,       0, roofline_opt },
+        { "footprint",     2,       0, footprint_opt },
+        { "cold",          2,       0, cold_opt },
+        { "escape",        0,       0, escape_opt },
+        { "dump-options",  0,       0, dump_opt },
+        { "version",       0,       0, version_opt },
+        { "help",          0, &optopt, help_opt },
+        { 0,               0,       0, 0 }
+    };
+    static const char shorts[] = ":" "a:b:Cd:F::f:JK::n:p:R::r:s:tu::w:X";
+
+    struct bits_opts_t
+    {
+        bits_t dump: 1;
+        bits_t usage: 1;
+        bits_t version: 1;
+    };
+    struct bits_opts_t bits = {
+        .dump    = false,
+        .usage   = false,
+        .version = false
+    };
+    int opt;
+
+#define argv_optind()                      \
+    ({                                     \
+        size_t i = INT_AS_SIZE(optind);    \
+        ASSERT_SIZE_DEC_NO_OVERFLOW(i);    \
+        ASSERT(i - 1 < INT_AS_SIZE(argc)); \
+        argv[i - 1];                       \
+    })
+
+#define optopt_char()                   \
+    ({                                  \
+        ASSERT(ISASCII((char) optopt)); \
+        (char) optopt;                  \
+    })
+
+#define missing_opt_arg_str(n) \
+    error("argument for option '%s' not found", n)
+#define missing_opt_arg_ch(n) \
+    error("argument for option '-%c' not found", n);
+#define not_allowed_opt_arg(n) \
+    error("option '%s' does not allow an argument", n)
+#define invalid_opt_str(n) \
+    error("invalid command line option '%s'", n)
+#define invalid_opt_ch(n) \
+    error("invalid command line option '-%c'", n)
+
+    opterr = 0;
+    optind = 1;
+    while ((opt = getopt_long(
+        argc, argv, shorts, longs, 0)) != EOF) {
+        switch (opt) {
+        case input_file_opt:
+            opts.input_file = options_parse_file_optarg(
+                "input-file", optarg);
+            break;
+        case cref_parsers_opt:
+            opts.cref_parsers = options_parse_cref_parsers_optarg(
+                "cref-parsers", optarg);
+            break;
+        case iterations_opt:
+            opts.iterations = options_parse_size_optarg(
+                "iterations", optarg, 1, 100000);
+            break;
+        case warm_up_opt:
+            opts.warm_up = options_parse_size_optarg(
+                "warm-up", optarg, 0, 1000);
+            break;
+        case sponge_max_opt:
+            opts.sponge_max = options_parse_su_size_optarg(
+                "sponge-max", optarg, 1, MB(10));
+            break;
+        case throughput_opt:
+            opts.throughput = true;
+            break;
+        case baseline_opt:
+            opts.baseline = options_parse_file_optarg(
+                "baseline", optarg);
+            opts.throughput = true;
+            break;
+        case min_ratio_opt:
+            opts.min_ratio = options_parse_size_optarg(
+                "min-ratio", optarg, 1, 100);
+            break;
+        case json_lines_opt:
+            opts.json_lines = true;
+            break;
+        case compare_opt:
+            opts.compare = true;
+            break;
+        case alpha_opt:
+            opts.alpha = options_parse_size_optarg(
+                "alpha", optarg, 1, 50);
+            break;
+        case threshold_opt:
+            opts.threshold = options_parse_size_optarg(
+                "threshold", optarg, 0, 100);
+            break;
+        case unicode_opt:
+            opts.unicode = optarg != NULL
+                ? options_parse_size_optarg(
+                    "unicode", optarg, 1, 1000000)
+                : 10000;
+            break;
+        case roofline_opt:
+            if (optarg != NULL)
+                options_parse_densities_optarg(
+                    "roofline", optarg, &opts);
+            opts.roofline = true;
+            break;
+        case footprint_opt:
+            opts.footprint = optarg != NULL
+                ? options_parse_size_optarg(
+                    "footprint", optarg, 1, 1000000)
+                : 1000;
+            break;
+        case cold_opt:
+            opts.cold = optarg != NULL
+                ? options_parse_size_optarg(
+                    "cold", optarg, 1, 1000000)
+                : 256;
+            break;
+        case escape_opt:
+            opts.escape = true;
+            break;
+        case dump_opt:
+            bits.dump = true;
+            break;
+        case version_opt:
+            bits.version = true;
+            break;
+        case 0:
+            bits.usage = true;
+            break;
+        case ':': {
+            const char* opt = argv_optind();
+            if (opt[0] == '-' && opt[1] == '-')
+                missing_opt_arg_str(opt);
+            else
+                missing_opt_arg_ch(optopt_char());
+            break;
+        }
+        case '?':
+        default:
+            if (optopt == 0)
+                invalid_opt_str(argv_optind());
+            else
+            if (optopt != '?') {
+                char* opt = argv_optind();
+                if (opt[0] == '-' && opt[1] == '-') {
+                    char* end = strchr(opt, '=');
+                    if (end) *end = '\0';
+                    not_allowed_opt_arg(opt);
+                }
+                else
+                    invalid_opt_ch(optopt_char());
+            }
+            else
+                bits.usage = true;
+            break;
+        }
+    }
+
+    ASSERT(optind > 0);
+    ASSERT(optind <= argc);
+
+    argc -= optind;
+    argv += optind;
+
+    opts.argc = INT_AS_SIZE(argc);
+    opts.argv = argv;
+
+    if (opts.compare) {
+        size_t i;
+
+        for (i = 0; i < ARRAY_SIZE(opts.compare_files) &&
+             opts.argc > 0; i ++) {
+            opts.compare_files[i] = *opts.argv ++;
+            opts.argc --;
+        }
+    }
+    else
+    if (opts.argc > 0) {
+        opts.input_file = *opts.argv ++;
+        opts.argc --;
+    }
+
+    if (bits.version)
+        options_version();
+    if (bits.dump)
+        options_dump(&opts);
+    if (bits.usage)
+        options_usage();
+
+    if (bits.dump ||
+        bits.version ||
+        bits.usage)
+        exit(0);
+
+    if (opts.compare) {
+        if (opts.compare_files[1] == NULL)
+            error("option '-C|--compare' requires "
+                "two input files");
+        return &opts;
+    }
+
+    if (opts.unicode || opts.roofline) {
+        if (opts.unicode && opts.roofline)
+            error("options '-u|--unicode' and "
+                "'-R|--roofline' are exclusive");
+        if (opts.throughput)
+            error("option '%s' cannot be combined "
+                "with option '-t|--throughput'",
+                opts.unicode ? "-u|--unicode"
+                : "-R|--roofline");
+        return &opts;
+    }
+
+    if (opts.input_file == NULL)
+        error("input file not given");
+    if (opts.min_ratio && opts.baseline == NULL)
+        error("option '-r|--min-ratio' requires "
+            "option '-b|--baseline'");
+
+    if (opts.escape) {
+        if (opts.throughput ||
+            opts.footprint ||
+            opts.cold)
+            error("option '-X|--escape' cannot be combined "
+                "with option '%s'",
+                opts.throughput ? "-t|--throughput"
+                : opts.footprint ? "-F|--footprint"
+                : "-K|--cold");
+        return &opts;
+    }
+
+    if (opts.footprint || opts.cold) {
+        if (opts.footprint && opts.cold)
+            error("options '-F|--footprint' and "
+                "'-K|--cold' are exclusive");
+        if (opts.throughput)
+            error("option '%s' cannot be combined "
+                "with option '-t|--throughput'",
+                opts.cold ? "-K|--cold"
+                : "-F|--footprint");
+    }
+#ifndef BENCH_FOOTPRINT
+    if (opts.footprint)
+        error("option '-F|--footprint' is not "
+            "supported on this platform");
+#endif
+    if (opts.footprint && opts.json_lines)
+        error("option '-F|--footprint' cannot be "
+            "combined with option '-J|--json-lines'");
+
+    return &opts;
+}
+
+typedef
+    size_t (*get_version_func_t)(void);
+typedef
+    int (*parse_func_t)(const char*);
+
+struct module_lib_funcs_t
+{
+    get_version_func_t get_version;
+    parse_func_t       parse;
+
+    // stev: not entries of 'module_lib_def': these
+    // are set by 'module_lib_load' -- see below
+    const uchar_t*     table;
+    size_t             table_size;
+};
+
+#define module_lib_t dyn_lib_t
+
+#undef  CASE
+#define CASE(n) \
+    DYN_LIB_ENTRY(module_lib_funcs_t, n)
+static const struct dyn_lib_entry_t
+module_lib_entries[] = {
+    CASE(get_version),
+    CASE(parse),
+};
+
+static const struct dyn_lib_def_t
+module_lib_def = {
+    .ver_major = HTML_CREF_VERSION_MAJOR,
+    .ver_minor = HTML_CREF_VERSION_MINOR,
+    .n_entries = ARRAY_SIZE(module_lib_entries),
+    .entries = module_lib_entries,
+};
+
+#undef  CASE
+#define CASE(n) case dyn_lib_error_ ## n
+
+static void module_lib_print_error_desc(
+    struct dyn_lib_error_info_t* error,
+    FILE* file)
+{
+    switch (error->type) {
+
+    CASE(invalid_lib_name):
+        fputs("invalid library name", file);
+        break;
+    CASE(load_lib_failed):
+        fputs("failed loading library", file);
+        break;
+    CASE(symbol_not_found): {
+        const struct dyn_lib_entry_t* e =
+            ARRAY_NULL_ELEM_REF(
+                module_lib_entries,
+                error->sym);
+
+        ASSERT(e != NULL);
+        fprintf(file,
+            "'%s' symbol not found", e->name);
+        break;
+    }
+    CASE(wrong_lib_version):
+        fputs("wrong library version", file);
+        break;
+
+    default:
+        UNEXPECT_VAR("%d", error->type);
+    }
+}
+
+// stev: 'html_cref_NAME_get_error' is not an entry
+// of 'module_lib_def', since only some modules define
+// it: a module which got loaded may yet have failed
+// initializing itself -- as 'mtrie' does when its
+// index file is missing or invalid; neither is the
+// function 'html_cref_NAME_get_table': the offsets
+// that the parsers return are into 'html_cref_table',
+// unless the parser comes with its own table -- as
+// 'mtrie' does, of which table is read from its
+// index file
+
+typedef
+    const char* (*get_error_func_t)(void);
+typedef
+    const uchar_t* (*get_table_func_t)(size_t*);
+
+static void* module_lib_get_sym(
+    struct module_lib_t* lib,
+    const char* name, const char* sym)
+{
+    char* n = NULL;
+    void* f;
+
+    if (asprintf(&n, "html_cref_%s_%s",
+            name, sym) < 0)
+        error("asprintf failed");
+
+    dlerror();
+    f = dlsym(lib->sobj, n);
+    dlerror();
+
+    free(n);
+    return f;
+}
+
+// stev: a module that fails loading does not stop
+// the program: a warning is issued and the module
+// gets skipped
+
+static bool module_lib_load(
+    struct module_lib_t* lib, const char* name,
+    struct module_lib_funcs_t* funcs)
+{
+    struct dyn_lib_error_info_t e;
+    char *m = NULL, *n = NULL;
+
+    if (asprintf(&n, "html-cref-%s.so", name) < 0)
+        error("asprintf failed");
+
+    if (dyn_lib_init(lib, n, &module_lib_def, funcs, &e, &m)) {
+        get_error_func_t g;
+        get_table_func_t t;
+        const char* r;
+
+        g = (get_error_func_t)
+            module_lib_get_sym(lib, name, "get_error");
+        if (g == NULL || !(r = g())) {
+            t = (get_table_func_t)
+                module_lib_get_sym(lib, name, "get_table");
+            funcs->table_size = html_cref_table_size;
+            funcs->table = t != NULL
+                ? t(&funcs->table_size)
+                : html_cref_table;
+            ASSERT(funcs->table != NULL);
+            return true;
+        }
+
+        fprintf(stderr, "%s: warning: %s: module error: %s\n",
+            program, lib->lib_name, r);
+        dyn_lib_done(lib);
+        free(n);
+        return false;
+    }
+
+    fprintf(stderr, "%s: warning: %s: module lib error: ",
+        program, lib->lib_name);
+    module_lib_print_error_desc(&e, stderr);
+    if (m != NULL)
+        fprintf(stderr, ": %s\n", m);
+    else
+        fputc('\n', stderr);
+
+    free(m);
+    dyn_lib_done(lib);
+    free(n);
+
+    return false;
+}
+
+static void module_lib_done(
+    struct module_lib_t* lib)
+{
+    free(CONST_CAST(lib->lib_name, char));
+    dyn_lib_done(lib);
+}
+
+#undef  CASE
+#define CASE(n) [file_buf_error_file_ ## n] = #n
+
+static void input_error(
+    const struct file_buf_t* input)
+    NORETURN;
+
+static void input_error(
+    const struct file_buf_t* input)
+{
+    static const char* const types[] = {
+        CASE(open),
+        CASE(stat),
+        CASE(read),
+        CASE(close),
+    };
+    const char* t = ARRAY_NULL_ELEM(types,
+        input->error_info.type);
+
+    ASSERT(t != NULL);
+
+    error("%s: %s error: %s",
+        input->file_name, t,
+        strerror(input->error_info.sys_error));
+}
+
+static uint64_t bench_time_now(void)
+{
+    struct timespec t;
+
+    if (clock_gettime(CLOCK_MONOTONIC, &t))
+        error("clock_gettime failed: %s",
+            strerror(errno));
+
+    return (uint64_t) t.tv_sec * 1000000000 +
+           (uint64_t) t.tv_nsec;
+}
+
+#ifdef BENCH_CYCLES
+#define bench_cycles_now() __builtin_ia32_rdtsc()
+#else
+#define bench_cycles_now() UINT64_C(0)
+#endif
+
+struct bench_t;
+
+typedef
+    int (*bench_pass_func_t)(
+        const struct bench_t*,
+        parse_func_t);
+
+// stev: 'pass' makes one pass over the input, of
+// which size is 'units' items of kind 'unit' --
+// the named char references in 'refs' or the bytes
+// of 'buf'
+
+struct bench_t
+{
+    const struct options_t*        opts;
+    const struct html_cref_refs_t* refs;
+    bench_pass_func_t pass;
+    const char* unit;
+    size_t   units;
+    const char* buf;
+    size_t   len;
+    char*    dst;
+    const uchar_t* table;
+    size_t   table_size;
+    FILE*    out;
+    const char* cpu;
+    time_t   time;
+    double*  samples;
+    size_t   n_samples;
+};
+
+struct bench_result_t
+{
+    double ns;
+    double rate;
+    double cycles;
+    double min;
+    double median;
+    double p99;
+};
+
+static volatile int bench_sink;
+
+static int bench_pass(
+    const struct bench_t* bench,
+    parse_func_t func)
+{
+    const char **p, **e;
+    int s = 0;
+
+    for (p = bench->refs->ptr,
+         e = p + bench->refs->size;
+         p < e;
+         p ++)
+        s += func(*p);
+
+    return s;
+}
+
+// stev: the throughput pass decodes the whole input
+// the way 'process_subst_cref' of 'html-cref.c' does,
+// except for producing no output and no warnings
+
+static int bench_scan(
+    const struct bench_t* bench,
+    parse_func_t func)
+{
+    const size_t mask = SZ(1) << 7;
+    const char *p = bench->buf, *q;
+    const char *e = p + bench->len;
+    int s = 0;
+
+    ASSERT(*e == 0);
+
+    while ((q = html_cref_simd_find_amp(
+            p, PTR_DIFF(e, p)))) {
+        if (q[1] == '#') {
+            code_point_t c;
+
+            q += 2;
+            if (html_cref_unicode_parse_html(&q, &c) &&
+                *q == ';') {
+                s += c;
+                q ++;
+            }
+        }
+        else
+        if (ISALNUM(q[1])) {
+            int i;
+
+            if ((i = func(q + 1)) < 0)
+                q += 2;
+            else {
+                size_t j = INT_AS_SIZE(i);
+
+                ASSERT(j < bench->table_size);
+                q += (bench->table[j] & ~mask) + 1;
+                if (*q == ';') q ++;
+                s += i;
+            }
+        }
+        else
+            q += q[1] ? 2 : 1;
+
+        p = q;
+    }
+
+    return s;
+}
+
+// stev: the substitution pass is 'bench_scan' plus
+// the output of 'process_subst_cref': 'o' points to
+// the first char not yet written out, such that the
+// invalid char references get written out verbatim
+// along with the text that follows them
+
+static int bench_subst(
+    const struct bench_t* bench,
+    parse_func_t func)
+{
+    const size_t mask = SZ(1) << 7;
+    const char *p = bench->buf, *q, *o = p;
+    const char *e = p + bench->len;
+    FILE* f = bench->out;
+    int s = 0;
+
+    ASSERT(*e == 0);
+
+    while ((q = html_cref_simd_find_amp(
+            p, PTR_DIFF(e, p)))) {
+        const char* a = q;
+
+        if (q[1] == '#') {
+            code_point_t c;
+            utf8_t u;
+
+            q += 2;
+            if (html_cref_unicode_parse_html(&q, &c) &&
+                *q == ';') {
+                fwrite(o, 1, PTR_DIFF(a, o), f);
+                fwrite(u, 1, html_cref_unicode_encode_utf8(c, u), f);
+                o = ++ q;
+            }
+        }
+        else
+        if (ISALNUM(q[1])) {
+            const uchar_t* t;
+            size_t d;
+            int i;
+
+            if ((i = func(q + 1)) < 0)
+                q += 2;
+            else {
+                size_t j = INT_AS_SIZE(i);
+
+                ASSERT(j < bench->table_size);
+                t = &bench->table[j];
+                d = (*t & ~mask) + 1;
+
+                if (q[d] != ';' && !(*t & mask))
+                    q += d;
+                else {
+                    fwrite(o, 1, PTR_DIFF(a, o), f);
+                    fwrite(t + 2, 1, t[1], f);
+                    q += d;
+                    if (*q == ';') q ++;
+                    o = q;
+                    s += i;
+                }
+            }
+        }
+        else
+            q += q[1] ? 2 : 1;
+
+        p = q;
+    }
+    fwrite(o, 1, PTR_DIFF(e, o), f);
+
+    return s;
+}
+
+static int bench_memcpy(
+    const struct bench_t* bench,
+    parse_func_t func UNUSED)
+{
+    memcpy(bench->dst, bench->buf, bench->len);
+
+    return bench->dst[bench->len / 2];
+}
+
+static int bench_memchr(
+    const struct bench_t* bench,
+    parse_func_t func UNUSED)
+{
+    const char *p = bench->buf, *q;
+    const char *e = p + bench->len;
+    int s = 0;
+
+    for (; (q = memchr(p, '&', PTR_DIFF(e, p))); p = q + 1)
+        s ++;
+
+    return s;
+}
+
+// stev: the escape passes write the escaped input
+// text into 'dst': the naive one is the byte loop
+// that 'html_cref_escape' stands for
+
+static int bench_escape_naive(
+    const struct bench_t* bench,
+    parse_func_t func UNUSED)
+{
+    const char *p = bench->buf;
+    const char *e = p + bench->len;
+    char* d = bench->dst;
+
+#undef  CASE
+#define CASE(c, s)                      \
+    case c:                             \
+        memcpy(d, s, sizeof(s) - 1);    \
+        d += sizeof(s) - 1;             \
+        break
+
+    for (; p < e; p ++) {
+        switch (*p) {
+        CASE('&', "&amp;");
+        CASE('<', "&lt;");
+        CASE('>', "&gt;");
+        CASE('"', "&quot;");
+        CASE('\'', "&#39;");
+        default:
+            *d ++ = *p;
+        }
+    }
+
+    return d[-1];
+}
+
+static int bench_escape_simd(
+    const struct bench_t* bench,
+    parse_func_t func UNUSED)
+{
+    const char* q;
+    size_t l;
+
+    q = html_cref_escape(bench->buf, bench->len,
+            bench->dst, &l);
+
+    return q[l - 1];
+}
+
+// stev: the unicode pass decodes the numeric char
+// references the way 'process_subst_cref' does: the
+// pointers in 'refs' are to the chars right after
+// each '&#'
+
+static int bench_unicode_pass(
+    const struct bench_t* bench,
+    parse_func_t func UNUSED)
+{
+    const char **p, **e;
+    int s = 0;
+
+    for (p = bench->refs->ptr,
+         e = p + bench->refs->size;
+         p < e;
+         p ++) {
+        const char* q = *p;
+        code_point_t c;
+        utf8_t u;
+
+        if (html_cref_unicode_parse_html(&q, &c) &&
+            *q == ';')
+            s += html_cref_unicode_encode_utf8(c, u) + u[0];
+        else
+            s --;
+    }
+
+    return s;
+}
+
+static int bench_compare_samples(
+    const void* a, const void* b)
+{
+    double x = *(const double*) a;
+    double y = *(const double*) b;
+
+    return (x > y) - (x < y);
+}
+
+// stev: the p-th percentile of the sorted samples
+// by the nearest-rank method
+
+static double bench_percentile(
+    const struct bench_t* bench, size_t p)
+{
+    size_t k;
+
+    ASSERT(p > 0 && p <= 100);
+    ASSERT(bench->n_samples > 0);
+
+    k = (p * bench->n_samples + 99) / 100;
+    ASSERT(k > 0);
+
+    return bench->samples[k - 1];
+}
+
+// stev: the buffer written and the block of code
+// executed by 'bench_thrash' for evicting the data
+// and the instruction caches; the code is made of
+// NOPs ending with a return instruction, thus is
+// available only on x86 -- elsewhere or when the
+// mapping cannot be made executable, only the data
+// caches get evicted
+
+enum {
+    bench_thrash_data_size = MB(32),
+    bench_thrash_code_size = MB(1),
+};
+
+struct bench_thrash_t
+{
+    volatile char* data;
+    void         (*code)(void);
+};
+
+static struct bench_thrash_t bench_thrash_caches;
+
+static void bench_thrash_init(void)
+{
+    struct bench_thrash_t* t = &bench_thrash_caches;
+    void* p;
+
+    t->data = calloc(bench_thrash_data_size, 1);
+    ASSERT(t->data != NULL);
+
+#ifdef BENCH_CYCLES
+    p = mmap(NULL, bench_thrash_code_size,
+            PROT_READ | PROT_WRITE,
+            MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (p == MAP_FAILED)
+        error("mmap failed: %s", strerror(errno));
+
+    // stev: 0x90 is NOP and 0xc3 is RET
+    memset(p, 0x90, bench_thrash_code_size - 1);
+    ((uchar_t*) p)[bench_thrash_code_size - 1] = 0xc3;
+
+    if (mprotect(p, bench_thrash_code_size,
+            PROT_READ | PROT_EXEC)) {
+        fprintf(stderr,
+            "%s: warning: mprotect failed: %s: "
+            "evicting the data caches only\n",
+            program, strerror(errno));
+        munmap(p, bench_thrash_code_size);
+    }
+    else
+        t->code = (void (*)(void)) p;
+#else
+    (void) p;
+#endif
+}
+
+static void bench_thrash_done(void)
+{
+    struct bench_thrash_t* t = &bench_thrash_caches;
+
+    if (t->code != NULL)
+        munmap((void*) t->code,
+            bench_thrash_code_size);
+    free((void*) t->data);
+    memset(t, 0, sizeof(*t));
+}
+
+static void bench_thrash(void)
+{
+    struct bench_thrash_t* t = &bench_thrash_caches;
+    size_t i;
+
+    for (i = 0; i < bench_thrash_data_size; i += 64)
+        t->data[i] ++;
+    if (t->code != NULL)
+        t->code();
+}
+
+// stev: the cold pass parses the char references in
+// documents of 'cold' references each, evicting the
+// caches prior to each document; only the parsing
+// is timed; returns the nanoseconds spent and stores
+// in 'cycles' the cycles spent
+
+static uint64_t bench_cold_pass(
+    const struct bench_t* bench,
+    parse_func_t func,
+    uint64_t* cycles,
+    int* sum)
+{
+    const size_t m = bench->opts->cold;
+    const char **p, **q, **e;
+    uint64_t t = 0, c = 0, a, b;
+    int s = 0;
+
+    for (p = bench->refs->ptr,
+         e = p + bench->refs->size;
+         p < e;) {
+        q = PTR_DIFF(e, p) > m ? p + m : e;
+
+        bench_thrash();
+
+        a = bench_time_now();
+        b = bench_cycles_now();
+
+        for (; p < q; p ++)
+            s += func(*p);
+
+        c += bench_cycles_now() - b;
+        t += bench_time_now() - a;
+    }
+
+    *cycles = c;
+    *sum += s;
+
+    return t;
+}
+
+static void bench_run(
+    struct bench_t* bench,
+    parse_func_t func,
+    struct bench_result_t* result)
+{
+    const double n = bench->units;
+    uint64_t t, c, s_t = 0, s_c = 0;
+    size_t i;
+    int s = 0;
+
+    ASSERT(n > 0);
+    ASSERT(bench->n_samples ==
+        bench->opts->iterations);
+
+    for (i = 0; i < bench->opts->warm_up; i ++)
+        s += bench->pass(bench, func);
+
+    for (i = 0; i < bench->n_samples; i ++) {
+        if (bench->opts->cold)
+            t = bench_cold_pass(bench, func, &c, &s);
+        else {
+            t = bench_time_now();
+            c = bench_cycles_now();
+
+            s += bench->pass(bench, func);
+
+            c = bench_cycles_now() - c;
+            t = bench_time_now() - t;
+        }
+
+        bench->samples[i] = t / n;
+        s_t += t;
+        s_c += c;
+    }
+    bench_sink = s;
+
+    qsort(bench->samples, bench->n_samples,
+        sizeof(*bench->samples),
+        bench_compare_samples);
+
+    result->ns = s_t / (n * bench->n_samples);
+    result->rate = result->ns > 0
+        ? 1e9 / result->ns : 0;
+    result->cycles = s_c / (n * bench->n_samples);
+    result->min = bench->samples[0];
+    result->median = bench_percentile(bench, 50);
+    result->p99 = bench_percentile(bench, 99);
+}
+
+// stev: the throughput of the input relative to
+// that of the baseline, as percentage
+
+static double bench_ratio(
+    const struct bench_result_t* result,
+    const struct bench_result_t* base)
+{
+    return base->rate > 0
+        ? 100 * result->rate / base->rate : 0;
+}
+
+static void bench_print_head(
+    const struct options_t* opts)
+{
+    const char* u = opts->throughput ||
+        opts->escape ? "byte" : "ref";
+    char b[3][16];
+
+    snprintf(b[0], sizeof(b[0]), "ns/%s", u);
+    snprintf(b[1], sizeof(b[1]), "%ss/s", u);
+    snprintf(b[2], sizeof(b[2]), "cycles/%s", u);
+
+    fprintf(stdout,
+        "%-8s %8s %12s %10s %8s %8s %8s",
+        "module", b[0], b[1], b[2],
+        "min", "median", "p99");
+    if (opts->baseline != NULL)
+        fprintf(stdout, " %12s %7s",
+            "base-bytes/s", "ratio");
+    fputc('\n', stdout);
+}
+
+static void bench_print_result(
+    const char* name,
+    const struct bench_result_t* result,
+    const struct bench_result_t* base)
+{
+    fprintf(stdout, "%-8s %8.2f %12.0f ",
+        name, result->ns, result->rate);
+#ifdef BENCH_CYCLES
+    fprintf(stdout, "%10.2f", result->cycles);
+#else
+    fprintf(stdout, "%10s", "-");
+#endif
+    fprintf(stdout, " %8.2f %8.2f %8.2f",
+        result->min, result->median,
+        result->p99);
+    if (base != NULL)
+        fprintf(stdout, " %12.0f %6.2f%%",
+            base->rate, bench_ratio(result, base));
+    fputc('\n', stdout);
+}
+
+#ifdef BENCH_FOOTPRINT
+
+// stev: 'begin' is initially the base address of
+// the module -- as obtained by 'dladdr(3)' -- and
+// upon return of 'dl_iterate_phdr(3)' the address
+// of the module's executable segment, of which end
+// is 'end'
+
+struct bench_text_t
+{
+    uintptr_t begin;
+    uintptr_t end;
+};
+
+static int bench_text_find(
+    struct dl_phdr_info* info,
+    size_t size UNUSED,
+    void* data)
+{
+    struct bench_text_t* t = data;
+    const ElfW(Phdr) *p, *e;
+
+    if (info->dlpi_addr != t->begin)
+        return 0;
+
+    for (p = info->dlpi_phdr,
+         e = p + info->dlpi_phnum;
+         p < e;
+         p ++) {
+        if (p->p_type != PT_LOAD ||
+            !(p->p_flags & PF_X))
+            continue;
+        t->begin = info->dlpi_addr + p->p_vaddr;
+        t->end = t->begin + p->p_memsz;
+        return 1;
+    }
+
+    return 0;
+}
+
+struct bench_footprint_t
+{
+    size_t text;
+    size_t lines;
+    size_t pages;
+    size_t insns;
+    size_t refs;
+};
+
+// stev: the child process makes one pass over at
+// most 'opts->footprint' of the char references --
+// every k-th of them --, being single-stepped all
+// along by the parent process; only the instructions
+// of the module's executable segment are counted; an
+// instruction counts in the cache line and in the
+// page where it starts
+
+static int bench_footprint_pass(
+    const struct bench_t* bench,
+    parse_func_t func,
+    size_t step)
+{
+    const char **p, **e;
+    int s = 0;
+
+    for (p = bench->refs->ptr,
+         e = p + bench->refs->size;
+         p < e;
+         p += step)
+        s += func(*p);
+
+    return s;
+}
+
+static void bench_footprint(
+    const struct bench_t* bench,
+    parse_func_t func,
+    struct bench_footprint_t* result)
+{
+    struct user_regs_struct r;
+    struct bench_text_t t;
+    uchar_t *l, *g;
+    size_t n, m, i, k;
+    uintptr_t a;
+    Dl_info d;
+    pid_t p;
+    int s;
+
+    if (!dladdr((void*) func, &d))
+        error("dladdr failed");
+
+    t.begin = (uintptr_t) d.dli_fbase;
+    t.end = 0;
+    if (!dl_iterate_phdr(bench_text_find, &t))
+        error("%s: executable segment not found",
+            d.dli_fname);
+    ASSERT(t.begin < t.end);
+
+    n = ((t.end - 1) >> 6) - (t.begin >> 6) + 1;
+    m = ((t.end - 1) >> 12) - (t.begin >> 12) + 1;
+    l = calloc(n, 1);
+    ASSERT(l != NULL);
+    g = calloc(m, 1);
+    ASSERT(g != NULL);
+
+    memset(result, 0, sizeof(*result));
+    result->text = t.end - t.begin;
+
+    // stev: trace every k-th char reference only,
+    // such that at most 'opts->footprint' of them
+    i = bench->refs->size;
+    k = i > bench->opts->footprint
+      ? (i - 1) / bench->opts->footprint + 1
+      : 1;
+    result->refs = i ? (i - 1) / k + 1 : 0;
+
+    fflush(stdout);
+    fflush(stderr);
+
+    if ((p = fork()) < 0)
+        error("fork failed: %s", strerror(errno));
+    if (p == 0) {
+        if (ptrace(PTRACE_TRACEME, 0, NULL, NULL) < 0)
+            _exit(127);
+        raise(SIGSTOP);
+        bench_sink = bench_footprint_pass(bench, func, k);
+        _exit(0);
+    }
+
+    if (waitpid(p, &s, 0) < 0)
+        error("waitpid failed: %s", strerror(errno));
+    if (!WIFSTOPPED(s))
+        error("tracing the child process failed "
+            "(see /proc/sys/kernel/yama/ptrace_scope)");
+
+    for (;;) {
+        if (ptrace(PTRACE_SINGLESTEP, p, NULL, NULL) < 0)
+            error("ptrace failed: %s", strerror(errno));
+        if (waitpid(p, &s, 0) < 0)
+            error("waitpid failed: %s", strerror(errno));
+        if (WIFEXITED(s) || WIFSIGNALED(s))
+            break;
+        if (ptrace(PTRACE_GETREGS, p, NULL, &r) < 0)
+            error("ptrace failed: %s", strerror(errno));
+
+        a = BENCH_IP(r);
+        if (a < t.begin || a >= t.end)
+            continue;
+
+        result->insns ++;
+        l[(a >> 6) - (t.begin >> 6)] = 1;
+        g[(a >> 12) - (t.begin >> 12)] = 1;
+    }
+
+    if (!WIFEXITED(s) || WEXITSTATUS(s))
+        error("the child process failed");
+
+    for (i = 0; i < n; i ++)
+        result->lines += l[i];
+    for (i = 0; i < m; i ++)
+        result->pages += g[i];
+
+    free(g);
+    free(l);
+}
+
+static void bench_print_footprint_head(void)
+{
+    fprintf(stdout,
+        "%-8s %10s %13s %6s %6s %9s\n",
+        "module", "text-bytes", "touched-bytes",
+        "lines", "pages", "insns/ref");
+}
+
+static void bench_print_footprint(
+    const char* name,
+    const struct bench_footprint_t* result)
+{
+    fprintf(stdout,
+        "%-8s %10zu %13zu %6zu %6zu %9.2f\n",
+        name, result->text, result->lines * 64,
+        result->lines, result->pages,
+        result->refs
+        ? (double) result->insns / result->refs : 0);
+}
+
+#endif // BENCH_FOOTPRINT
+
+static void bench_print_json_string(
+    const char* str)
+{
+    const char* p;
+
+    fputc('"', stdout);
+    for (p = str; *p; p ++) {
+        if (*p == '"' || *p == '\\')
+            fprintf(stdout, "\\%c", *p);
+        else
+        if ((uchar_t) *p < 0x20)
+            fprintf(stdout, "\\u%04x", (uchar_t) *p);
+        else
+            fputc(*p, stdout);
+    }
+    fputc('"', stdout);
+}
+
+// stev: the samples are printed out in increasing
+// order, since 'bench_run' is sorting them
+
+static void bench_print_json(
+    const struct bench_t* bench,
+    const char* name,
+    const char* file,
+    const struct bench_result_t* result)
+{
+    const struct options_t* opts = bench->opts;
+    size_t i;
+
+#define JSON_STRING(n, v)                  \
+    do {                                   \
+        fputs(",\"" n "\":", stdout);      \
+        bench_print_json_string(v);        \
+    } while (0)
+
+    fputs("{\"module\":", stdout);
+    bench_print_json_string(name);
+    JSON_STRING("unit", bench->unit);
+    JSON_STRING("commit", BENCH_COMMIT);
+    JSON_STRING("build", BENCH_BUILD);
+    JSON_STRING("compiler", "gcc " __VERSION__);
+    JSON_STRING("cpu", bench->cpu);
+    JSON_STRING("input", file);
+    fprintf(stdout,
+        ",\"size\":%zu"
+        ",\"warm_up\":%zu"
+        ",\"iterations\":%zu"
+        ",\"time\":%lld"
+        ",\"ns\":%.4f"
+        ",\"samples\":[",
+        bench->units,
+        opts->warm_up,
+        bench->n_samples,
+        (long long) bench->time,
+        result->ns);
+    for (i = 0; i < bench->n_samples; i ++)
+        fprintf(stdout, "%s%.4f", i ? "," : "",
+            bench->samples[i]);
+    fputs("]}\n", stdout);
+}
+
+struct bench_record_t
+{
+    char*   module;
+    char*   unit;
+    double* samples;
+    size_t  n_samples;
+};
+
+struct bench_records_t
+{
+    struct bench_record_t* ptr;
+    size_t size;
+    size_t max;
+};
+
+// stev: the JSON lines parsed below are those printed
+// out by 'bench_print_json': the parsing is therefore
+// not general -- it only extracts the needed values
+
+static char* bench_json_string(
+    const char* line, const char* name)
+{
+    const char *p, *q;
+    char* k;
+
+    if (asprintf(&k, "\"%s\":\"", name) < 0)
+        error("asprintf failed");
+
+    p = strstr(line, k);
+    if (p != NULL) {
+        p += strlen(k);
+        for (q = p; *q && *q != '"'; q ++)
+            if (*q == '\\' && q[1]) q ++;
+    }
+    free(k);
+
+    if (p == NULL || *q != '"')
+        return NULL;
+
+    k = strndup(p, PTR_DIFF(q, p));
+    ASSERT(k != NULL);
+    return k;
+}
+
+static size_t bench_json_samples(
+    const char* line, double** samples)
+{
+    static const char key[] = "\"samples\":[";
+    const char* p;
+    size_t n = 0, m = 0;
+    double* s = NULL;
+    char* e;
+
+    if (!(p = strstr(line, key)))
+        return 0;
+    p += sizeof(key) - 1;
+
+    while (*p != ']') {
+        double v = strtod(p, &e);
+
+        if (e == p || (*e != ',' && *e != ']')) {
+            free(s);
+            return 0;
+        }
+        if (n == m) {
+            m = m ? 2 * m : 32;
+            s = realloc(s, m * sizeof(*s));
+            ASSERT(s != NULL);
+        }
+        s[n ++] = v;
+
+        p = *e == ',' ? e + 1 : e;
+    }
+
+    *samples = s;
+    return n;
+}
+
+static void bench_record_done(
+    struct bench_record_t* rec)
+{
+    free(rec->samples);
+    free(rec->unit);
+    free(rec->module);
+}
+
+// stev: of the records of a same module, the
+// last one in the file replaces the previous
+
+static void bench_records_load(
+    struct bench_records_t* recs,
+    const char* file)
+{
+    char* l = NULL;
+    size_t n = 0, k = 0;
+    ssize_t r;
+    FILE* f;
+
+    memset(recs, 0, sizeof(*recs));
+
+    if (!(f = fopen(file, "r")))
+        error("%s: open error: %s",
+            file, strerror(errno));
+
+    while ((r = getline(&l, &n, f)) > 0) {
+        struct bench_record_t e, *p;
+        size_t i;
+
+        k ++;
+        e.module = bench_json_string(l, "module");
+        e.unit = bench_json_string(l, "unit");
+        e.n_samples = bench_json_samples(l, &e.samples);
+
+        if (e.module == NULL ||
+            e.unit == NULL ||
+            e.n_samples == 0)
+            error("%s:%zu: invalid record", file, k);
+
+        for (i = 0, p = recs->ptr; i < recs->size; i ++, p ++)
+            if (!strcmp(p->module, e.module))
+                break;
+        if (i < recs->size)
+            bench_record_done(p);
+        else {
+            if (recs->size == recs->max) {
+                recs->max = recs->max ? 2 * recs->max : 16;
+                recs->ptr = realloc(recs->ptr,
+                    recs->max * sizeof(*recs->ptr));
+                ASSERT(recs->ptr != NULL);
+            }
+            p = recs->ptr + recs->size ++;
+        }
+        *p = e;
+    }
+
+    free(l);
+    fclose(f);
+
+    if (recs->size == 0)
+        error("%s: no records found", file);
+}
+
+static void bench_records_done(
+    struct bench_records_t* recs)
+{
+    size_t i;
+
+    for (i = 0; i < recs->size; i ++)
+        bench_record_done(recs->ptr + i);
+    free(recs->ptr);
+}
+
+struct bench_rank_t
+{
+    double value;
+    bool   first;
+};
+
+static int bench_compare_ranks(
+    const void* a, const void* b)
+{
+    double x = ((const struct bench_rank_t*) a)->value;
+    double y = ((const struct bench_rank_t*) b)->value;
+
+    return (x > y) - (x < y);
+}
+
+// stev: the two-sided Mann-Whitney U test by the
+// normal approximation, with continuity and ties
+// corrections; returns the p-value and stores in
+// 'u' the U statistic of the first sample
+
+static double bench_mann_whitney(
+    const double* x, size_t n,
+    const double* y, size_t m,
+    double* u)
+{
+    const size_t l = n + m;
+    struct bench_rank_t* a;
+    double r = 0, t = 0, d, v, z;
+    size_t i, j, k;
+
+    ASSERT(n > 0 && m > 0);
+
+    a = malloc(l * sizeof(*a));
+    ASSERT(a != NULL);
+
+    for (i = 0; i < n; i ++)
+        a[i] = (struct bench_rank_t) { x[i], true };
+    for (i = 0; i < m; i ++)
+        a[n + i] = (struct bench_rank_t) { y[i], false };
+
+    qsort(a, l, sizeof(*a), bench_compare_ranks);
+
+    // stev: the tied values get the mean of the
+    // ranks they span; ranks are 1-based
+    for (i = 0; i < l; i = j) {
+        for (j = i + 1; j < l && a[j].value == a[i].value; j ++);
+        d = (i + 1 + j) / 2.0;
+        for (k = i; k < j; k ++)
+            if (a[k].first) r += d;
+        d = j - i;
+        t += d * d * d - d;
+    }
+    free(a);
+
+    *u = r - n * (n + 1) / 2.0;
+
+    v = n * m / 12.0 * ((l + 1) - t / (l * (l - 1.0)));
+    if (l < 2 || v <= 0)
+        return 1;
+
+    d = *u - n * m / 2.0;
+    z = (fabs(d) - 0.5) / sqrt(v);
+    if (z < 0)
+        z = 0;
+
+    return erfc(z / M_SQRT2);
+}
+
+static double bench_median(
+    const double* samples, size_t n)
+{
+    double* s;
+    double r;
+
+    ASSERT(n > 0);
+
+    s = malloc(n * sizeof(*s));
+    ASSERT(s != NULL);
+    memcpy(s, samples, n * sizeof(*s));
+
+    qsort(s, n, sizeof(*s), bench_compare_samples);
+    r = n % 2 ? s[n / 2] : (s[n / 2 - 1] + s[n / 2]) / 2;
+
+    free(s);
+    return r;
+}
+
+// stev: a module is flagged as regressed when its
+// samples differ significantly and the median time
+// per unit increased by more than the threshold
+
+static int bench_compare(
+    const struct options_t* opts)
+{
+    struct bench_records_t a, b;
+    size_t i, j, k = 0, f = 0;
+
+    bench_records_load(&a, opts->compare_files[0]);
+    bench_records_load(&b, opts->compare_files[1]);
+
+    for (i = 0; i < b.size; i ++) {
+        const struct bench_record_t *o = NULL, *n = b.ptr + i;
+        double m0, m1, c, p, u;
+        const char* v = "-";
+
+        for (j = 0; j < a.size; j ++)
+            if (!strcmp(a.ptr[j].module, n->module)) {
+                o = a.ptr + j;
+                break;
+            }
+        if (o == NULL)
+            continue;
+
+        if (strcmp(o->unit, n->unit))
+            error("%s: records of different units: "
+                "'%s' and '%s'", n->module, o->unit,
+                n->unit);
+
+        m0 = bench_median(o->samples, o->n_samples);
+        m1 = bench_median(n->samples, n->n_samples);
+        c = m0 > 0 ? 100 * (m1 - m0) / m0 : 0;
+
+        p = bench_mann_whitney(
+            n->samples, n->n_samples,
+            o->samples, o->n_samples, &u);
+
+        if (100 * p < opts->alpha) {
+            if (c > (double) opts->threshold) {
+                v = "regression";
+                f ++;
+            }
+            else
+            if (c < -(double) opts->threshold)
+                v = "improvement";
+        }
+
+        if (k ++ == 0)
+            fprintf(stdout,
+                "%-8s %10s %10s %8s %8s %8s %s\n",
+                "module", "old-median", "new-median",
+                "change", "U", "p-value", "verdict");
+        fprintf(stdout,
+            "%-8s %10.2f %10.2f %+7.2f%% %8.1f %8.4f %s\n",
+            n->module, m0, m1, c, u, p, v);
+    }
+
+    bench_records_done(&b);
+    bench_records_done(&a);
+
+    if (k == 0)
+        error("no modules in common to compare");
+    if (f > 0)
+        error("%zu parser module(s) regressed", f);
+
+    return 0;
+}
+
+struct bench_range_t
+{
+    const char*  name;
+    code_point_t min;
+    code_point_t max;
+    bool         valid;
+};
+
+static const struct bench_range_t bench_ranges[] = {
+    { "ascii",  0x20u,     0x7eu,     true  },
+    { "c1",     0x80u,     0x9fu,     true  },
+    { "utf8-2", 0xa0u,     0x7ffu,    true  },
+    { "utf8-3", 0x800u,    0xfffdu,   true  },
+    { "utf8-4", 0x10000u,  0x10fffdu, true  },
+    { "beyond", 0x110000u, 0xffffffu, false },
+};
+
+// stev: xorshift64, see George Marsaglia,
+// Xorshift RNGs, Journal of Statistical
+// Software, Vol. 8, Issue 14, Jul 2003
+
+static uint64_t bench_random(uint64_t* state)
+{
+    uint64_t x = *state;
+
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+
+    return *state = x;
+}
+
+// stev: the code points of the valid ranges that
+// are rejected by the parser -- e.g. noncharacters,
+// surrogates and code points of the range 'c1' not
+// having overrides -- are drawn again, such that all
+// references generated do take the same code path
+
+static void bench_unicode_gen(
+    const struct bench_range_t* range,
+    bool hex, char* buf,
+    struct html_cref_refs_t* refs,
+    uint64_t* state)
+{
+    enum { N = 16 };
+    const uint64_t m = range->max - range->min + 1;
+    size_t i;
+
+    for (i = 0; i < refs->size; i ++) {
+        char* b = buf + i * N;
+        const char* q;
+        code_point_t v, c;
+        bool r;
+
+        do {
+            v = range->min + bench_random(state) % m;
+            snprintf(b, N, hex ? "&#x%X;" : "&#%u;", v);
+            q = b + 2;
+            r = html_cref_unicode_parse_html(&q, &c) &&
+                *q == ';';
+        } while (r != range->valid);
+
+        refs->ptr[i] = b + 2;
+    }
+}
+
+static int bench_unicode(
+    const struct options_t* opts)
+{
+    struct html_cref_refs_t refs;
+    uint64_t s = UINT64_C(0x9e3779b97f4a7c15);
+    struct bench_result_t r;
+    struct bench_t bench;
+    size_t i, j, k = 0;
+    char c[128], n[16];
+    char* b;
+
+    b = malloc(SIZE_MUL(opts->unicode, SZ(16)));
+    ASSERT(b != NULL);
+
+    refs.size = opts->unicode;
+    refs.ptr = malloc(refs.size * sizeof(*refs.ptr));
+    ASSERT(refs.ptr != NULL);
+
+    memset(&bench, 0, sizeof bench);
+    bench.opts = opts;
+    bench.refs = &refs;
+    bench.pass = bench_unicode_pass;
+    bench.unit = "ref";
+    bench.units = refs.size;
+    bench.cpu = cpu_info_model_name(c, sizeof c)
+        ? c : "";
+    bench.time = time(NULL);
+    bench.n_samples = opts->iterations;
+    bench.samples = malloc(
+        bench.n_samples * sizeof(*bench.samples));
+    ASSERT(bench.samples != NULL);
+
+    for (i = 0; i < ARRAY_SIZE(bench_ranges); i ++) {
+        for (j = 0; j < 2; j ++) {
+            bench_unicode_gen(&bench_ranges[i],
+                j, b, &refs, &s);
+            bench_run(&bench, NULL, &r);
+
+            snprintf(n, sizeof n, "%s/%c",
+                bench_ranges[i].name, j ? 'x' : 'd');
+            if (opts->json_lines)
+                bench_print_json(&bench, n,
+                    "unicode", &r);
+            else {
+                if (k ++ == 0)
+                    bench_print_head(opts);
+                bench_print_result(n, &r, NULL);
+            }
+        }
+    }
+
+    free(bench.samples);
+    free(refs.ptr);
+    free(b);
+
+    return 0;
+}
+
+// stev: the synthetic text is made of words followed
+// by spaces and of char references -- drawn from the
+// fixed sets below --, such that the char references
+// make up 'density' percents of the bytes of the text;
+// returns the number of char references generated
+
+static size_t bench_roofline_gen(
+    char* buf, size_t len, size_t density,
+    uint64_t* state)
+{
+    static const char* const refs[] = {
+        "&amp;", "&lt;", "&gt;", "&quot;", "&nbsp;",
+        "&copy;", "&eacute;", "&hellip;", "&mdash;",
+        "&rarr;", "&#233;", "&#x2014;", "&#8364;",
+        "&#x1F600;"
+    };
+    static const char* const words[] = {
+        "the ", "of ", "and ", "to ", "in ", "is ",
+        "that ", "for ", "it ", "with ", "as ", "was ",
+        "on ", "page ", "data ", "text ", "price ",
+        "search ", "home ", "contact ", "news "
+    };
+    size_t k = 0, r = 0, n = 0;
+
+    while (k < len) {
+        const char* w;
+        size_t l;
+        bool b;
+
+        b = r * 100 < density * (k + 1);
+        w = b
+            ? refs[bench_random(state) % ARRAY_SIZE(refs)]
+            : words[bench_random(state) % ARRAY_SIZE(words)];
+
+        l = strlen(w);
+        if (l > len - k)
+            l = len - k;
+        else
+        if (b)
+            n ++;
+
+        memcpy(buf + k, w, l);
+        if (b)
+            r += l;
+        k += l;
+    }
+    buf[len] = 0;
+
+    return n;
+}
+
+struct bench_module_t
+{
+    char*                     name;
+    struct module_lib_t       lib;
+    struct module_lib_funcs_t funcs;
+};
+
+static void bench_roofline_print(
+    const struct bench_t* bench,
+    const char* name, size_t density,
+    const struct bench_result_t* result)
+{
+    char n[64];
+
+    if (bench->opts->json_lines) {
+        snprintf(n, sizeof n, "%s/%zu",
+            name, density);
+        bench_print_json(bench, n,
+            "roofline", result);
+    }
+    else
+        fprintf(stdout, " %8.2f",
+            result->median > 0
+            ? 1 / result->median : 0);
+}
+
+// stev: the GB/s printed out are computed from
+// the medians of the nanoseconds spent per byte
+
+static int bench_roofline(
+    const struct options_t* opts)
+{
+    const size_t l = opts->sponge_max;
+    uint64_t s = UINT64_C(0x9e3779b97f4a7c15);
+    struct bench_module_t* m;
+    struct bench_result_t r;
+    struct bench_t bench;
+    size_t i, j, k = 0;
+    const char *p, *q;
+    char c[128], *b;
+
+    m = malloc(strlen(opts->cref_parsers) * sizeof(*m));
+    ASSERT(m != NULL);
+
+    for (p = opts->cref_parsers; *p; p = q) {
+        for (; *p == ' '; p ++);
+        for (q = p; *q && *q != ' '; q ++);
+        if (q == p)
+            continue;
+
+        m[k].name = strndup(p, PTR_DIFF(q, p));
+        ASSERT(m[k].name != NULL);
+
+        if (module_lib_load(&m[k].lib, m[k].name,
+                &m[k].funcs))
+            k ++;
+        else
+            free(m[k].name);
+    }
+    if (k == 0)
+        error("no parser module could be loaded");
+
+    b = malloc(l + 1);
+    ASSERT(b != NULL);
+
+    memset(&bench, 0, sizeof bench);
+    bench.opts = opts;
+    bench.unit = "byte";
+    bench.units = l;
+    bench.buf = b;
+    bench.len = l;
+    bench.dst = malloc(l);
+    ASSERT(bench.dst != NULL);
+    bench.out = fopen("/dev/null", "w");
+    if (bench.out == NULL)
+        error("/dev/null: open error: %s",
+            strerror(errno));
+    bench.cpu = cpu_info_model_name(c, sizeof c)
+        ? c : "";
+    bench.time = time(NULL);
+    bench.n_samples = opts->iterations;
+    bench.samples = malloc(
+        bench.n_samples * sizeof(*bench.samples));
+    ASSERT(bench.samples != NULL);
+
+    if (!opts->json_lines) {
+        fprintf(stdout, "%-7s %9s %8s %8s",
+            "density", "refs", "memcpy", "memchr");
+        for (j = 0; j < k; j ++)
+            fprintf(stdout, " %8s", m[j].name);
+        fputc('\n', stdout);
+    }
+
+    for (i = 0; i < opts->n_densities; i ++) {
+        const size_t d = opts->densities[i];
+        const size_t n = bench_roofline_gen(
+            b, l, d, &s);
+
+        if (!opts->json_lines)
+            fprintf(stdout, "%6zu%% %9zu", d, n);
+
+        bench.pass = bench_memcpy;
+        bench_run(&bench, NULL, &r);
+        bench_roofline_print(&bench, "memcpy", d, &r);
+
+        bench.pass = bench_memchr;
+        bench_run(&bench, NULL, &r);
+        bench_roofline_print(&bench, "memchr", d, &r);
+
+        bench.pass = bench_subst;
+        for (j = 0; j < k; j ++) {
+            bench.table = m[j].funcs.table;
+            bench.table_size = m[j].funcs.table_size;
+            bench_run(&bench, m[j].funcs.parse, &r);
+            bench_roofline_print(&bench, m[j].name, d, &r);
+        }
+
+        if (!opts->json_lines)
+            fputc('\n', stdout);
+    }
+
+    for (j = 0; j < k; j ++) {
+        module_lib_done(&m[j].lib);
+        free(m[j].name);
+    }
+    free(bench.samples);
+    fclose(bench.out);
+    free(bench.dst);
+    free(b);
+    free(m);
+
+    return 0;
+}
+
+static void bench_escape(
+    struct bench_t* bench)
+{
+    const struct {
+        const char*       name;
+        bench_pass_func_t pass;
+    } e[] = {
+        { "naive",
+          bench_escape_naive },
+        { html_cref_simd_name(
+            html_cref_simd_variant()),
+          bench_escape_simd },
+    };
+    struct bench_result_t r;
+    size_t i;
+
+    bench->dst = malloc(
+        HTML_CREF_ESCAPE_SIZE(bench->len));
+    ASSERT(bench->dst != NULL);
+
+    for (i = 0; i < ARRAY_SIZE(e); i ++) {
+        bench->pass = e[i].pass;
+        bench_run(bench, NULL, &r);
+
+        if (bench->opts->json_lines)
+            bench_print_json(bench, e[i].name,
+                bench->opts->input_file, &r);
+        else {
+            if (i == 0)
+                bench_print_head(bench->opts);
+            bench_print_result(e[i].name, &r, NULL);
+        }
+    }
+
+    free(bench->dst);
+    bench->dst = NULL;
+}
+
+int main(int argc, char* argv[])
+{
+    const struct options_t* opts =
+        options(argc, argv);
+    struct html_cref_refs_t refs = {
+        .ptr = NULL, .size = 0
+    };
+    struct file_buf_t buf, base_buf;
+    struct bench_t bench, base;
+    const char *p, *q;
+    size_t k = 0, f = 0;
+    char c[128];
+
+    if (opts->compare)
+        return bench_compare(opts);
+    if (opts->unicode)
+        return bench_unicode(opts);
+    if (opts->roofline)
+        return bench_roofline(opts);
+
+    file_buf_init(&buf, opts->input_file,
+        opts->sponge_max);
+    if (buf.error_info.type != file_buf_error_none)
+        input_error(&buf);
+
+    if (!opts->throughput && !opts->escape) {
+        html_cref_refs_init(&refs,
+            PTR_CHAR_CAST(buf.ptr), buf.size);
+        if (refs.size == 0)
+            error("%s: no named char references found",
+                opts->input_file);
+    }
+    else
+    if (buf.size == 0)
+        error("%s: input file is empty",
+            opts->input_file);
+
+    memset(&bench, 0, sizeof bench);
+    bench.opts = opts;
+    bench.refs = &refs;
+    bench.pass = opts->throughput
+        ? bench_scan : bench_pass;
+    bench.unit = opts->throughput || opts->escape
+        ? "byte" : "ref";
+    bench.units = opts->throughput || opts->escape
+        ? buf.size : refs.size;
+    bench.buf = PTR_CHAR_CAST(buf.ptr);
+    bench.len = buf.size;
+    bench.cpu = cpu_info_model_name(c, sizeof c)
+        ? c : "";
+    bench.time = time(NULL);
+    bench.n_samples = opts->iterations;
+    bench.samples = malloc(
+        bench.n_samples * sizeof(*bench.samples));
+    ASSERT(bench.samples != NULL);
+
+    if (opts->baseline != NULL) {
+        file_buf_init(&base_buf, opts->baseline,
+            opts->sponge_max);
+        if (base_buf.error_info.type != file_buf_error_none)
+            input_error(&base_buf);
+        if (base_buf.size == 0)
+            error("%s: baseline file is empty",
+                opts->baseline);
+
+        base = bench;
+        base.buf = PTR_CHAR_CAST(base_buf.ptr);
+        base.len = base_buf.size;
+        base.units = base_buf.size;
+        base.samples = malloc(
+            base.n_samples * sizeof(*base.samples));
+        ASSERT(base.samples != NULL);
+    }
+
+    if (opts->escape) {
+        bench_escape(&bench);
+        free(bench.samples);
+        file_buf_done(&buf);
+        return 0;
+    }
+
+    if (opts->cold)
+        bench_thrash_init();
+
+    for (p = opts->cref_parsers; *p; p = q) {
+        struct module_lib_funcs_t l;
+        struct bench_result_t r, b;
+        struct module_lib_t lib;
+        char* n;
+
+        for (; *p == ' '; p ++);
+        for (q = p; *q && *q != ' '; q ++);
+        if (q == p)
+            continue;
+
+        n = strndup(p, PTR_DIFF(q, p));
+        ASSERT(n != NULL);
+
+        if (module_lib_load(&lib, n, &l)) {
+#ifdef BENCH_FOOTPRINT
+            if (opts->footprint) {
+                struct bench_footprint_t t;
+
+                bench_footprint(&bench, l.parse, &t);
+                if (k == 0)
+                    bench_print_footprint_head();
+                bench_print_footprint(n, &t);
+                module_lib_done(&lib);
+                free(n);
+                k ++;
+                continue;
+            }
+#endif
+            bench.table = base.table = l.table;
+            bench.table_size = base.table_size = l.table_size;
+            bench_run(&bench, l.parse, &r);
+            if (opts->baseline != NULL)
+                bench_run(&base, l.parse, &b);
+            if (opts->json_lines)
+                bench_print_json(&bench, n,
+                    opts->input_file, &r);
+            else {
+                if (k == 0)
+                    bench_print_head(opts);
+                bench_print_result(n, &r,
+                    opts->baseline != NULL ? &b : NULL);
+            }
+            if (opts->min_ratio &&
+                bench_ratio(&r, &b) < opts->min_ratio) {
+                fflush(stdout);
+                fprintf(stderr,
+                    "%s: warning: %s: throughput ratio "
+                    "below %zu%%\n",
+                    program, n, opts->min_ratio);
+                f ++;
+            }
+            module_lib_done(&lib);
+            k ++;
+        }
+        free(n);
+    }
+
+    if (opts->baseline != NULL) {
+        free(base.samples);
+        file_buf_done(&base_buf);
+    }
+    if (opts->cold)
+        bench_thrash_done();
+    free(bench.samples);
+    html_cref_refs_done(&refs);
+    file_buf_done(&buf);
+
+    if (k == 0)
+        error("no parser module could be loaded");
+    if (f > 0)
+        error("%zu parser module(s) below the minimum "
+            "throughput ratio", f);
+
+    return 0;
+}
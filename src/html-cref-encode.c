@@ -0,0 +1,226 @@
+// Copyright (C) 2019  Stefan Vargyas
+// 
+// This file is part of Html-Cref.
+// 
+// Html-Cref is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// 
+// Html-Cref is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+// 
+// You should have received a copy of the GNU General Public License
+// along with Html-Cref.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "config.h"
+
+#include <stddef.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "common.h"
+#include "ptr-traits.h"
+#include "char-traits.h"
+
+#include "html-cref-table.h"
+#include "html-cref-encode.h"
+
+// stev: the entries are sorted by their code points;
+// 'slots' is an open addressing hash table, keyed by
+// the first code point of the entries, of which non-
+// zero elements are indices plus one in 'buckets';
+// a bucket is the range of the entries that have the
+// same first code point -- the one of the entry with
+// one code point, if any, being the first in range
+
+struct html_cref_encode_bucket_t
+{
+    code_point_t code;
+    size_t       first;
+    size_t       count;
+};
+
+struct html_cref_encode_t
+{
+    struct html_cref_encode_entry_t*
+            entries;
+    struct html_cref_encode_bucket_t*
+            buckets;
+    size_t* slots;
+    size_t  mask;
+    size_t  n_entries;
+    size_t  n_buckets;
+};
+
+static struct html_cref_encode_t html_cref_encode;
+
+static inline size_t html_cref_encode_hash(
+    code_point_t c)
+{
+    // stev: Knuth's multiplicative hashing
+    return (c * 2654435761u) >> 8;
+}
+
+static int html_cref_encode_compare(
+    const void* a, const void* b)
+{
+    const struct html_cref_encode_entry_t* x = a;
+    const struct html_cref_encode_entry_t* y = b;
+    bool u, v;
+
+    if (x->code[0] != y->code[0])
+        return x->code[0] < y->code[0] ? -1 : 1;
+    if (x->code[1] != y->code[1])
+        return x->code[1] < y->code[1] ? -1 : 1;
+    if (x->len != y->len)
+        return x->len < y->len ? -1 : 1;
+
+    u = CHAR_IS_LOWER(*x->name);
+    v = CHAR_IS_LOWER(*y->name);
+    if (u != v)
+        return u ? -1 : 1;
+
+    return strcmp(x->name, y->name);
+}
+
+void html_cref_encode_init(void)
+{
+    const size_t mask = SZ(1) << 7;
+    struct html_cref_encode_t* r = &html_cref_encode;
+    struct html_cref_encode_entry_t *e, *f;
+    const uchar_t *t, *p, *q;
+    size_t i, j, k, n;
+
+    memset(r, 0, sizeof(*r));
+
+    r->entries = malloc(html_cref_table_n_names *
+        sizeof(*r->entries));
+    ASSERT(r->entries != NULL);
+
+    for (i = 0, t = html_cref_table;
+         i < html_cref_table_n_names;
+         i ++, t += t[1] + 2) {
+        ASSERT(PTR_DIFF(t, html_cref_table) <
+            html_cref_table_size);
+
+        e = &r->entries[i];
+        e->name = html_cref_table_names[i];
+        e->len = *t & ~mask;
+        ASSERT(strlen(e->name) == e->len);
+
+        for (j = 0,
+             p = t + 2,
+             q = p + t[1];
+             p < q;
+             p += n, j ++) {
+            ASSERT(j < ARRAY_SIZE(e->code));
+            n = html_cref_unicode_decode_utf8(
+                    PTR_CHAR_CAST_CONST(p),
+                    PTR_DIFF(q, p),
+                    &e->code[j]);
+            ASSERT(n > 0);
+        }
+        ASSERT(j > 0);
+        if (j < 2)
+            e->code[1] = 0;
+    }
+    ASSERT(PTR_DIFF(t, html_cref_table) ==
+        html_cref_table_size);
+
+    qsort(r->entries, html_cref_table_n_names,
+        sizeof(*r->entries),
+        html_cref_encode_compare);
+
+    // stev: keep the preferred entry of each
+    // sequence of code points, that is the
+    // first of the entries of the sequence
+    for (e = r->entries,
+         f = e + html_cref_table_n_names,
+         n = 0;
+         e < f;
+         e ++) {
+        if (n > 0 &&
+            r->entries[n - 1].code[0] == e->code[0] &&
+            r->entries[n - 1].code[1] == e->code[1])
+            continue;
+        r->entries[n ++] = *e;
+    }
+    r->n_entries = n;
+
+    r->buckets = malloc(n * sizeof(*r->buckets));
+    ASSERT(r->buckets != NULL);
+
+    for (i = 0; i < n; i = j) {
+        for (j = i + 1; j < n &&
+             r->entries[j].code[0] ==
+             r->entries[i].code[0]; j ++);
+
+        r->buckets[r->n_buckets ++] =
+            (struct html_cref_encode_bucket_t) {
+                .code  = r->entries[i].code[0],
+                .first = i,
+                .count = j - i
+            };
+    }
+
+    for (k = 2; k < 2 * r->n_buckets; k *= 2);
+    r->slots = calloc(k, sizeof(*r->slots));
+    ASSERT(r->slots != NULL);
+    r->mask = k - 1;
+
+    for (i = 0; i < r->n_buckets; i ++) {
+        for (k = html_cref_encode_hash(
+                r->buckets[i].code) & r->mask;
+             r->slots[k];
+             k = (k + 1) & r->mask);
+        r->slots[k] = i + 1;
+    }
+}
+
+void html_cref_encode_done(void)
+{
+    free(html_cref_encode.slots);
+    free(html_cref_encode.buckets);
+    free(html_cref_encode.entries);
+}
+
+const struct html_cref_encode_entry_t*
+    html_cref_encode_lookup(
+        code_point_t c, code_point_t next)
+{
+    const struct html_cref_encode_t* r = &html_cref_encode;
+    const struct html_cref_encode_bucket_t* b;
+    const struct html_cref_encode_entry_t *p, *e;
+    size_t k, i;
+
+    ASSERT(r->slots != NULL);
+
+    for (k = html_cref_encode_hash(c) & r->mask;
+         r->slots[k];
+         k = (k + 1) & r->mask) {
+        b = &r->buckets[r->slots[k] - 1];
+        if (b->code != c)
+            continue;
+
+        p = r->entries + b->first;
+        e = p + b->count;
+
+        // stev: the entry with one code point
+        // -- if any -- is the first in bucket
+        if (next) {
+            for (i = p->code[1] ? 0 : 1;
+                 p + i < e;
+                 i ++) {
+                if (p[i].code[1] == next)
+                    return p + i;
+            }
+        }
+        return p->code[1] ? NULL : p;
+    }
+    return NULL;
+}
+
@@ -0,0 +1,54 @@
+// Copyright (C) 2019  Stefan Vargyas
+// 
+// This file is part of Html-Cref.
+// 
+// Html-Cref is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// 
+// Html-Cref is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+// 
+// You should have received a copy of the GNU General Public License
+// along with Html-Cref.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef __HTML_CREF_ENCODE_H
+#define __HTML_CREF_ENCODE_H
+
+#include <stddef.h>
+
+#include "html-cref-unicode.h"
+
+// stev: the reverse index of 'html_cref_table' maps
+// sequences of one or two code points to the names
+// of the named char references that stand for them;
+// of several names of the same sequence, the index
+// keeps the preferred one: the shortest, and among
+// those of equal length, the one starting with a
+// lower case letter -- e.g. 'amp' over 'AMP' --;
+// the second code point of the entries with one code
+// point is zero
+
+struct html_cref_encode_entry_t
+{
+    code_point_t code[2];
+    const char*  name;
+    size_t       len;
+};
+
+void html_cref_encode_init(void);
+void html_cref_encode_done(void);
+
+// stev: return the entry of the sequence made of 'c'
+// and 'next' if there is such an entry, otherwise the
+// entry of 'c' alone, or NULL if there is none
+
+const struct html_cref_encode_entry_t*
+    html_cref_encode_lookup(
+        code_point_t c, code_point_t next);
+
+#endif /* __HTML_CREF_ENCODE_H */
+
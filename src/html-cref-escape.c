@@ -0,0 +1,86 @@
+// Copyright (C) 2019  Stefan Vargyas
+// 
+// This file is part of Html-Cref.
+// 
+// Html-Cref is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// 
+// Html-Cref is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+// 
+// You should have received a copy of the GNU General Public License
+// along with Html-Cref.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "config.h"
+
+#include <stddef.h>
+#include <string.h>
+
+#include "common.h"
+#include "ptr-traits.h"
+
+#include "html-cref-simd.h"
+#include "html-cref-escape.h"
+
+// stev: the replacement text of each significant char,
+// preceded by its length; the rows are wide enough for
+// a fixed-size copy of 'html_cref_escape_max' chars, no
+// matter which the char is
+
+static const char
+html_cref_escape_table[256][html_cref_escape_max + 2] = {
+    ['&']  = "\5&amp;",
+    ['<']  = "\4&lt;",
+    ['>']  = "\4&gt;",
+    ['"']  = "\6&quot;",
+    ['\''] = "\5&#39;",
+};
+
+// stev: the buffer has room for 'html_cref_escape_max'
+// chars for each of the chars not yet escaped, thus the
+// fixed-size copy of a replacement never overflows it
+
+const char* html_cref_escape(
+    const char* ptr, size_t n,
+    char* buf, size_t* len)
+{
+    const char *p = ptr, *q, *e = ptr + n;
+    const char* r;
+    char* b = buf;
+    size_t l;
+
+    ASSERT(ptr != NULL || n == 0);
+    ASSERT(len != NULL);
+
+    if (!(q = html_cref_simd_find_escape(p, n))) {
+        *len = n;
+        return ptr;
+    }
+
+    ASSERT(buf != NULL);
+    do {
+        l = PTR_DIFF(q, p);
+        memcpy(b, p, l);
+        b += l;
+
+        r = html_cref_escape_table[(uchar_t) *q];
+        ASSERT(*r > 0);
+        memcpy(b, r + 1, html_cref_escape_max);
+        b += *r;
+
+        p = q + 1;
+    } while ((q = html_cref_simd_find_escape(
+                p, PTR_DIFF(e, p))));
+
+    l = PTR_DIFF(e, p);
+    memcpy(b, p, l);
+    b += l;
+
+    *len = PTR_DIFF(b, buf);
+    return buf;
+}
+
@@ -0,0 +1,51 @@
+// Copyright (C) 2019  Stefan Vargyas
+// 
+// This file is part of Html-Cref.
+// 
+// Html-Cref is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// 
+// Html-Cref is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+// 
+// You should have received a copy of the GNU General Public License
+// along with Html-Cref.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef __HTML_CREF_ESCAPE_H
+#define __HTML_CREF_ESCAPE_H
+
+#include <stddef.h>
+
+// stev: the chars that are significant in HTML text and
+// in quoted attribute values are '&', '<', '>', '"' and
+// '\''; each of them is escaped by a char reference of
+// at most 'html_cref_escape_max' chars: '&amp;', '&lt;',
+// '&gt;', '&quot;' and '&#39;' -- the latter instead of
+// '&apos;', which HTML 4 does not know of
+
+enum { html_cref_escape_max = 6 };
+
+// stev: the size of a buffer that is large enough for
+// the escaped text of any 'n' chars
+
+#define HTML_CREF_ESCAPE_SIZE(n) \
+    (SIZE_MUL(n, (size_t) html_cref_escape_max))
+
+// stev: escape the significant chars among the 'n'
+// chars at 'p': when there is none, return 'p' itself
+// -- no char gets copied --, otherwise write out the
+// escaped text into 'buf' -- of which size must be at
+// least 'HTML_CREF_ESCAPE_SIZE(n)' -- and return 'buf';
+// in either case, store the length of the text that
+// is returned into '*len'
+
+const char* html_cref_escape(
+    const char* p, size_t n,
+    char* buf, size_t* len);
+
+#endif /* __HTML_CREF_ESCAPE_H */
+
@@ -0,0 +1,16611 @@
+// Copyright (C) 2019  Stefan Vargyas
+// 
+// This file is part of Html-Cref.
+// 
+// Html-Cref is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// 
+// Html-Cref is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+// 
+// You should have received a copy of the GNU General Public License
+// along with Html-Cref.  If not, see <http://www.gnu.org/licenses/>.
+
+//
+// This file was generated by a command like:
+// $ html-cref-gen --gen-ftrie-func --heading
+//
+
+static int html_cref_ftrie_cold_1(const char* p, int r)
+    __attribute__ ((cold, noinline));
+
+static int html_cref_ftrie_cold_1(const char* p, int r)
+{
+    switch (*p ++) {
+    case 'a':
+        switch (*p ++) {
+        case 'c':
+            if (*p ++ == 'r') {
+                return 2964;
+            }
+            return r;
+        case 'l':
+            if (*p ++ == 'g') {
+                return 2968;
+            }
+            return r;
+        }
+        return r;
+    }
+    return r;
+}
+
+static int html_cref_ftrie_cold_2(const char* p, int r)
+    __attribute__ ((cold, noinline));
+
+static int html_cref_ftrie_cold_2(const char* p, int r)
+{
+    switch (*p ++) {
+    case 'E':
+        return 3105;
+    case 'a':
+        if (*p ++ == 'c' &&
+            *p ++ == 'i' &&
+            *p ++ == 'r') {
+            return 3110;
+        }
+        return r;
+    case 'e':
+        return 3115;
+    case 'i':
+        if (*p ++ == 'd') {
+            return 3120;
+        }
+        return r;
+    case 'p':
+        if (*p ++ == 'r' &&
+            *p ++ == 'o' &&
+            *p ++ == 'x') {
+            r = 3128;
+            if (*p ++ == 'e' &&
+                *p ++ == 'q') {
+                return 3133;
+            }
+            return r;
+        }
+        return r;
+    }
+    return r;
+}
+
+static int html_cref_ftrie_cold_3(const char* p, int r)
+    __attribute__ ((cold, noinline));
+
+static int html_cref_ftrie_cold_3(const char* p, int r)
+{
+    switch (*p ++) {
+    case 'E':
+        return 2907;
+    case 'd':
+        return 2914;
+    case 'u':
+        if (*p ++ == 't' &&
+            *p ++ == 'e') {
+            return 2923;
+        }
+        return r;
+    case 'y':
+        return 2927;
+    }
+    return r;
+}
+
+static int html_cref_ftrie_cold_4(const char* p, int r)
+    __attribute__ ((cold, noinline));
+
+static int html_cref_ftrie_cold_4(const char* p, int r)
+{
+    switch (*p ++) {
+    case 'e':
+        switch (*p ++) {
+        case 'f':
+            if (*p ++ == 's' &&
+                *p ++ == 'y' &&
+                *p ++ == 'm') {
+                return 2950;
+            }
+            return r;
+        case 'p':
+            if (*p ++ == 'h') {
+                return 2955;
+            }
+            return r;
+        }
+        return r;
+    }
+    return r;
+}
+
+static int html_cref_ftrie_cold_5(const char* p, int r)
+    __attribute__ ((cold, noinline));
+
+static int html_cref_ftrie_cold_5(const char* p, int r)
+{
+    switch (*p ++) {
+    case 'b':
+        if (*p ++ == 'r' &&
+            *p ++ == 'e' &&
+            *p ++ == 'v' &&
+            *p ++ == 'e') {
+            return 2898;
+        }
+        return r;
+    case 'e':
+        if (*p ++ == 'l' &&
+            *p ++ == 'i' &&
+            *p ++ == 'g') {
+            return 2931;
+        }
+        return r;
+    case 'f':
+        r = 2935;
+        if (*p ++ == 'r') {
+            return 2940;
+        }
+        return r;
+    case 'n':
+        switch (*p ++) {
+        case 'd':
+            r = 2976;
+            switch (*p ++) {
+            case 'a':
+                if (*p ++ == 'n' &&
+                    *p ++ == 'd') {
+                    return 2981;
+                }
+                return r;
+            case 'd':
+                return 2986;
+            case 's':
+                if (*p ++ == 'l' &&
+                    *p ++ == 'o' &&
+                    *p ++ == 'p' &&
+                    *p ++ == 'e') {
+                    return 2991;
+                }
+                return r;
+            case 'v':
+                return 2996;
+            }
+            return r;
+        case 'g':
+            r = 3001;
+            switch (*p ++) {
+            case 'e':
+                return 3006;
+            case 'l':
+                if (*p ++ == 'e') {
+                    return 3011;
+                }
+                return r;
+            case 'm':
+                if (*p ++ == 's' &&
+                    *p ++ == 'd') {
+                    r = 3016;
+                    if (*p ++ == 'a') {
+                        switch (*p ++) {
+                        case 'a':
+                            return 3021;
+                        case 'b':
+                            return 3026;
+                        case 'c':
+                            return 3031;
+                        case 'd':
+                            return 3036;
+                        case 'e':
+                            return 3041;
+                        case 'f':
+                            return 3046;
+                        case 'g':
+                            return 3051;
+                        case 'h':
+                            return 3056;
+                        }
+                        return r;
+                    }
+                    return r;
+                }
+                return r;
+            case 'r':
+                if (*p ++ == 't') {
+                    r = 3061;
+                    if (*p ++ == 'v' &&
+                        *p ++ == 'b') {
+                        r = 3066;
+                        if (*p ++ == 'd') {
+                            return 3071;
+                        }
+                        return r;
+                    }
+                    return r;
+                }
+                return r;
+            case 's':
+                switch (*p ++) {
+                case 'p':
+                    if (*p ++ == 'h') {
+                        return 3076;
+                    }
+                    return r;
+                case 't':
+                    return 3081;
+                }
+                return r;
+            case 'z':
+                if (*p ++ == 'a' &&
+                    *p ++ == 'r' &&
+                    *p ++ == 'r') {
+                    return 3085;
+                }
+                return r;
+            }
+            return r;
+        }
+        return r;
+    case 'o':
+        switch (*p ++) {
+        case 'g':
+            if (*p ++ == 'o' &&
+                *p ++ == 'n') {
+                return 3090;
+            }
+            return r;
+        case 'p':
+            if (*p ++ == 'f') {
+                return 3094;
+            }
+            return r;
+        }
+        return r;
+    case 'r':
+        if (*p ++ == 'i' &&
+            *p ++ == 'n' &&
+            *p ++ == 'g') {
+            return 3138;
+        }
+        return r;
+    case 's':
+        switch (*p ++) {
+        case 'c':
+            if (*p ++ == 'r') {
+                return 3142;
+            }
+            return r;
+        case 't':
+            return 3148;
+        case 'y':
+            if (*p ++ == 'm' &&
+                *p ++ == 'p') {
+                r = 3151;
+                if (*p ++ == 'e' &&
+                    *p ++ == 'q') {
+                    return 3156;
+                }
+                return r;
+            }
+            return r;
+        }
+        return r;
+    case 't':
+        if (*p ++ == 'i' &&
+            *p ++ == 'l' &&
+            *p ++ == 'd' &&
+            *p ++ == 'e') {
+            return 3161;
+        }
+        return r;
+    case 'w':
+        switch (*p ++) {
+        case 'c':
+            if (*p ++ == 'o' &&
+                *p ++ == 'n' &&
+                *p ++ == 'i' &&
+                *p ++ == 'n' &&
+                *p ++ == 't') {
+                return 3169;
+            }
+            return r;
+        case 'i':
+            if (*p ++ == 'n' &&
+                *p ++ == 't') {
+                return 3174;
+            }
+            return r;
+        }
+        return r;
+    }
+    return r;
+}
+
+static int html_cref_ftrie_cold_6(const char* p, int r)
+    __attribute__ ((cold, noinline));
+
+static int html_cref_ftrie_cold_6(const char* p, int r)
+{
+    switch (*p ++) {
+    case 'u':
+        if (*p ++ == 'm' &&
+            *p ++ == 'p') {
+            r = 6806;
+            if (*p ++ == 'e') {
+                return 6813;
+            }
+            return r;
+        }
+        return r;
+    }
+    return r;
+}
+
+static int html_cref_ftrie_cold_7(const char* p, int r)
+    __attribute__ ((cold, noinline));
+
+static int html_cref_ftrie_cold_7(const char* p, int r)
+{
+    switch (*p ++) {
+    case 'g':
+        if (*p ++ == 'l') {
+            return 7425;
+        }
+        return r;
+    case 'l':
+        if (*p ++ == 'g') {
+            return 7434;
+        }
+        return r;
+    case 'r':
+        if (*p ++ == 'i' &&
+            *p ++ == 'a' &&
+            *p ++ == 'n' &&
+            *p ++ == 'g' &&
+            *p ++ == 'l' &&
+            *p ++ == 'e') {
+            switch (*p ++) {
+            case 'l':
+                if (*p ++ == 'e' &&
+                    *p ++ == 'f' &&
+                    *p ++ == 't') {
+                    r = 7439;
+                    if (*p ++ == 'e' &&
+                        *p ++ == 'q') {
+                        return 7444;
+                    }
+                    return r;
+                }
+                return r;
+            case 'r':
+                if (*p ++ == 'i' &&
+                    *p ++ == 'g' &&
+                    *p ++ == 'h' &&
+                    *p ++ == 't') {
+                    r = 7449;
+                    if (*p ++ == 'e' &&
+                        *p ++ == 'q') {
+                        return 7454;
+                    }
+                    return r;
+                }
+                return r;
+            }
+            return r;
+        }
+        return r;
+    }
+    return r;
+}
+
+static int html_cref_ftrie_cold_8(const char* p, int r)
+    __attribute__ ((cold, noinline));
+
+static int html_cref_ftrie_cold_8(const char* p, int r)
+{
+    switch (*p ++) {
+    case 'A':
+        if (*p ++ == 'r' &&
+            *p ++ == 'r') {
+            return 6864;
+        }
+        return r;
+    case 'a':
+        if (*p ++ == 'r') {
+            switch (*p ++) {
+            case 'h':
+                if (*p ++ == 'k') {
+                    return 6869;
+                }
+                return r;
+            case 'r':
+                r = 6874;
+                if (*p ++ == 'o' &&
+                    *p ++ == 'w') {
+                    return 6879;
+                }
+                return r;
+            }
+            return r;
+        }
+        return r;
+    case 'd':
+        if (*p ++ == 'o' &&
+            *p ++ == 't') {
+            return 6884;
+        }
+        return r;
+    case 'q':
+        if (*p ++ == 'u' &&
+            *p ++ == 'i' &&
+            *p ++ == 'v') {
+            return 6891;
+        }
+        return r;
+    case 's':
+        switch (*p ++) {
+        case 'e':
+            if (*p ++ == 'a' &&
+                *p ++ == 'r') {
+                return 6896;
+            }
+            return r;
+        case 'i':
+            if (*p ++ == 'm') {
+                return 6901;
+            }
+            return r;
+        }
+        return r;
+    case 'x':
+        if (*p ++ == 'i' &&
+            *p ++ == 's' &&
+            *p ++ == 't') {
+            r = 6908;
+            if (*p ++ == 's') {
+                return 6913;
+            }
+            return r;
+        }
+        return r;
+    }
+    return r;
+}
+
+static int html_cref_ftrie_cold_9(const char* p, int r)
+    __attribute__ ((cold, noinline));
+
+static int html_cref_ftrie_cold_9(const char* p, int r)
+{
+    switch (*p ++) {
+    case 'G':
+        switch (*p ++) {
+        case 'g':
+            return 6673;
+        case 't':
+            r = 6680;
+            if (*p ++ == 'v') {
+                return 6688;
+            }
+            return r;
+        }
+        return r;
+    case 'L':
+        switch (*p ++) {
+        case 'e':
+            if (*p ++ == 'f' &&
+                *p ++ == 't') {
+                switch (*p ++) {
+                case 'a':
+                    if (*p ++ == 'r' &&
+                        *p ++ == 'r' &&
+                        *p ++ == 'o' &&
+                        *p ++ == 'w') {
+                        return 6695;
+                    }
+                    return r;
+                case 'r':
+                    if (*p ++ == 'i' &&
+                        *p ++ == 'g' &&
+                        *p ++ == 'h' &&
+                        *p ++ == 't' &&
+                        *p ++ == 'a' &&
+                        *p ++ == 'r' &&
+                        *p ++ == 'r' &&
+                        *p ++ == 'o' &&
+                        *p ++ == 'w') {
+                        return 6700;
+                    }
+                    return r;
+                }
+                return r;
+            }
+            return r;
+        case 'l':
+            return 6705;
+        case 't':
+            r = 6712;
+            if (*p ++ == 'v') {
+                return 6720;
+            }
+            return r;
+        }
+        return r;
+    case 'R':
+        if (*p ++ == 'i' &&
+            *p ++ == 'g' &&
+            *p ++ == 'h' &&
+            *p ++ == 't' &&
+            *p ++ == 'a' &&
+            *p ++ == 'r' &&
+            *p ++ == 'r' &&
+            *p ++ == 'o' &&
+            *p ++ == 'w') {
+            return 6727;
+        }
+        return r;
+    case 'V':
+        switch (*p ++) {
+        case 'D':
+            if (*p ++ == 'a' &&
+                *p ++ == 's' &&
+                *p ++ == 'h') {
+                return 6732;
+            }
+            return r;
+        case 'd':
+            if (*p ++ == 'a' &&
+                *p ++ == 's' &&
+                *p ++ == 'h') {
+                return 6737;
+            }
+            return r;
+        }
+        return r;
+    case 'a':
+        switch (*p ++) {
+        case 'b':
+            if (*p ++ == 'l' &&
+                *p ++ == 'a') {
+                return 6742;
+            }
+            return r;
+        case 'c':
+            if (*p ++ == 'u' &&
+                *p ++ == 't' &&
+                *p ++ == 'e') {
+                return 6747;
+            }
+            return r;
+        case 'n':
+            if (*p ++ == 'g') {
+                return 6751;
+            }
+            return r;
+        case 'p':
+            r = 6759;
+            switch (*p ++) {
+            case 'E':
+                return 6764;
+            case 'i':
+                if (*p ++ == 'd') {
+                    return 6771;
+                }
+                return r;
+            case 'o':
+                if (*p ++ == 's') {
+                    return 6778;
+                }
+                return r;
+            case 'p':
+                if (*p ++ == 'r' &&
+                    *p ++ == 'o' &&
+                    *p ++ == 'x') {
+                    return 6782;
+                }
+                return r;
+            }
+            return r;
+        case 't':
+            if (*p ++ == 'u' &&
+                *p ++ == 'r') {
+                r = 6787;
+                if (*p ++ == 'a' &&
+                    *p ++ == 'l') {
+                    r = 6792;
+                    if (*p ++ == 's') {
+                        return 6797;
+                    }
+                    return r;
+                }
+                return r;
+            }
+            return r;
+        }
+        return r;
+    case 'c':
+        switch (*p ++) {
+        case 'a':
+            switch (*p ++) {
+            case 'p':
+                return 6820;
+            case 'r':
+                if (*p ++ == 'o' &&
+                    *p ++ == 'n') {
+                    return 6825;
+                }
+                return r;
+            }
+            return r;
+        case 'e':
+            if (*p ++ == 'd' &&
+                *p ++ == 'i' &&
+                *p ++ == 'l') {
+                return 6829;
+            }
+            return r;
+        case 'o':
+            if (*p ++ == 'n' &&
+                *p ++ == 'g') {
+                r = 6833;
+                if (*p ++ == 'd' &&
+                    *p ++ == 'o' &&
+                    *p ++ == 't') {
+                    return 6838;
+                }
+                return r;
+            }
+            return r;
+        case 'u':
+            if (*p ++ == 'p') {
+                return 6845;
+            }
+            return r;
+        case 'y':
+            return 6850;
+        }
+        return r;
+    case 'f':
+        if (*p ++ == 'r') {
+            return 6918;
+        }
+        return r;
+    case 'g':
+        switch (*p ++) {
+        case 'E':
+            return 6924;
+        case 'e':
+            r = 6931;
+            switch (*p ++) {
+            case 'q':
+                r = 6936;
+                switch (*p ++) {
+                case 'q':
+                    return 6941;
+                case 's':
+                    if (*p ++ == 'l' &&
+                        *p ++ == 'a' &&
+                        *p ++ == 'n' &&
+                        *p ++ == 't') {
+                        return 6948;
+                    }
+                    return r;
+                }
+                return r;
+            case 's':
+                return 6955;
+            }
+            return r;
+        case 's':
+            if (*p ++ == 'i' &&
+                *p ++ == 'm') {
+                return 6962;
+            }
+            return r;
+        case 't':
+            r = 6967;
+            if (*p ++ == 'r') {
+                return 6972;
+            }
+            return r;
+        }
+        return r;
+    case 'h':
+        switch (*p ++) {
+        case 'A':
+            if (*p ++ == 'r' &&
+                *p ++ == 'r') {
+                return 6977;
+            }
+            return r;
+        case 'a':
+            if (*p ++ == 'r' &&
+                *p ++ == 'r') {
+                return 6982;
+            }
+            return r;
+        case 'p':
+            if (*p ++ == 'a' &&
+                *p ++ == 'r') {
+                return 6987;
+            }
+            return r;
+        }
+        return r;
+    case 'i':
+        r = 6992;
+        switch (*p ++) {
+        case 's':
+            r = 6997;
+            if (*p ++ == 'd') {
+                return 7002;
+            }
+            return r;
+        case 'v':
+            return 7007;
+        }
+        return r;
+    case 'j':
+        if (*p ++ == 'c' &&
+            *p ++ == 'y') {
+            return 7012;
+        }
+        return r;
+    case 'l':
+        switch (*p ++) {
+        case 'A':
+            if (*p ++ == 'r' &&
+                *p ++ == 'r') {
+                return 7016;
+            }
+            return r;
+        case 'E':
+            return 7021;
+        case 'a':
+            if (*p ++ == 'r' &&
+                *p ++ == 'r') {
+                return 7028;
+            }
+            return r;
+        case 'd':
+            if (*p ++ == 'r') {
+                return 7033;
+            }
+            return r;
+        case 'e':
+            r = 7038;
+            switch (*p ++) {
+            case 'f':
+                if (*p ++ == 't') {
+                    switch (*p ++) {
+                    case 'a':
+                        if (*p ++ == 'r' &&
+                            *p ++ == 'r' &&
+                            *p ++ == 'o' &&
+                            *p ++ == 'w') {
+                            return 7043;
+                        }
+                        return r;
+                    case 'r':
+                        if (*p ++ == 'i' &&
+                            *p ++ == 'g' &&
+                            *p ++ == 'h' &&
+                            *p ++ == 't' &&
+                            *p ++ == 'a' &&
+                            *p ++ == 'r' &&
+                            *p ++ == 'r' &&
+                            *p ++ == 'o' &&
+                            *p ++ == 'w') {
+                            return 7048;
+                        }
+                        return r;
+                    }
+                    return r;
+                }
+                return r;
+            case 'q':
+                r = 7053;
+                switch (*p ++) {
+                case 'q':
+                    return 7058;
+                case 's':
+                    if (*p ++ == 'l' &&
+                        *p ++ == 'a' &&
+                        *p ++ == 'n' &&
+                        *p ++ == 't') {
+                        return 7065;
+                    }
+                    return r;
+                }
+                return r;
+            case 's':
+                r = 7072;
+                if (*p ++ == 's') {
+                    return 7079;
+                }
+                return r;
+            }
+            return r;
+        case 's':
+            if (*p ++ == 'i' &&
+                *p ++ == 'm') {
+                return 7084;
+            }
+            return r;
+        case 't':
+            r = 7089;
+            if (*p ++ == 'r' &&
+                *p ++ == 'i') {
+                r = 7094;
+                if (*p ++ == 'e') {
+                    return 7099;
+                }
+                return r;
+            }
+            return r;
+        }
+        return r;
+    case 'm':
+        if (*p ++ == 'i' &&
+            *p ++ == 'd') {
+            return 7104;
+        }
+        return r;
+    case 'o':
+        switch (*p ++) {
+        case 'p':
+            if (*p ++ == 'f') {
+                return 7109;
+            }
+            return r;
+        case 't':
+            r = 7115;
+            switch (*p ++) {
+            case 'i':
+                if (*p ++ == 'n') {
+                    r = 7119;
+                    switch (*p ++) {
+                    case 'E':
+                        return 7124;
+                    case 'd':
+                        if (*p ++ == 'o' &&
+                            *p ++ == 't') {
+                            return 7131;
+                        }
+                        return r;
+                    case 'v':
+                        switch (*p ++) {
+                        case 'a':
+                            return 7138;
+                        case 'b':
+                            return 7143;
+                        case 'c':
+                            return 7148;
+                        }
+                        return r;
+                    }
+                    return r;
+                }
+                return r;
+            case 'n':
+                if (*p ++ == 'i') {
+                    r = 7153;
+                    if (*p ++ == 'v') {
+                        switch (*p ++) {
+                        case 'a':
+                            return 7158;
+                        case 'b':
+                            return 7163;
+                        case 'c':
+                            return 7168;
+                        }
+                        return r;
+                    }
+                    return r;
+                }
+                return r;
+            }
+            return r;
+        }
+        return r;
+    case 'p':
+        switch (*p ++) {
+        case 'a':
+            if (*p ++ == 'r') {
+                r = 7173;
+                switch (*p ++) {
+                case 'a':
+                    if (*p ++ == 'l' &&
+                        *p ++ == 'l' &&
+                        *p ++ == 'e' &&
+                        *p ++ == 'l') {
+                        return 7178;
+                    }
+                    return r;
+                case 's':
+                    if (*p ++ == 'l') {
+                        return 7183;
+                    }
+                    return r;
+                case 't':
+                    return 7191;
+                }
+                return r;
+            }
+            return r;
+        case 'o':
+            if (*p ++ == 'l' &&
+                *p ++ == 'i' &&
+                *p ++ == 'n' &&
+                *p ++ == 't') {
+                return 7198;
+            }
+            return r;
+        case 'r':
+            r = 7203;
+            switch (*p ++) {
+            case 'c':
+                if (*p ++ == 'u' &&
+                    *p ++ == 'e') {
+                    return 7208;
+                }
+                return r;
+            case 'e':
+                r = 7213;
+                if (*p ++ == 'c') {
+                    r = 7220;
+                    if (*p ++ == 'e' &&
+                        *p ++ == 'q') {
+                        return 7225;
+                    }
+                    return r;
+                }
+                return r;
+            }
+            return r;
+        }
+        return r;
+    case 'r':
+        switch (*p ++) {
+        case 'A':
+            if (*p ++ == 'r' &&
+                *p ++ == 'r') {
+                return 7232;
+            }
+            return r;
+        case 'a':
+            if (*p ++ == 'r' &&
+                *p ++ == 'r') {
+                r = 7237;
+                switch (*p ++) {
+                case 'c':
+                    return 7242;
+                case 'w':
+                    return 7249;
+                }
+                return r;
+            }
+            return r;
+        case 'i':
+            if (*p ++ == 'g' &&
+                *p ++ == 'h' &&
+                *p ++ == 't' &&
+                *p ++ == 'a' &&
+                *p ++ == 'r' &&
+                *p ++ == 'r' &&
+                *p ++ == 'o' &&
+                *p ++ == 'w') {
+                return 7256;
+            }
+            return r;
+        case 't':
+            if (*p ++ == 'r' &&
+                *p ++ == 'i') {
+                r = 7261;
+                if (*p ++ == 'e') {
+                    return 7266;
+                }
+                return r;
+            }
+            return r;
+        }
+        return r;
+    case 's':
+        switch (*p ++) {
+        case 'c':
+            r = 7271;
+            switch (*p ++) {
+            case 'c':
+                if (*p ++ == 'u' &&
+                    *p ++ == 'e') {
+                    return 7276;
+                }
+                return r;
+            case 'e':
+                return 7281;
+            case 'r':
+                return 7288;
+            }
+            return r;
+        case 'h':
+            if (*p ++ == 'o' &&
+                *p ++ == 'r' &&
+                *p ++ == 't') {
+                switch (*p ++) {
+                case 'm':
+                    if (*p ++ == 'i' &&
+                        *p ++ == 'd') {
+                        return 7294;
+                    }
+                    return r;
+                case 'p':
+                    if (*p ++ == 'a' &&
+                        *p ++ == 'r' &&
+                        *p ++ == 'a' &&
+                        *p ++ == 'l' &&
+                        *p ++ == 'l' &&
+                        *p ++ == 'e' &&
+                        *p ++ == 'l') {
+                        return 7299;
+                    }
+                    return r;
+                }
+                return r;
+            }
+            return r;
+        case 'i':
+            if (*p ++ == 'm') {
+                r = 7304;
+                if (*p ++ == 'e') {
+                    r = 7309;
+                    if (*p ++ == 'q') {
+                        return 7314;
+                    }
+                    return r;
+                }
+                return r;
+            }
+            return r;
+        case 'm':
+            if (*p ++ == 'i' &&
+                *p ++ == 'd') {
+                return 7319;
+            }
+            return r;
+        case 'p':
+            if (*p ++ == 'a' &&
+                *p ++ == 'r') {
+                return 7324;
+            }
+            return r;
+        case 'q':
+            if (*p ++ == 's' &&
+                *p ++ == 'u') {
+                switch (*p ++) {
+                case 'b':
+                    if (*p ++ == 'e') {
+                        return 7329;
+                    }
+                    return r;
+                case 'p':
+                    if (*p ++ == 'e') {
+                        return 7334;
+                    }
+                    return r;
+                }
+                return r;
+            }
+            return r;
+        case 'u':
+            switch (*p ++) {
+            case 'b':
+                r = 7339;
+                switch (*p ++) {
+                case 'E':
+                    return 7344;
+                case 'e':
+                    return 7351;
+                case 's':
+                    if (*p ++ == 'e' &&
+                        *p ++ == 't') {
+                        r = 7356;
+                        if (*p ++ == 'e' &&
+                            *p ++ == 'q') {
+                            r = 7364;
+                            if (*p ++ == 'q') {
+                                return 7369;
+                            }
+                            return r;
+                        }
+                        return r;
+                    }
+                    return r;
+                }
+                return r;
+            case 'c':
+                if (*p ++ == 'c') {
+                    r = 7376;
+                    if (*p ++ == 'e' &&
+                        *p ++ == 'q') {
+                        return 7381;
+                    }
+                    return r;
+                }
+                return r;
+            case 'p':
+                r = 7388;
+                switch (*p ++) {
+                case 'E':
+                    return 7393;
+                case 'e':
+                    return 7400;
+                case 's':
+                    if (*p ++ == 'e' &&
+                        *p ++ == 't') {
+                        r = 7405;
+                        if (*p ++ == 'e' &&
+                            *p ++ == 'q') {
+                            r = 7413;
+                            if (*p ++ == 'q') {
+                                return 7418;
+                            }
+                            return r;
+                        }
+                        return r;
+                    }
+                    return r;
+                }
+                return r;
+            }
+            return r;
+        }
+        return r;
+    case 'u':
+        r = 7459;
+        if (*p ++ == 'm') {
+            r = 7463;
+            switch (*p ++) {
+            case 'e':
+                if (*p ++ == 'r' &&
+                    *p ++ == 'o') {
+                    return 7466;
+                }
+                return r;
+            case 's':
+                if (*p ++ == 'p') {
+                    return 7471;
+                }
+                return r;
+            }
+            return r;
+        }
+        return r;
+    case 'v':
+        switch (*p ++) {
+        case 'D':
+            if (*p ++ == 'a' &&
+                *p ++ == 's' &&
+                *p ++ == 'h') {
+                return 7476;
+            }
+            return r;
+        case 'H':
+            if (*p ++ == 'a' &&
+                *p ++ == 'r' &&
+                *p ++ == 'r') {
+                return 7481;
+            }
+            return r;
+        case 'a':
+            if (*p ++ == 'p') {
+                return 7486;
+            }
+            return r;
+        case 'd':
+            if (*p ++ == 'a' &&
+                *p ++ == 's' &&
+                *p ++ == 'h') {
+                return 7494;
+            }
+            return r;
+        case 'g':
+            switch (*p ++) {
+            case 'e':
+                return 7499;
+            case 't':
+                return 7507;
+            }
+            return r;
+        case 'i':
+            if (*p ++ == 'n' &&
+                *p ++ == 'f' &&
+                *p ++ == 'i' &&
+                *p ++ == 'n') {
+                return 7513;
+            }
+            return r;
+        case 'l':
+            switch (*p ++) {
+            case 'A':
+                if (*p ++ == 'r' &&
+                    *p ++ == 'r') {
+                    return 7518;
+                }
+                return r;
+            case 'e':
+                return 7523;
+            case 't':
+                r = 7531;
+                if (*p ++ == 'r' &&
+                    *p ++ == 'i' &&
+                    *p ++ == 'e') {
+                    return 7537;
+                }
+                return r;
+            }
+            return r;
+        case 'r':
+            switch (*p ++) {
+            case 'A':
+                if (*p ++ == 'r' &&
+                    *p ++ == 'r') {
+                    return 7545;
+                }
+                return r;
+            case 't':
+                if (*p ++ == 'r' &&
+                    *p ++ == 'i' &&
+                    *p ++ == 'e') {
+                    return 7550;
+                }
+                return r;
+            }
+            return r;
+        case 's':
+            if (*p ++ == 'i' &&
+                *p ++ == 'm') {
+                return 7558;
+            }
+            return r;
+        }
+        return r;
+    case 'w':
+        switch (*p ++) {
+        case 'A':
+            if (*p ++ == 'r' &&
+                *p ++ == 'r') {
+                return 7566;
+            }
+            return r;
+        case 'a':
+            if (*p ++ == 'r') {
+                switch (*p ++) {
+                case 'h':
+                    if (*p ++ == 'k') {
+                        return 7571;
+                    }
+                    return r;
+                case 'r':
+                    r = 7576;
+                    if (*p ++ == 'o' &&
+                        *p ++ == 'w') {
+                        return 7581;
+                    }
+                    return r;
+                }
+                return r;
+            }
+            return r;
+        case 'n':
+            if (*p ++ == 'e' &&
+                *p ++ == 'a' &&
+                *p ++ == 'r') {
+                return 7586;
+            }
+            return r;
+        }
+        return r;
+    }
+    return r;
+}
+
+static int html_cref_ftrie_cold_10(const char* p, int r)
+    __attribute__ ((cold, noinline));
+
+static int html_cref_ftrie_cold_10(const char* p, int r)
+{
+    switch (*p ++) {
+    case 'a':
+        if (*p ++ == 't') {
+            switch (*p ++) {
+            case 'e':
+                if (*p ++ == 'r' &&
+                    *p ++ == 'n' &&
+                    *p ++ == 'i' &&
+                    *p ++ == 'o' &&
+                    *p ++ == 'n' &&
+                    *p ++ == 's') {
+                    return 8187;
+                }
+                return r;
+            case 'i':
+                if (*p ++ == 'n' &&
+                    *p ++ == 't') {
+                    return 8192;
+                }
+                return r;
+            }
+            return r;
+        }
+        return r;
+    case 'e':
+        if (*p ++ == 's' &&
+            *p ++ == 't') {
+            r = 8197;
+            if (*p ++ == 'e' &&
+                *p ++ == 'q') {
+                return 8200;
+            }
+            return r;
+        }
+        return r;
+    }
+    return r;
+}
+
+static int html_cref_ftrie_cold_11(const char* p, int r)
+    __attribute__ ((cold, noinline));
+
+static int html_cref_ftrie_cold_11(const char* p, int r)
+{
+    switch (*p ++) {
+    case 'f':
+        if (*p ++ == 'r') {
+            return 8159;
+        }
+        return r;
+    case 'i':
+        if (*p ++ == 'n' &&
+            *p ++ == 't') {
+            return 8165;
+        }
+        return r;
+    case 'o':
+        if (*p ++ == 'p' &&
+            *p ++ == 'f') {
+            return 8170;
+        }
+        return r;
+    case 'p':
+        if (*p ++ == 'r' &&
+            *p ++ == 'i' &&
+            *p ++ == 'm' &&
+            *p ++ == 'e') {
+            return 8176;
+        }
+        return r;
+    case 's':
+        if (*p ++ == 'c' &&
+            *p ++ == 'r') {
+            return 8181;
+        }
+        return r;
+    }
+    return r;
+}
+
+static int html_cref_ftrie_cold_12(const char* p, int r)
+    __attribute__ ((cold, noinline));
+
+static int html_cref_ftrie_cold_12(const char* p, int r)
+{
+    switch (*p ++) {
+    case 'c':
+        switch (*p ++) {
+        case 'c':
+            return 6411;
+        case 'i':
+            if (*p ++ == 'r') {
+                return 6416;
+            }
+            return r;
+        }
+        return r;
+    case 'd':
+        if (*p ++ == 'o' &&
+            *p ++ == 't') {
+            return 6421;
+        }
+        return r;
+    case 'h':
+        if (*p ++ == 'r' &&
+            *p ++ == 'e' &&
+            *p ++ == 'e') {
+            return 6426;
+        }
+        return r;
+    case 'i':
+        if (*p ++ == 'm' &&
+            *p ++ == 'e' &&
+            *p ++ == 's') {
+            return 6431;
+        }
+        return r;
+    case 'l':
+        if (*p ++ == 'a' &&
+            *p ++ == 'r' &&
+            *p ++ == 'r') {
+            return 6436;
+        }
+        return r;
+    case 'q':
+        if (*p ++ == 'u' &&
+            *p ++ == 'e' &&
+            *p ++ == 's' &&
+            *p ++ == 't') {
+            return 6441;
+        }
+        return r;
+    case 'r':
+        switch (*p ++) {
+        case 'P':
+            if (*p ++ == 'a' &&
+                *p ++ == 'r') {
+                return 6446;
+            }
+            return r;
+        case 'i':
+            r = 6451;
+            switch (*p ++) {
+            case 'e':
+                return 6456;
+            case 'f':
+                return 6461;
+            }
+            return r;
+        }
+        return r;
+    }
+    return r;
+}
+
+static int html_cref_ftrie_cold_13(const char* p, int r)
+    __attribute__ ((cold, noinline));
+
+static int html_cref_ftrie_cold_13(const char* p, int r)
+{
+    switch (*p ++) {
+    case 'b':
+        r = 5822;
+        if (*p ++ == 'f' &&
+            *p ++ == 's') {
+            return 5827;
+        }
+        return r;
+    case 'f':
+        if (*p ++ == 's') {
+            return 5832;
+        }
+        return r;
+    case 'h':
+        if (*p ++ == 'k') {
+            return 5837;
+        }
+        return r;
+    case 'l':
+        if (*p ++ == 'p') {
+            return 5842;
+        }
+        return r;
+    case 'p':
+        if (*p ++ == 'l') {
+            return 5847;
+        }
+        return r;
+    case 's':
+        if (*p ++ == 'i' &&
+            *p ++ == 'm') {
+            return 5852;
+        }
+        return r;
+    case 't':
+        if (*p ++ == 'l') {
+            return 5857;
+        }
+        return r;
+    }
+    return r;
+}
+
+static int html_cref_ftrie_cold_14(const char* p, int r)
+    __attribute__ ((cold, noinline));
+
+static int html_cref_ftrie_cold_14(const char* p, int r)
+{
+    switch (*p ++) {
+    case 'c':
+        if (*p ++ == 'u' &&
+            *p ++ == 't' &&
+            *p ++ == 'e') {
+            return 5775;
+        }
+        return r;
+    case 'e':
+        if (*p ++ == 'm' &&
+            *p ++ == 'p' &&
+            *p ++ == 't' &&
+            *p ++ == 'y' &&
+            *p ++ == 'v') {
+            return 5779;
+        }
+        return r;
+    case 'g':
+        if (*p ++ == 'r' &&
+            *p ++ == 'a' &&
+            *p ++ == 'n') {
+            return 5784;
+        }
+        return r;
+    case 'm':
+        if (*p ++ == 'b' &&
+            *p ++ == 'd' &&
+            *p ++ == 'a') {
+            return 5789;
+        }
+        return r;
+    case 'n':
+        if (*p ++ == 'g') {
+            r = 5793;
+            switch (*p ++) {
+            case 'd':
+                return 5798;
+            case 'l':
+                if (*p ++ == 'e') {
+                    return 5803;
+                }
+                return r;
+            }
+            return r;
+        }
+        return r;
+    case 'p':
+        return 5808;
+    case 't':
+        r = 5862;
+        switch (*p ++) {
+        case 'a':
+            if (*p ++ == 'i' &&
+                *p ++ == 'l') {
+                return 5867;
+            }
+            return r;
+        case 'e':
+            r = 5872;
+            if (*p ++ == 's') {
+                return 5877;
+            }
+            return r;
+        }
+        return r;
+    }
+    return r;
+}
+
+static int html_cref_ftrie_cold_15(const char* p, int r)
+    __attribute__ ((cold, noinline));
+
+static int html_cref_ftrie_cold_15(const char* p, int r)
+{
+    switch (*p ++) {
+    case 'r':
+        return 5946;
+    }
+    return r;
+}
+
+static int html_cref_ftrie_cold_16(const char* p, int r)
+    __attribute__ ((cold, noinline));
+
+static int html_cref_ftrie_cold_16(const char* p, int r)
+{
+    switch (*p ++) {
+    case 'c':
+        if (*p ++ == 'a') {
+            return 5936;
+        }
+        return r;
+    case 'r':
+        switch (*p ++) {
+        case 'd':
+            if (*p ++ == 'h' &&
+                *p ++ == 'a' &&
+                *p ++ == 'r') {
+                return 5951;
+            }
+            return r;
+        case 'u':
+            if (*p ++ == 's' &&
+                *p ++ == 'h' &&
+                *p ++ == 'a' &&
+                *p ++ == 'r') {
+                return 5956;
+            }
+            return r;
+        }
+        return r;
+    case 's':
+        if (*p ++ == 'h') {
+            return 5961;
+        }
+        return r;
+    }
+    return r;
+}
+
+static int html_cref_ftrie_cold_17(const char* p, int r)
+    __attribute__ ((cold, noinline));
+
+static int html_cref_ftrie_cold_17(const char* p, int r)
+{
+    switch (*p ++) {
+    case 'r':
+        return 6399;
+    }
+    return r;
+}
+
+static int html_cref_ftrie_cold_18(const char* p, int r)
+    __attribute__ ((cold, noinline));
+
+static int html_cref_ftrie_cold_18(const char* p, int r)
+{
+    switch (*p ++) {
+    case 'b':
+        return 6391;
+    }
+    return r;
+}
+
+static int html_cref_ftrie_cold_19(const char* p, int r)
+    __attribute__ ((cold, noinline));
+
+static int html_cref_ftrie_cold_19(const char* p, int r)
+{
+    switch (*p ++) {
+    case 'a':
+        if (*p ++ == 'q' &&
+            *p ++ == 'u' &&
+            *p ++ == 'o') {
+            return 6360;
+        }
+        return r;
+    case 'c':
+        if (*p ++ == 'r') {
+            return 6365;
+        }
+        return r;
+    case 'h':
+        return 6371;
+    case 'i':
+        if (*p ++ == 'm') {
+            r = 6376;
+            switch (*p ++) {
+            case 'e':
+                return 6381;
+            case 'g':
+                return 6386;
+            }
+            return r;
+        }
+        return r;
+    case 't':
+        if (*p ++ == 'r' &&
+            *p ++ == 'o' &&
+            *p ++ == 'k') {
+            return 6404;
+        }
+        return r;
+    }
+    return r;
+}
+
+static int html_cref_ftrie_cold_20(const char* p, int r)
+    __attribute__ ((cold, noinline));
+
+static int html_cref_ftrie_cold_20(const char* p, int r)
+{
+    switch (*p ++) {
+    case 'f':
+        if (*p ++ == 't') {
+            switch (*p ++) {
+            case 'a':
+                if (*p ++ == 'r' &&
+                    *p ++ == 'r' &&
+                    *p ++ == 'o' &&
+                    *p ++ == 'w') {
+                    r = 5971;
+                    if (*p ++ == 't' &&
+                        *p ++ == 'a' &&
+                        *p ++ == 'i' &&
+                        *p ++ == 'l') {
+                        return 5976;
+                    }
+                    return r;
+                }
+                return r;
+            case 'h':
+                if (*p ++ == 'a' &&
+                    *p ++ == 'r' &&
+                    *p ++ == 'p' &&
+                    *p ++ == 'o' &&
+                    *p ++ == 'o' &&
+                    *p ++ == 'n') {
+                    switch (*p ++) {
+                    case 'd':
+                        if (*p ++ == 'o' &&
+                            *p ++ == 'w' &&
+                            *p ++ == 'n') {
+                            return 5981;
+                        }
+                        return r;
+                    case 'u':
+                        if (*p ++ == 'p') {
+                            return 5986;
+                        }
+                        return r;
+                    }
+                    return r;
+                }
+                return r;
+            case 'l':
+                if (*p ++ == 'e' &&
+                    *p ++ == 'f' &&
+                    *p ++ == 't' &&
+                    *p ++ == 'a' &&
+                    *p ++ == 'r' &&
+                    *p ++ == 'r' &&
+                    *p ++ == 'o' &&
+                    *p ++ == 'w' &&
+                    *p ++ == 's') {
+                    return 5991;
+                }
+                return r;
+            case 'r':
+                if (*p ++ == 'i' &&
+                    *p ++ == 'g' &&
+                    *p ++ == 'h' &&
+                    *p ++ == 't') {
+                    switch (*p ++) {
+                    case 'a':
+                        if (*p ++ == 'r' &&
+                            *p ++ == 'r' &&
+                            *p ++ == 'o' &&
+                            *p ++ == 'w') {
+                            r = 5996;
+                            if (*p ++ == 's') {
+                                return 6001;
+                            }
+                            return r;
+                        }
+                        return r;
+                    case 'h':
+                        if (*p ++ == 'a' &&
+                            *p ++ == 'r' &&
+                            *p ++ == 'p' &&
+                            *p ++ == 'o' &&
+                            *p ++ == 'o' &&
+                            *p ++ == 'n' &&
+                            *p ++ == 's') {
+                            return 6006;
+                        }
+                        return r;
+                    case 's':
+                        if (*p ++ == 'q' &&
+                            *p ++ == 'u' &&
+                            *p ++ == 'i' &&
+                            *p ++ == 'g' &&
+                            *p ++ == 'a' &&
+                            *p ++ == 'r' &&
+                            *p ++ == 'r' &&
+                            *p ++ == 'o' &&
+                            *p ++ == 'w') {
+                            return 6011;
+                        }
+                        return r;
+                    }
+                    return r;
+                }
+                return r;
+            case 't':
+                if (*p ++ == 'h' &&
+                    *p ++ == 'r' &&
+                    *p ++ == 'e' &&
+                    *p ++ == 'e' &&
+                    *p ++ == 't' &&
+                    *p ++ == 'i' &&
+                    *p ++ == 'm' &&
+                    *p ++ == 'e' &&
+                    *p ++ == 's') {
+                    return 6016;
+                }
+                return r;
+            }
+            return r;
+        }
+        return r;
+    case 'g':
+        return 6021;
+    case 'q':
+        r = 6026;
+        switch (*p ++) {
+        case 'q':
+            return 6031;
+        case 's':
+            if (*p ++ == 'l' &&
+                *p ++ == 'a' &&
+                *p ++ == 'n' &&
+                *p ++ == 't') {
+                return 6036;
+            }
+            return r;
+        }
+        return r;
+    case 's':
+        r = 6041;
+        switch (*p ++) {
+        case 'c':
+            if (*p ++ == 'c') {
+                return 6046;
+            }
+            return r;
+        case 'd':
+            if (*p ++ == 'o' &&
+                *p ++ == 't') {
+                r = 6051;
+                if (*p ++ == 'o') {
+                    r = 6056;
+                    if (*p ++ == 'r') {
+                        return 6061;
+                    }
+                    return r;
+                }
+                return r;
+            }
+            return r;
+        case 'g':
+            r = 6066;
+            if (*p ++ == 'e' &&
+                *p ++ == 's') {
+                return 6074;
+            }
+            return r;
+        case 's':
+            switch (*p ++) {
+            case 'a':
+                if (*p ++ == 'p' &&
+                    *p ++ == 'p' &&
+                    *p ++ == 'r' &&
+                    *p ++ == 'o' &&
+                    *p ++ == 'x') {
+                    return 6079;
+                }
+                return r;
+            case 'd':
+                if (*p ++ == 'o' &&
+                    *p ++ == 't') {
+                    return 6084;
+                }
+                return r;
+            case 'e':
+                if (*p ++ == 'q') {
+                    switch (*p ++) {
+                    case 'g':
+                        if (*p ++ == 't' &&
+                            *p ++ == 'r') {
+                            return 6089;
+                        }
+                        return r;
+                    case 'q':
+                        if (*p ++ == 'g' &&
+                            *p ++ == 't' &&
+                            *p ++ == 'r') {
+                            return 6094;
+                        }
+                        return r;
+                    }
+                    return r;
+                }
+                return r;
+            case 'g':
+                if (*p ++ == 't' &&
+                    *p ++ == 'r') {
+                    return 6099;
+                }
+                return r;
+            case 's':
+                if (*p ++ == 'i' &&
+                    *p ++ == 'm') {
+                    return 6104;
+                }
+                return r;
+            }
+            return r;
+        }
+        return r;
+    }
+    return r;
+}
+
+static int html_cref_ftrie_cold_21(const char* p, int r)
+    __attribute__ ((cold, noinline));
+
+static int html_cref_ftrie_cold_21(const char* p, int r)
+{
+    switch (*p ++) {
+    case 'A':
+        switch (*p ++) {
+        case 'a':
+            if (*p ++ == 'r' &&
+                *p ++ == 'r') {
+                return 5740;
+            }
+            return r;
+        case 'r':
+            if (*p ++ == 'r') {
+                return 5745;
+            }
+            return r;
+        case 't':
+            if (*p ++ == 'a' &&
+                *p ++ == 'i' &&
+                *p ++ == 'l') {
+                return 5750;
+            }
+            return r;
+        }
+        return r;
+    case 'B':
+        if (*p ++ == 'a' &&
+            *p ++ == 'r' &&
+            *p ++ == 'r') {
+            return 5755;
+        }
+        return r;
+    case 'E':
+        r = 5760;
+        if (*p ++ == 'g') {
+            return 5765;
+        }
+        return r;
+    case 'H':
+        if (*p ++ == 'a' &&
+            *p ++ == 'r') {
+            return 5770;
+        }
+        return r;
+    case 'b':
+        switch (*p ++) {
+        case 'a':
+            if (*p ++ == 'r' &&
+                *p ++ == 'r') {
+                return 5885;
+            }
+            return r;
+        case 'b':
+            if (*p ++ == 'r' &&
+                *p ++ == 'k') {
+                return 5890;
+            }
+            return r;
+        case 'r':
+            switch (*p ++) {
+            case 'a':
+                if (*p ++ == 'c') {
+                    switch (*p ++) {
+                    case 'e':
+                        return 5895;
+                    case 'k':
+                        return 5898;
+                    }
+                    return r;
+                }
+                return r;
+            case 'k':
+                switch (*p ++) {
+                case 'e':
+                    return 5901;
+                case 's':
+                    if (*p ++ == 'l') {
+                        switch (*p ++) {
+                        case 'd':
+                            return 5906;
+                        case 'u':
+                            return 5911;
+                        }
+                        return r;
+                    }
+                    return r;
+                }
+                return r;
+            }
+            return r;
+        }
+        return r;
+    case 'c':
+        switch (*p ++) {
+        case 'a':
+            if (*p ++ == 'r' &&
+                *p ++ == 'o' &&
+                *p ++ == 'n') {
+                return 5916;
+            }
+            return r;
+        case 'e':
+            switch (*p ++) {
+            case 'd':
+                if (*p ++ == 'i' &&
+                    *p ++ == 'l') {
+                    return 5920;
+                }
+                return r;
+            case 'i':
+                if (*p ++ == 'l') {
+                    return 5924;
+                }
+                return r;
+            }
+            return r;
+        case 'u':
+            if (*p ++ == 'b') {
+                return 5929;
+            }
+            return r;
+        case 'y':
+            return 5932;
+        }
+        return r;
+    case 'f':
+        switch (*p ++) {
+        case 'i':
+            if (*p ++ == 's' &&
+                *p ++ == 'h' &&
+                *p ++ == 't') {
+                return 6109;
+            }
+            return r;
+        case 'l':
+            if (*p ++ == 'o' &&
+                *p ++ == 'o' &&
+                *p ++ == 'r') {
+                return 6114;
+            }
+            return r;
+        case 'r':
+            return 6119;
+        }
+        return r;
+    case 'g':
+        r = 6125;
+        if (*p ++ == 'E') {
+            return 6130;
+        }
+        return r;
+    case 'h':
+        switch (*p ++) {
+        case 'a':
+            if (*p ++ == 'r') {
+                switch (*p ++) {
+                case 'd':
+                    return 6135;
+                case 'u':
+                    r = 6140;
+                    if (*p ++ == 'l') {
+                        return 6145;
+                    }
+                    return r;
+                }
+                return r;
+            }
+            return r;
+        case 'b':
+            if (*p ++ == 'l' &&
+                *p ++ == 'k') {
+                return 6150;
+            }
+            return r;
+        }
+        return r;
+    case 'j':
+        if (*p ++ == 'c' &&
+            *p ++ == 'y') {
+            return 6155;
+        }
+        return r;
+    case 'l':
+        r = 6159;
+        switch (*p ++) {
+        case 'a':
+            if (*p ++ == 'r' &&
+                *p ++ == 'r') {
+                return 6164;
+            }
+            return r;
+        case 'c':
+            if (*p ++ == 'o' &&
+                *p ++ == 'r' &&
+                *p ++ == 'n' &&
+                *p ++ == 'e' &&
+                *p ++ == 'r') {
+                return 6169;
+            }
+            return r;
+        case 'h':
+            if (*p ++ == 'a' &&
+                *p ++ == 'r' &&
+                *p ++ == 'd') {
+                return 6174;
+            }
+            return r;
+        case 't':
+            if (*p ++ == 'r' &&
+                *p ++ == 'i') {
+                return 6179;
+            }
+            return r;
+        }
+        return r;
+    case 'm':
+        switch (*p ++) {
+        case 'i':
+            if (*p ++ == 'd' &&
+                *p ++ == 'o' &&
+                *p ++ == 't') {
+                return 6184;
+            }
+            return r;
+        case 'o':
+            if (*p ++ == 'u' &&
+                *p ++ == 's' &&
+                *p ++ == 't') {
+                r = 6188;
+                if (*p ++ == 'a' &&
+                    *p ++ == 'c' &&
+                    *p ++ == 'h' &&
+                    *p ++ == 'e') {
+                    return 6193;
+                }
+                return r;
+            }
+            return r;
+        }
+        return r;
+    case 'n':
+        switch (*p ++) {
+        case 'E':
+            return 6198;
+        case 'a':
+            if (*p ++ == 'p') {
+                r = 6203;
+                if (*p ++ == 'p' &&
+                    *p ++ == 'r' &&
+                    *p ++ == 'o' &&
+                    *p ++ == 'x') {
+                    return 6208;
+                }
+                return r;
+            }
+            return r;
+        case 'e':
+            r = 6213;
+            if (*p ++ == 'q') {
+                r = 6218;
+                if (*p ++ == 'q') {
+                    return 6223;
+                }
+                return r;
+            }
+            return r;
+        case 's':
+            if (*p ++ == 'i' &&
+                *p ++ == 'm') {
+                return 6228;
+            }
+            return r;
+        }
+        return r;
+    case 'o':
+        switch (*p ++) {
+        case 'a':
+            switch (*p ++) {
+            case 'n':
+                if (*p ++ == 'g') {
+                    return 6233;
+                }
+                return r;
+            case 'r':
+                if (*p ++ == 'r') {
+                    return 6238;
+                }
+                return r;
+            }
+            return r;
+        case 'b':
+            if (*p ++ == 'r' &&
+                *p ++ == 'k') {
+                return 6243;
+            }
+            return r;
+        case 'n':
+            if (*p ++ == 'g') {
+                switch (*p ++) {
+                case 'l':
+                    if (*p ++ == 'e' &&
+                        *p ++ == 'f' &&
+                        *p ++ == 't') {
+                        switch (*p ++) {
+                        case 'a':
+                            if (*p ++ == 'r' &&
+                                *p ++ == 'r' &&
+                                *p ++ == 'o' &&
+                                *p ++ == 'w') {
+                                return 6248;
+                            }
+                            return r;
+                        case 'r':
+                            if (*p ++ == 'i' &&
+                                *p ++ == 'g' &&
+                                *p ++ == 'h' &&
+                                *p ++ == 't' &&
+                                *p ++ == 'a' &&
+                                *p ++ == 'r' &&
+                                *p ++ == 'r' &&
+                                *p ++ == 'o' &&
+                                *p ++ == 'w') {
+                                return 6253;
+                            }
+                            return r;
+                        }
+                        return r;
+                    }
+                    return r;
+                case 'm':
+                    if (*p ++ == 'a' &&
+                        *p ++ == 'p' &&
+                        *p ++ == 's' &&
+                        *p ++ == 't' &&
+                        *p ++ == 'o') {
+                        return 6258;
+                    }
+                    return r;
+                case 'r':
+                    if (*p ++ == 'i' &&
+                        *p ++ == 'g' &&
+                        *p ++ == 'h' &&
+                        *p ++ == 't' &&
+                        *p ++ == 'a' &&
+                        *p ++ == 'r' &&
+                        *p ++ == 'r' &&
+                        *p ++ == 'o' &&
+                        *p ++ == 'w') {
+                        return 6263;
+                    }
+                    return r;
+                }
+                return r;
+            }
+            return r;
+        case 'o':
+            if (*p ++ == 'p' &&
+                *p ++ == 'a' &&
+                *p ++ == 'r' &&
+                *p ++ == 'r' &&
+                *p ++ == 'o' &&
+                *p ++ == 'w') {
+                switch (*p ++) {
+                case 'l':
+                    if (*p ++ == 'e' &&
+                        *p ++ == 'f' &&
+                        *p ++ == 't') {
+                        return 6268;
+                    }
+                    return r;
+                case 'r':
+                    if (*p ++ == 'i' &&
+                        *p ++ == 'g' &&
+                        *p ++ == 'h' &&
+                        *p ++ == 't') {
+                        return 6273;
+                    }
+                    return r;
+                }
+                return r;
+            }
+            return r;
+        case 'p':
+            switch (*p ++) {
+            case 'a':
+                if (*p ++ == 'r') {
+                    return 6278;
+                }
+                return r;
+            case 'f':
+                return 6283;
+            case 'l':
+                if (*p ++ == 'u' &&
+                    *p ++ == 's') {
+                    return 6289;
+                }
+                return r;
+            }
+            return r;
+        case 't':
+            if (*p ++ == 'i' &&
+                *p ++ == 'm' &&
+                *p ++ == 'e' &&
+                *p ++ == 's') {
+                return 6294;
+            }
+            return r;
+        case 'w':
+            switch (*p ++) {
+            case 'a':
+                if (*p ++ == 's' &&
+                    *p ++ == 't') {
+                    return 6299;
+                }
+                return r;
+            case 'b':
+                if (*p ++ == 'a' &&
+                    *p ++ == 'r') {
+                    return 6304;
+                }
+                return r;
+            }
+            return r;
+        case 'z':
+            r = 6307;
+            switch (*p ++) {
+            case 'e':
+                if (*p ++ == 'n' &&
+                    *p ++ == 'g' &&
+                    *p ++ == 'e') {
+                    return 6312;
+                }
+                return r;
+            case 'f':
+                return 6317;
+            }
+            return r;
+        }
+        return r;
+    case 'p':
+        if (*p ++ == 'a' &&
+            *p ++ == 'r') {
+            r = 6322;
+            if (*p ++ == 'l' &&
+                *p ++ == 't') {
+                return 6325;
+            }
+            return r;
+        }
+        return r;
+    case 'r':
+        switch (*p ++) {
+        case 'a':
+            if (*p ++ == 'r' &&
+                *p ++ == 'r') {
+                return 6330;
+            }
+            return r;
+        case 'c':
+            if (*p ++ == 'o' &&
+                *p ++ == 'r' &&
+                *p ++ == 'n' &&
+                *p ++ == 'e' &&
+                *p ++ == 'r') {
+                return 6335;
+            }
+            return r;
+        case 'h':
+            if (*p ++ == 'a' &&
+                *p ++ == 'r') {
+                r = 6340;
+                if (*p ++ == 'd') {
+                    return 6345;
+                }
+                return r;
+            }
+            return r;
+        case 'm':
+            return 6350;
+        case 't':
+            if (*p ++ == 'r' &&
+                *p ++ == 'i') {
+                return 6355;
+            }
+            return r;
+        }
+        return r;
+    case 'u':
+        if (*p ++ == 'r') {
+            switch (*p ++) {
+            case 'd':
+                if (*p ++ == 's' &&
+                    *p ++ == 'h' &&
+                    *p ++ == 'a' &&
+                    *p ++ == 'r') {
+                    return 6466;
+                }
+                return r;
+            case 'u':
+                if (*p ++ == 'h' &&
+                    *p ++ == 'a' &&
+                    *p ++ == 'r') {
+                    return 6471;
+                }
+                return r;
+            }
+            return r;
+        }
+        return r;
+    case 'v':
+        switch (*p ++) {
+        case 'e':
+            if (*p ++ == 'r' &&
+                *p ++ == 't' &&
+                *p ++ == 'n' &&
+                *p ++ == 'e' &&
+                *p ++ == 'q' &&
+                *p ++ == 'q') {
+                return 6476;
+            }
+            return r;
+        case 'n':
+            if (*p ++ == 'E') {
+                return 6484;
+            }
+            return r;
+        }
+        return r;
+    }
+    return r;
+}
+
+static int html_cref_ftrie_cold_22(const char* p, int r)
+    __attribute__ ((cold, noinline));
+
+static int html_cref_ftrie_cold_22(const char* p, int r)
+{
+    switch (*p ++) {
+    case 'c':
+        switch (*p ++) {
+        case 'c':
+            return 5206;
+        case 'i':
+            if (*p ++ == 'r') {
+                return 5211;
+            }
+            return r;
+        }
+        return r;
+    case 'd':
+        if (*p ++ == 'o' &&
+            *p ++ == 't') {
+            return 5216;
+        }
+        return r;
+    case 'l':
+        if (*p ++ == 'P' &&
+            *p ++ == 'a' &&
+            *p ++ == 'r') {
+            return 5221;
+        }
+        return r;
+    case 'q':
+        if (*p ++ == 'u' &&
+            *p ++ == 'e' &&
+            *p ++ == 's' &&
+            *p ++ == 't') {
+            return 5226;
+        }
+        return r;
+    case 'r':
+        switch (*p ++) {
+        case 'a':
+            switch (*p ++) {
+            case 'p':
+                if (*p ++ == 'p' &&
+                    *p ++ == 'r' &&
+                    *p ++ == 'o' &&
+                    *p ++ == 'x') {
+                    return 5231;
+                }
+                return r;
+            case 'r':
+                if (*p ++ == 'r') {
+                    return 5236;
+                }
+                return r;
+            }
+            return r;
+        case 'd':
+            if (*p ++ == 'o' &&
+                *p ++ == 't') {
+                return 5241;
+            }
+            return r;
+        case 'e':
+            if (*p ++ == 'q') {
+                switch (*p ++) {
+                case 'l':
+                    if (*p ++ == 'e' &&
+                        *p ++ == 's' &&
+                        *p ++ == 's') {
+                        return 5246;
+                    }
+                    return r;
+                case 'q':
+                    if (*p ++ == 'l' &&
+                        *p ++ == 'e' &&
+                        *p ++ == 's' &&
+                        *p ++ == 's') {
+                        return 5251;
+                    }
+                    return r;
+                }
+                return r;
+            }
+            return r;
+        case 'l':
+            if (*p ++ == 'e' &&
+                *p ++ == 's' &&
+                *p ++ == 's') {
+                return 5256;
+            }
+            return r;
+        case 's':
+            if (*p ++ == 'i' &&
+                *p ++ == 'm') {
+                return 5261;
+            }
+            return r;
+        }
+        return r;
+    }
+    return r;
+}
+
+static int html_cref_ftrie_cold_23(const char* p, int r)
+    __attribute__ ((cold, noinline));
+
+static int html_cref_ftrie_cold_23(const char* p, int r)
+{
+    switch (*p ++) {
+    case 'l':
+        return 5036;
+    case 'q':
+        r = 5041;
+        switch (*p ++) {
+        case 'q':
+            return 5046;
+        case 's':
+            if (*p ++ == 'l' &&
+                *p ++ == 'a' &&
+                *p ++ == 'n' &&
+                *p ++ == 't') {
+                return 5051;
+            }
+            return r;
+        }
+        return r;
+    case 's':
+        r = 5056;
+        switch (*p ++) {
+        case 'c':
+            if (*p ++ == 'c') {
+                return 5061;
+            }
+            return r;
+        case 'd':
+            if (*p ++ == 'o' &&
+                *p ++ == 't') {
+                r = 5066;
+                if (*p ++ == 'o') {
+                    r = 5071;
+                    if (*p ++ == 'l') {
+                        return 5076;
+                    }
+                    return r;
+                }
+                return r;
+            }
+            return r;
+        case 'l':
+            r = 5081;
+            if (*p ++ == 'e' &&
+                *p ++ == 's') {
+                return 5089;
+            }
+            return r;
+        }
+        return r;
+    }
+    return r;
+}
+
+static int html_cref_ftrie_cold_24(const char* p, int r)
+    __attribute__ ((cold, noinline));
+
+static int html_cref_ftrie_cold_24(const char* p, int r)
+{
+    switch (*p ++) {
+    case 'E':
+        r = 4988;
+        if (*p ++ == 'l') {
+            return 4993;
+        }
+        return r;
+    case 'a':
+        switch (*p ++) {
+        case 'c':
+            if (*p ++ == 'u' &&
+                *p ++ == 't' &&
+                *p ++ == 'e') {
+                return 4998;
+            }
+            return r;
+        case 'm':
+            if (*p ++ == 'm' &&
+                *p ++ == 'a') {
+                r = 5002;
+                if (*p ++ == 'd') {
+                    return 5006;
+                }
+                return r;
+            }
+            return r;
+        case 'p':
+            return 5010;
+        }
+        return r;
+    case 'b':
+        if (*p ++ == 'r' &&
+            *p ++ == 'e' &&
+            *p ++ == 'v' &&
+            *p ++ == 'e') {
+            return 5015;
+        }
+        return r;
+    case 'c':
+        switch (*p ++) {
+        case 'i':
+            if (*p ++ == 'r' &&
+                *p ++ == 'c') {
+                return 5019;
+            }
+            return r;
+        case 'y':
+            return 5023;
+        }
+        return r;
+    case 'd':
+        if (*p ++ == 'o' &&
+            *p ++ == 't') {
+            return 5027;
+        }
+        return r;
+    case 'f':
+        if (*p ++ == 'r') {
+            return 5094;
+        }
+        return r;
+    case 'g':
+        r = 5100;
+        if (*p ++ == 'g') {
+            return 5105;
+        }
+        return r;
+    case 'i':
+        if (*p ++ == 'm' &&
+            *p ++ == 'e' &&
+            *p ++ == 'l') {
+            return 5110;
+        }
+        return r;
+    case 'j':
+        if (*p ++ == 'c' &&
+            *p ++ == 'y') {
+            return 5115;
+        }
+        return r;
+    case 'l':
+        r = 5119;
+        switch (*p ++) {
+        case 'E':
+            return 5124;
+        case 'a':
+            return 5129;
+        case 'j':
+            return 5134;
+        }
+        return r;
+    case 'n':
+        switch (*p ++) {
+        case 'E':
+            return 5139;
+        case 'a':
+            if (*p ++ == 'p') {
+                r = 5144;
+                if (*p ++ == 'p' &&
+                    *p ++ == 'r' &&
+                    *p ++ == 'o' &&
+                    *p ++ == 'x') {
+                    return 5149;
+                }
+                return r;
+            }
+            return r;
+        case 'e':
+            r = 5154;
+            if (*p ++ == 'q') {
+                r = 5159;
+                if (*p ++ == 'q') {
+                    return 5164;
+                }
+                return r;
+            }
+            return r;
+        case 's':
+            if (*p ++ == 'i' &&
+                *p ++ == 'm') {
+                return 5169;
+            }
+            return r;
+        }
+        return r;
+    case 'o':
+        if (*p ++ == 'p' &&
+            *p ++ == 'f') {
+            return 5174;
+        }
+        return r;
+    case 'r':
+        if (*p ++ == 'a' &&
+            *p ++ == 'v' &&
+            *p ++ == 'e') {
+            return 5180;
+        }
+        return r;
+    case 's':
+        switch (*p ++) {
+        case 'c':
+            if (*p ++ == 'r') {
+                return 5183;
+            }
+            return r;
+        case 'i':
+            if (*p ++ == 'm') {
+                r = 5188;
+                switch (*p ++) {
+                case 'e':
+                    return 5193;
+                case 'l':
+                    return 5198;
+                }
+                return r;
+            }
+            return r;
+        }
+        return r;
+    case 'v':
+        switch (*p ++) {
+        case 'e':
+            if (*p ++ == 'r' &&
+                *p ++ == 't' &&
+                *p ++ == 'n' &&
+                *p ++ == 'e' &&
+                *p ++ == 'q' &&
+                *p ++ == 'q') {
+                return 5266;
+            }
+            return r;
+        case 'n':
+            if (*p ++ == 'E') {
+                return 5274;
+            }
+            return r;
+        }
+        return r;
+    }
+    return r;
+}
+
+static int html_cref_ftrie_cold_25(const char* p, int r)
+    __attribute__ ((cold, noinline));
+
+static int html_cref_ftrie_cold_25(const char* p, int r)
+{
+    switch (*p ++) {
+    case 'a':
+        if (*p ++ == 'p') {
+            return 8283;
+        }
+        return r;
+    case 'b':
+        r = 8288;
+        if (*p ++ == 'f' &&
+            *p ++ == 's') {
+            return 8293;
+        }
+        return r;
+    case 'c':
+        return 8298;
+    case 'f':
+        if (*p ++ == 's') {
+            return 8303;
+        }
+        return r;
+    case 'h':
+        if (*p ++ == 'k') {
+            return 8308;
+        }
+        return r;
+    case 'l':
+        if (*p ++ == 'p') {
+            return 8313;
+        }
+        return r;
+    case 'p':
+        if (*p ++ == 'l') {
+            return 8318;
+        }
+        return r;
+    case 's':
+        if (*p ++ == 'i' &&
+            *p ++ == 'm') {
+            return 8323;
+        }
+        return r;
+    case 't':
+        if (*p ++ == 'l') {
+            return 8328;
+        }
+        return r;
+    case 'w':
+        return 8333;
+    }
+    return r;
+}
+
+static int html_cref_ftrie_cold_26(const char* p, int r)
+    __attribute__ ((cold, noinline));
+
+static int html_cref_ftrie_cold_26(const char* p, int r)
+{
+    switch (*p ++) {
+    case 'c':
+        switch (*p ++) {
+        case 'e':
+            return 8233;
+        case 'u':
+            if (*p ++ == 't' &&
+                *p ++ == 'e') {
+                return 8240;
+            }
+            return r;
+        }
+        return r;
+    case 'd':
+        if (*p ++ == 'i' &&
+            *p ++ == 'c') {
+            return 8244;
+        }
+        return r;
+    case 'e':
+        if (*p ++ == 'm' &&
+            *p ++ == 'p' &&
+            *p ++ == 't' &&
+            *p ++ == 'y' &&
+            *p ++ == 'v') {
+            return 8249;
+        }
+        return r;
+    case 'n':
+        if (*p ++ == 'g') {
+            r = 8254;
+            switch (*p ++) {
+            case 'd':
+                return 8259;
+            case 'e':
+                return 8264;
+            case 'l':
+                if (*p ++ == 'e') {
+                    return 8269;
+                }
+                return r;
+            }
+            return r;
+        }
+        return r;
+    case 't':
+        switch (*p ++) {
+        case 'a':
+            if (*p ++ == 'i' &&
+                *p ++ == 'l') {
+                return 8338;
+            }
+            return r;
+        case 'i':
+            if (*p ++ == 'o') {
+                r = 8343;
+                if (*p ++ == 'n' &&
+                    *p ++ == 'a' &&
+                    *p ++ == 'l' &&
+                    *p ++ == 's') {
+                    return 8348;
+                }
+                return r;
+            }
+            return r;
+        }
+        return r;
+    }
+    return r;
+}
+
+static int html_cref_ftrie_cold_27(const char* p, int r)
+    __attribute__ ((cold, noinline));
+
+static int html_cref_ftrie_cold_27(const char* p, int r)
+{
+    switch (*p ++) {
+    case 'r':
+        return 8659;
+    }
+    return r;
+}
+
+static int html_cref_ftrie_cold_28(const char* p, int r)
+    __attribute__ ((cold, noinline));
+
+static int html_cref_ftrie_cold_28(const char* p, int r)
+{
+    switch (*p ++) {
+    case 'b':
+        return 8651;
+    }
+    return r;
+}
+
+static int html_cref_ftrie_cold_29(const char* p, int r)
+    __attribute__ ((cold, noinline));
+
+static int html_cref_ftrie_cold_29(const char* p, int r)
+{
+    switch (*p ++) {
+    case 'a':
+        if (*p ++ == 'q' &&
+            *p ++ == 'u' &&
+            *p ++ == 'o') {
+            return 8635;
+        }
+        return r;
+    case 'c':
+        if (*p ++ == 'r') {
+            return 8640;
+        }
+        return r;
+    case 'h':
+        return 8646;
+    }
+    return r;
+}
+
+static int html_cref_ftrie_cold_30(const char* p, int r)
+    __attribute__ ((cold, noinline));
+
+static int html_cref_ftrie_cold_30(const char* p, int r)
+{
+    switch (*p ++) {
+    case 'r':
+        return 8419;
+    }
+    return r;
+}
+
+static int html_cref_ftrie_cold_31(const char* p, int r)
+    __attribute__ ((cold, noinline));
+
+static int html_cref_ftrie_cold_31(const char* p, int r)
+{
+    switch (*p ++) {
+    case 'c':
+        if (*p ++ == 'a') {
+            return 8404;
+        }
+        return r;
+    case 'l':
+        if (*p ++ == 'd' &&
+            *p ++ == 'h' &&
+            *p ++ == 'a' &&
+            *p ++ == 'r') {
+            return 8409;
+        }
+        return r;
+    case 's':
+        if (*p ++ == 'h') {
+            return 8424;
+        }
+        return r;
+    }
+    return r;
+}
+
+static int html_cref_ftrie_cold_32(const char* p, int r)
+    __attribute__ ((cold, noinline));
+
+static int html_cref_ftrie_cold_32(const char* p, int r)
+{
+    switch (*p ++) {
+    case 'a':
+        if (*p ++ == 'l') {
+            r = 8429;
+            switch (*p ++) {
+            case 'i':
+                if (*p ++ == 'n' &&
+                    *p ++ == 'e') {
+                    return 8434;
+                }
+                return r;
+            case 'p':
+                if (*p ++ == 'a' &&
+                    *p ++ == 'r' &&
+                    *p ++ == 't') {
+                    return 8439;
+                }
+                return r;
+            case 's':
+                return 8444;
+            }
+            return r;
+        }
+        return r;
+    case 'c':
+        if (*p ++ == 't') {
+            return 8449;
+        }
+        return r;
+    }
+    return r;
+}
+
+static int html_cref_ftrie_cold_33(const char* p, int r)
+    __attribute__ ((cold, noinline));
+
+static int html_cref_ftrie_cold_33(const char* p, int r)
+{
+    switch (*p ++) {
+    case 'A':
+        switch (*p ++) {
+        case 'a':
+            if (*p ++ == 'r' &&
+                *p ++ == 'r') {
+                return 8208;
+            }
+            return r;
+        case 'r':
+            if (*p ++ == 'r') {
+                return 8213;
+            }
+            return r;
+        case 't':
+            if (*p ++ == 'a' &&
+                *p ++ == 'i' &&
+                *p ++ == 'l') {
+                return 8218;
+            }
+            return r;
+        }
+        return r;
+    case 'B':
+        if (*p ++ == 'a' &&
+            *p ++ == 'r' &&
+            *p ++ == 'r') {
+            return 8223;
+        }
+        return r;
+    case 'H':
+        if (*p ++ == 'a' &&
+            *p ++ == 'r') {
+            return 8228;
+        }
+        return r;
+    case 'b':
+        switch (*p ++) {
+        case 'a':
+            if (*p ++ == 'r' &&
+                *p ++ == 'r') {
+                return 8353;
+            }
+            return r;
+        case 'b':
+            if (*p ++ == 'r' &&
+                *p ++ == 'k') {
+                return 8358;
+            }
+            return r;
+        case 'r':
+            switch (*p ++) {
+            case 'a':
+                if (*p ++ == 'c') {
+                    switch (*p ++) {
+                    case 'e':
+                        return 8363;
+                    case 'k':
+                        return 8366;
+                    }
+                    return r;
+                }
+                return r;
+            case 'k':
+                switch (*p ++) {
+                case 'e':
+                    return 8369;
+                case 's':
+                    if (*p ++ == 'l') {
+                        switch (*p ++) {
+                        case 'd':
+                            return 8374;
+                        case 'u':
+                            return 8379;
+                        }
+                        return r;
+                    }
+                    return r;
+                }
+                return r;
+            }
+            return r;
+        }
+        return r;
+    case 'c':
+        switch (*p ++) {
+        case 'a':
+            if (*p ++ == 'r' &&
+                *p ++ == 'o' &&
+                *p ++ == 'n') {
+                return 8384;
+            }
+            return r;
+        case 'e':
+            switch (*p ++) {
+            case 'd':
+                if (*p ++ == 'i' &&
+                    *p ++ == 'l') {
+                    return 8388;
+                }
+                return r;
+            case 'i':
+                if (*p ++ == 'l') {
+                    return 8392;
+                }
+                return r;
+            }
+            return r;
+        case 'u':
+            if (*p ++ == 'b') {
+                return 8397;
+            }
+            return r;
+        case 'y':
+            return 8400;
+        }
+        return r;
+    case 'f':
+        switch (*p ++) {
+        case 'i':
+            if (*p ++ == 's' &&
+                *p ++ == 'h' &&
+                *p ++ == 't') {
+                return 8458;
+            }
+            return r;
+        case 'l':
+            if (*p ++ == 'o' &&
+                *p ++ == 'o' &&
+                *p ++ == 'r') {
+                return 8463;
+            }
+            return r;
+        case 'r':
+            return 8468;
+        }
+        return r;
+    case 'h':
+        switch (*p ++) {
+        case 'a':
+            if (*p ++ == 'r') {
+                switch (*p ++) {
+                case 'd':
+                    return 8474;
+                case 'u':
+                    r = 8479;
+                    if (*p ++ == 'l') {
+                        return 8484;
+                    }
+                    return r;
+                }
+                return r;
+            }
+            return r;
+        case 'o':
+            r = 8489;
+            if (*p ++ == 'v') {
+                return 8493;
+            }
+            return r;
+        }
+        return r;
+    case 'i':
+        switch (*p ++) {
+        case 'g':
+            if (*p ++ == 'h' &&
+                *p ++ == 't') {
+                switch (*p ++) {
+                case 'a':
+                    if (*p ++ == 'r' &&
+                        *p ++ == 'r' &&
+                        *p ++ == 'o' &&
+                        *p ++ == 'w') {
+                        r = 8497;
+                        if (*p ++ == 't' &&
+                            *p ++ == 'a' &&
+                            *p ++ == 'i' &&
+                            *p ++ == 'l') {
+                            return 8502;
+                        }
+                        return r;
+                    }
+                    return r;
+                case 'h':
+                    if (*p ++ == 'a' &&
+                        *p ++ == 'r' &&
+                        *p ++ == 'p' &&
+                        *p ++ == 'o' &&
+                        *p ++ == 'o' &&
+                        *p ++ == 'n') {
+                        switch (*p ++) {
+                        case 'd':
+                            if (*p ++ == 'o' &&
+                                *p ++ == 'w' &&
+                                *p ++ == 'n') {
+                                return 8507;
+                            }
+                            return r;
+                        case 'u':
+                            if (*p ++ == 'p') {
+                                return 8512;
+                            }
+                            return r;
+                        }
+                        return r;
+                    }
+                    return r;
+                case 'l':
+                    if (*p ++ == 'e' &&
+                        *p ++ == 'f' &&
+                        *p ++ == 't') {
+                        switch (*p ++) {
+                        case 'a':
+                            if (*p ++ == 'r' &&
+                                *p ++ == 'r' &&
+                                *p ++ == 'o' &&
+                                *p ++ == 'w' &&
+                                *p ++ == 's') {
+                                return 8517;
+                            }
+                            return r;
+                        case 'h':
+                            if (*p ++ == 'a' &&
+                                *p ++ == 'r' &&
+                                *p ++ == 'p' &&
+                                *p ++ == 'o' &&
+                                *p ++ == 'o' &&
+                                *p ++ == 'n' &&
+                                *p ++ == 's') {
+                                return 8522;
+                            }
+                            return r;
+                        }
+                        return r;
+                    }
+                    return r;
+                case 'r':
+                    if (*p ++ == 'i' &&
+                        *p ++ == 'g' &&
+                        *p ++ == 'h' &&
+                        *p ++ == 't' &&
+                        *p ++ == 'a' &&
+                        *p ++ == 'r' &&
+                        *p ++ == 'r' &&
+                        *p ++ == 'o' &&
+                        *p ++ == 'w' &&
+                        *p ++ == 's') {
+                        return 8527;
+                    }
+                    return r;
+                case 's':
+                    if (*p ++ == 'q' &&
+                        *p ++ == 'u' &&
+                        *p ++ == 'i' &&
+                        *p ++ == 'g' &&
+                        *p ++ == 'a' &&
+                        *p ++ == 'r' &&
+                        *p ++ == 'r' &&
+                        *p ++ == 'o' &&
+                        *p ++ == 'w') {
+                        return 8532;
+                    }
+                    return r;
+                case 't':
+                    if (*p ++ == 'h' &&
+                        *p ++ == 'r' &&
+                        *p ++ == 'e' &&
+                        *p ++ == 'e' &&
+                        *p ++ == 't' &&
+                        *p ++ == 'i' &&
+                        *p ++ == 'm' &&
+                        *p ++ == 'e' &&
+                        *p ++ == 's') {
+                        return 8537;
+                    }
+                    return r;
+                }
+                return r;
+            }
+            return r;
+        case 'n':
+            if (*p ++ == 'g') {
+                return 8542;
+            }
+            return r;
+        case 's':
+            if (*p ++ == 'i' &&
+                *p ++ == 'n' &&
+                *p ++ == 'g' &&
+                *p ++ == 'd' &&
+                *p ++ == 'o' &&
+                *p ++ == 't' &&
+                *p ++ == 's' &&
+                *p ++ == 'e' &&
+                *p ++ == 'q') {
+                return 8546;
+            }
+            return r;
+        }
+        return r;
+    case 'l':
+        switch (*p ++) {
+        case 'a':
+            if (*p ++ == 'r' &&
+                *p ++ == 'r') {
+                return 8551;
+            }
+            return r;
+        case 'h':
+            if (*p ++ == 'a' &&
+                *p ++ == 'r') {
+                return 8556;
+            }
+            return r;
+        case 'm':
+            return 8561;
+        }
+        return r;
+    case 'm':
+        if (*p ++ == 'o' &&
+            *p ++ == 'u' &&
+            *p ++ == 's' &&
+            *p ++ == 't') {
+            r = 8566;
+            if (*p ++ == 'a' &&
+                *p ++ == 'c' &&
+                *p ++ == 'h' &&
+                *p ++ == 'e') {
+                return 8571;
+            }
+            return r;
+        }
+        return r;
+    case 'n':
+        if (*p ++ == 'm' &&
+            *p ++ == 'i' &&
+            *p ++ == 'd') {
+            return 8576;
+        }
+        return r;
+    case 'o':
+        switch (*p ++) {
+        case 'a':
+            switch (*p ++) {
+            case 'n':
+                if (*p ++ == 'g') {
+                    return 8581;
+                }
+                return r;
+            case 'r':
+                if (*p ++ == 'r') {
+                    return 8586;
+                }
+                return r;
+            }
+            return r;
+        case 'b':
+            if (*p ++ == 'r' &&
+                *p ++ == 'k') {
+                return 8591;
+            }
+            return r;
+        case 'p':
+            switch (*p ++) {
+            case 'a':
+                if (*p ++ == 'r') {
+                    return 8596;
+                }
+                return r;
+            case 'f':
+                return 8601;
+            case 'l':
+                if (*p ++ == 'u' &&
+                    *p ++ == 's') {
+                    return 8607;
+                }
+                return r;
+            }
+            return r;
+        case 't':
+            if (*p ++ == 'i' &&
+                *p ++ == 'm' &&
+                *p ++ == 'e' &&
+                *p ++ == 's') {
+                return 8612;
+            }
+            return r;
+        }
+        return r;
+    case 'p':
+        switch (*p ++) {
+        case 'a':
+            if (*p ++ == 'r') {
+                r = 8617;
+                if (*p ++ == 'g' &&
+                    *p ++ == 't') {
+                    return 8620;
+                }
+                return r;
+            }
+            return r;
+        case 'p':
+            if (*p ++ == 'o' &&
+                *p ++ == 'l' &&
+                *p ++ == 'i' &&
+                *p ++ == 'n' &&
+                *p ++ == 't') {
+                return 8625;
+            }
+            return r;
+        }
+        return r;
+    case 'r':
+        if (*p ++ == 'a' &&
+            *p ++ == 'r' &&
+            *p ++ == 'r') {
+            return 8630;
+        }
+        return r;
+    case 't':
+        switch (*p ++) {
+        case 'h':
+            if (*p ++ == 'r' &&
+                *p ++ == 'e' &&
+                *p ++ == 'e') {
+                return 8664;
+            }
+            return r;
+        case 'i':
+            if (*p ++ == 'm' &&
+                *p ++ == 'e' &&
+                *p ++ == 's') {
+                return 8669;
+            }
+            return r;
+        case 'r':
+            if (*p ++ == 'i') {
+                r = 8674;
+                switch (*p ++) {
+                case 'e':
+                    return 8679;
+                case 'f':
+                    return 8684;
+                case 'l':
+                    if (*p ++ == 't' &&
+                        *p ++ == 'r' &&
+                        *p ++ == 'i') {
+                        return 8689;
+                    }
+                    return r;
+                }
+                return r;
+            }
+            return r;
+        }
+        return r;
+    case 'u':
+        if (*p ++ == 'l' &&
+            *p ++ == 'u' &&
+            *p ++ == 'h' &&
+            *p ++ == 'a' &&
+            *p ++ == 'r') {
+            return 8694;
+        }
+        return r;
+    case 'x':
+        return 8699;
+    }
+    return r;
+}
+
+static int html_cref_ftrie_cold_34(const char* p, int r)
+    __attribute__ ((cold, noinline));
+
+static int html_cref_ftrie_cold_34(const char* p, int r)
+{
+    switch (*p ++) {
+    case 's':
+        if (*p ++ == 'r') {
+            return 4028;
+        }
+        return r;
+    }
+    return r;
+}
+
+static int html_cref_ftrie_cold_35(const char* p, int r)
+    __attribute__ ((cold, noinline));
+
+static int html_cref_ftrie_cold_35(const char* p, int r)
+{
+    switch (*p ++) {
+    case 'f':
+        return 4013;
+    case 'r':
+        if (*p ++ == 'o' &&
+            *p ++ == 'd') {
+            return 4019;
+        }
+        return r;
+    }
+    return r;
+}
+
+static int html_cref_ftrie_cold_36(const char* p, int r)
+    __attribute__ ((cold, noinline));
+
+static int html_cref_ftrie_cold_36(const char* p, int r)
+{
+    switch (*p ++) {
+    case 'l':
+        if (*p ++ == 'o' &&
+            *p ++ == 'n') {
+            r = 3959;
+            if (*p ++ == 'e') {
+                r = 3962;
+                if (*p ++ == 'q') {
+                    return 3967;
+                }
+                return r;
+            }
+            return r;
+        }
+        return r;
+    case 'm':
+        switch (*p ++) {
+        case 'm':
+            if (*p ++ == 'a') {
+                r = 3972;
+                if (*p ++ == 't') {
+                    return 3975;
+                }
+                return r;
+            }
+            return r;
+        case 'p':
+            r = 3978;
+            switch (*p ++) {
+            case 'f':
+                if (*p ++ == 'n') {
+                    return 3983;
+                }
+                return r;
+            case 'l':
+                if (*p ++ == 'e') {
+                    switch (*p ++) {
+                    case 'm':
+                        if (*p ++ == 'e' &&
+                            *p ++ == 'n' &&
+                            *p ++ == 't') {
+                            return 3988;
+                        }
+                        return r;
+                    case 'x':
+                        if (*p ++ == 'e' &&
+                            *p ++ == 's') {
+                            return 3993;
+                        }
+                        return r;
+                    }
+                    return r;
+                }
+                return r;
+            }
+            return r;
+        }
+        return r;
+    case 'n':
+        switch (*p ++) {
+        case 'g':
+            r = 3998;
+            if (*p ++ == 'd' &&
+                *p ++ == 'o' &&
+                *p ++ == 't') {
+                return 4003;
+            }
+            return r;
+        case 'i':
+            if (*p ++ == 'n' &&
+                *p ++ == 't') {
+                return 4008;
+            }
+            return r;
+        }
+        return r;
+    }
+    return r;
+}
+
+static int html_cref_ftrie_cold_37(const char* p, int r)
+    __attribute__ ((cold, noinline));
+
+static int html_cref_ftrie_cold_37(const char* p, int r)
+{
+    switch (*p ++) {
+    case 'a':
+        switch (*p ++) {
+        case 'p':
+            if (*p ++ == 's') {
+                return 3804;
+            }
+            return r;
+        case 'r':
+            if (*p ++ == 'o' &&
+                *p ++ == 'n') {
+                return 3809;
+            }
+            return r;
+        }
+        return r;
+    case 'i':
+        if (*p ++ == 'r' &&
+            *p ++ == 'c') {
+            return 3817;
+        }
+        return r;
+    case 'u':
+        if (*p ++ == 'p' &&
+            *p ++ == 's') {
+            r = 3821;
+            if (*p ++ == 's' &&
+                *p ++ == 'm') {
+                return 3826;
+            }
+            return r;
+        }
+        return r;
+    }
+    return r;
+}
+
+static int html_cref_ftrie_cold_38(const char* p, int r)
+    __attribute__ ((cold, noinline));
+
+static int html_cref_ftrie_cold_38(const char* p, int r)
+{
+    switch (*p ++) {
+    case 'e':
+        if (*p ++ == 'r' &&
+            *p ++ == 'd' &&
+            *p ++ == 'o' &&
+            *p ++ == 't') {
+            return 3848;
+        }
+        return r;
+    }
+    return r;
+}
+
+static int html_cref_ftrie_cold_39(const char* p, int r)
+    __attribute__ ((cold, noinline));
+
+static int html_cref_ftrie_cold_39(const char* p, int r)
+{
+    switch (*p ++) {
+    case 'd':
+        if (*p ++ == 'i' &&
+            *p ++ == 'l') {
+            return 3835;
+        }
+        return r;
+    case 'm':
+        if (*p ++ == 'p' &&
+            *p ++ == 't' &&
+            *p ++ == 'y' &&
+            *p ++ == 'v') {
+            return 3839;
+        }
+        return r;
+    }
+    return r;
+}
+
+static int html_cref_ftrie_cold_40(const char* p, int r)
+    __attribute__ ((cold, noinline));
+
+static int html_cref_ftrie_cold_40(const char* p, int r)
+{
+    switch (*p ++) {
+    case 'a':
+        switch (*p ++) {
+        case 'c':
+            if (*p ++ == 'u' &&
+                *p ++ == 't' &&
+                *p ++ == 'e') {
+                return 3753;
+            }
+            return r;
+        case 'p':
+            r = 3757;
+            switch (*p ++) {
+            case 'a':
+                if (*p ++ == 'n' &&
+                    *p ++ == 'd') {
+                    return 3762;
+                }
+                return r;
+            case 'b':
+                if (*p ++ == 'r' &&
+                    *p ++ == 'c' &&
+                    *p ++ == 'u' &&
+                    *p ++ == 'p') {
+                    return 3767;
+                }
+                return r;
+            case 'c':
+                switch (*p ++) {
+                case 'a':
+                    if (*p ++ == 'p') {
+                        return 3772;
+                    }
+                    return r;
+                case 'u':
+                    if (*p ++ == 'p') {
+                        return 3777;
+                    }
+                    return r;
+                }
+                return r;
+            case 'd':
+                if (*p ++ == 'o' &&
+                    *p ++ == 't') {
+                    return 3782;
+                }
+                return r;
+            case 's':
+                return 3787;
+            }
+            return r;
+        case 'r':
+            switch (*p ++) {
+            case 'e':
+                if (*p ++ == 't') {
+                    return 3795;
+                }
+                return r;
+            case 'o':
+                if (*p ++ == 'n') {
+                    return 3800;
+                }
+                return r;
+            }
+            return r;
+        }
+        return r;
+    case 'd':
+        if (*p ++ == 'o' &&
+            *p ++ == 't') {
+            return 3831;
+        }
+        return r;
+    case 'f':
+        if (*p ++ == 'r') {
+            return 3852;
+        }
+        return r;
+    case 'h':
+        switch (*p ++) {
+        case 'c':
+            if (*p ++ == 'y') {
+                return 3858;
+            }
+            return r;
+        case 'e':
+            if (*p ++ == 'c' &&
+                *p ++ == 'k') {
+                r = 3862;
+                if (*p ++ == 'm' &&
+                    *p ++ == 'a' &&
+                    *p ++ == 'r' &&
+                    *p ++ == 'k') {
+                    return 3867;
+                }
+                return r;
+            }
+            return r;
+        case 'i':
+            return 3872;
+        }
+        return r;
+    case 'i':
+        if (*p ++ == 'r') {
+            r = 3876;
+            switch (*p ++) {
+            case 'E':
+                return 3881;
+            case 'c':
+                r = 3886;
+                switch (*p ++) {
+                case 'e':
+                    if (*p ++ == 'q') {
+                        return 3890;
+                    }
+                    return r;
+                case 'l':
+                    if (*p ++ == 'e') {
+                        switch (*p ++) {
+                        case 'a':
+                            if (*p ++ == 'r' &&
+                                *p ++ == 'r' &&
+                                *p ++ == 'o' &&
+                                *p ++ == 'w') {
+                                switch (*p ++) {
+                                case 'l':
+                                    if (*p ++ == 'e' &&
+                                        *p ++ == 'f' &&
+                                        *p ++ == 't') {
+                                        return 3895;
+                                    }
+                                    return r;
+                                case 'r':
+                                    if (*p ++ == 'i' &&
+                                        *p ++ == 'g' &&
+                                        *p ++ == 'h' &&
+                                        *p ++ == 't') {
+                                        return 3900;
+                                    }
+                                    return r;
+                                }
+                                return r;
+                            }
+                            return r;
+                        case 'd':
+                            switch (*p ++) {
+                            case 'R':
+                                return 3905;
+                            case 'S':
+                                return 3909;
+                            case 'a':
+                                if (*p ++ == 's' &&
+                                    *p ++ == 't') {
+                                    return 3914;
+                                }
+                                return r;
+                            case 'c':
+                                if (*p ++ == 'i' &&
+                                    *p ++ == 'r' &&
+                                    *p ++ == 'c') {
+                                    return 3919;
+                                }
+                                return r;
+                            case 'd':
+                                if (*p ++ == 'a' &&
+                                    *p ++ == 's' &&
+                                    *p ++ == 'h') {
+                                    return 3924;
+                                }
+                                return r;
+                            }
+                            return r;
+                        }
+                        return r;
+                    }
+                    return r;
+                }
+                return r;
+            case 'e':
+                return 3929;
+            case 'f':
+                if (*p ++ == 'n' &&
+                    *p ++ == 'i' &&
+                    *p ++ == 'n' &&
+                    *p ++ == 't') {
+                    return 3934;
+                }
+                return r;
+            case 'm':
+                if (*p ++ == 'i' &&
+                    *p ++ == 'd') {
+                    return 3939;
+                }
+                return r;
+            case 's':
+                if (*p ++ == 'c' &&
+                    *p ++ == 'i' &&
+                    *p ++ == 'r') {
+                    return 3944;
+                }
+                return r;
+            }
+            return r;
+        }
+        return r;
+    case 'l':
+        if (*p ++ == 'u' &&
+            *p ++ == 'b' &&
+            *p ++ == 's') {
+            r = 3949;
+            if (*p ++ == 'u' &&
+                *p ++ == 'i' &&
+                *p ++ == 't') {
+                return 3954;
+            }
+            return r;
+        }
+        return r;
+    case 'r':
+        switch (*p ++) {
+        case 'a':
+            if (*p ++ == 'r' &&
+                *p ++ == 'r') {
+                return 4033;
+            }
+            return r;
+        case 'o':
+            if (*p ++ == 's' &&
+                *p ++ == 's') {
+                return 4038;
+            }
+            return r;
+        }
+        return r;
+    case 's':
+        switch (*p ++) {
+        case 'c':
+            if (*p ++ == 'r') {
+                return 4043;
+            }
+            return r;
+        case 'u':
+            switch (*p ++) {
+            case 'b':
+                r = 4049;
+                if (*p ++ == 'e') {
+                    return 4054;
+                }
+                return r;
+            case 'p':
+                r = 4059;
+                if (*p ++ == 'e') {
+                    return 4064;
+                }
+                return r;
+            }
+            return r;
+        }
+        return r;
+    case 't':
+        if (*p ++ == 'd' &&
+            *p ++ == 'o' &&
+            *p ++ == 't') {
+            return 4069;
+        }
+        return r;
+    case 'u':
+        switch (*p ++) {
+        case 'd':
+            if (*p ++ == 'a' &&
+                *p ++ == 'r' &&
+                *p ++ == 'r') {
+                switch (*p ++) {
+                case 'l':
+                    return 4074;
+                case 'r':
+                    return 4079;
+                }
+                return r;
+            }
+            return r;
+        case 'e':
+            switch (*p ++) {
+            case 'p':
+                if (*p ++ == 'r') {
+                    return 4084;
+                }
+                return r;
+            case 's':
+                if (*p ++ == 'c') {
+                    return 4089;
+                }
+                return r;
+            }
+            return r;
+        case 'l':
+            if (*p ++ == 'a' &&
+                *p ++ == 'r' &&
+                *p ++ == 'r') {
+                r = 4094;
+                if (*p ++ == 'p') {
+                    return 4099;
+                }
+                return r;
+            }
+            return r;
+        case 'p':
+            r = 4104;
+            switch (*p ++) {
+            case 'b':
+                if (*p ++ == 'r' &&
+                    *p ++ == 'c' &&
+                    *p ++ == 'a' &&
+                    *p ++ == 'p') {
+                    return 4109;
+                }
+                return r;
+            case 'c':
+                switch (*p ++) {
+                case 'a':
+                    if (*p ++ == 'p') {
+                        return 4114;
+                    }
+                    return r;
+                case 'u':
+                    if (*p ++ == 'p') {
+                        return 4119;
+                    }
+                    return r;
+                }
+                return r;
+            case 'd':
+                if (*p ++ == 'o' &&
+                    *p ++ == 't') {
+                    return 4124;
+                }
+                return r;
+            case 'o':
+                if (*p ++ == 'r') {
+                    return 4129;
+                }
+                return r;
+            case 's':
+                return 4134;
+            }
+            return r;
+        case 'r':
+            switch (*p ++) {
+            case 'a':
+                if (*p ++ == 'r' &&
+                    *p ++ == 'r') {
+                    r = 4142;
+                    if (*p ++ == 'm') {
+                        return 4147;
+                    }
+                    return r;
+                }
+                return r;
+            case 'l':
+                if (*p ++ == 'y') {
+                    switch (*p ++) {
+                    case 'e':
+                        if (*p ++ == 'q') {
+                            switch (*p ++) {
+                            case 'p':
+                                if (*p ++ == 'r' &&
+                                    *p ++ == 'e' &&
+                                    *p ++ == 'c') {
+                                    return 4152;
+                                }
+                                return r;
+                            case 's':
+                                if (*p ++ == 'u' &&
+                                    *p ++ == 'c' &&
+                                    *p ++ == 'c') {
+                                    return 4157;
+                                }
+                                return r;
+                            }
+                            return r;
+                        }
+                        return r;
+                    case 'v':
+                        if (*p ++ == 'e' &&
+                            *p ++ == 'e') {
+                            return 4162;
+                        }
+                        return r;
+                    case 'w':
+                        if (*p ++ == 'e' &&
+                            *p ++ == 'd' &&
+                            *p ++ == 'g' &&
+                            *p ++ == 'e') {
+                            return 4167;
+                        }
+                        return r;
+                    }
+                    return r;
+                }
+                return r;
+            case 'r':
+                if (*p ++ == 'e' &&
+                    *p ++ == 'n') {
+                    return 4172;
+                }
+                return r;
+            case 'v':
+                if (*p ++ == 'e' &&
+                    *p ++ == 'a' &&
+                    *p ++ == 'r' &&
+                    *p ++ == 'r' &&
+                    *p ++ == 'o' &&
+                    *p ++ == 'w') {
+                    switch (*p ++) {
+                    case 'l':
+                        if (*p ++ == 'e' &&
+                            *p ++ == 'f' &&
+                            *p ++ == 't') {
+                            return 4176;
+                        }
+                        return r;
+                    case 'r':
+                        if (*p ++ == 'i' &&
+                            *p ++ == 'g' &&
+                            *p ++ == 'h' &&
+                            *p ++ == 't') {
+                            return 4181;
+                        }
+                        return r;
+                    }
+                    return r;
+                }
+                return r;
+            }
+            return r;
+        case 'v':
+            if (*p ++ == 'e' &&
+                *p ++ == 'e') {
+                return 4186;
+            }
+            return r;
+        case 'w':
+            if (*p ++ == 'e' &&
+                *p ++ == 'd') {
+                return 4191;
+            }
+            return r;
+        }
+        return r;
+    case 'w':
+        switch (*p ++) {
+        case 'c':
+            if (*p ++ == 'o' &&
+                *p ++ == 'n' &&
+                *p ++ == 'i' &&
+                *p ++ == 'n' &&
+                *p ++ == 't') {
+                return 4196;
+            }
+            return r;
+        case 'i':
+            if (*p ++ == 'n' &&
+                *p ++ == 't') {
+                return 4201;
+            }
+            return r;
+        }
+        return r;
+    case 'y':
+        if (*p ++ == 'l' &&
+            *p ++ == 'c' &&
+            *p ++ == 't' &&
+            *p ++ == 'y') {
+            return 4206;
+        }
+        return r;
+    }
+    return r;
+}
+
+static int html_cref_ftrie_cold_41(const char* p, int r)
+    __attribute__ ((cold, noinline));
+
+static int html_cref_ftrie_cold_41(const char* p, int r)
+{
+    switch (*p ++) {
+    case 'a':
+        if (*p ++ == 's' &&
+            *p ++ == 't') {
+            return 6585;
+        }
+        return r;
+    case 'c':
+        if (*p ++ == 'i' &&
+            *p ++ == 'r') {
+            return 6588;
+        }
+        return r;
+    }
+    return r;
+}
+
+static int html_cref_ftrie_cold_42(const char* p, int r)
+    __attribute__ ((cold, noinline));
+
+static int html_cref_ftrie_cold_42(const char* p, int r)
+{
+    switch (*p ++) {
+    case 'n':
+        if (*p ++ == 'u' &&
+            *p ++ == 's') {
+            r = 6597;
+            switch (*p ++) {
+            case 'b':
+                return 6602;
+            case 'd':
+                r = 6607;
+                if (*p ++ == 'u') {
+                    return 6612;
+                }
+                return r;
+            }
+            return r;
+        }
+        return r;
+    }
+    return r;
+}
+
+static int html_cref_ftrie_cold_43(const char* p, int r)
+    __attribute__ ((cold, noinline));
+
+static int html_cref_ftrie_cold_43(const char* p, int r)
+{
+    switch (*p ++) {
+    case 'D':
+        if (*p ++ == 'D' &&
+            *p ++ == 'o' &&
+            *p ++ == 't') {
+            return 6492;
+        }
+        return r;
+    case 'a':
+        switch (*p ++) {
+        case 'c':
+            if (*p ++ == 'r') {
+                return 6497;
+            }
+            return r;
+        case 'l':
+            switch (*p ++) {
+            case 'e':
+                return 6501;
+            case 't':
+                r = 6506;
+                if (*p ++ == 'e' &&
+                    *p ++ == 's' &&
+                    *p ++ == 'e') {
+                    return 6511;
+                }
+                return r;
+            }
+            return r;
+        case 'p':
+            r = 6516;
+            if (*p ++ == 's' &&
+                *p ++ == 't' &&
+                *p ++ == 'o') {
+                r = 6521;
+                switch (*p ++) {
+                case 'd':
+                    if (*p ++ == 'o' &&
+                        *p ++ == 'w' &&
+                        *p ++ == 'n') {
+                        return 6526;
+                    }
+                    return r;
+                case 'l':
+                    if (*p ++ == 'e' &&
+                        *p ++ == 'f' &&
+                        *p ++ == 't') {
+                        return 6531;
+                    }
+                    return r;
+                case 'u':
+                    if (*p ++ == 'p') {
+                        return 6536;
+                    }
+                    return r;
+                }
+                return r;
+            }
+            return r;
+        case 'r':
+            if (*p ++ == 'k' &&
+                *p ++ == 'e' &&
+                *p ++ == 'r') {
+                return 6541;
+            }
+            return r;
+        }
+        return r;
+    case 'c':
+        switch (*p ++) {
+        case 'o':
+            if (*p ++ == 'm' &&
+                *p ++ == 'm' &&
+                *p ++ == 'a') {
+                return 6546;
+            }
+            return r;
+        case 'y':
+            return 6551;
+        }
+        return r;
+    case 'e':
+        if (*p ++ == 'a' &&
+            *p ++ == 's' &&
+            *p ++ == 'u' &&
+            *p ++ == 'r' &&
+            *p ++ == 'e' &&
+            *p ++ == 'd' &&
+            *p ++ == 'a' &&
+            *p ++ == 'n' &&
+            *p ++ == 'g' &&
+            *p ++ == 'l' &&
+            *p ++ == 'e') {
+            return 6560;
+        }
+        return r;
+    case 'f':
+        if (*p ++ == 'r') {
+            return 6565;
+        }
+        return r;
+    case 'h':
+        if (*p ++ == 'o') {
+            return 6571;
+        }
+        return r;
+    case 'l':
+        switch (*p ++) {
+        case 'c':
+            if (*p ++ == 'p') {
+                return 6617;
+            }
+            return r;
+        case 'd':
+            if (*p ++ == 'r') {
+                return 6622;
+            }
+            return r;
+        }
+        return r;
+    case 'n':
+        if (*p ++ == 'p' &&
+            *p ++ == 'l' &&
+            *p ++ == 'u' &&
+            *p ++ == 's') {
+            return 6627;
+        }
+        return r;
+    case 'o':
+        switch (*p ++) {
+        case 'd':
+            if (*p ++ == 'e' &&
+                *p ++ == 'l' &&
+                *p ++ == 's') {
+                return 6632;
+            }
+            return r;
+        case 'p':
+            if (*p ++ == 'f') {
+                return 6637;
+            }
+            return r;
+        }
+        return r;
+    case 'p':
+        return 6643;
+    case 's':
+        switch (*p ++) {
+        case 'c':
+            if (*p ++ == 'r') {
+                return 6648;
+            }
+            return r;
+        case 't':
+            if (*p ++ == 'p' &&
+                *p ++ == 'o' &&
+                *p ++ == 's') {
+                return 6654;
+            }
+            return r;
+        }
+        return r;
+    case 'u':
+        r = 6659;
+        switch (*p ++) {
+        case 'l':
+            if (*p ++ == 't' &&
+                *p ++ == 'i' &&
+                *p ++ == 'm' &&
+                *p ++ == 'a' &&
+                *p ++ == 'p') {
+                return 6663;
+            }
+            return r;
+        case 'm':
+            if (*p ++ == 'a' &&
+                *p ++ == 'p') {
+                return 6668;
+            }
+            return r;
+        }
+        return r;
+    }
+    return r;
+}
+
+static int html_cref_ftrie_cold_44(const char* p, int r)
+    __attribute__ ((cold, noinline));
+
+static int html_cref_ftrie_cold_44(const char* p, int r)
+{
+    switch (*p ++) {
+    case 'u':
+        if (*p ++ == 'i' &&
+            *p ++ == 't') {
+            return 5334;
+        }
+        return r;
+    }
+    return r;
+}
+
+static int html_cref_ftrie_cold_45(const char* p, int r)
+    __attribute__ ((cold, noinline));
+
+static int html_cref_ftrie_cold_45(const char* p, int r)
+{
+    switch (*p ++) {
+    case 'r':
+        if (*p ++ == 'c' &&
+            *p ++ == 'o' &&
+            *p ++ == 'n') {
+            return 5344;
+        }
+        return r;
+    }
+    return r;
+}
+
+static int html_cref_ftrie_cold_46(const char* p, int r)
+    __attribute__ ((cold, noinline));
+
+static int html_cref_ftrie_cold_46(const char* p, int r)
+{
+    switch (*p ++) {
+    case 'A':
+        if (*p ++ == 'r' &&
+            *p ++ == 'r') {
+            return 5282;
+        }
+        return r;
+    case 'a':
+        switch (*p ++) {
+        case 'i':
+            if (*p ++ == 'r' &&
+                *p ++ == 's' &&
+                *p ++ == 'p') {
+                return 5287;
+            }
+            return r;
+        case 'l':
+            if (*p ++ == 'f') {
+                return 5292;
+            }
+            return r;
+        case 'm':
+            if (*p ++ == 'i' &&
+                *p ++ == 'l' &&
+                *p ++ == 't') {
+                return 5296;
+            }
+            return r;
+        case 'r':
+            switch (*p ++) {
+            case 'd':
+                if (*p ++ == 'c' &&
+                    *p ++ == 'y') {
+                    return 5301;
+                }
+                return r;
+            case 'r':
+                r = 5305;
+                switch (*p ++) {
+                case 'c':
+                    if (*p ++ == 'i' &&
+                        *p ++ == 'r') {
+                        return 5310;
+                    }
+                    return r;
+                case 'w':
+                    return 5315;
+                }
+                return r;
+            }
+            return r;
+        }
+        return r;
+    case 'b':
+        if (*p ++ == 'a' &&
+            *p ++ == 'r') {
+            return 5320;
+        }
+        return r;
+    case 'c':
+        if (*p ++ == 'i' &&
+            *p ++ == 'r' &&
+            *p ++ == 'c') {
+            return 5325;
+        }
+        return r;
+    case 'f':
+        if (*p ++ == 'r') {
+            return 5349;
+        }
+        return r;
+    case 'k':
+        if (*p ++ == 's') {
+            switch (*p ++) {
+            case 'e':
+                if (*p ++ == 'a' &&
+                    *p ++ == 'r' &&
+                    *p ++ == 'o' &&
+                    *p ++ == 'w') {
+                    return 5355;
+                }
+                return r;
+            case 'w':
+                if (*p ++ == 'a' &&
+                    *p ++ == 'r' &&
+                    *p ++ == 'o' &&
+                    *p ++ == 'w') {
+                    return 5360;
+                }
+                return r;
+            }
+            return r;
+        }
+        return r;
+    case 'o':
+        switch (*p ++) {
+        case 'a':
+            if (*p ++ == 'r' &&
+                *p ++ == 'r') {
+                return 5365;
+            }
+            return r;
+        case 'm':
+            if (*p ++ == 't' &&
+                *p ++ == 'h' &&
+                *p ++ == 't') {
+                return 5370;
+            }
+            return r;
+        case 'o':
+            if (*p ++ == 'k') {
+                switch (*p ++) {
+                case 'l':
+                    if (*p ++ == 'e' &&
+                        *p ++ == 'f' &&
+                        *p ++ == 't' &&
+                        *p ++ == 'a' &&
+                        *p ++ == 'r' &&
+                        *p ++ == 'r' &&
+                        *p ++ == 'o' &&
+                        *p ++ == 'w') {
+                        return 5375;
+                    }
+                    return r;
+                case 'r':
+                    if (*p ++ == 'i' &&
+                        *p ++ == 'g' &&
+                        *p ++ == 'h' &&
+                        *p ++ == 't' &&
+                        *p ++ == 'a' &&
+                        *p ++ == 'r' &&
+                        *p ++ == 'r' &&
+                        *p ++ == 'o' &&
+                        *p ++ == 'w') {
+                        return 5380;
+                    }
+                    return r;
+                }
+                return r;
+            }
+            return r;
+        case 'p':
+            if (*p ++ == 'f') {
+                return 5385;
+            }
+            return r;
+        case 'r':
+            if (*p ++ == 'b' &&
+                *p ++ == 'a' &&
+                *p ++ == 'r') {
+                return 5391;
+            }
+            return r;
+        }
+        return r;
+    case 's':
+        switch (*p ++) {
+        case 'c':
+            if (*p ++ == 'r') {
+                return 5396;
+            }
+            return r;
+        case 'l':
+            if (*p ++ == 'a' &&
+                *p ++ == 's' &&
+                *p ++ == 'h') {
+                return 5402;
+            }
+            return r;
+        case 't':
+            if (*p ++ == 'r' &&
+                *p ++ == 'o' &&
+                *p ++ == 'k') {
+                return 5407;
+            }
+            return r;
+        }
+        return r;
+    case 'y':
+        switch (*p ++) {
+        case 'b':
+            if (*p ++ == 'u' &&
+                *p ++ == 'l' &&
+                *p ++ == 'l') {
+                return 5411;
+            }
+            return r;
+        case 'p':
+            if (*p ++ == 'h' &&
+                *p ++ == 'e' &&
+                *p ++ == 'n') {
+                return 5416;
+            }
+            return r;
+        }
+        return r;
+    }
+    return r;
+}
+
+static int html_cref_ftrie_cold_47(const char* p, int r)
+    __attribute__ ((cold, noinline));
+
+static int html_cref_ftrie_cold_47(const char* p, int r)
+{
+    switch (*p ++) {
+    case 's':
+        if (*p ++ == 't' &&
+            *p ++ == 'e' &&
+            *p ++ == 'r') {
+            return 4532;
+        }
+        return r;
+    }
+    return r;
+}
+
+static int html_cref_ftrie_cold_48(const char* p, int r)
+    __attribute__ ((cold, noinline));
+
+static int html_cref_ftrie_cold_48(const char* p, int r)
+{
+    switch (*p ++) {
+    case 'm':
+        if (*p ++ == 'l') {
+            return 4784;
+        }
+        return r;
+    }
+    return r;
+}
+
+static int html_cref_ftrie_cold_49(const char* p, int r)
+    __attribute__ ((cold, noinline));
+
+static int html_cref_ftrie_cold_49(const char* p, int r)
+{
+    switch (*p ++) {
+    case 's':
+        r = 4588;
+        if (*p ++ == 'd' &&
+            *p ++ == 'o' &&
+            *p ++ == 't') {
+            return 4593;
+        }
+        return r;
+    }
+    return r;
+}
+
+static int html_cref_ftrie_cold_50(const char* p, int r)
+    __attribute__ ((cold, noinline));
+
+static int html_cref_ftrie_cold_50(const char* p, int r)
+{
+    switch (*p ++) {
+    case 'a':
+        if (*p ++ == 'r' &&
+            *p ++ == 'o' &&
+            *p ++ == 'n') {
+            return 4537;
+        }
+        return r;
+    case 'o':
+        if (*p ++ == 'l' &&
+            *p ++ == 'o' &&
+            *p ++ == 'n') {
+            return 4550;
+        }
+        return r;
+    case 'y':
+        return 4555;
+    }
+    return r;
+}
+
+static int html_cref_ftrie_cold_51(const char* p, int r)
+    __attribute__ ((cold, noinline));
+
+static int html_cref_ftrie_cold_51(const char* p, int r)
+{
+    switch (*p ++) {
+    case '1':
+        switch (*p ++) {
+        case '3':
+            return 4647;
+        case '4':
+            return 4652;
+        }
+        return r;
+    }
+    return r;
+}
+
+static int html_cref_ftrie_cold_52(const char* p, int r)
+    __attribute__ ((cold, noinline));
+
+static int html_cref_ftrie_cold_52(const char* p, int r)
+{
+    switch (*p ++) {
+    case 'a':
+        if (*p ++ == 'c' &&
+            *p ++ == 'r') {
+            return 4623;
+        }
+        return r;
+    case 'p':
+        if (*p ++ == 't' &&
+            *p ++ == 'y') {
+            r = 4627;
+            switch (*p ++) {
+            case 's':
+                if (*p ++ == 'e' &&
+                    *p ++ == 't') {
+                    return 4632;
+                }
+                return r;
+            case 'v':
+                return 4637;
+            }
+            return r;
+        }
+        return r;
+    }
+    return r;
+}
+
+static int html_cref_ftrie_cold_53(const char* p, int r)
+    __attribute__ ((cold, noinline));
+
+static int html_cref_ftrie_cold_53(const char* p, int r)
+{
+    switch (*p ++) {
+    case 'g':
+        return 4657;
+    }
+    return r;
+}
+
+static int html_cref_ftrie_cold_54(const char* p, int r)
+    __attribute__ ((cold, noinline));
+
+static int html_cref_ftrie_cold_54(const char* p, int r)
+{
+    switch (*p ++) {
+    case 'D':
+        switch (*p ++) {
+        case 'D':
+            if (*p ++ == 'o' &&
+                *p ++ == 't') {
+                return 4518;
+            }
+            return r;
+        case 'o':
+            if (*p ++ == 't') {
+                return 4523;
+            }
+            return r;
+        }
+        return r;
+    case 'd':
+        if (*p ++ == 'o' &&
+            *p ++ == 't') {
+            return 4559;
+        }
+        return r;
+    case 'e':
+        return 4563;
+    case 'f':
+        switch (*p ++) {
+        case 'D':
+            if (*p ++ == 'o' &&
+                *p ++ == 't') {
+                return 4568;
+            }
+            return r;
+        case 'r':
+            return 4573;
+        }
+        return r;
+    case 'l':
+        r = 4598;
+        switch (*p ++) {
+        case 'i':
+            if (*p ++ == 'n' &&
+                *p ++ == 't' &&
+                *p ++ == 'e' &&
+                *p ++ == 'r' &&
+                *p ++ == 's') {
+                return 4603;
+            }
+            return r;
+        case 'l':
+            return 4608;
+        case 's':
+            r = 4613;
+            if (*p ++ == 'd' &&
+                *p ++ == 'o' &&
+                *p ++ == 't') {
+                return 4618;
+            }
+            return r;
+        }
+        return r;
+    case 'o':
+        switch (*p ++) {
+        case 'g':
+            if (*p ++ == 'o' &&
+                *p ++ == 'n') {
+                return 4666;
+            }
+            return r;
+        case 'p':
+            if (*p ++ == 'f') {
+                return 4670;
+            }
+            return r;
+        }
+        return r;
+    case 'p':
+        switch (*p ++) {
+        case 'a':
+            if (*p ++ == 'r') {
+                r = 4676;
+                if (*p ++ == 's' &&
+                    *p ++ == 'l') {
+                    return 4681;
+                }
+                return r;
+            }
+            return r;
+        case 'l':
+            if (*p ++ == 'u' &&
+                *p ++ == 's') {
+                return 4686;
+            }
+            return r;
+        case 's':
+            if (*p ++ == 'i') {
+                r = 4691;
+                switch (*p ++) {
+                case 'l':
+                    if (*p ++ == 'o' &&
+                        *p ++ == 'n') {
+                        return 4695;
+                    }
+                    return r;
+                case 'v':
+                    return 4699;
+                }
+                return r;
+            }
+            return r;
+        }
+        return r;
+    case 'q':
+        switch (*p ++) {
+        case 'c':
+            switch (*p ++) {
+            case 'i':
+                if (*p ++ == 'r' &&
+                    *p ++ == 'c') {
+                    return 4703;
+                }
+                return r;
+            case 'o':
+                if (*p ++ == 'l' &&
+                    *p ++ == 'o' &&
+                    *p ++ == 'n') {
+                    return 4708;
+                }
+                return r;
+            }
+            return r;
+        case 's':
+            switch (*p ++) {
+            case 'i':
+                if (*p ++ == 'm') {
+                    return 4713;
+                }
+                return r;
+            case 'l':
+                if (*p ++ == 'a' &&
+                    *p ++ == 'n' &&
+                    *p ++ == 't') {
+                    switch (*p ++) {
+                    case 'g':
+                        if (*p ++ == 't' &&
+                            *p ++ == 'r') {
+                            return 4718;
+                        }
+                        return r;
+                    case 'l':
+                        if (*p ++ == 'e' &&
+                            *p ++ == 's' &&
+                            *p ++ == 's') {
+                            return 4723;
+                        }
+                        return r;
+                    }
+                    return r;
+                }
+                return r;
+            }
+            return r;
+        case 'u':
+            switch (*p ++) {
+            case 'a':
+                if (*p ++ == 'l' &&
+                    *p ++ == 's') {
+                    return 4728;
+                }
+                return r;
+            case 'e':
+                if (*p ++ == 's' &&
+                    *p ++ == 't') {
+                    return 4731;
+                }
+                return r;
+            case 'i':
+                if (*p ++ == 'v') {
+                    r = 4736;
+                    if (*p ++ == 'D' &&
+                        *p ++ == 'D') {
+                        return 4741;
+                    }
+                    return r;
+                }
+                return r;
+            }
+            return r;
+        case 'v':
+            if (*p ++ == 'p' &&
+                *p ++ == 'a' &&
+                *p ++ == 'r' &&
+                *p ++ == 's' &&
+                *p ++ == 'l') {
+                return 4746;
+            }
+            return r;
+        }
+        return r;
+    case 'r':
+        switch (*p ++) {
+        case 'D':
+            if (*p ++ == 'o' &&
+                *p ++ == 't') {
+                return 4751;
+            }
+            return r;
+        case 'a':
+            if (*p ++ == 'r' &&
+                *p ++ == 'r') {
+                return 4756;
+            }
+            return r;
+        }
+        return r;
+    case 's':
+        switch (*p ++) {
+        case 'c':
+            if (*p ++ == 'r') {
+                return 4761;
+            }
+            return r;
+        case 'd':
+            if (*p ++ == 'o' &&
+                *p ++ == 't') {
+                return 4766;
+            }
+            return r;
+        case 'i':
+            if (*p ++ == 'm') {
+                return 4771;
+            }
+            return r;
+        }
+        return r;
+    case 't':
+        switch (*p ++) {
+        case 'a':
+            return 4776;
+        case 'h':
+            return 4780;
+        }
+        return r;
+    case 'x':
+        switch (*p ++) {
+        case 'c':
+            if (*p ++ == 'l') {
+                return 4793;
+            }
+            return r;
+        case 'i':
+            if (*p ++ == 's' &&
+                *p ++ == 't') {
+                return 4796;
+            }
+            return r;
+        case 'p':
+            switch (*p ++) {
+            case 'e':
+                if (*p ++ == 'c' &&
+                    *p ++ == 't' &&
+                    *p ++ == 'a' &&
+                    *p ++ == 't' &&
+                    *p ++ == 'i' &&
+                    *p ++ == 'o' &&
+                    *p ++ == 'n') {
+                    return 4801;
+                }
+                return r;
+            case 'o':
+                if (*p ++ == 'n' &&
+                    *p ++ == 'e' &&
+                    *p ++ == 'n' &&
+                    *p ++ == 't' &&
+                    *p ++ == 'i' &&
+                    *p ++ == 'a' &&
+                    *p ++ == 'l' &&
+                    *p ++ == 'e') {
+                    return 4806;
+                }
+                return r;
+            }
+            return r;
+        }
+        return r;
+    }
+    return r;
+}
+
+static int html_cref_ftrie_cold_55(const char* p, int r)
+    __attribute__ ((cold, noinline));
+
+static int html_cref_ftrie_cold_55(const char* p, int r)
+{
+    switch (*p ++) {
+    case 'i':
+        switch (*p ++) {
+        case 'a':
+            if (*p ++ == 'n' &&
+                *p ++ == 'g' &&
+                *p ++ == 'l' &&
+                *p ++ == 'e') {
+                r = 9619;
+                switch (*p ++) {
+                case 'd':
+                    if (*p ++ == 'o' &&
+                        *p ++ == 'w' &&
+                        *p ++ == 'n') {
+                        return 9624;
+                    }
+                    return r;
+                case 'l':
+                    if (*p ++ == 'e' &&
+                        *p ++ == 'f' &&
+                        *p ++ == 't') {
+                        r = 9629;
+                        if (*p ++ == 'e' &&
+                            *p ++ == 'q') {
+                            return 9634;
+                        }
+                        return r;
+                    }
+                    return r;
+                case 'q':
+                    return 9639;
+                case 'r':
+                    if (*p ++ == 'i' &&
+                        *p ++ == 'g' &&
+                        *p ++ == 'h' &&
+                        *p ++ == 't') {
+                        r = 9644;
+                        if (*p ++ == 'e' &&
+                            *p ++ == 'q') {
+                            return 9649;
+                        }
+                        return r;
+                    }
+                    return r;
+                }
+                return r;
+            }
+            return r;
+        case 'd':
+            if (*p ++ == 'o' &&
+                *p ++ == 't') {
+                return 9654;
+            }
+            return r;
+        case 'e':
+            return 9659;
+        case 'm':
+            if (*p ++ == 'i' &&
+                *p ++ == 'n' &&
+                *p ++ == 'u' &&
+                *p ++ == 's') {
+                return 9664;
+            }
+            return r;
+        case 'p':
+            if (*p ++ == 'l' &&
+                *p ++ == 'u' &&
+                *p ++ == 's') {
+                return 9669;
+            }
+            return r;
+        case 's':
+            if (*p ++ == 'b') {
+                return 9674;
+            }
+            return r;
+        case 't':
+            if (*p ++ == 'i' &&
+                *p ++ == 'm' &&
+                *p ++ == 'e') {
+                return 9679;
+            }
+            return r;
+        }
+        return r;
+    case 'p':
+        if (*p ++ == 'e' &&
+            *p ++ == 'z' &&
+            *p ++ == 'i' &&
+            *p ++ == 'u' &&
+            *p ++ == 'm') {
+            return 9684;
+        }
+        return r;
+    }
+    return r;
+}
+
+static int html_cref_ftrie_cold_56(const char* p, int r)
+    __attribute__ ((cold, noinline));
+
+static int html_cref_ftrie_cold_56(const char* p, int r)
+{
+    switch (*p ++) {
+    case 'b':
+        r = 9553;
+        if (*p ++ == 'a' &&
+            *p ++ == 'r') {
+            return 9558;
+        }
+        return r;
+    case 'd':
+        return 9563;
+    }
+    return r;
+}
+
+static int html_cref_ftrie_cold_57(const char* p, int r)
+    __attribute__ ((cold, noinline));
+
+static int html_cref_ftrie_cold_57(const char* p, int r)
+{
+    switch (*p ++) {
+    case 'l':
+        if (*p ++ == 'd' &&
+            *p ++ == 'e') {
+            return 9545;
+        }
+        return r;
+    case 'n':
+        if (*p ++ == 't') {
+            return 9568;
+        }
+        return r;
+    }
+    return r;
+}
+
+static int html_cref_ftrie_cold_58(const char* p, int r)
+    __attribute__ ((cold, noinline));
+
+static int html_cref_ftrie_cold_58(const char* p, int r)
+{
+    switch (*p ++) {
+    case 'c':
+        if (*p ++ == 'k') {
+            switch (*p ++) {
+            case 'a':
+                if (*p ++ == 'p' &&
+                    *p ++ == 'p' &&
+                    *p ++ == 'r' &&
+                    *p ++ == 'o' &&
+                    *p ++ == 'x') {
+                    return 9516;
+                }
+                return r;
+            case 's':
+                if (*p ++ == 'i' &&
+                    *p ++ == 'm') {
+                    return 9521;
+                }
+                return r;
+            }
+            return r;
+        }
+        return r;
+    }
+    return r;
+}
+
+static int html_cref_ftrie_cold_59(const char* p, int r)
+    __attribute__ ((cold, noinline));
+
+static int html_cref_ftrie_cold_59(const char* p, int r)
+{
+    switch (*p ++) {
+    case 'e':
+        switch (*p ++) {
+        case 'r':
+            if (*p ++ == 'e') {
+                switch (*p ++) {
+                case '4':
+                    return 9494;
+                case 'f':
+                    if (*p ++ == 'o' &&
+                        *p ++ == 'r' &&
+                        *p ++ == 'e') {
+                        return 9499;
+                    }
+                    return r;
+                }
+                return r;
+            }
+            return r;
+        case 't':
+            if (*p ++ == 'a') {
+                r = 9504;
+                switch (*p ++) {
+                case 's':
+                    if (*p ++ == 'y' &&
+                        *p ++ == 'm') {
+                        return 9508;
+                    }
+                    return r;
+                case 'v':
+                    return 9512;
+                }
+                return r;
+            }
+            return r;
+        }
+        return r;
+    case 'k':
+        switch (*p ++) {
+        case 'a':
+            if (*p ++ == 'p') {
+                return 9531;
+            }
+            return r;
+        case 's':
+            if (*p ++ == 'i' &&
+                *p ++ == 'm') {
+                return 9536;
+            }
+            return r;
+        }
+        return r;
+    case 'o':
+        if (*p ++ == 'r' &&
+            *p ++ == 'n') {
+            return 9541;
+        }
+        return r;
+    }
+    return r;
+}
+
+static int html_cref_ftrie_cold_60(const char* p, int r)
+    __attribute__ ((cold, noinline));
+
+static int html_cref_ftrie_cold_60(const char* p, int r)
+{
+    switch (*p ++) {
+    case 'a':
+        switch (*p ++) {
+        case 'r':
+            if (*p ++ == 'g' &&
+                *p ++ == 'e' &&
+                *p ++ == 't') {
+                return 9452;
+            }
+            return r;
+        case 'u':
+            return 9457;
+        }
+        return r;
+    case 'b':
+        if (*p ++ == 'r' &&
+            *p ++ == 'k') {
+            return 9461;
+        }
+        return r;
+    case 'c':
+        switch (*p ++) {
+        case 'a':
+            if (*p ++ == 'r' &&
+                *p ++ == 'o' &&
+                *p ++ == 'n') {
+                return 9466;
+            }
+            return r;
+        case 'e':
+            if (*p ++ == 'd' &&
+                *p ++ == 'i' &&
+                *p ++ == 'l') {
+                return 9470;
+            }
+            return r;
+        case 'y':
+            return 9474;
+        }
+        return r;
+    case 'd':
+        if (*p ++ == 'o' &&
+            *p ++ == 't') {
+            return 9478;
+        }
+        return r;
+    case 'e':
+        if (*p ++ == 'l' &&
+            *p ++ == 'r' &&
+            *p ++ == 'e' &&
+            *p ++ == 'c') {
+            return 9483;
+        }
+        return r;
+    case 'f':
+        if (*p ++ == 'r') {
+            return 9488;
+        }
+        return r;
+    case 'o':
+        switch (*p ++) {
+        case 'e':
+            if (*p ++ == 'a') {
+                return 9573;
+            }
+            return r;
+        case 'p':
+            r = 9578;
+            switch (*p ++) {
+            case 'b':
+                if (*p ++ == 'o' &&
+                    *p ++ == 't') {
+                    return 9583;
+                }
+                return r;
+            case 'c':
+                if (*p ++ == 'i' &&
+                    *p ++ == 'r') {
+                    return 9588;
+                }
+                return r;
+            case 'f':
+                r = 9593;
+                if (*p ++ == 'o' &&
+                    *p ++ == 'r' &&
+                    *p ++ == 'k') {
+                    return 9599;
+                }
+                return r;
+            }
+            return r;
+        case 's':
+            if (*p ++ == 'a') {
+                return 9604;
+            }
+            return r;
+        }
+        return r;
+    case 'p':
+        if (*p ++ == 'r' &&
+            *p ++ == 'i' &&
+            *p ++ == 'm' &&
+            *p ++ == 'e') {
+            return 9609;
+        }
+        return r;
+    case 's':
+        switch (*p ++) {
+        case 'c':
+            switch (*p ++) {
+            case 'r':
+                return 9689;
+            case 'y':
+                return 9695;
+            }
+            return r;
+        case 'h':
+            if (*p ++ == 'c' &&
+                *p ++ == 'y') {
+                return 9699;
+            }
+            return r;
+        case 't':
+            if (*p ++ == 'r' &&
+                *p ++ == 'o' &&
+                *p ++ == 'k') {
+                return 9703;
+            }
+            return r;
+        }
+        return r;
+    case 'w':
+        switch (*p ++) {
+        case 'i':
+            if (*p ++ == 'x' &&
+                *p ++ == 't') {
+                return 9707;
+            }
+            return r;
+        case 'o':
+            if (*p ++ == 'h' &&
+                *p ++ == 'e' &&
+                *p ++ == 'a' &&
+                *p ++ == 'd') {
+                switch (*p ++) {
+                case 'l':
+                    if (*p ++ == 'e' &&
+                        *p ++ == 'f' &&
+                        *p ++ == 't' &&
+                        *p ++ == 'a' &&
+                        *p ++ == 'r' &&
+                        *p ++ == 'r' &&
+                        *p ++ == 'o' &&
+                        *p ++ == 'w') {
+                        return 9712;
+                    }
+                    return r;
+                case 'r':
+                    if (*p ++ == 'i' &&
+                        *p ++ == 'g' &&
+                        *p ++ == 'h' &&
+                        *p ++ == 't' &&
+                        *p ++ == 'a' &&
+                        *p ++ == 'r' &&
+                        *p ++ == 'r' &&
+                        *p ++ == 'o' &&
+                        *p ++ == 'w') {
+                        return 9717;
+                    }
+                    return r;
+                }
+                return r;
+            }
+            return r;
+        }
+        return r;
+    }
+    return r;
+}
+
+static int html_cref_ftrie_cold_61(const char* p, int r)
+    __attribute__ ((cold, noinline));
+
+static int html_cref_ftrie_cold_61(const char* p, int r)
+{
+    switch (*p ++) {
+    case 'e':
+        if (*p ++ == 't') {
+            return 3728;
+        }
+        return r;
+    }
+    return r;
+}
+
+static int html_cref_ftrie_cold_62(const char* p, int r)
+    __attribute__ ((cold, noinline));
+
+static int html_cref_ftrie_cold_62(const char* p, int r)
+{
+    switch (*p ++) {
+    case 'm':
+        if (*p ++ == 'p') {
+            r = 3733;
+            switch (*p ++) {
+            case 'E':
+                return 3738;
+            case 'e':
+                r = 3743;
+                if (*p ++ == 'q') {
+                    return 3748;
+                }
+                return r;
+            }
+            return r;
+        }
+        return r;
+    }
+    return r;
+}
+
+static int html_cref_ftrie_cold_63(const char* p, int r)
+    __attribute__ ((cold, noinline));
+
+static int html_cref_ftrie_cold_63(const char* p, int r)
+{
+    switch (*p ++) {
+    case 'h':
+        return 3275;
+    case 'w':
+        if (*p ++ == 'e' &&
+            *p ++ == 'e' &&
+            *p ++ == 'n') {
+            return 3280;
+        }
+        return r;
+    }
+    return r;
+}
+
+static int html_cref_ftrie_cold_64(const char* p, int r)
+    __attribute__ ((cold, noinline));
+
+static int html_cref_ftrie_cold_64(const char* p, int r)
+{
+    switch (*p ++) {
+    case 'c':
+        if (*p ++ == 'a' &&
+            *p ++ == 'u' &&
+            *p ++ == 's') {
+            r = 3247;
+            if (*p ++ == 'e') {
+                return 3252;
+            }
+            return r;
+        }
+        return r;
+    case 'm':
+        if (*p ++ == 'p' &&
+            *p ++ == 't' &&
+            *p ++ == 'y' &&
+            *p ++ == 'v') {
+            return 3257;
+        }
+        return r;
+    case 'p':
+        if (*p ++ == 's' &&
+            *p ++ == 'i') {
+            return 3262;
+        }
+        return r;
+    case 'r':
+        if (*p ++ == 'n' &&
+            *p ++ == 'o' &&
+            *p ++ == 'u') {
+            return 3266;
+        }
+        return r;
+    }
+    return r;
+}
+
+static int html_cref_ftrie_cold_65(const char* p, int r)
+    __attribute__ ((cold, noinline));
+
+static int html_cref_ftrie_cold_65(const char* p, int r)
+{
+    switch (*p ++) {
+    case 'N':
+        if (*p ++ == 'o' &&
+            *p ++ == 't') {
+            return 3179;
+        }
+        return r;
+    case 'a':
+        switch (*p ++) {
+        case 'c':
+            if (*p ++ == 'k') {
+                switch (*p ++) {
+                case 'c':
+                    if (*p ++ == 'o' &&
+                        *p ++ == 'n' &&
+                        *p ++ == 'g') {
+                        return 3184;
+                    }
+                    return r;
+                case 'e':
+                    if (*p ++ == 'p' &&
+                        *p ++ == 's' &&
+                        *p ++ == 'i' &&
+                        *p ++ == 'l' &&
+                        *p ++ == 'o' &&
+                        *p ++ == 'n') {
+                        return 3189;
+                    }
+                    return r;
+                case 'p':
+                    if (*p ++ == 'r' &&
+                        *p ++ == 'i' &&
+                        *p ++ == 'm' &&
+                        *p ++ == 'e') {
+                        return 3193;
+                    }
+                    return r;
+                case 's':
+                    if (*p ++ == 'i' &&
+                        *p ++ == 'm') {
+                        r = 3198;
+                        if (*p ++ == 'e' &&
+                            *p ++ == 'q') {
+                            return 3203;
+                        }
+                        return r;
+                    }
+                    return r;
+                }
+                return r;
+            }
+            return r;
+        case 'r':
+            switch (*p ++) {
+            case 'v':
+                if (*p ++ == 'e' &&
+                    *p ++ == 'e') {
+                    return 3208;
+                }
+                return r;
+            case 'w':
+                if (*p ++ == 'e' &&
+                    *p ++ == 'd') {
+                    r = 3213;
+                    if (*p ++ == 'g' &&
+                        *p ++ == 'e') {
+                        return 3218;
+                    }
+                    return r;
+                }
+                return r;
+            }
+            return r;
+        }
+        return r;
+    case 'b':
+        if (*p ++ == 'r' &&
+            *p ++ == 'k') {
+            r = 3223;
+            if (*p ++ == 't' &&
+                *p ++ == 'b' &&
+                *p ++ == 'r' &&
+                *p ++ == 'k') {
+                return 3228;
+            }
+            return r;
+        }
+        return r;
+    case 'c':
+        switch (*p ++) {
+        case 'o':
+            if (*p ++ == 'n' &&
+                *p ++ == 'g') {
+                return 3233;
+            }
+            return r;
+        case 'y':
+            return 3238;
+        }
+        return r;
+    case 'd':
+        if (*p ++ == 'q' &&
+            *p ++ == 'u' &&
+            *p ++ == 'o') {
+            return 3242;
+        }
+        return r;
+    case 'f':
+        if (*p ++ == 'r') {
+            return 3285;
+        }
+        return r;
+    case 'i':
+        if (*p ++ == 'g') {
+            switch (*p ++) {
+            case 'c':
+                switch (*p ++) {
+                case 'a':
+                    if (*p ++ == 'p') {
+                        return 3291;
+                    }
+                    return r;
+                case 'i':
+                    if (*p ++ == 'r' &&
+                        *p ++ == 'c') {
+                        return 3296;
+                    }
+                    return r;
+                case 'u':
+                    if (*p ++ == 'p') {
+                        return 3301;
+                    }
+                    return r;
+                }
+                return r;
+            case 'o':
+                switch (*p ++) {
+                case 'd':
+                    if (*p ++ == 'o' &&
+                        *p ++ == 't') {
+                        return 3306;
+                    }
+                    return r;
+                case 'p':
+                    if (*p ++ == 'l' &&
+                        *p ++ == 'u' &&
+                        *p ++ == 's') {
+                        return 3311;
+                    }
+                    return r;
+                case 't':
+                    if (*p ++ == 'i' &&
+                        *p ++ == 'm' &&
+                        *p ++ == 'e' &&
+                        *p ++ == 's') {
+                        return 3316;
+                    }
+                    return r;
+                }
+                return r;
+            case 's':
+                switch (*p ++) {
+                case 'q':
+                    if (*p ++ == 'c' &&
+                        *p ++ == 'u' &&
+                        *p ++ == 'p') {
+                        return 3321;
+                    }
+                    return r;
+                case 't':
+                    if (*p ++ == 'a' &&
+                        *p ++ == 'r') {
+                        return 3326;
+                    }
+                    return r;
+                }
+                return r;
+            case 't':
+                if (*p ++ == 'r' &&
+                    *p ++ == 'i' &&
+                    *p ++ == 'a' &&
+                    *p ++ == 'n' &&
+                    *p ++ == 'g' &&
+                    *p ++ == 'l' &&
+                    *p ++ == 'e') {
+                    switch (*p ++) {
+                    case 'd':
+                        if (*p ++ == 'o' &&
+                            *p ++ == 'w' &&
+                            *p ++ == 'n') {
+                            return 3331;
+                        }
+                        return r;
+                    case 'u':
+                        if (*p ++ == 'p') {
+                            return 3336;
+                        }
+                        return r;
+                    }
+                    return r;
+                }
+                return r;
+            case 'u':
+                if (*p ++ == 'p' &&
+                    *p ++ == 'l' &&
+                    *p ++ == 'u' &&
+                    *p ++ == 's') {
+                    return 3341;
+                }
+                return r;
+            case 'v':
+                if (*p ++ == 'e' &&
+                    *p ++ == 'e') {
+                    return 3346;
+                }
+                return r;
+            case 'w':
+                if (*p ++ == 'e' &&
+                    *p ++ == 'd' &&
+                    *p ++ == 'g' &&
+                    *p ++ == 'e') {
+                    return 3351;
+                }
+                return r;
+            }
+            return r;
+        }
+        return r;
+    case 'k':
+        if (*p ++ == 'a' &&
+            *p ++ == 'r' &&
+            *p ++ == 'o' &&
+            *p ++ == 'w') {
+            return 3356;
+        }
+        return r;
+    case 'l':
+        switch (*p ++) {
+        case 'a':
+            switch (*p ++) {
+            case 'c':
+                if (*p ++ == 'k') {
+                    switch (*p ++) {
+                    case 'l':
+                        if (*p ++ == 'o' &&
+                            *p ++ == 'z' &&
+                            *p ++ == 'e' &&
+                            *p ++ == 'n' &&
+                            *p ++ == 'g' &&
+                            *p ++ == 'e') {
+                            return 3361;
+                        }
+                        return r;
+                    case 's':
+                        if (*p ++ == 'q' &&
+                            *p ++ == 'u' &&
+                            *p ++ == 'a' &&
+                            *p ++ == 'r' &&
+                            *p ++ == 'e') {
+                            return 3366;
+                        }
+                        return r;
+                    case 't':
+                        if (*p ++ == 'r' &&
+                            *p ++ == 'i' &&
+                            *p ++ == 'a' &&
+                            *p ++ == 'n' &&
+                            *p ++ == 'g' &&
+                            *p ++ == 'l' &&
+                            *p ++ == 'e') {
+                            r = 3371;
+                            switch (*p ++) {
+                            case 'd':
+                                if (*p ++ == 'o' &&
+                                    *p ++ == 'w' &&
+                                    *p ++ == 'n') {
+                                    return 3376;
+                                }
+                                return r;
+                            case 'l':
+                                if (*p ++ == 'e' &&
+                                    *p ++ == 'f' &&
+                                    *p ++ == 't') {
+                                    return 3381;
+                                }
+                                return r;
+                            case 'r':
+                                if (*p ++ == 'i' &&
+                                    *p ++ == 'g' &&
+                                    *p ++ == 'h' &&
+                                    *p ++ == 't') {
+                                    return 3386;
+                                }
+                                return r;
+                            }
+                            return r;
+                        }
+                        return r;
+                    }
+                    return r;
+                }
+                return r;
+            case 'n':
+                if (*p ++ == 'k') {
+                    return 3391;
+                }
+                return r;
+            }
+            return r;
+        case 'k':
+            switch (*p ++) {
+            case '1':
+                switch (*p ++) {
+                case '2':
+                    return 3396;
+                case '4':
+                    return 3401;
+                }
+                return r;
+            case '3':
+                if (*p ++ == '4') {
+                    return 3406;
+                }
+                return r;
+            }
+            return r;
+        case 'o':
+            if (*p ++ == 'c' &&
+                *p ++ == 'k') {
+                return 3411;
+            }
+            return r;
+        }
+        return r;
+    case 'n':
+        switch (*p ++) {
+        case 'e':
+            r = 3416;
+            if (*p ++ == 'q' &&
+                *p ++ == 'u' &&
+                *p ++ == 'i' &&
+                *p ++ == 'v') {
+                return 3422;
+            }
+            return r;
+        case 'o':
+            if (*p ++ == 't') {
+                return 3430;
+            }
+            return r;
+        }
+        return r;
+    case 'o':
+        switch (*p ++) {
+        case 'p':
+            if (*p ++ == 'f') {
+                return 3435;
+            }
+            return r;
+        case 't':
+            r = 3441;
+            if (*p ++ == 't' &&
+                *p ++ == 'o' &&
+                *p ++ == 'm') {
+                return 3446;
+            }
+            return r;
+        case 'w':
+            if (*p ++ == 't' &&
+                *p ++ == 'i' &&
+                *p ++ == 'e') {
+                return 3451;
+            }
+            return r;
+        case 'x':
+            switch (*p ++) {
+            case 'D':
+                switch (*p ++) {
+                case 'L':
+                    return 3456;
+                case 'R':
+                    return 3461;
+                case 'l':
+                    return 3466;
+                case 'r':
+                    return 3471;
+                }
+                return r;
+            case 'H':
+                r = 3476;
+                switch (*p ++) {
+                case 'D':
+                    return 3481;
+                case 'U':
+                    return 3486;
+                case 'd':
+                    return 3491;
+                case 'u':
+                    return 3496;
+                }
+                return r;
+            case 'U':
+                switch (*p ++) {
+                case 'L':
+                    return 3501;
+                case 'R':
+                    return 3506;
+                case 'l':
+                    return 3511;
+                case 'r':
+                    return 3516;
+                }
+                return r;
+            case 'V':
+                r = 3521;
+                switch (*p ++) {
+                case 'H':
+                    return 3526;
+                case 'L':
+                    return 3531;
+                case 'R':
+                    return 3536;
+                case 'h':
+                    return 3541;
+                case 'l':
+                    return 3546;
+                case 'r':
+                    return 3551;
+                }
+                return r;
+            case 'b':
+                if (*p ++ == 'o' &&
+                    *p ++ == 'x') {
+                    return 3556;
+                }
+                return r;
+            case 'd':
+                switch (*p ++) {
+                case 'L':
+                    return 3561;
+                case 'R':
+                    return 3566;
+                case 'l':
+                    return 3571;
+                case 'r':
+                    return 3576;
+                }
+                return r;
+            case 'h':
+                r = 3581;
+                switch (*p ++) {
+                case 'D':
+                    return 3586;
+                case 'U':
+                    return 3591;
+                case 'd':
+                    return 3596;
+                case 'u':
+                    return 3601;
+                }
+                return r;
+            case 'm':
+                if (*p ++ == 'i' &&
+                    *p ++ == 'n' &&
+                    *p ++ == 'u' &&
+                    *p ++ == 's') {
+                    return 3606;
+                }
+                return r;
+            case 'p':
+                if (*p ++ == 'l' &&
+                    *p ++ == 'u' &&
+                    *p ++ == 's') {
+                    return 3611;
+                }
+                return r;
+            case 't':
+                if (*p ++ == 'i' &&
+                    *p ++ == 'm' &&
+                    *p ++ == 'e' &&
+                    *p ++ == 's') {
+                    return 3616;
+                }
+                return r;
+            case 'u':
+                switch (*p ++) {
+                case 'L':
+                    return 3621;
+                case 'R':
+                    return 3626;
+                case 'l':
+                    return 3631;
+                case 'r':
+                    return 3636;
+                }
+                return r;
+            case 'v':
+                r = 3641;
+                switch (*p ++) {
+                case 'H':
+                    return 3646;
+                case 'L':
+                    return 3651;
+                case 'R':
+                    return 3656;
+                case 'h':
+                    return 3661;
+                case 'l':
+                    return 3666;
+                case 'r':
+                    return 3671;
+                }
+                return r;
+            }
+            return r;
+        }
+        return r;
+    case 'p':
+        if (*p ++ == 'r' &&
+            *p ++ == 'i' &&
+            *p ++ == 'm' &&
+            *p ++ == 'e') {
+            return 3676;
+        }
+        return r;
+    case 'r':
+        switch (*p ++) {
+        case 'e':
+            if (*p ++ == 'v' &&
+                *p ++ == 'e') {
+                return 3681;
+            }
+            return r;
+        case 'v':
+            if (*p ++ == 'b' &&
+                *p ++ == 'a' &&
+                *p ++ == 'r') {
+                return 3685;
+            }
+            return r;
+        }
+        return r;
+    case 's':
+        switch (*p ++) {
+        case 'c':
+            if (*p ++ == 'r') {
+                return 3689;
+            }
+            return r;
+        case 'e':
+            if (*p ++ == 'm' &&
+                *p ++ == 'i') {
+                return 3695;
+            }
+            return r;
+        case 'i':
+            if (*p ++ == 'm') {
+                r = 3700;
+                if (*p ++ == 'e') {
+                    return 3705;
+                }
+                return r;
+            }
+            return r;
+        case 'o':
+            if (*p ++ == 'l') {
+                r = 3710;
+                switch (*p ++) {
+                case 'b':
+                    return 3713;
+                case 'h':
+                    if (*p ++ == 's' &&
+                        *p ++ == 'u' &&
+                        *p ++ == 'b') {
+                        return 3718;
+                    }
+                    return r;
+                }
+                return r;
+            }
+            return r;
+        }
+        return r;
+    }
+    return r;
+}
+
+static int html_cref_ftrie_cold_66(const char* p, int r)
+    __attribute__ ((cold, noinline));
+
+static int html_cref_ftrie_cold_66(const char* p, int r)
+{
+    switch (*p ++) {
+    case 's':
+        if (*p ++ == 't') {
+            return 7600;
+        }
+        return r;
+    }
+    return r;
+}
+
+static int html_cref_ftrie_cold_67(const char* p, int r)
+    __attribute__ ((cold, noinline));
+
+static int html_cref_ftrie_cold_67(const char* p, int r)
+{
+    switch (*p ++) {
+    case 'S':
+        return 7591;
+    case 'c':
+        switch (*p ++) {
+        case 'i':
+            if (*p ++ == 'r') {
+                r = 7605;
+                if (*p ++ == 'c') {
+                    return 7610;
+                }
+                return r;
+            }
+            return r;
+        case 'y':
+            return 7614;
+        }
+        return r;
+    case 'd':
+        switch (*p ++) {
+        case 'a':
+            if (*p ++ == 's' &&
+                *p ++ == 'h') {
+                return 7618;
+            }
+            return r;
+        case 'b':
+            if (*p ++ == 'l' &&
+                *p ++ == 'a' &&
+                *p ++ == 'c') {
+                return 7623;
+            }
+            return r;
+        case 'i':
+            if (*p ++ == 'v') {
+                return 7627;
+            }
+            return r;
+        case 'o':
+            if (*p ++ == 't') {
+                return 7632;
+            }
+            return r;
+        case 's':
+            if (*p ++ == 'o' &&
+                *p ++ == 'l' &&
+                *p ++ == 'd') {
+                return 7637;
+            }
+            return r;
+        }
+        return r;
+    case 'e':
+        if (*p ++ == 'l' &&
+            *p ++ == 'i' &&
+            *p ++ == 'g') {
+            return 7642;
+        }
+        return r;
+    case 'f':
+        switch (*p ++) {
+        case 'c':
+            if (*p ++ == 'i' &&
+                *p ++ == 'r') {
+                return 7646;
+            }
+            return r;
+        case 'r':
+            return 7651;
+        }
+        return r;
+    case 'g':
+        switch (*p ++) {
+        case 'o':
+            if (*p ++ == 'n') {
+                return 7657;
+            }
+            return r;
+        case 'r':
+            if (*p ++ == 'a' &&
+                *p ++ == 'v' &&
+                *p ++ == 'e') {
+                return 7661;
+            }
+            return r;
+        case 't':
+            return 7665;
+        }
+        return r;
+    case 'h':
+        switch (*p ++) {
+        case 'b':
+            if (*p ++ == 'a' &&
+                *p ++ == 'r') {
+                return 7670;
+            }
+            return r;
+        case 'm':
+            return 7675;
+        }
+        return r;
+    case 'i':
+        if (*p ++ == 'n' &&
+            *p ++ == 't') {
+            return 7679;
+        }
+        return r;
+    case 'l':
+        switch (*p ++) {
+        case 'a':
+            if (*p ++ == 'r' &&
+                *p ++ == 'r') {
+                return 7684;
+            }
+            return r;
+        case 'c':
+            switch (*p ++) {
+            case 'i':
+                if (*p ++ == 'r') {
+                    return 7689;
+                }
+                return r;
+            case 'r':
+                if (*p ++ == 'o' &&
+                    *p ++ == 's' &&
+                    *p ++ == 's') {
+                    return 7694;
+                }
+                return r;
+            }
+            return r;
+        case 'i':
+            if (*p ++ == 'n' &&
+                *p ++ == 'e') {
+                return 7699;
+            }
+            return r;
+        case 't':
+            return 7704;
+        }
+        return r;
+    case 'm':
+        switch (*p ++) {
+        case 'a':
+            if (*p ++ == 'c' &&
+                *p ++ == 'r') {
+                return 7709;
+            }
+            return r;
+        case 'e':
+            if (*p ++ == 'g' &&
+                *p ++ == 'a') {
+                return 7713;
+            }
+            return r;
+        case 'i':
+            switch (*p ++) {
+            case 'c':
+                if (*p ++ == 'r' &&
+                    *p ++ == 'o' &&
+                    *p ++ == 'n') {
+                    return 7717;
+                }
+                return r;
+            case 'd':
+                return 7721;
+            case 'n':
+                if (*p ++ == 'u' &&
+                    *p ++ == 's') {
+                    return 7726;
+                }
+                return r;
+            }
+            return r;
+        }
+        return r;
+    case 'o':
+        if (*p ++ == 'p' &&
+            *p ++ == 'f') {
+            return 7731;
+        }
+        return r;
+    case 'p':
+        switch (*p ++) {
+        case 'a':
+            if (*p ++ == 'r') {
+                return 7737;
+            }
+            return r;
+        case 'e':
+            if (*p ++ == 'r' &&
+                *p ++ == 'p') {
+                return 7742;
+            }
+            return r;
+        case 'l':
+            if (*p ++ == 'u' &&
+                *p ++ == 's') {
+                return 7747;
+            }
+            return r;
+        }
+        return r;
+    case 'r':
+        r = 7752;
+        switch (*p ++) {
+        case 'a':
+            if (*p ++ == 'r' &&
+                *p ++ == 'r') {
+                return 7757;
+            }
+            return r;
+        case 'd':
+            r = 7762;
+            switch (*p ++) {
+            case 'e':
+                if (*p ++ == 'r') {
+                    r = 7767;
+                    if (*p ++ == 'o' &&
+                        *p ++ == 'f') {
+                        return 7772;
+                    }
+                    return r;
+                }
+                return r;
+            case 'f':
+                return 7777;
+            case 'm':
+                return 7781;
+            }
+            return r;
+        case 'i':
+            if (*p ++ == 'g' &&
+                *p ++ == 'o' &&
+                *p ++ == 'f') {
+                return 7785;
+            }
+            return r;
+        case 'o':
+            if (*p ++ == 'r') {
+                return 7790;
+            }
+            return r;
+        case 's':
+            if (*p ++ == 'l' &&
+                *p ++ == 'o' &&
+                *p ++ == 'p' &&
+                *p ++ == 'e') {
+                return 7795;
+            }
+            return r;
+        case 'v':
+            return 7800;
+        }
+        return r;
+    case 's':
+        switch (*p ++) {
+        case 'c':
+            if (*p ++ == 'r') {
+                return 7805;
+            }
+            return r;
+        case 'l':
+            if (*p ++ == 'a' &&
+                *p ++ == 's' &&
+                *p ++ == 'h') {
+                return 7810;
+            }
+            return r;
+        case 'o':
+            if (*p ++ == 'l') {
+                return 7814;
+            }
+            return r;
+        }
+        return r;
+    case 't':
+        if (*p ++ == 'i') {
+            switch (*p ++) {
+            case 'l':
+                if (*p ++ == 'd' &&
+                    *p ++ == 'e') {
+                    return 7819;
+                }
+                return r;
+            case 'm':
+                if (*p ++ == 'e' &&
+                    *p ++ == 's') {
+                    r = 7823;
+                    if (*p ++ == 'a' &&
+                        *p ++ == 's') {
+                        return 7828;
+                    }
+                    return r;
+                }
+                return r;
+            }
+            return r;
+        }
+        return r;
+    case 'v':
+        if (*p ++ == 'b' &&
+            *p ++ == 'a' &&
+            *p ++ == 'r') {
+            return 7837;
+        }
+        return r;
+    }
+    return r;
+}
+
+static int html_cref_ftrie_cold_68(const char* p, int r)
+    __attribute__ ((cold, noinline));
+
+static int html_cref_ftrie_cold_68(const char* p, int r)
+{
+    switch (*p ++) {
+    case 'l':
+        if (*p ++ == 't' &&
+            *p ++ == 'a') {
+            return 4287;
+        }
+        return r;
+    case 'm':
+        if (*p ++ == 'p' &&
+            *p ++ == 't' &&
+            *p ++ == 'y' &&
+            *p ++ == 'v') {
+            return 4291;
+        }
+        return r;
+    }
+    return r;
+}
+
+static int html_cref_ftrie_cold_69(const char* p, int r)
+    __attribute__ ((cold, noinline));
+
+static int html_cref_ftrie_cold_69(const char* p, int r)
+{
+    switch (*p ++) {
+    case 'l':
+        if (*p ++ == 'e' &&
+            *p ++ == 't' &&
+            *p ++ == 'h') {
+            return 4226;
+        }
+        return r;
+    case 's':
+        if (*p ++ == 'h') {
+            r = 4236;
+            if (*p ++ == 'v') {
+                return 4241;
+            }
+            return r;
+        }
+        return r;
+    }
+    return r;
+}
+
+static int html_cref_ftrie_cold_70(const char* p, int r)
+    __attribute__ ((cold, noinline));
+
+static int html_cref_ftrie_cold_70(const char* p, int r)
+{
+    switch (*p ++) {
+    case 'A':
+        if (*p ++ == 'r' &&
+            *p ++ == 'r') {
+            return 4211;
+        }
+        return r;
+    case 'H':
+        if (*p ++ == 'a' &&
+            *p ++ == 'r') {
+            return 4216;
+        }
+        return r;
+    case 'b':
+        switch (*p ++) {
+        case 'k':
+            if (*p ++ == 'a' &&
+                *p ++ == 'r' &&
+                *p ++ == 'o' &&
+                *p ++ == 'w') {
+                return 4246;
+            }
+            return r;
+        case 'l':
+            if (*p ++ == 'a' &&
+                *p ++ == 'c') {
+                return 4251;
+            }
+            return r;
+        }
+        return r;
+    case 'c':
+        switch (*p ++) {
+        case 'a':
+            if (*p ++ == 'r' &&
+                *p ++ == 'o' &&
+                *p ++ == 'n') {
+                return 4255;
+            }
+            return r;
+        case 'y':
+            return 4259;
+        }
+        return r;
+    case 'd':
+        r = 4263;
+        switch (*p ++) {
+        case 'a':
+            switch (*p ++) {
+            case 'g':
+                if (*p ++ == 'g' &&
+                    *p ++ == 'e' &&
+                    *p ++ == 'r') {
+                    return 4268;
+                }
+                return r;
+            case 'r':
+                if (*p ++ == 'r') {
+                    return 4273;
+                }
+                return r;
+            }
+            return r;
+        case 'o':
+            if (*p ++ == 't' &&
+                *p ++ == 's' &&
+                *p ++ == 'e' &&
+                *p ++ == 'q') {
+                return 4278;
+            }
+            return r;
+        }
+        return r;
+    case 'f':
+        switch (*p ++) {
+        case 'i':
+            if (*p ++ == 's' &&
+                *p ++ == 'h' &&
+                *p ++ == 't') {
+                return 4296;
+            }
+            return r;
+        case 'r':
+            return 4301;
+        }
+        return r;
+    case 'h':
+        if (*p ++ == 'a' &&
+            *p ++ == 'r') {
+            switch (*p ++) {
+            case 'l':
+                return 4307;
+            case 'r':
+                return 4312;
+            }
+            return r;
+        }
+        return r;
+    case 'i':
+        switch (*p ++) {
+        case 'a':
+            if (*p ++ == 'm') {
+                r = 4317;
+                switch (*p ++) {
+                case 'o':
+                    if (*p ++ == 'n' &&
+                        *p ++ == 'd') {
+                        r = 4322;
+                        if (*p ++ == 's' &&
+                            *p ++ == 'u' &&
+                            *p ++ == 'i' &&
+                            *p ++ == 't') {
+                            return 4327;
+                        }
+                        return r;
+                    }
+                    return r;
+                case 's':
+                    return 4332;
+                }
+                return r;
+            }
+            return r;
+        case 'e':
+            return 4337;
+        case 'g':
+            if (*p ++ == 'a' &&
+                *p ++ == 'm' &&
+                *p ++ == 'm' &&
+                *p ++ == 'a') {
+                return 4341;
+            }
+            return r;
+        case 's':
+            if (*p ++ == 'i' &&
+                *p ++ == 'n') {
+                return 4345;
+            }
+            return r;
+        case 'v':
+            r = 4350;
+            switch (*p ++) {
+            case 'i':
+                if (*p ++ == 'd' &&
+                    *p ++ == 'e') {
+                    r = 4354;
+                    if (*p ++ == 'o' &&
+                        *p ++ == 'n' &&
+                        *p ++ == 't' &&
+                        *p ++ == 'i' &&
+                        *p ++ == 'm' &&
+                        *p ++ == 'e' &&
+                        *p ++ == 's') {
+                        return 4358;
+                    }
+                    return r;
+                }
+                return r;
+            case 'o':
+                if (*p ++ == 'n' &&
+                    *p ++ == 'x') {
+                    return 4363;
+                }
+                return r;
+            }
+            return r;
+        }
+        return r;
+    case 'j':
+        if (*p ++ == 'c' &&
+            *p ++ == 'y') {
+            return 4368;
+        }
+        return r;
+    case 'l':
+        if (*p ++ == 'c') {
+            switch (*p ++) {
+            case 'o':
+                if (*p ++ == 'r' &&
+                    *p ++ == 'n') {
+                    return 4372;
+                }
+                return r;
+            case 'r':
+                if (*p ++ == 'o' &&
+                    *p ++ == 'p') {
+                    return 4377;
+                }
+                return r;
+            }
+            return r;
+        }
+        return r;
+    case 'o':
+        switch (*p ++) {
+        case 'l':
+            if (*p ++ == 'l' &&
+                *p ++ == 'a' &&
+                *p ++ == 'r') {
+                return 4382;
+            }
+            return r;
+        case 'p':
+            if (*p ++ == 'f') {
+                return 4385;
+            }
+            return r;
+        case 't':
+            r = 4391;
+            switch (*p ++) {
+            case 'e':
+                if (*p ++ == 'q') {
+                    r = 4395;
+                    if (*p ++ == 'd' &&
+                        *p ++ == 'o' &&
+                        *p ++ == 't') {
+                        return 4400;
+                    }
+                    return r;
+                }
+                return r;
+            case 'm':
+                if (*p ++ == 'i' &&
+                    *p ++ == 'n' &&
+                    *p ++ == 'u' &&
+                    *p ++ == 's') {
+                    return 4405;
+                }
+                return r;
+            case 'p':
+                if (*p ++ == 'l' &&
+                    *p ++ == 'u' &&
+                    *p ++ == 's') {
+                    return 4410;
+                }
+                return r;
+            case 's':
+                if (*p ++ == 'q' &&
+                    *p ++ == 'u' &&
+                    *p ++ == 'a' &&
+                    *p ++ == 'r' &&
+                    *p ++ == 'e') {
+                    return 4415;
+                }
+                return r;
+            }
+            return r;
+        case 'u':
+            if (*p ++ == 'b' &&
+                *p ++ == 'l' &&
+                *p ++ == 'e' &&
+                *p ++ == 'b' &&
+                *p ++ == 'a' &&
+                *p ++ == 'r' &&
+                *p ++ == 'w' &&
+                *p ++ == 'e' &&
+                *p ++ == 'd' &&
+                *p ++ == 'g' &&
+                *p ++ == 'e') {
+                return 4420;
+            }
+            return r;
+        case 'w':
+            if (*p ++ == 'n') {
+                switch (*p ++) {
+                case 'a':
+                    if (*p ++ == 'r' &&
+                        *p ++ == 'r' &&
+                        *p ++ == 'o' &&
+                        *p ++ == 'w') {
+                        return 4425;
+                    }
+                    return r;
+                case 'd':
+                    if (*p ++ == 'o' &&
+                        *p ++ == 'w' &&
+                        *p ++ == 'n' &&
+                        *p ++ == 'a' &&
+                        *p ++ == 'r' &&
+                        *p ++ == 'r' &&
+                        *p ++ == 'o' &&
+                        *p ++ == 'w' &&
+                        *p ++ == 's') {
+                        return 4430;
+                    }
+                    return r;
+                case 'h':
+                    if (*p ++ == 'a' &&
+                        *p ++ == 'r' &&
+                        *p ++ == 'p' &&
+                        *p ++ == 'o' &&
+                        *p ++ == 'o' &&
+                        *p ++ == 'n') {
+                        switch (*p ++) {
+                        case 'l':
+                            if (*p ++ == 'e' &&
+                                *p ++ == 'f' &&
+                                *p ++ == 't') {
+                                return 4435;
+                            }
+                            return r;
+                        case 'r':
+                            if (*p ++ == 'i' &&
+                                *p ++ == 'g' &&
+                                *p ++ == 'h' &&
+                                *p ++ == 't') {
+                                return 4440;
+                            }
+                            return r;
+                        }
+                        return r;
+                    }
+                    return r;
+                }
+                return r;
+            }
+            return r;
+        }
+        return r;
+    case 'r':
+        switch (*p ++) {
+        case 'b':
+            if (*p ++ == 'k' &&
+                *p ++ == 'a' &&
+                *p ++ == 'r' &&
+                *p ++ == 'o' &&
+                *p ++ == 'w') {
+                return 4445;
+            }
+            return r;
+        case 'c':
+            switch (*p ++) {
+            case 'o':
+                if (*p ++ == 'r' &&
+                    *p ++ == 'n') {
+                    return 4450;
+                }
+                return r;
+            case 'r':
+                if (*p ++ == 'o' &&
+                    *p ++ == 'p') {
+                    return 4455;
+                }
+                return r;
+            }
+            return r;
+        }
+        return r;
+    case 's':
+        switch (*p ++) {
+        case 'c':
+            switch (*p ++) {
+            case 'r':
+                return 4460;
+            case 'y':
+                return 4466;
+            }
+            return r;
+        case 'o':
+            if (*p ++ == 'l') {
+                return 4470;
+            }
+            return r;
+        case 't':
+            if (*p ++ == 'r' &&
+                *p ++ == 'o' &&
+                *p ++ == 'k') {
+                return 4475;
+            }
+            return r;
+        }
+        return r;
+    case 't':
+        switch (*p ++) {
+        case 'd':
+            if (*p ++ == 'o' &&
+                *p ++ == 't') {
+                return 4479;
+            }
+            return r;
+        case 'r':
+            if (*p ++ == 'i') {
+                r = 4484;
+                if (*p ++ == 'f') {
+                    return 4489;
+                }
+                return r;
+            }
+            return r;
+        }
+        return r;
+    case 'u':
+        switch (*p ++) {
+        case 'a':
+            if (*p ++ == 'r' &&
+                *p ++ == 'r') {
+                return 4494;
+            }
+            return r;
+        case 'h':
+            if (*p ++ == 'a' &&
+                *p ++ == 'r') {
+                return 4499;
+            }
+            return r;
+        }
+        return r;
+    case 'w':
+        if (*p ++ == 'a' &&
+            *p ++ == 'n' &&
+            *p ++ == 'g' &&
+            *p ++ == 'l' &&
+            *p ++ == 'e') {
+            return 4504;
+        }
+        return r;
+    case 'z':
+        switch (*p ++) {
+        case 'c':
+            if (*p ++ == 'y') {
+                return 4509;
+            }
+            return r;
+        case 'i':
+            if (*p ++ == 'g' &&
+                *p ++ == 'r' &&
+                *p ++ == 'a' &&
+                *p ++ == 'r' &&
+                *p ++ == 'r') {
+                return 4513;
+            }
+            return r;
+        }
+        return r;
+    }
+    return r;
+}
+
+static int html_cref_ftrie_cold_71(const char* p, int r)
+    __attribute__ ((cold, noinline));
+
+static int html_cref_ftrie_cold_71(const char* p, int r)
+{
+    switch (*p ++) {
+    case 'a':
+        if (*p ++ == 'r' &&
+            *p ++ == 'r') {
+            return 9930;
+        }
+        return r;
+    }
+    return r;
+}
+
+static int html_cref_ftrie_cold_72(const char* p, int r)
+    __attribute__ ((cold, noinline));
+
+static int html_cref_ftrie_cold_72(const char* p, int r)
+{
+    switch (*p ++) {
+    case 'A':
+        if (*p ++ == 'r' &&
+            *p ++ == 'r') {
+            return 9722;
+        }
+        return r;
+    case 'H':
+        if (*p ++ == 'a' &&
+            *p ++ == 'r') {
+            return 9727;
+        }
+        return r;
+    case 'b':
+        if (*p ++ == 'r') {
+            switch (*p ++) {
+            case 'c':
+                if (*p ++ == 'y') {
+                    return 9741;
+                }
+                return r;
+            case 'e':
+                if (*p ++ == 'v' &&
+                    *p ++ == 'e') {
+                    return 9745;
+                }
+                return r;
+            }
+            return r;
+        }
+        return r;
+    case 'c':
+        switch (*p ++) {
+        case 'i':
+            if (*p ++ == 'r' &&
+                *p ++ == 'c') {
+                return 9749;
+            }
+            return r;
+        case 'y':
+            return 9753;
+        }
+        return r;
+    case 'd':
+        switch (*p ++) {
+        case 'a':
+            if (*p ++ == 'r' &&
+                *p ++ == 'r') {
+                return 9757;
+            }
+            return r;
+        case 'b':
+            if (*p ++ == 'l' &&
+                *p ++ == 'a' &&
+                *p ++ == 'c') {
+                return 9762;
+            }
+            return r;
+        case 'h':
+            if (*p ++ == 'a' &&
+                *p ++ == 'r') {
+                return 9766;
+            }
+            return r;
+        }
+        return r;
+    case 'f':
+        switch (*p ++) {
+        case 'i':
+            if (*p ++ == 's' &&
+                *p ++ == 'h' &&
+                *p ++ == 't') {
+                return 9771;
+            }
+            return r;
+        case 'r':
+            return 9776;
+        }
+        return r;
+    case 'g':
+        if (*p ++ == 'r' &&
+            *p ++ == 'a' &&
+            *p ++ == 'v' &&
+            *p ++ == 'e') {
+            return 9782;
+        }
+        return r;
+    case 'h':
+        switch (*p ++) {
+        case 'a':
+            if (*p ++ == 'r') {
+                switch (*p ++) {
+                case 'l':
+                    return 9786;
+                case 'r':
+                    return 9791;
+                }
+                return r;
+            }
+            return r;
+        case 'b':
+            if (*p ++ == 'l' &&
+                *p ++ == 'k') {
+                return 9796;
+            }
+            return r;
+        }
+        return r;
+    case 'l':
+        switch (*p ++) {
+        case 'c':
+            switch (*p ++) {
+            case 'o':
+                if (*p ++ == 'r' &&
+                    *p ++ == 'n') {
+                    r = 9801;
+                    if (*p ++ == 'e' &&
+                        *p ++ == 'r') {
+                        return 9806;
+                    }
+                    return r;
+                }
+                return r;
+            case 'r':
+                if (*p ++ == 'o' &&
+                    *p ++ == 'p') {
+                    return 9811;
+                }
+                return r;
+            }
+            return r;
+        case 't':
+            if (*p ++ == 'r' &&
+                *p ++ == 'i') {
+                return 9816;
+            }
+            return r;
+        }
+        return r;
+    case 'm':
+        switch (*p ++) {
+        case 'a':
+            if (*p ++ == 'c' &&
+                *p ++ == 'r') {
+                return 9821;
+            }
+            return r;
+        case 'l':
+            return 9825;
+        }
+        return r;
+    case 'o':
+        switch (*p ++) {
+        case 'g':
+            if (*p ++ == 'o' &&
+                *p ++ == 'n') {
+                return 9829;
+            }
+            return r;
+        case 'p':
+            if (*p ++ == 'f') {
+                return 9833;
+            }
+            return r;
+        }
+        return r;
+    case 'p':
+        switch (*p ++) {
+        case 'a':
+            if (*p ++ == 'r' &&
+                *p ++ == 'r' &&
+                *p ++ == 'o' &&
+                *p ++ == 'w') {
+                return 9839;
+            }
+            return r;
+        case 'd':
+            if (*p ++ == 'o' &&
+                *p ++ == 'w' &&
+                *p ++ == 'n' &&
+                *p ++ == 'a' &&
+                *p ++ == 'r' &&
+                *p ++ == 'r' &&
+                *p ++ == 'o' &&
+                *p ++ == 'w') {
+                return 9844;
+            }
+            return r;
+        case 'h':
+            if (*p ++ == 'a' &&
+                *p ++ == 'r' &&
+                *p ++ == 'p' &&
+                *p ++ == 'o' &&
+                *p ++ == 'o' &&
+                *p ++ == 'n') {
+                switch (*p ++) {
+                case 'l':
+                    if (*p ++ == 'e' &&
+                        *p ++ == 'f' &&
+                        *p ++ == 't') {
+                        return 9849;
+                    }
+                    return r;
+                case 'r':
+                    if (*p ++ == 'i' &&
+                        *p ++ == 'g' &&
+                        *p ++ == 'h' &&
+                        *p ++ == 't') {
+                        return 9854;
+                    }
+                    return r;
+                }
+                return r;
+            }
+            return r;
+        case 'l':
+            if (*p ++ == 'u' &&
+                *p ++ == 's') {
+                return 9859;
+            }
+            return r;
+        case 's':
+            if (*p ++ == 'i') {
+                r = 9864;
+                switch (*p ++) {
+                case 'h':
+                    return 9868;
+                case 'l':
+                    if (*p ++ == 'o' &&
+                        *p ++ == 'n') {
+                        return 9872;
+                    }
+                    return r;
+                }
+                return r;
+            }
+            return r;
+        case 'u':
+            if (*p ++ == 'p' &&
+                *p ++ == 'a' &&
+                *p ++ == 'r' &&
+                *p ++ == 'r' &&
+                *p ++ == 'o' &&
+                *p ++ == 'w' &&
+                *p ++ == 's') {
+                return 9876;
+            }
+            return r;
+        }
+        return r;
+    case 'r':
+        switch (*p ++) {
+        case 'c':
+            switch (*p ++) {
+            case 'o':
+                if (*p ++ == 'r' &&
+                    *p ++ == 'n') {
+                    r = 9881;
+                    if (*p ++ == 'e' &&
+                        *p ++ == 'r') {
+                        return 9886;
+                    }
+                    return r;
+                }
+                return r;
+            case 'r':
+                if (*p ++ == 'o' &&
+                    *p ++ == 'p') {
+                    return 9891;
+                }
+                return r;
+            }
+            return r;
+        case 'i':
+            if (*p ++ == 'n' &&
+                *p ++ == 'g') {
+                return 9896;
+            }
+            return r;
+        case 't':
+            if (*p ++ == 'r' &&
+                *p ++ == 'i') {
+                return 9900;
+            }
+            return r;
+        }
+        return r;
+    case 's':
+        if (*p ++ == 'c' &&
+            *p ++ == 'r') {
+            return 9905;
+        }
+        return r;
+    case 't':
+        switch (*p ++) {
+        case 'd':
+            if (*p ++ == 'o' &&
+                *p ++ == 't') {
+                return 9911;
+            }
+            return r;
+        case 'i':
+            if (*p ++ == 'l' &&
+                *p ++ == 'd' &&
+                *p ++ == 'e') {
+                return 9916;
+            }
+            return r;
+        case 'r':
+            if (*p ++ == 'i') {
+                r = 9920;
+                if (*p ++ == 'f') {
+                    return 9925;
+                }
+                return r;
+            }
+            return r;
+        }
+        return r;
+    case 'w':
+        if (*p ++ == 'a' &&
+            *p ++ == 'n' &&
+            *p ++ == 'g' &&
+            *p ++ == 'l' &&
+            *p ++ == 'e') {
+            return 9939;
+        }
+        return r;
+    }
+    return r;
+}
+
+static int html_cref_ftrie_cold_73(const char* p, int r)
+    __attribute__ ((cold, noinline));
+
+static int html_cref_ftrie_cold_73(const char* p, int r)
+{
+    switch (*p ++) {
+    case 'i':
+        if (*p ++ == 'n' &&
+            *p ++ == 't' &&
+            *p ++ == 'i' &&
+            *p ++ == 'n' &&
+            *p ++ == 't') {
+            return 7999;
+        }
+        return r;
+    case 'p':
+        if (*p ++ == 'f') {
+            return 8004;
+        }
+        return r;
+    }
+    return r;
+}
+
+static int html_cref_ftrie_cold_74(const char* p, int r)
+    __attribute__ ((cold, noinline));
+
+static int html_cref_ftrie_cold_74(const char* p, int r)
+{
+    switch (*p ++) {
+    case 'a':
+        if (*p ++ == 'c' &&
+            *p ++ == 'i' &&
+            *p ++ == 'r') {
+            return 7951;
+        }
+        return r;
+    case 'b':
+        return 7956;
+    case 'c':
+        if (*p ++ == 'i' &&
+            *p ++ == 'r') {
+            return 7961;
+        }
+        return r;
+    case 'd':
+        switch (*p ++) {
+        case 'o':
+            return 7966;
+        case 'u':
+            return 7971;
+        }
+        return r;
+    case 'e':
+        return 7976;
+    case 's':
+        if (*p ++ == 'i' &&
+            *p ++ == 'm') {
+            return 7985;
+        }
+        return r;
+    case 't':
+        if (*p ++ == 'w' &&
+            *p ++ == 'o') {
+            return 7990;
+        }
+        return r;
+    }
+    return r;
+}
+
+static int html_cref_ftrie_cold_75(const char* p, int r)
+    __attribute__ ((cold, noinline));
+
+static int html_cref_ftrie_cold_75(const char* p, int r)
+{
+    switch (*p ++) {
+    case 'a':
+        if (*p ++ == 'n') {
+            switch (*p ++) {
+            case 'c':
+                if (*p ++ == 'k') {
+                    r = 7933;
+                    if (*p ++ == 'h') {
+                        return 7938;
+                    }
+                    return r;
+                }
+                return r;
+            case 'k':
+                if (*p ++ == 'v') {
+                    return 7943;
+                }
+                return r;
+            }
+            return r;
+        }
+        return r;
+    }
+    return r;
+}
+
+static int html_cref_ftrie_cold_76(const char* p, int r)
+    __attribute__ ((cold, noinline));
+
+static int html_cref_ftrie_cold_76(const char* p, int r)
+{
+    switch (*p ++) {
+    case 'l':
+        if (*p ++ == 'l' &&
+            *p ++ == 'e' &&
+            *p ++ == 'l') {
+            return 7851;
+        }
+        return r;
+    }
+    return r;
+}
+
+static int html_cref_ftrie_cold_77(const char* p, int r)
+    __attribute__ ((cold, noinline));
+
+static int html_cref_ftrie_cold_77(const char* p, int r)
+{
+    switch (*p ++) {
+    case 's':
+        switch (*p ++) {
+        case 'i':
+            if (*p ++ == 'm') {
+                return 7856;
+            }
+            return r;
+        case 'l':
+            return 7861;
+        }
+        return r;
+    case 't':
+        return 7866;
+    }
+    return r;
+}
+
+static int html_cref_ftrie_cold_78(const char* p, int r)
+    __attribute__ ((cold, noinline));
+
+static int html_cref_ftrie_cold_78(const char* p, int r)
+{
+    switch (*p ++) {
+    case 's':
+        return 8084;
+    }
+    return r;
+}
+
+static int html_cref_ftrie_cold_79(const char* p, int r)
+    __attribute__ ((cold, noinline));
+
+static int html_cref_ftrie_cold_79(const char* p, int r)
+{
+    switch (*p ++) {
+    case 'E':
+        return 8019;
+    case 'a':
+        if (*p ++ == 'p') {
+            return 8024;
+        }
+        return r;
+    case 'c':
+        if (*p ++ == 'u' &&
+            *p ++ == 'e') {
+            return 8029;
+        }
+        return r;
+    case 'e':
+        r = 8034;
+        if (*p ++ == 'c') {
+            r = 8039;
+            switch (*p ++) {
+            case 'a':
+                if (*p ++ == 'p' &&
+                    *p ++ == 'p' &&
+                    *p ++ == 'r' &&
+                    *p ++ == 'o' &&
+                    *p ++ == 'x') {
+                    return 8044;
+                }
+                return r;
+            case 'c':
+                if (*p ++ == 'u' &&
+                    *p ++ == 'r' &&
+                    *p ++ == 'l' &&
+                    *p ++ == 'y' &&
+                    *p ++ == 'e' &&
+                    *p ++ == 'q') {
+                    return 8049;
+                }
+                return r;
+            case 'e':
+                if (*p ++ == 'q') {
+                    return 8054;
+                }
+                return r;
+            case 'n':
+                switch (*p ++) {
+                case 'a':
+                    if (*p ++ == 'p' &&
+                        *p ++ == 'p' &&
+                        *p ++ == 'r' &&
+                        *p ++ == 'o' &&
+                        *p ++ == 'x') {
+                        return 8059;
+                    }
+                    return r;
+                case 'e':
+                    if (*p ++ == 'q' &&
+                        *p ++ == 'q') {
+                        return 8064;
+                    }
+                    return r;
+                case 's':
+                    if (*p ++ == 'i' &&
+                        *p ++ == 'm') {
+                        return 8069;
+                    }
+                    return r;
+                }
+                return r;
+            case 's':
+                if (*p ++ == 'i' &&
+                    *p ++ == 'm') {
+                    return 8074;
+                }
+                return r;
+            }
+            return r;
+        }
+        return r;
+    case 'n':
+        switch (*p ++) {
+        case 'E':
+            return 8089;
+        case 'a':
+            if (*p ++ == 'p') {
+                return 8094;
+            }
+            return r;
+        case 's':
+            if (*p ++ == 'i' &&
+                *p ++ == 'm') {
+                return 8099;
+            }
+            return r;
+        }
+        return r;
+    case 'o':
+        switch (*p ++) {
+        case 'd':
+            return 8104;
+        case 'f':
+            switch (*p ++) {
+            case 'a':
+                if (*p ++ == 'l' &&
+                    *p ++ == 'a' &&
+                    *p ++ == 'r') {
+                    return 8109;
+                }
+                return r;
+            case 'l':
+                if (*p ++ == 'i' &&
+                    *p ++ == 'n' &&
+                    *p ++ == 'e') {
+                    return 8114;
+                }
+                return r;
+            case 's':
+                if (*p ++ == 'u' &&
+                    *p ++ == 'r' &&
+                    *p ++ == 'f') {
+                    return 8119;
+                }
+                return r;
+            }
+            return r;
+        case 'p':
+            r = 8124;
+            if (*p ++ == 't' &&
+                *p ++ == 'o') {
+                return 8129;
+            }
+            return r;
+        }
+        return r;
+    case 's':
+        if (*p ++ == 'i' &&
+            *p ++ == 'm') {
+            return 8134;
+        }
+        return r;
+    case 'u':
+        if (*p ++ == 'r' &&
+            *p ++ == 'e' &&
+            *p ++ == 'l') {
+            return 8139;
+        }
+        return r;
+    }
+    return r;
+}
+
+static int html_cref_ftrie_cold_80(const char* p, int r)
+    __attribute__ ((cold, noinline));
+
+static int html_cref_ftrie_cold_80(const char* p, int r)
+{
+    switch (*p ++) {
+    case 'c':
+        if (*p ++ == 'y') {
+            return 7871;
+        }
+        return r;
+    case 'e':
+        if (*p ++ == 'r') {
+            switch (*p ++) {
+            case 'c':
+                if (*p ++ == 'n' &&
+                    *p ++ == 't') {
+                    return 7875;
+                }
+                return r;
+            case 'i':
+                if (*p ++ == 'o' &&
+                    *p ++ == 'd') {
+                    return 7878;
+                }
+                return r;
+            case 'm':
+                if (*p ++ == 'i' &&
+                    *p ++ == 'l') {
+                    return 7881;
+                }
+                return r;
+            case 'p':
+                return 7886;
+            case 't':
+                if (*p ++ == 'e' &&
+                    *p ++ == 'n' &&
+                    *p ++ == 'k') {
+                    return 7891;
+                }
+                return r;
+            }
+            return r;
+        }
+        return r;
+    case 'f':
+        if (*p ++ == 'r') {
+            return 7896;
+        }
+        return r;
+    case 'h':
+        switch (*p ++) {
+        case 'i':
+            r = 7902;
+            if (*p ++ == 'v') {
+                return 7906;
+            }
+            return r;
+        case 'm':
+            if (*p ++ == 'm' &&
+                *p ++ == 'a' &&
+                *p ++ == 't') {
+                return 7910;
+            }
+            return r;
+        case 'o':
+            if (*p ++ == 'n' &&
+                *p ++ == 'e') {
+                return 7915;
+            }
+            return r;
+        }
+        return r;
+    case 'i':
+        r = 7920;
+        switch (*p ++) {
+        case 't':
+            if (*p ++ == 'c' &&
+                *p ++ == 'h' &&
+                *p ++ == 'f' &&
+                *p ++ == 'o' &&
+                *p ++ == 'r' &&
+                *p ++ == 'k') {
+                return 7924;
+            }
+            return r;
+        case 'v':
+            return 7929;
+        }
+        return r;
+    case 'm':
+        return 7995;
+    case 's':
+        switch (*p ++) {
+        case 'c':
+            if (*p ++ == 'r') {
+                return 8144;
+            }
+            return r;
+        case 'i':
+            return 8150;
+        }
+        return r;
+    case 'u':
+        if (*p ++ == 'n' &&
+            *p ++ == 'c' &&
+            *p ++ == 's' &&
+            *p ++ == 'p') {
+            return 8154;
+        }
+        return r;
+    }
+    return r;
+}
+
+static int html_cref_ftrie_cold_81(const char* p, int r)
+    __attribute__ ((cold, noinline));
+
+static int html_cref_ftrie_cold_81(const char* p, int r)
+{
+    switch (*p ++) {
+    case 't':
+        if (*p ++ == 'i' &&
+            *p ++ == 'e') {
+            return 5537;
+        }
+        return r;
+    }
+    return r;
+}
+
+static int html_cref_ftrie_cold_82(const char* p, int r)
+    __attribute__ ((cold, noinline));
+
+static int html_cref_ftrie_cold_82(const char* p, int r)
+{
+    switch (*p ++) {
+    case 'c':
+        if (*p ++ == 'a' &&
+            *p ++ == 'r' &&
+            *p ++ == 'e') {
+            return 5527;
+        }
+        return r;
+    case 'o':
+        if (*p ++ == 'd' &&
+            *p ++ == 'o' &&
+            *p ++ == 't') {
+            return 5542;
+        }
+        return r;
+    case 't':
+        r = 5546;
+        switch (*p ++) {
+        case 'c':
+            if (*p ++ == 'a' &&
+                *p ++ == 'l') {
+                return 5551;
+            }
+            return r;
+        case 'e':
+            switch (*p ++) {
+            case 'g':
+                if (*p ++ == 'e' &&
+                    *p ++ == 'r' &&
+                    *p ++ == 's') {
+                    return 5556;
+                }
+                return r;
+            case 'r':
+                if (*p ++ == 'c' &&
+                    *p ++ == 'a' &&
+                    *p ++ == 'l') {
+                    return 5561;
+                }
+                return r;
+            }
+            return r;
+        case 'l':
+            if (*p ++ == 'a' &&
+                *p ++ == 'r' &&
+                *p ++ == 'h' &&
+                *p ++ == 'k') {
+                return 5566;
+            }
+            return r;
+        case 'p':
+            if (*p ++ == 'r' &&
+                *p ++ == 'o' &&
+                *p ++ == 'd') {
+                return 5571;
+            }
+            return r;
+        }
+        return r;
+    }
+    return r;
+}
+
+static int html_cref_ftrie_cold_83(const char* p, int r)
+    __attribute__ ((cold, noinline));
+
+static int html_cref_ftrie_cold_83(const char* p, int r)
+{
+    switch (*p ++) {
+    case 'c':
+        r = 5425;
+        switch (*p ++) {
+        case 'i':
+            if (*p ++ == 'r' &&
+                *p ++ == 'c') {
+                return 5430;
+            }
+            return r;
+        case 'y':
+            return 5434;
+        }
+        return r;
+    case 'e':
+        switch (*p ++) {
+        case 'c':
+            if (*p ++ == 'y') {
+                return 5438;
+            }
+            return r;
+        case 'x':
+            if (*p ++ == 'c' &&
+                *p ++ == 'l') {
+                return 5442;
+            }
+            return r;
+        }
+        return r;
+    case 'f':
+        switch (*p ++) {
+        case 'f':
+            return 5446;
+        case 'r':
+            return 5451;
+        }
+        return r;
+    case 'g':
+        if (*p ++ == 'r' &&
+            *p ++ == 'a' &&
+            *p ++ == 'v' &&
+            *p ++ == 'e') {
+            return 5457;
+        }
+        return r;
+    case 'i':
+        r = 5461;
+        switch (*p ++) {
+        case 'i':
+            switch (*p ++) {
+            case 'i':
+                if (*p ++ == 'n' &&
+                    *p ++ == 't') {
+                    return 5466;
+                }
+                return r;
+            case 'n':
+                if (*p ++ == 't') {
+                    return 5471;
+                }
+                return r;
+            }
+            return r;
+        case 'n':
+            if (*p ++ == 'f' &&
+                *p ++ == 'i' &&
+                *p ++ == 'n') {
+                return 5476;
+            }
+            return r;
+        case 'o':
+            if (*p ++ == 't' &&
+                *p ++ == 'a') {
+                return 5481;
+            }
+            return r;
+        }
+        return r;
+    case 'j':
+        if (*p ++ == 'l' &&
+            *p ++ == 'i' &&
+            *p ++ == 'g') {
+            return 5486;
+        }
+        return r;
+    case 'm':
+        switch (*p ++) {
+        case 'a':
+            switch (*p ++) {
+            case 'c':
+                if (*p ++ == 'r') {
+                    return 5490;
+                }
+                return r;
+            case 'g':
+                switch (*p ++) {
+                case 'e':
+                    return 5494;
+                case 'l':
+                    if (*p ++ == 'i' &&
+                        *p ++ == 'n' &&
+                        *p ++ == 'e') {
+                        return 5499;
+                    }
+                    return r;
+                case 'p':
+                    if (*p ++ == 'a' &&
+                        *p ++ == 'r' &&
+                        *p ++ == 't') {
+                        return 5504;
+                    }
+                    return r;
+                }
+                return r;
+            case 't':
+                if (*p ++ == 'h') {
+                    return 5509;
+                }
+                return r;
+            }
+            return r;
+        case 'o':
+            if (*p ++ == 'f') {
+                return 5513;
+            }
+            return r;
+        case 'p':
+            if (*p ++ == 'e' &&
+                *p ++ == 'd') {
+                return 5518;
+            }
+            return r;
+        }
+        return r;
+    case 'o':
+        switch (*p ++) {
+        case 'c':
+            if (*p ++ == 'y') {
+                return 5576;
+            }
+            return r;
+        case 'g':
+            if (*p ++ == 'o' &&
+                *p ++ == 'n') {
+                return 5580;
+            }
+            return r;
+        case 'p':
+            if (*p ++ == 'f') {
+                return 5584;
+            }
+            return r;
+        case 't':
+            if (*p ++ == 'a') {
+                return 5590;
+            }
+            return r;
+        }
+        return r;
+    case 'p':
+        if (*p ++ == 'r' &&
+            *p ++ == 'o' &&
+            *p ++ == 'd') {
+            return 5594;
+        }
+        return r;
+    case 'q':
+        if (*p ++ == 'u' &&
+            *p ++ == 'e' &&
+            *p ++ == 's' &&
+            *p ++ == 't') {
+            return 5599;
+        }
+        return r;
+    case 's':
+        switch (*p ++) {
+        case 'c':
+            if (*p ++ == 'r') {
+                return 5603;
+            }
+            return r;
+        case 'i':
+            if (*p ++ == 'n') {
+                r = 5609;
+                switch (*p ++) {
+                case 'E':
+                    return 5614;
+                case 'd':
+                    if (*p ++ == 'o' &&
+                        *p ++ == 't') {
+                        return 5619;
+                    }
+                    return r;
+                case 's':
+                    r = 5624;
+                    if (*p ++ == 'v') {
+                        return 5629;
+                    }
+                    return r;
+                case 'v':
+                    return 5634;
+                }
+                return r;
+            }
+            return r;
+        }
+        return r;
+    case 't':
+        r = 5639;
+        if (*p ++ == 'i' &&
+            *p ++ == 'l' &&
+            *p ++ == 'd' &&
+            *p ++ == 'e') {
+            return 5644;
+        }
+        return r;
+    case 'u':
+        switch (*p ++) {
+        case 'k':
+            if (*p ++ == 'c' &&
+                *p ++ == 'y') {
+                return 5648;
+            }
+            return r;
+        case 'm':
+            if (*p ++ == 'l') {
+                return 5652;
+            }
+            return r;
+        }
+        return r;
+    }
+    return r;
+}
+
+static int html_cref_ftrie_cold_84(const char* p, int r)
+    __attribute__ ((cold, noinline));
+
+static int html_cref_ftrie_cold_84(const char* p, int r)
+{
+    switch (*p ++) {
+    case 'A':
+        if (*p ++ == 'r' &&
+            *p ++ == 'r') {
+            return 8794;
+        }
+        return r;
+    case 'a':
+        if (*p ++ == 'r') {
+            switch (*p ++) {
+            case 'h':
+                if (*p ++ == 'k') {
+                    return 8799;
+                }
+                return r;
+            case 'r':
+                r = 8804;
+                if (*p ++ == 'o' &&
+                    *p ++ == 'w') {
+                    return 8809;
+                }
+                return r;
+            }
+            return r;
+        }
+        return r;
+    case 'm':
+        if (*p ++ == 'i') {
+            return 8818;
+        }
+        return r;
+    case 's':
+        if (*p ++ == 'w' &&
+            *p ++ == 'a' &&
+            *p ++ == 'r') {
+            return 8821;
+        }
+        return r;
+    case 't':
+        if (*p ++ == 'm') {
+            switch (*p ++) {
+            case 'i':
+                if (*p ++ == 'n' &&
+                    *p ++ == 'u' &&
+                    *p ++ == 's') {
+                    return 8826;
+                }
+                return r;
+            case 'n':
+                return 8831;
+            }
+            return r;
+        }
+        return r;
+    case 'x':
+        if (*p ++ == 't') {
+            return 8836;
+        }
+        return r;
+    }
+    return r;
+}
+
+static int html_cref_ftrie_cold_85(const char* p, int r)
+    __attribute__ ((cold, noinline));
+
+static int html_cref_ftrie_cold_85(const char* p, int r)
+{
+    switch (*p ++) {
+    case 'a':
+        if (*p ++ == 'r' &&
+            *p ++ == 'p') {
+            return 8852;
+        }
+        return r;
+    case 'c':
+        switch (*p ++) {
+        case 'h':
+            if (*p ++ == 'c' &&
+                *p ++ == 'y') {
+                return 8857;
+            }
+            return r;
+        case 'y':
+            return 8861;
+        }
+        return r;
+    case 'o':
+        if (*p ++ == 'r' &&
+            *p ++ == 't') {
+            switch (*p ++) {
+            case 'm':
+                if (*p ++ == 'i' &&
+                    *p ++ == 'd') {
+                    return 8865;
+                }
+                return r;
+            case 'p':
+                if (*p ++ == 'a' &&
+                    *p ++ == 'r' &&
+                    *p ++ == 'a' &&
+                    *p ++ == 'l' &&
+                    *p ++ == 'l' &&
+                    *p ++ == 'e' &&
+                    *p ++ == 'l') {
+                    return 8870;
+                }
+                return r;
+            }
+            return r;
+        }
+        return r;
+    }
+    return r;
+}
+
+static int html_cref_ftrie_cold_86(const char* p, int r)
+    __attribute__ ((cold, noinline));
+
+static int html_cref_ftrie_cold_86(const char* p, int r)
+{
+    switch (*p ++) {
+    case '1':
+        return 9311;
+    case '3':
+        return 9319;
+    case 'E':
+        return 9323;
+    case 'd':
+        switch (*p ++) {
+        case 'o':
+            if (*p ++ == 't') {
+                return 9328;
+            }
+            return r;
+        case 's':
+            if (*p ++ == 'u' &&
+                *p ++ == 'b') {
+                return 9333;
+            }
+            return r;
+        }
+        return r;
+    case 'e':
+        r = 9338;
+        if (*p ++ == 'd' &&
+            *p ++ == 'o' &&
+            *p ++ == 't') {
+            return 9343;
+        }
+        return r;
+    case 'h':
+        if (*p ++ == 's') {
+            switch (*p ++) {
+            case 'o':
+                if (*p ++ == 'l') {
+                    return 9348;
+                }
+                return r;
+            case 'u':
+                if (*p ++ == 'b') {
+                    return 9353;
+                }
+                return r;
+            }
+            return r;
+        }
+        return r;
+    case 'l':
+        if (*p ++ == 'a' &&
+            *p ++ == 'r' &&
+            *p ++ == 'r') {
+            return 9358;
+        }
+        return r;
+    case 'm':
+        if (*p ++ == 'u' &&
+            *p ++ == 'l' &&
+            *p ++ == 't') {
+            return 9363;
+        }
+        return r;
+    case 'n':
+        switch (*p ++) {
+        case 'E':
+            return 9368;
+        case 'e':
+            return 9373;
+        }
+        return r;
+    case 'p':
+        if (*p ++ == 'l' &&
+            *p ++ == 'u' &&
+            *p ++ == 's') {
+            return 9378;
+        }
+        return r;
+    case 's':
+        switch (*p ++) {
+        case 'e':
+            if (*p ++ == 't') {
+                r = 9383;
+                switch (*p ++) {
+                case 'e':
+                    if (*p ++ == 'q') {
+                        r = 9388;
+                        if (*p ++ == 'q') {
+                            return 9393;
+                        }
+                        return r;
+                    }
+                    return r;
+                case 'n':
+                    if (*p ++ == 'e' &&
+                        *p ++ == 'q') {
+                        r = 9398;
+                        if (*p ++ == 'q') {
+                            return 9403;
+                        }
+                        return r;
+                    }
+                    return r;
+                }
+                return r;
+            }
+            return r;
+        case 'i':
+            if (*p ++ == 'm') {
+                return 9408;
+            }
+            return r;
+        case 'u':
+            switch (*p ++) {
+            case 'b':
+                return 9413;
+            case 'p':
+                return 9418;
+            }
+            return r;
+        }
+        return r;
+    }
+    return r;
+}
+
+static int html_cref_ftrie_cold_87(const char* p, int r)
+    __attribute__ ((cold, noinline));
+
+static int html_cref_ftrie_cold_87(const char* p, int r)
+{
+    switch (*p ++) {
+    case 'b':
+        r = 9166;
+        switch (*p ++) {
+        case 'E':
+            return 9171;
+        case 'd':
+            if (*p ++ == 'o' &&
+                *p ++ == 't') {
+                return 9176;
+            }
+            return r;
+        case 'e':
+            r = 9181;
+            if (*p ++ == 'd' &&
+                *p ++ == 'o' &&
+                *p ++ == 't') {
+                return 9186;
+            }
+            return r;
+        case 'm':
+            if (*p ++ == 'u' &&
+                *p ++ == 'l' &&
+                *p ++ == 't') {
+                return 9191;
+            }
+            return r;
+        case 'n':
+            switch (*p ++) {
+            case 'E':
+                return 9196;
+            case 'e':
+                return 9201;
+            }
+            return r;
+        case 'p':
+            if (*p ++ == 'l' &&
+                *p ++ == 'u' &&
+                *p ++ == 's') {
+                return 9206;
+            }
+            return r;
+        case 'r':
+            if (*p ++ == 'a' &&
+                *p ++ == 'r' &&
+                *p ++ == 'r') {
+                return 9211;
+            }
+            return r;
+        case 's':
+            switch (*p ++) {
+            case 'e':
+                if (*p ++ == 't') {
+                    r = 9216;
+                    switch (*p ++) {
+                    case 'e':
+                        if (*p ++ == 'q') {
+                            r = 9221;
+                            if (*p ++ == 'q') {
+                                return 9226;
+                            }
+                            return r;
+                        }
+                        return r;
+                    case 'n':
+                        if (*p ++ == 'e' &&
+                            *p ++ == 'q') {
+                            r = 9231;
+                            if (*p ++ == 'q') {
+                                return 9236;
+                            }
+                            return r;
+                        }
+                        return r;
+                    }
+                    return r;
+                }
+                return r;
+            case 'i':
+                if (*p ++ == 'm') {
+                    return 9241;
+                }
+                return r;
+            case 'u':
+                switch (*p ++) {
+                case 'b':
+                    return 9246;
+                case 'p':
+                    return 9251;
+                }
+                return r;
+            }
+            return r;
+        }
+        return r;
+    case 'c':
+        if (*p ++ == 'c') {
+            r = 9256;
+            switch (*p ++) {
+            case 'a':
+                if (*p ++ == 'p' &&
+                    *p ++ == 'p' &&
+                    *p ++ == 'r' &&
+                    *p ++ == 'o' &&
+                    *p ++ == 'x') {
+                    return 9261;
+                }
+                return r;
+            case 'c':
+                if (*p ++ == 'u' &&
+                    *p ++ == 'r' &&
+                    *p ++ == 'l' &&
+                    *p ++ == 'y' &&
+                    *p ++ == 'e' &&
+                    *p ++ == 'q') {
+                    return 9266;
+                }
+                return r;
+            case 'e':
+                if (*p ++ == 'q') {
+                    return 9271;
+                }
+                return r;
+            case 'n':
+                switch (*p ++) {
+                case 'a':
+                    if (*p ++ == 'p' &&
+                        *p ++ == 'p' &&
+                        *p ++ == 'r' &&
+                        *p ++ == 'o' &&
+                        *p ++ == 'x') {
+                        return 9276;
+                    }
+                    return r;
+                case 'e':
+                    if (*p ++ == 'q' &&
+                        *p ++ == 'q') {
+                        return 9281;
+                    }
+                    return r;
+                case 's':
+                    if (*p ++ == 'i' &&
+                        *p ++ == 'm') {
+                        return 9286;
+                    }
+                    return r;
+                }
+                return r;
+            case 's':
+                if (*p ++ == 'i' &&
+                    *p ++ == 'm') {
+                    return 9291;
+                }
+                return r;
+            }
+            return r;
+        }
+        return r;
+    case 'm':
+        return 9296;
+    case 'n':
+        if (*p ++ == 'g') {
+            return 9301;
+        }
+        return r;
+    }
+    return r;
+}
+
+static int html_cref_ftrie_cold_88(const char* p, int r)
+    __attribute__ ((cold, noinline));
+
+static int html_cref_ftrie_cold_88(const char* p, int r)
+{
+    switch (*p ++) {
+    case 'a':
+        if (*p ++ == 'c' &&
+            *p ++ == 'u' &&
+            *p ++ == 't' &&
+            *p ++ == 'e') {
+            return 8704;
+        }
+        return r;
+    case 'b':
+        if (*p ++ == 'q' &&
+            *p ++ == 'u' &&
+            *p ++ == 'o') {
+            return 8708;
+        }
+        return r;
+    case 'c':
+        r = 8713;
+        switch (*p ++) {
+        case 'E':
+            return 8718;
+        case 'a':
+            switch (*p ++) {
+            case 'p':
+                return 8723;
+            case 'r':
+                if (*p ++ == 'o' &&
+                    *p ++ == 'n') {
+                    return 8728;
+                }
+                return r;
+            }
+            return r;
+        case 'c':
+            if (*p ++ == 'u' &&
+                *p ++ == 'e') {
+                return 8732;
+            }
+            return r;
+        case 'e':
+            r = 8737;
+            if (*p ++ == 'd' &&
+                *p ++ == 'i' &&
+                *p ++ == 'l') {
+                return 8742;
+            }
+            return r;
+        case 'i':
+            if (*p ++ == 'r' &&
+                *p ++ == 'c') {
+                return 8746;
+            }
+            return r;
+        case 'n':
+            switch (*p ++) {
+            case 'E':
+                return 8750;
+            case 'a':
+                if (*p ++ == 'p') {
+                    return 8755;
+                }
+                return r;
+            case 's':
+                if (*p ++ == 'i' &&
+                    *p ++ == 'm') {
+                    return 8760;
+                }
+                return r;
+            }
+            return r;
+        case 'p':
+            if (*p ++ == 'o' &&
+                *p ++ == 'l' &&
+                *p ++ == 'i' &&
+                *p ++ == 'n' &&
+                *p ++ == 't') {
+                return 8765;
+            }
+            return r;
+        case 's':
+            if (*p ++ == 'i' &&
+                *p ++ == 'm') {
+                return 8770;
+            }
+            return r;
+        case 'y':
+            return 8775;
+        }
+        return r;
+    case 'd':
+        if (*p ++ == 'o' &&
+            *p ++ == 't') {
+            r = 8779;
+            switch (*p ++) {
+            case 'b':
+                return 8784;
+            case 'e':
+                return 8789;
+            }
+            return r;
+        }
+        return r;
+    case 'f':
+        if (*p ++ == 'r') {
+            r = 8841;
+            if (*p ++ == 'o' &&
+                *p ++ == 'w' &&
+                *p ++ == 'n') {
+                return 8847;
+            }
+            return r;
+        }
+        return r;
+    case 'i':
+        switch (*p ++) {
+        case 'g':
+            if (*p ++ == 'm' &&
+                *p ++ == 'a') {
+                r = 8879;
+                switch (*p ++) {
+                case 'f':
+                    return 8883;
+                case 'v':
+                    return 8887;
+                }
+                return r;
+            }
+            return r;
+        case 'm':
+            r = 8891;
+            switch (*p ++) {
+            case 'd':
+                if (*p ++ == 'o' &&
+                    *p ++ == 't') {
+                    return 8896;
+                }
+                return r;
+            case 'e':
+                r = 8901;
+                if (*p ++ == 'q') {
+                    return 8906;
+                }
+                return r;
+            case 'g':
+                r = 8911;
+                if (*p ++ == 'E') {
+                    return 8916;
+                }
+                return r;
+            case 'l':
+                r = 8921;
+                if (*p ++ == 'E') {
+                    return 8926;
+                }
+                return r;
+            case 'n':
+                if (*p ++ == 'e') {
+                    return 8931;
+                }
+                return r;
+            case 'p':
+                if (*p ++ == 'l' &&
+                    *p ++ == 'u' &&
+                    *p ++ == 's') {
+                    return 8936;
+                }
+                return r;
+            case 'r':
+                if (*p ++ == 'a' &&
+                    *p ++ == 'r' &&
+                    *p ++ == 'r') {
+                    return 8941;
+                }
+                return r;
+            }
+            return r;
+        }
+        return r;
+    case 'l':
+        if (*p ++ == 'a' &&
+            *p ++ == 'r' &&
+            *p ++ == 'r') {
+            return 8946;
+        }
+        return r;
+    case 'm':
+        switch (*p ++) {
+        case 'a':
+            switch (*p ++) {
+            case 'l':
+                if (*p ++ == 'l' &&
+                    *p ++ == 's' &&
+                    *p ++ == 'e' &&
+                    *p ++ == 't' &&
+                    *p ++ == 'm' &&
+                    *p ++ == 'i' &&
+                    *p ++ == 'n' &&
+                    *p ++ == 'u' &&
+                    *p ++ == 's') {
+                    return 8951;
+                }
+                return r;
+            case 's':
+                if (*p ++ == 'h' &&
+                    *p ++ == 'p') {
+                    return 8956;
+                }
+                return r;
+            }
+            return r;
+        case 'e':
+            if (*p ++ == 'p' &&
+                *p ++ == 'a' &&
+                *p ++ == 'r' &&
+                *p ++ == 's' &&
+                *p ++ == 'l') {
+                return 8961;
+            }
+            return r;
+        case 'i':
+            switch (*p ++) {
+            case 'd':
+                return 8966;
+            case 'l':
+                if (*p ++ == 'e') {
+                    return 8971;
+                }
+                return r;
+            }
+            return r;
+        case 't':
+            r = 8976;
+            if (*p ++ == 'e') {
+                r = 8981;
+                if (*p ++ == 's') {
+                    return 8986;
+                }
+                return r;
+            }
+            return r;
+        }
+        return r;
+    case 'o':
+        switch (*p ++) {
+        case 'f':
+            if (*p ++ == 't' &&
+                *p ++ == 'c' &&
+                *p ++ == 'y') {
+                return 8994;
+            }
+            return r;
+        case 'l':
+            r = 8998;
+            if (*p ++ == 'b') {
+                r = 9001;
+                if (*p ++ == 'a' &&
+                    *p ++ == 'r') {
+                    return 9006;
+                }
+                return r;
+            }
+            return r;
+        case 'p':
+            if (*p ++ == 'f') {
+                return 9011;
+            }
+            return r;
+        }
+        return r;
+    case 'p':
+        if (*p ++ == 'a') {
+            switch (*p ++) {
+            case 'd':
+                if (*p ++ == 'e' &&
+                    *p ++ == 's') {
+                    r = 9017;
+                    if (*p ++ == 'u' &&
+                        *p ++ == 'i' &&
+                        *p ++ == 't') {
+                        return 9022;
+                    }
+                    return r;
+                }
+                return r;
+            case 'r':
+                return 9027;
+            }
+            return r;
+        }
+        return r;
+    case 'q':
+        switch (*p ++) {
+        case 'c':
+            switch (*p ++) {
+            case 'a':
+                if (*p ++ == 'p') {
+                    r = 9032;
+                    if (*p ++ == 's') {
+                        return 9037;
+                    }
+                    return r;
+                }
+                return r;
+            case 'u':
+                if (*p ++ == 'p') {
+                    r = 9045;
+                    if (*p ++ == 's') {
+                        return 9050;
+                    }
+                    return r;
+                }
+                return r;
+            }
+            return r;
+        case 's':
+            if (*p ++ == 'u') {
+                switch (*p ++) {
+                case 'b':
+                    r = 9058;
+                    switch (*p ++) {
+                    case 'e':
+                        return 9063;
+                    case 's':
+                        if (*p ++ == 'e' &&
+                            *p ++ == 't') {
+                            r = 9068;
+                            if (*p ++ == 'e' &&
+                                *p ++ == 'q') {
+                                return 9073;
+                            }
+                            return r;
+                        }
+                        return r;
+                    }
+                    return r;
+                case 'p':
+                    r = 9078;
+                    switch (*p ++) {
+                    case 'e':
+                        return 9083;
+                    case 's':
+                        if (*p ++ == 'e' &&
+                            *p ++ == 't') {
+                            r = 9088;
+                            if (*p ++ == 'e' &&
+                                *p ++ == 'q') {
+                                return 9093;
+                            }
+                            return r;
+                        }
+                        return r;
+                    }
+                    return r;
+                }
+                return r;
+            }
+            return r;
+        case 'u':
+            r = 9098;
+            switch (*p ++) {
+            case 'a':
+                if (*p ++ == 'r') {
+                    switch (*p ++) {
+                    case 'e':
+                        return 9103;
+                    case 'f':
+                        return 9108;
+                    }
+                    return r;
+                }
+                return r;
+            case 'f':
+                return 9113;
+            }
+            return r;
+        }
+        return r;
+    case 'r':
+        if (*p ++ == 'a' &&
+            *p ++ == 'r' &&
+            *p ++ == 'r') {
+            return 9118;
+        }
+        return r;
+    case 's':
+        switch (*p ++) {
+        case 'c':
+            if (*p ++ == 'r') {
+                return 9123;
+            }
+            return r;
+        case 'e':
+            if (*p ++ == 't' &&
+                *p ++ == 'm' &&
+                *p ++ == 'n') {
+                return 9129;
+            }
+            return r;
+        case 'm':
+            if (*p ++ == 'i' &&
+                *p ++ == 'l' &&
+                *p ++ == 'e') {
+                return 9134;
+            }
+            return r;
+        case 't':
+            if (*p ++ == 'a' &&
+                *p ++ == 'r' &&
+                *p ++ == 'f') {
+                return 9139;
+            }
+            return r;
+        }
+        return r;
+    case 't':
+        switch (*p ++) {
+        case 'a':
+            if (*p ++ == 'r') {
+                r = 9144;
+                if (*p ++ == 'f') {
+                    return 9149;
+                }
+                return r;
+            }
+            return r;
+        case 'r':
+            switch (*p ++) {
+            case 'a':
+                if (*p ++ == 'i' &&
+                    *p ++ == 'g' &&
+                    *p ++ == 'h' &&
+                    *p ++ == 't') {
+                    switch (*p ++) {
+                    case 'e':
+                        if (*p ++ == 'p' &&
+                            *p ++ == 's' &&
+                            *p ++ == 'i' &&
+                            *p ++ == 'l' &&
+                            *p ++ == 'o' &&
+                            *p ++ == 'n') {
+                            return 9154;
+                        }
+                        return r;
+                    case 'p':
+                        if (*p ++ == 'h' &&
+                            *p ++ == 'i') {
+                            return 9158;
+                        }
+                        return r;
+                    }
+                    return r;
+                }
+                return r;
+            case 'n':
+                if (*p ++ == 's') {
+                    return 9162;
+                }
+                return r;
+            }
+            return r;
+        }
+        return r;
+    case 'w':
+        switch (*p ++) {
+        case 'A':
+            if (*p ++ == 'r' &&
+                *p ++ == 'r') {
+                return 9423;
+            }
+            return r;
+        case 'a':
+            if (*p ++ == 'r') {
+                switch (*p ++) {
+                case 'h':
+                    if (*p ++ == 'k') {
+                        return 9428;
+                    }
+                    return r;
+                case 'r':
+                    r = 9433;
+                    if (*p ++ == 'o' &&
+                        *p ++ == 'w') {
+                        return 9438;
+                    }
+                    return r;
+                }
+                return r;
+            }
+            return r;
+        case 'n':
+            if (*p ++ == 'w' &&
+                *p ++ == 'a' &&
+                *p ++ == 'r') {
+                return 9443;
+            }
+            return r;
+        }
+        return r;
+    }
+    return r;
+}
+
+static int html_cref_ftrie_cold_89(const char* p, int r)
+    __attribute__ ((cold, noinline));
+
+static int html_cref_ftrie_cold_89(const char* p, int r)
+{
+    switch (*p ++) {
+    case '3':
+        return 4904;
+    case '4':
+        return 4909;
+    case '5':
+        return 4913;
+    case '6':
+        return 4918;
+    case '8':
+        return 4923;
+    }
+    return r;
+}
+
+static int html_cref_ftrie_cold_90(const char* p, int r)
+    __attribute__ ((cold, noinline));
+
+static int html_cref_ftrie_cold_90(const char* p, int r)
+{
+    switch (*p ++) {
+    case '2':
+        switch (*p ++) {
+        case '3':
+            return 4928;
+        case '5':
+            return 4933;
+        }
+        return r;
+    case '3':
+        switch (*p ++) {
+        case '4':
+            return 4938;
+        case '5':
+            return 4942;
+        case '8':
+            return 4947;
+        }
+        return r;
+    case '4':
+        if (*p ++ == '5') {
+            return 4952;
+        }
+        return r;
+    case '5':
+        switch (*p ++) {
+        case '6':
+            return 4957;
+        case '8':
+            return 4962;
+        }
+        return r;
+    case '7':
+        if (*p ++ == '8') {
+            return 4967;
+        }
+        return r;
+    }
+    return r;
+}
+
+static int html_cref_ftrie_cold_91(const char* p, int r)
+    __attribute__ ((cold, noinline));
+
+static int html_cref_ftrie_cold_91(const char* p, int r)
+{
+    switch (*p ++) {
+    case 's':
+        if (*p ++ == 'l') {
+            return 4972;
+        }
+        return r;
+    }
+    return r;
+}
+
+static int html_cref_ftrie_cold_92(const char* p, int r)
+    __attribute__ ((cold, noinline));
+
+static int html_cref_ftrie_cold_92(const char* p, int r)
+{
+    switch (*p ++) {
+    case 'o':
+        if (*p ++ == 'w' &&
+            *p ++ == 'n') {
+            return 4977;
+        }
+        return r;
+    }
+    return r;
+}
+
+static int html_cref_ftrie_cold_93(const char* p, int r)
+    __attribute__ ((cold, noinline));
+
+static int html_cref_ftrie_cold_93(const char* p, int r)
+{
+    switch (*p ++) {
+    case 'a':
+        if (*p ++ == 'l' &&
+            *p ++ == 'l' &&
+            *p ++ == 'i' &&
+            *p ++ == 'n' &&
+            *p ++ == 'g' &&
+            *p ++ == 'd' &&
+            *p ++ == 'o' &&
+            *p ++ == 't' &&
+            *p ++ == 's' &&
+            *p ++ == 'e' &&
+            *p ++ == 'q') {
+            return 4811;
+        }
+        return r;
+    case 'c':
+        if (*p ++ == 'y') {
+            return 4816;
+        }
+        return r;
+    case 'e':
+        if (*p ++ == 'm' &&
+            *p ++ == 'a' &&
+            *p ++ == 'l' &&
+            *p ++ == 'e') {
+            return 4820;
+        }
+        return r;
+    case 'f':
+        switch (*p ++) {
+        case 'i':
+            if (*p ++ == 'l' &&
+                *p ++ == 'i' &&
+                *p ++ == 'g') {
+                return 4825;
+            }
+            return r;
+        case 'l':
+            switch (*p ++) {
+            case 'i':
+                if (*p ++ == 'g') {
+                    return 4830;
+                }
+                return r;
+            case 'l':
+                if (*p ++ == 'i' &&
+                    *p ++ == 'g') {
+                    return 4835;
+                }
+                return r;
+            }
+            return r;
+        case 'r':
+            return 4840;
+        }
+        return r;
+    case 'i':
+        if (*p ++ == 'l' &&
+            *p ++ == 'i' &&
+            *p ++ == 'g') {
+            return 4846;
+        }
+        return r;
+    case 'j':
+        if (*p ++ == 'l' &&
+            *p ++ == 'i' &&
+            *p ++ == 'g') {
+            return 4851;
+        }
+        return r;
+    case 'l':
+        switch (*p ++) {
+        case 'a':
+            if (*p ++ == 't') {
+                return 4855;
+            }
+            return r;
+        case 'l':
+            if (*p ++ == 'i' &&
+                *p ++ == 'g') {
+                return 4860;
+            }
+            return r;
+        case 't':
+            if (*p ++ == 'n' &&
+                *p ++ == 's') {
+                return 4865;
+            }
+            return r;
+        }
+        return r;
+    case 'n':
+        if (*p ++ == 'o' &&
+            *p ++ == 'f') {
+            return 4870;
+        }
+        return r;
+    case 'o':
+        switch (*p ++) {
+        case 'p':
+            if (*p ++ == 'f') {
+                return 4874;
+            }
+            return r;
+        case 'r':
+            switch (*p ++) {
+            case 'a':
+                if (*p ++ == 'l' &&
+                    *p ++ == 'l') {
+                    return 4880;
+                }
+                return r;
+            case 'k':
+                r = 4885;
+                if (*p ++ == 'v') {
+                    return 4890;
+                }
+                return r;
+            }
+            return r;
+        }
+        return r;
+    case 'p':
+        if (*p ++ == 'a' &&
+            *p ++ == 'r' &&
+            *p ++ == 't' &&
+            *p ++ == 'i' &&
+            *p ++ == 'n' &&
+            *p ++ == 't') {
+            return 4895;
+        }
+        return r;
+    case 's':
+        if (*p ++ == 'c' &&
+            *p ++ == 'r') {
+            return 4982;
+        }
+        return r;
+    }
+    return r;
+}
+
+static int html_cref_ftrie_cold_94(const char* p, int r)
+    __attribute__ ((cold, noinline));
+
+static int html_cref_ftrie_cold_94(const char* p, int r)
+{
+    switch (*p ++) {
+    case 'a':
+        if (*p ++ == 'c' &&
+            *p ++ == 'u' &&
+            *p ++ == 't' &&
+            *p ++ == 'e') {
+            return 10404;
+        }
+        return r;
+    case 'c':
+        switch (*p ++) {
+        case 'a':
+            if (*p ++ == 'r' &&
+                *p ++ == 'o' &&
+                *p ++ == 'n') {
+                return 10408;
+            }
+            return r;
+        case 'y':
+            return 10412;
+        }
+        return r;
+    case 'd':
+        if (*p ++ == 'o' &&
+            *p ++ == 't') {
+            return 10416;
+        }
+        return r;
+    case 'e':
+        switch (*p ++) {
+        case 'e':
+            if (*p ++ == 't' &&
+                *p ++ == 'r' &&
+                *p ++ == 'f') {
+                return 10420;
+            }
+            return r;
+        case 't':
+            if (*p ++ == 'a') {
+                return 10425;
+            }
+            return r;
+        }
+        return r;
+    case 'f':
+        if (*p ++ == 'r') {
+            return 10429;
+        }
+        return r;
+    case 'h':
+        if (*p ++ == 'c' &&
+            *p ++ == 'y') {
+            return 10435;
+        }
+        return r;
+    case 'i':
+        if (*p ++ == 'g' &&
+            *p ++ == 'r' &&
+            *p ++ == 'a' &&
+            *p ++ == 'r' &&
+            *p ++ == 'r') {
+            return 10439;
+        }
+        return r;
+    case 'o':
+        if (*p ++ == 'p' &&
+            *p ++ == 'f') {
+            return 10444;
+        }
+        return r;
+    case 's':
+        if (*p ++ == 'c' &&
+            *p ++ == 'r') {
+            return 10450;
+        }
+        return r;
+    }
+    return r;
+}
+
+static int html_cref_ftrie_cold_95(const char* p, int r)
+    __attribute__ ((cold, noinline));
+
+static int html_cref_ftrie_cold_95(const char* p, int r)
+{
+    switch (*p ++) {
+    case 'a':
+        if (*p ++ == 'c') {
+            switch (*p ++) {
+            case 'u':
+                if (*p ++ == 't' &&
+                    *p ++ == 'e') {
+                    return 10354;
+                }
+                return r;
+            case 'y':
+                return 10358;
+            }
+            return r;
+        }
+        return r;
+    case 'c':
+        switch (*p ++) {
+        case 'i':
+            if (*p ++ == 'r' &&
+                *p ++ == 'c') {
+                return 10362;
+            }
+            return r;
+        case 'y':
+            return 10366;
+        }
+        return r;
+    case 'f':
+        if (*p ++ == 'r') {
+            return 10374;
+        }
+        return r;
+    case 'i':
+        if (*p ++ == 'c' &&
+            *p ++ == 'y') {
+            return 10380;
+        }
+        return r;
+    case 'o':
+        if (*p ++ == 'p' &&
+            *p ++ == 'f') {
+            return 10384;
+        }
+        return r;
+    case 's':
+        if (*p ++ == 'c' &&
+            *p ++ == 'r') {
+            return 10390;
+        }
+        return r;
+    case 'u':
+        switch (*p ++) {
+        case 'c':
+            if (*p ++ == 'y') {
+                return 10396;
+            }
+            return r;
+        case 'm':
+            if (*p ++ == 'l') {
+                return 10400;
+            }
+            return r;
+        }
+        return r;
+    }
+    return r;
+}
+
+static int html_cref_ftrie_cold_96(const char* p, int r)
+    __attribute__ ((cold, noinline));
+
+static int html_cref_ftrie_cold_96(const char* p, int r)
+{
+    switch (*p ++) {
+    case 'A':
+        switch (*p ++) {
+        case 'E':
+            if (*p ++ == 'l' &&
+                *p ++ == 'i' &&
+                *p ++ == 'g') {
+                return 0;
+            }
+            return r;
+        case 'M':
+            if (*p ++ == 'P') {
+                return 4;
+            }
+            return r;
+        case 'a':
+            if (*p ++ == 'c' &&
+                *p ++ == 'u' &&
+                *p ++ == 't' &&
+                *p ++ == 'e') {
+                return 7;
+            }
+            return r;
+        case 'b':
+            if (*p ++ == 'r' &&
+                *p ++ == 'e' &&
+                *p ++ == 'v' &&
+                *p ++ == 'e') {
+                return 11;
+            }
+            return r;
+        case 'c':
+            switch (*p ++) {
+            case 'i':
+                if (*p ++ == 'r' &&
+                    *p ++ == 'c') {
+                    return 15;
+                }
+                return r;
+            case 'y':
+                return 19;
+            }
+            return r;
+        case 'f':
+            if (*p ++ == 'r') {
+                return 23;
+            }
+            return r;
+        case 'g':
+            if (*p ++ == 'r' &&
+                *p ++ == 'a' &&
+                *p ++ == 'v' &&
+                *p ++ == 'e') {
+                return 29;
+            }
+            return r;
+        case 'l':
+            if (*p ++ == 'p' &&
+                *p ++ == 'h' &&
+                *p ++ == 'a') {
+                return 33;
+            }
+            return r;
+        case 'm':
+            if (*p ++ == 'a' &&
+                *p ++ == 'c' &&
+                *p ++ == 'r') {
+                return 37;
+            }
+            return r;
+        case 'n':
+            if (*p ++ == 'd') {
+                return 41;
+            }
+            return r;
+        case 'o':
+            switch (*p ++) {
+            case 'g':
+                if (*p ++ == 'o' &&
+                    *p ++ == 'n') {
+                    return 46;
+                }
+                return r;
+            case 'p':
+                if (*p ++ == 'f') {
+                    return 50;
+                }
+                return r;
+            }
+            return r;
+        case 'p':
+            if (*p ++ == 'p' &&
+                *p ++ == 'l' &&
+                *p ++ == 'y' &&
+                *p ++ == 'F' &&
+                *p ++ == 'u' &&
+                *p ++ == 'n' &&
+                *p ++ == 'c' &&
+                *p ++ == 't' &&
+                *p ++ == 'i' &&
+                *p ++ == 'o' &&
+                *p ++ == 'n') {
+                return 56;
+            }
+            return r;
+        case 'r':
+            if (*p ++ == 'i' &&
+                *p ++ == 'n' &&
+                *p ++ == 'g') {
+                return 61;
+            }
+            return r;
+        case 's':
+            switch (*p ++) {
+            case 'c':
+                if (*p ++ == 'r') {
+                    return 65;
+                }
+                return r;
+            case 's':
+                if (*p ++ == 'i' &&
+                    *p ++ == 'g' &&
+                    *p ++ == 'n') {
+                    return 71;
+                }
+                return r;
+            }
+            return r;
+        case 't':
+            if (*p ++ == 'i' &&
+                *p ++ == 'l' &&
+                *p ++ == 'd' &&
+                *p ++ == 'e') {
+                return 76;
+            }
+            return r;
+        case 'u':
+            if (*p ++ == 'm' &&
+                *p ++ == 'l') {
+                return 80;
+            }
+            return r;
+        }
+        return r;
+    case 'B':
+        switch (*p ++) {
+        case 'a':
+            switch (*p ++) {
+            case 'c':
+                if (*p ++ == 'k' &&
+                    *p ++ == 's' &&
+                    *p ++ == 'l' &&
+                    *p ++ == 'a' &&
+                    *p ++ == 's' &&
+                    *p ++ == 'h') {
+                    return 84;
+                }
+                return r;
+            case 'r':
+                switch (*p ++) {
+                case 'v':
+                    return 89;
+                case 'w':
+                    if (*p ++ == 'e' &&
+                        *p ++ == 'd') {
+                        return 94;
+                    }
+                    return r;
+                }
+                return r;
+            }
+            return r;
+        case 'c':
+            if (*p ++ == 'y') {
+                return 99;
+            }
+            return r;
+        case 'e':
+            switch (*p ++) {
+            case 'c':
+                if (*p ++ == 'a' &&
+                    *p ++ == 'u' &&
+                    *p ++ == 's' &&
+                    *p ++ == 'e') {
+                    return 103;
+                }
+                return r;
+            case 'r':
+                if (*p ++ == 'n' &&
+                    *p ++ == 'o' &&
+                    *p ++ == 'u' &&
+                    *p ++ == 'l' &&
+                    *p ++ == 'l' &&
+                    *p ++ == 'i' &&
+                    *p ++ == 's') {
+                    return 108;
+                }
+                return r;
+            case 't':
+                if (*p ++ == 'a') {
+                    return 113;
+                }
+                return r;
+            }
+            return r;
+        case 'f':
+            if (*p ++ == 'r') {
+                return 117;
+            }
+            return r;
+        case 'o':
+            if (*p ++ == 'p' &&
+                *p ++ == 'f') {
+                return 123;
+            }
+            return r;
+        case 'r':
+            if (*p ++ == 'e' &&
+                *p ++ == 'v' &&
+                *p ++ == 'e') {
+                return 129;
+            }
+            return r;
+        case 's':
+            if (*p ++ == 'c' &&
+                *p ++ == 'r') {
+                return 133;
+            }
+            return r;
+        case 'u':
+            if (*p ++ == 'm' &&
+                *p ++ == 'p' &&
+                *p ++ == 'e' &&
+                *p ++ == 'q') {
+                return 138;
+            }
+            return r;
+        }
+        return r;
+    case 'C':
+        switch (*p ++) {
+        case 'H':
+            if (*p ++ == 'c' &&
+                *p ++ == 'y') {
+                return 143;
+            }
+            return r;
+        case 'O':
+            if (*p ++ == 'P' &&
+                *p ++ == 'Y') {
+                return 147;
+            }
+            return r;
+        case 'a':
+            switch (*p ++) {
+            case 'c':
+                if (*p ++ == 'u' &&
+                    *p ++ == 't' &&
+                    *p ++ == 'e') {
+                    return 151;
+                }
+                return r;
+            case 'p':
+                r = 155;
+                if (*p ++ == 'i' &&
+                    *p ++ == 't' &&
+                    *p ++ == 'a' &&
+                    *p ++ == 'l' &&
+                    *p ++ == 'D' &&
+                    *p ++ == 'i' &&
+                    *p ++ == 'f' &&
+                    *p ++ == 'f' &&
+                    *p ++ == 'e' &&
+                    *p ++ == 'r' &&
+                    *p ++ == 'e' &&
+                    *p ++ == 'n' &&
+                    *p ++ == 't' &&
+                    *p ++ == 'i' &&
+                    *p ++ == 'a' &&
+                    *p ++ == 'l' &&
+                    *p ++ == 'D') {
+                    return 160;
+                }
+                return r;
+            case 'y':
+                if (*p ++ == 'l' &&
+                    *p ++ == 'e' &&
+                    *p ++ == 'y' &&
+                    *p ++ == 's') {
+                    return 165;
+                }
+                return r;
+            }
+            return r;
+        case 'c':
+            switch (*p ++) {
+            case 'a':
+                if (*p ++ == 'r' &&
+                    *p ++ == 'o' &&
+                    *p ++ == 'n') {
+                    return 170;
+                }
+                return r;
+            case 'e':
+                if (*p ++ == 'd' &&
+                    *p ++ == 'i' &&
+                    *p ++ == 'l') {
+                    return 174;
+                }
+                return r;
+            case 'i':
+                if (*p ++ == 'r' &&
+                    *p ++ == 'c') {
+                    return 178;
+                }
+                return r;
+            case 'o':
+                if (*p ++ == 'n' &&
+                    *p ++ == 'i' &&
+                    *p ++ == 'n' &&
+                    *p ++ == 't') {
+                    return 182;
+                }
+                return r;
+            }
+            return r;
+        case 'd':
+            if (*p ++ == 'o' &&
+                *p ++ == 't') {
+                return 187;
+            }
+            return r;
+        case 'e':
+            switch (*p ++) {
+            case 'd':
+                if (*p ++ == 'i' &&
+                    *p ++ == 'l' &&
+                    *p ++ == 'l' &&
+                    *p ++ == 'a') {
+                    return 191;
+                }
+                return r;
+            case 'n':
+                if (*p ++ == 't' &&
+                    *p ++ == 'e' &&
+                    *p ++ == 'r' &&
+                    *p ++ == 'D' &&
+                    *p ++ == 'o' &&
+                    *p ++ == 't') {
+                    return 195;
+                }
+                return r;
+            }
+            return r;
+        case 'f':
+            if (*p ++ == 'r') {
+                return 199;
+            }
+            return r;
+        case 'h':
+            if (*p ++ == 'i') {
+                return 204;
+            }
+            return r;
+        case 'i':
+            if (*p ++ == 'r' &&
+                *p ++ == 'c' &&
+                *p ++ == 'l' &&
+                *p ++ == 'e') {
+                switch (*p ++) {
+                case 'D':
+                    if (*p ++ == 'o' &&
+                        *p ++ == 't') {
+                        return 208;
+                    }
+                    return r;
+                case 'M':
+                    if (*p ++ == 'i' &&
+                        *p ++ == 'n' &&
+                        *p ++ == 'u' &&
+                        *p ++ == 's') {
+                        return 213;
+                    }
+                    return r;
+                case 'P':
+                    if (*p ++ == 'l' &&
+                        *p ++ == 'u' &&
+                        *p ++ == 's') {
+                        return 218;
+                    }
+                    return r;
+                case 'T':
+                    if (*p ++ == 'i' &&
+                        *p ++ == 'm' &&
+                        *p ++ == 'e' &&
+                        *p ++ == 's') {
+                        return 223;
+                    }
+                    return r;
+                }
+                return r;
+            }
+            return r;
+        case 'l':
+            if (*p ++ == 'o') {
+                switch (*p ++) {
+                case 'c':
+                    if (*p ++ == 'k' &&
+                        *p ++ == 'w' &&
+                        *p ++ == 'i' &&
+                        *p ++ == 's' &&
+                        *p ++ == 'e' &&
+                        *p ++ == 'C' &&
+                        *p ++ == 'o' &&
+                        *p ++ == 'n' &&
+                        *p ++ == 't' &&
+                        *p ++ == 'o' &&
+                        *p ++ == 'u' &&
+                        *p ++ == 'r' &&
+                        *p ++ == 'I' &&
+                        *p ++ == 'n' &&
+                        *p ++ == 't' &&
+                        *p ++ == 'e' &&
+                        *p ++ == 'g' &&
+                        *p ++ == 'r' &&
+                        *p ++ == 'a' &&
+                        *p ++ == 'l') {
+                        return 228;
+                    }
+                    return r;
+                case 's':
+                    if (*p ++ == 'e' &&
+                        *p ++ == 'C' &&
+                        *p ++ == 'u' &&
+                        *p ++ == 'r' &&
+                        *p ++ == 'l' &&
+                        *p ++ == 'y') {
+                        switch (*p ++) {
+                        case 'D':
+                            if (*p ++ == 'o' &&
+                                *p ++ == 'u' &&
+                                *p ++ == 'b' &&
+                                *p ++ == 'l' &&
+                                *p ++ == 'e' &&
+                                *p ++ == 'Q' &&
+                                *p ++ == 'u' &&
+                                *p ++ == 'o' &&
+                                *p ++ == 't' &&
+                                *p ++ == 'e') {
+                                return 233;
+                            }
+                            return r;
+                        case 'Q':
+                            if (*p ++ == 'u' &&
+                                *p ++ == 'o' &&
+                                *p ++ == 't' &&
+                                *p ++ == 'e') {
+                                return 238;
+                            }
+                            return r;
+                        }
+                        return r;
+                    }
+                    return r;
+                }
+                return r;
+            }
+            return r;
+        case 'o':
+            switch (*p ++) {
+            case 'l':
+                if (*p ++ == 'o' &&
+                    *p ++ == 'n') {
+                    r = 243;
+                    if (*p ++ == 'e') {
+                        return 248;
+                    }
+                    return r;
+                }
+                return r;
+            case 'n':
+                switch (*p ++) {
+                case 'g':
+                    if (*p ++ == 'r' &&
+                        *p ++ == 'u' &&
+                        *p ++ == 'e' &&
+                        *p ++ == 'n' &&
+                        *p ++ == 't') {
+                        return 253;
+                    }
+                    return r;
+                case 'i':
+                    if (*p ++ == 'n' &&
+                        *p ++ == 't') {
+                        return 258;
+                    }
+                    return r;
+                case 't':
+                    if (*p ++ == 'o' &&
+                        *p ++ == 'u' &&
+                        *p ++ == 'r' &&
+                        *p ++ == 'I' &&
+                        *p ++ == 'n' &&
+                        *p ++ == 't' &&
+                        *p ++ == 'e' &&
+                        *p ++ == 'g' &&
+                        *p ++ == 'r' &&
+                        *p ++ == 'a' &&
+                        *p ++ == 'l') {
+                        return 263;
+                    }
+                    return r;
+                }
+                return r;
+            case 'p':
+                switch (*p ++) {
+                case 'f':
+                    return 268;
+                case 'r':
+                    if (*p ++ == 'o' &&
+                        *p ++ == 'd' &&
+                        *p ++ == 'u' &&
+                        *p ++ == 'c' &&
+                        *p ++ == 't') {
+                        return 273;
+                    }
+                    return r;
+                }
+                return r;
+            case 'u':
+                if (*p ++ == 'n' &&
+                    *p ++ == 't' &&
+                    *p ++ == 'e' &&
+                    *p ++ == 'r' &&
+                    *p ++ == 'C' &&
+                    *p ++ == 'l' &&
+                    *p ++ == 'o' &&
+                    *p ++ == 'c' &&
+                    *p ++ == 'k' &&
+                    *p ++ == 'w' &&
+                    *p ++ == 'i' &&
+                    *p ++ == 's' &&
+                    *p ++ == 'e' &&
+                    *p ++ == 'C' &&
+                    *p ++ == 'o' &&
+                    *p ++ == 'n' &&
+                    *p ++ == 't' &&
+                    *p ++ == 'o' &&
+                    *p ++ == 'u' &&
+                    *p ++ == 'r' &&
+                    *p ++ == 'I' &&
+                    *p ++ == 'n' &&
+                    *p ++ == 't' &&
+                    *p ++ == 'e' &&
+                    *p ++ == 'g' &&
+                    *p ++ == 'r' &&
+                    *p ++ == 'a' &&
+                    *p ++ == 'l') {
+                    return 278;
+                }
+                return r;
+            }
+            return r;
+        case 'r':
+            if (*p ++ == 'o' &&
+                *p ++ == 's' &&
+                *p ++ == 's') {
+                return 283;
+            }
+            return r;
+        case 's':
+            if (*p ++ == 'c' &&
+                *p ++ == 'r') {
+                return 288;
+            }
+            return r;
+        case 'u':
+            if (*p ++ == 'p') {
+                r = 294;
+                if (*p ++ == 'C' &&
+                    *p ++ == 'a' &&
+                    *p ++ == 'p') {
+                    return 299;
+                }
+                return r;
+            }
+            return r;
+        }
+        return r;
+    case 'D':
+        switch (*p ++) {
+        case 'D':
+            r = 304;
+            if (*p ++ == 'o' &&
+                *p ++ == 't' &&
+                *p ++ == 'r' &&
+                *p ++ == 'a' &&
+                *p ++ == 'h' &&
+                *p ++ == 'd') {
+                return 309;
+            }
+            return r;
+        case 'J':
+            if (*p ++ == 'c' &&
+                *p ++ == 'y') {
+                return 314;
+            }
+            return r;
+        case 'S':
+            if (*p ++ == 'c' &&
+                *p ++ == 'y') {
+                return 318;
+            }
+            return r;
+        case 'Z':
+            if (*p ++ == 'c' &&
+                *p ++ == 'y') {
+                return 322;
+            }
+            return r;
+        case 'a':
+            switch (*p ++) {
+            case 'g':
+                if (*p ++ == 'g' &&
+                    *p ++ == 'e' &&
+                    *p ++ == 'r') {
+                    return 326;
+                }
+                return r;
+            case 'r':
+                if (*p ++ == 'r') {
+                    return 331;
+                }
+                return r;
+            case 's':
+                if (*p ++ == 'h' &&
+                    *p ++ == 'v') {
+                    return 336;
+                }
+                return r;
+            }
+            return r;
+        case 'c':
+            switch (*p ++) {
+            case 'a':
+                if (*p ++ == 'r' &&
+                    *p ++ == 'o' &&
+                    *p ++ == 'n') {
+                    return 341;
+                }
+                return r;
+            case 'y':
+                return 345;
+            }
+            return r;
+        case 'e':
+            if (*p ++ == 'l') {
+                r = 349;
+                if (*p ++ == 't' &&
+                    *p ++ == 'a') {
+                    return 354;
+                }
+                return r;
+            }
+            return r;
+        case 'f':
+            if (*p ++ == 'r') {
+                return 358;
+            }
+            return r;
+        case 'i':
+            switch (*p ++) {
+            case 'a':
+                switch (*p ++) {
+                case 'c':
+                    if (*p ++ == 'r' &&
+                        *p ++ == 'i' &&
+                        *p ++ == 't' &&
+                        *p ++ == 'i' &&
+                        *p ++ == 'c' &&
+                        *p ++ == 'a' &&
+                        *p ++ == 'l') {
+                        switch (*p ++) {
+                        case 'A':
+                            if (*p ++ == 'c' &&
+                                *p ++ == 'u' &&
+                                *p ++ == 't' &&
+                                *p ++ == 'e') {
+                                return 364;
+                            }
+                            return r;
+                        case 'D':
+                            if (*p ++ == 'o') {
+                                switch (*p ++) {
+                                case 't':
+                                    return 368;
+                                case 'u':
+                                    if (*p ++ == 'b' &&
+                                        *p ++ == 'l' &&
+                                        *p ++ == 'e' &&
+                                        *p ++ == 'A' &&
+                                        *p ++ == 'c' &&
+                                        *p ++ == 'u' &&
+                                        *p ++ == 't' &&
+                                        *p ++ == 'e') {
+                                        return 372;
+                                    }
+                                    return r;
+                                }
+                                return r;
+                            }
+                            return r;
+                        case 'G':
+                            if (*p ++ == 'r' &&
+                                *p ++ == 'a' &&
+                                *p ++ == 'v' &&
+                                *p ++ == 'e') {
+                                return 376;
+                            }
+                            return r;
+                        case 'T':
+                            if (*p ++ == 'i' &&
+                                *p ++ == 'l' &&
+                                *p ++ == 'd' &&
+                                *p ++ == 'e') {
+                                return 379;
+                            }
+                            return r;
+                        }
+                        return r;
+                    }
+                    return r;
+                case 'm':
+                    if (*p ++ == 'o' &&
+                        *p ++ == 'n' &&
+                        *p ++ == 'd') {
+                        return 383;
+                    }
+                    return r;
+                }
+                return r;
+            case 'f':
+                if (*p ++ == 'f' &&
+                    *p ++ == 'e' &&
+                    *p ++ == 'r' &&
+                    *p ++ == 'e' &&
+                    *p ++ == 'n' &&
+                    *p ++ == 't' &&
+                    *p ++ == 'i' &&
+                    *p ++ == 'a' &&
+                    *p ++ == 'l' &&
+                    *p ++ == 'D') {
+                    return 388;
+                }
+                return r;
+            }
+            return r;
+        case 'o':
+            switch (*p ++) {
+            case 'p':
+                if (*p ++ == 'f') {
+                    return 393;
+                }
+                return r;
+            case 't':
+                r = 399;
+                switch (*p ++) {
+                case 'D':
+                    if (*p ++ == 'o' &&
+                        *p ++ == 't') {
+                        return 403;
+                    }
+                    return r;
+                case 'E':
+                    if (*p ++ == 'q' &&
+                        *p ++ == 'u' &&
+                        *p ++ == 'a' &&
+                        *p ++ == 'l') {
+                        return 408;
+                    }
+                    return r;
+                }
+                return r;
+            case 'u':
+                if (*p ++ == 'b' &&
+                    *p ++ == 'l' &&
+                    *p ++ == 'e') {
+                    switch (*p ++) {
+                    case 'C':
+                        if (*p ++ == 'o' &&
+                            *p ++ == 'n' &&
+                            *p ++ == 't' &&
+                            *p ++ == 'o' &&
+                            *p ++ == 'u' &&
+                            *p ++ == 'r' &&
+                            *p ++ == 'I' &&
+                            *p ++ == 'n' &&
+                            *p ++ == 't' &&
+                            *p ++ == 'e' &&
+                            *p ++ == 'g' &&
+                            *p ++ == 'r' &&
+                            *p ++ == 'a' &&
+                            *p ++ == 'l') {
+                            return 413;
+                        }
+                        return r;
+                    case 'D':
+                        if (*p ++ == 'o') {
+                            switch (*p ++) {
+                            case 't':
+                                return 418;
+                            case 'w':
+                                if (*p ++ == 'n' &&
+                                    *p ++ == 'A' &&
+                                    *p ++ == 'r' &&
+                                    *p ++ == 'r' &&
+                                    *p ++ == 'o' &&
+                                    *p ++ == 'w') {
+                                    return 422;
+                                }
+                                return r;
+                            }
+                            return r;
+                        }
+                        return r;
+                    case 'L':
+                        switch (*p ++) {
+                        case 'e':
+                            if (*p ++ == 'f' &&
+                                *p ++ == 't') {
+                                switch (*p ++) {
+                                case 'A':
+                                    if (*p ++ == 'r' &&
+                                        *p ++ == 'r' &&
+                                        *p ++ == 'o' &&
+                                        *p ++ == 'w') {
+                                        return 427;
+                                    }
+                                    return r;
+                                case 'R':
+                                    if (*p ++ == 'i' &&
+                                        *p ++ == 'g' &&
+                                        *p ++ == 'h' &&
+                                        *p ++ == 't' &&
+                                        *p ++ == 'A' &&
+                                        *p ++ == 'r' &&
+                                        *p ++ == 'r' &&
+                                        *p ++ == 'o' &&
+                                        *p ++ == 'w') {
+                                        return 432;
+                                    }
+                                    return r;
+                                case 'T':
+                                    if (*p ++ == 'e' &&
+                                        *p ++ == 'e') {
+                                        return 437;
+                                    }
+                                    return r;
+                                }
+                                return r;
+                            }
+                            return r;
+                        case 'o':
+                            if (*p ++ == 'n' &&
+                                *p ++ == 'g') {
+                                switch (*p ++) {
+                                case 'L':
+                                    if (*p ++ == 'e' &&
+                                        *p ++ == 'f' &&
+                                        *p ++ == 't') {
+                                        switch (*p ++) {
+                                        case 'A':
+                                            if (*p ++ == 'r' &&
+                                                *p ++ == 'r' &&
+                                                *p ++ == 'o' &&
+                                                *p ++ == 'w') {
+                                                return 442;
+                                            }
+                                            return r;
+                                        case 'R':
+                                            if (*p ++ == 'i' &&
+                                                *p ++ == 'g' &&
+                                                *p ++ == 'h' &&
+                                                *p ++ == 't' &&
+                                                *p ++ == 'A' &&
+                                                *p ++ == 'r' &&
+                                                *p ++ == 'r' &&
+                                                *p ++ == 'o' &&
+                                                *p ++ == 'w') {
+                                                return 447;
+                                            }
+                                            return r;
+                                        }
+                                        return r;
+                                    }
+                                    return r;
+                                case 'R':
+                                    if (*p ++ == 'i' &&
+                                        *p ++ == 'g' &&
+                                        *p ++ == 'h' &&
+                                        *p ++ == 't' &&
+                                        *p ++ == 'A' &&
+                                        *p ++ == 'r' &&
+                                        *p ++ == 'r' &&
+                                        *p ++ == 'o' &&
+                                        *p ++ == 'w') {
+                                        return 452;
+                                    }
+                                    return r;
+                                }
+                                return r;
+                            }
+                            return r;
+                        }
+                        return r;
+                    case 'R':
+                        if (*p ++ == 'i' &&
+                            *p ++ == 'g' &&
+                            *p ++ == 'h' &&
+                            *p ++ == 't') {
+                            switch (*p ++) {
+                            case 'A':
+                                if (*p ++ == 'r' &&
+                                    *p ++ == 'r' &&
+                                    *p ++ == 'o' &&
+                                    *p ++ == 'w') {
+                                    return 457;
+                                }
+                                return r;
+                            case 'T':
+                                if (*p ++ == 'e' &&
+                                    *p ++ == 'e') {
+                                    return 462;
+                                }
+                                return r;
+                            }
+                            return r;
+                        }
+                        return r;
+                    case 'U':
+                        if (*p ++ == 'p') {
+                            switch (*p ++) {
+                            case 'A':
+                                if (*p ++ == 'r' &&
+                                    *p ++ == 'r' &&
+                                    *p ++ == 'o' &&
+                                    *p ++ == 'w') {
+                                    return 467;
+                                }
+                                return r;
+                            case 'D':
+                                if (*p ++ == 'o' &&
+                                    *p ++ == 'w' &&
+                                    *p ++ == 'n' &&
+                                    *p ++ == 'A' &&
+                                    *p ++ == 'r' &&
+                                    *p ++ == 'r' &&
+                                    *p ++ == 'o' &&
+                                    *p ++ == 'w') {
+                                    return 472;
+                                }
+                                return r;
+                            }
+                            return r;
+                        }
+                        return r;
+                    case 'V':
+                        if (*p ++ == 'e' &&
+                            *p ++ == 'r' &&
+                            *p ++ == 't' &&
+                            *p ++ == 'i' &&
+                            *p ++ == 'c' &&
+                            *p ++ == 'a' &&
+                            *p ++ == 'l' &&
+                            *p ++ == 'B' &&
+                            *p ++ == 'a' &&
+                            *p ++ == 'r') {
+                            return 477;
+                        }
+                        return r;
+                    }
+                    return r;
+                }
+                return r;
+            case 'w':
+                if (*p ++ == 'n') {
+                    switch (*p ++) {
+                    case 'A':
+                        if (*p ++ == 'r' &&
+                            *p ++ == 'r' &&
+                            *p ++ == 'o' &&
+                            *p ++ == 'w') {
+                            r = 482;
+                            switch (*p ++) {
+                            case 'B':
+                                if (*p ++ == 'a' &&
+                                    *p ++ == 'r') {
+                                    return 487;
+                                }
+                                return r;
+                            case 'U':
+                                if (*p ++ == 'p' &&
+                                    *p ++ == 'A' &&
+                                    *p ++ == 'r' &&
+                                    *p ++ == 'r' &&
+                                    *p ++ == 'o' &&
+                                    *p ++ == 'w') {
+                                    return 492;
+                                }
+                                return r;
+                            }
+                            return r;
+                        }
+                        return r;
+                    case 'B':
+                        if (*p ++ == 'r' &&
+                            *p ++ == 'e' &&
+                            *p ++ == 'v' &&
+                            *p ++ == 'e') {
+                            return 497;
+                        }
+                        return r;
+                    case 'L':
+                        if (*p ++ == 'e' &&
+                            *p ++ == 'f' &&
+                            *p ++ == 't') {
+                            switch (*p ++) {
+                            case 'R':
+                                if (*p ++ == 'i' &&
+                                    *p ++ == 'g' &&
+                                    *p ++ == 'h' &&
+                                    *p ++ == 't' &&
+                                    *p ++ == 'V' &&
+                                    *p ++ == 'e' &&
+                                    *p ++ == 'c' &&
+                                    *p ++ == 't' &&
+                                    *p ++ == 'o' &&
+                                    *p ++ == 'r') {
+                                    return 501;
+                                }
+                                return r;
+                            case 'T':
+                                if (*p ++ == 'e' &&
+                                    *p ++ == 'e' &&
+                                    *p ++ == 'V' &&
+                                    *p ++ == 'e' &&
+                                    *p ++ == 'c' &&
+                                    *p ++ == 't' &&
+                                    *p ++ == 'o' &&
+                                    *p ++ == 'r') {
+                                    return 506;
+                                }
+                                return r;
+                            case 'V':
+                                if (*p ++ == 'e' &&
+                                    *p ++ == 'c' &&
+                                    *p ++ == 't' &&
+                                    *p ++ == 'o' &&
+                                    *p ++ == 'r') {
+                                    r = 511;
+                                    if (*p ++ == 'B' &&
+                                        *p ++ == 'a' &&
+                                        *p ++ == 'r') {
+                                        return 516;
+                                    }
+                                    return r;
+                                }
+                                return r;
+                            }
+                            return r;
+                        }
+                        return r;
+                    case 'R':
+                        if (*p ++ == 'i' &&
+                            *p ++ == 'g' &&
+                            *p ++ == 'h' &&
+                            *p ++ == 't') {
+                            switch (*p ++) {
+                            case 'T':
+                                if (*p ++ == 'e' &&
+                                    *p ++ == 'e' &&
+                                    *p ++ == 'V' &&
+                                    *p ++ == 'e' &&
+                                    *p ++ == 'c' &&
+                                    *p ++ == 't' &&
+                                    *p ++ == 'o' &&
+                                    *p ++ == 'r') {
+                                    return 521;
+                                }
+                                return r;
+                            case 'V':
+                                if (*p ++ == 'e' &&
+                                    *p ++ == 'c' &&
+                                    *p ++ == 't' &&
+                                    *p ++ == 'o' &&
+                                    *p ++ == 'r') {
+                                    r = 526;
+                                    if (*p ++ == 'B' &&
+                                        *p ++ == 'a' &&
+                                        *p ++ == 'r') {
+                                        return 531;
+                                    }
+                                    return r;
+                                }
+                                return r;
+                            }
+                            return r;
+                        }
+                        return r;
+                    case 'T':
+                        if (*p ++ == 'e' &&
+                            *p ++ == 'e') {
+                            r = 536;
+                            if (*p ++ == 'A' &&
+                                *p ++ == 'r' &&
+                                *p ++ == 'r' &&
+                                *p ++ == 'o' &&
+                                *p ++ == 'w') {
+                                return 541;
+                            }
+                            return r;
+                        }
+                        return r;
+                    case 'a':
+                        if (*p ++ == 'r' &&
+                            *p ++ == 'r' &&
+                            *p ++ == 'o' &&
+                            *p ++ == 'w') {
+                            return 546;
+                        }
+                        return r;
+                    }
+                    return r;
+                }
+                return r;
+            }
+            return r;
+        case 's':
+            switch (*p ++) {
+            case 'c':
+                if (*p ++ == 'r') {
+                    return 551;
+                }
+                return r;
+            case 't':
+                if (*p ++ == 'r' &&
+                    *p ++ == 'o' &&
+                    *p ++ == 'k') {
+                    return 557;
+                }
+                return r;
+            }
+            return r;
+        }
+        return r;
+    case 'E':
+        switch (*p ++) {
+        case 'N':
+            if (*p ++ == 'G') {
+                return 561;
+            }
+            return r;
+        case 'T':
+            if (*p ++ == 'H') {
+                return 565;
+            }
+            return r;
+        case 'a':
+            if (*p ++ == 'c' &&
+                *p ++ == 'u' &&
+                *p ++ == 't' &&
+                *p ++ == 'e') {
+                return 569;
+            }
+            return r;
+        case 'c':
+            switch (*p ++) {
+            case 'a':
+                if (*p ++ == 'r' &&
+                    *p ++ == 'o' &&
+                    *p ++ == 'n') {
+                    return 573;
+                }
+                return r;
+            case 'i':
+                if (*p ++ == 'r' &&
+                    *p ++ == 'c') {
+                    return 577;
+                }
+                return r;
+            case 'y':
+                return 581;
+            }
+            return r;
+        case 'd':
+            if (*p ++ == 'o' &&
+                *p ++ == 't') {
+                return 585;
+            }
+            return r;
+        case 'f':
+            if (*p ++ == 'r') {
+                return 589;
+            }
+            return r;
+        case 'g':
+            if (*p ++ == 'r' &&
+                *p ++ == 'a' &&
+                *p ++ == 'v' &&
+                *p ++ == 'e') {
+                return 595;
+            }
+            return r;
+        case 'l':
+            if (*p ++ == 'e' &&
+                *p ++ == 'm' &&
+                *p ++ == 'e' &&
+                *p ++ == 'n' &&
+                *p ++ == 't') {
+                return 599;
+            }
+            return r;
+        case 'm':
+            switch (*p ++) {
+            case 'a':
+                if (*p ++ == 'c' &&
+                    *p ++ == 'r') {
+                    return 604;
+                }
+                return r;
+            case 'p':
+                if (*p ++ == 't' &&
+                    *p ++ == 'y') {
+                    switch (*p ++) {
+                    case 'S':
+                        if (*p ++ == 'm' &&
+                            *p ++ == 'a' &&
+                            *p ++ == 'l' &&
+                            *p ++ == 'l' &&
+                            *p ++ == 'S' &&
+                            *p ++ == 'q' &&
+                            *p ++ == 'u' &&
+                            *p ++ == 'a' &&
+                            *p ++ == 'r' &&
+                            *p ++ == 'e') {
+                            return 608;
+                        }
+                        return r;
+                    case 'V':
+                        if (*p ++ == 'e' &&
+                            *p ++ == 'r' &&
+                            *p ++ == 'y' &&
+                            *p ++ == 'S' &&
+                            *p ++ == 'm' &&
+                            *p ++ == 'a' &&
+                            *p ++ == 'l' &&
+                            *p ++ == 'l' &&
+                            *p ++ == 'S' &&
+                            *p ++ == 'q' &&
+                            *p ++ == 'u' &&
+                            *p ++ == 'a' &&
+                            *p ++ == 'r' &&
+                            *p ++ == 'e') {
+                            return 613;
+                        }
+                        return r;
+                    }
+                    return r;
+                }
+                return r;
+            }
+            return r;
+        case 'o':
+            switch (*p ++) {
+            case 'g':
+                if (*p ++ == 'o' &&
+                    *p ++ == 'n') {
+                    return 618;
+                }
+                return r;
+            case 'p':
+                if (*p ++ == 'f') {
+                    return 622;
+                }
+                return r;
+            }
+            return r;
+        case 'p':
+            if (*p ++ == 's' &&
+                *p ++ == 'i' &&
+                *p ++ == 'l' &&
+                *p ++ == 'o' &&
+                *p ++ == 'n') {
+                return 628;
+            }
+            return r;
+        case 'q':
+            if (*p ++ == 'u') {
+                switch (*p ++) {
+                case 'a':
+                    if (*p ++ == 'l') {
+                        r = 632;
+                        if (*p ++ == 'T' &&
+                            *p ++ == 'i' &&
+                            *p ++ == 'l' &&
+                            *p ++ == 'd' &&
+                            *p ++ == 'e') {
+                            return 637;
+                        }
+                        return r;
+                    }
+                    return r;
+                case 'i':
+                    if (*p ++ == 'l' &&
+                        *p ++ == 'i' &&
+                        *p ++ == 'b' &&
+                        *p ++ == 'r' &&
+                        *p ++ == 'i' &&
+                        *p ++ == 'u' &&
+                        *p ++ == 'm') {
+                        return 642;
+                    }
+                    return r;
+                }
+                return r;
+            }
+            return r;
+        case 's':
+            switch (*p ++) {
+            case 'c':
+                if (*p ++ == 'r') {
+                    return 647;
+                }
+                return r;
+            case 'i':
+                if (*p ++ == 'm') {
+                    return 652;
+                }
+                return r;
+            }
+            return r;
+        case 't':
+            if (*p ++ == 'a') {
+                return 657;
+            }
+            return r;
+        case 'u':
+            if (*p ++ == 'm' &&
+                *p ++ == 'l') {
+                return 661;
+            }
+            return r;
+        case 'x':
+            switch (*p ++) {
+            case 'i':
+                if (*p ++ == 's' &&
+                    *p ++ == 't' &&
+                    *p ++ == 's') {
+                    return 665;
+                }
+                return r;
+            case 'p':
+                if (*p ++ == 'o' &&
+                    *p ++ == 'n' &&
+                    *p ++ == 'e' &&
+                    *p ++ == 'n' &&
+                    *p ++ == 't' &&
+                    *p ++ == 'i' &&
+                    *p ++ == 'a' &&
+                    *p ++ == 'l' &&
+                    *p ++ == 'E') {
+                    return 670;
+                }
+                return r;
+            }
+            return r;
+        }
+        return r;
+    case 'F':
+        switch (*p ++) {
+        case 'c':
+            if (*p ++ == 'y') {
+                return 675;
+            }
+            return r;
+        case 'f':
+            if (*p ++ == 'r') {
+                return 679;
+            }
+            return r;
+        case 'i':
+            if (*p ++ == 'l' &&
+                *p ++ == 'l' &&
+                *p ++ == 'e' &&
+                *p ++ == 'd') {
+                switch (*p ++) {
+                case 'S':
+                    if (*p ++ == 'm' &&
+                        *p ++ == 'a' &&
+                        *p ++ == 'l' &&
+                        *p ++ == 'l' &&
+                        *p ++ == 'S' &&
+                        *p ++ == 'q' &&
+                        *p ++ == 'u' &&
+                        *p ++ == 'a' &&
+                        *p ++ == 'r' &&
+                        *p ++ == 'e') {
+                        return 685;
+                    }
+                    return r;
+                case 'V':
+                    if (*p ++ == 'e' &&
+                        *p ++ == 'r' &&
+                        *p ++ == 'y' &&
+                        *p ++ == 'S' &&
+                        *p ++ == 'm' &&
+                        *p ++ == 'a' &&
+                        *p ++ == 'l' &&
+                        *p ++ == 'l' &&
+                        *p ++ == 'S' &&
+                        *p ++ == 'q' &&
+                        *p ++ == 'u' &&
+                        *p ++ == 'a' &&
+                        *p ++ == 'r' &&
+                        *p ++ == 'e') {
+                        return 690;
+                    }
+                    return r;
+                }
+                return r;
+            }
+            return r;
+        case 'o':
+            switch (*p ++) {
+            case 'p':
+                if (*p ++ == 'f') {
+                    return 695;
+                }
+                return r;
+            case 'r':
+                if (*p ++ == 'A' &&
+                    *p ++ == 'l' &&
+                    *p ++ == 'l') {
+                    return 701;
+                }
+                return r;
+            case 'u':
+                if (*p ++ == 'r' &&
+                    *p ++ == 'i' &&
+                    *p ++ == 'e' &&
+                    *p ++ == 'r' &&
+                    *p ++ == 't' &&
+                    *p ++ == 'r' &&
+                    *p ++ == 'f') {
+                    return 706;
+                }
+                return r;
+            }
+            return r;
+        case 's':
+            if (*p ++ == 'c' &&
+                *p ++ == 'r') {
+                return 711;
+            }
+            return r;
+        }
+        return r;
+    case 'G':
+        switch (*p ++) {
+        case 'J':
+            if (*p ++ == 'c' &&
+                *p ++ == 'y') {
+                return 716;
+            }
+            return r;
+        case 'T':
+            return 720;
+        case 'a':
+            if (*p ++ == 'm' &&
+                *p ++ == 'm' &&
+                *p ++ == 'a') {
+                r = 723;
+                if (*p ++ == 'd') {
+                    return 727;
+                }
+                return r;
+            }
+            return r;
+        case 'b':
+            if (*p ++ == 'r' &&
+                *p ++ == 'e' &&
+                *p ++ == 'v' &&
+                *p ++ == 'e') {
+                return 731;
+            }
+            return r;
+        case 'c':
+            switch (*p ++) {
+            case 'e':
+                if (*p ++ == 'd' &&
+                    *p ++ == 'i' &&
+                    *p ++ == 'l') {
+                    return 735;
+                }
+                return r;
+            case 'i':
+                if (*p ++ == 'r' &&
+                    *p ++ == 'c') {
+                    return 739;
+                }
+                return r;
+            case 'y':
+                return 743;
+            }
+            return r;
+        case 'd':
+            if (*p ++ == 'o' &&
+                *p ++ == 't') {
+                return 747;
+            }
+            return r;
+        case 'f':
+            if (*p ++ == 'r') {
+                return 751;
+            }
+            return r;
+        case 'g':
+            return 757;
+        case 'o':
+            if (*p ++ == 'p' &&
+                *p ++ == 'f') {
+                return 762;
+            }
+            return r;
+        case 'r':
+            if (*p ++ == 'e' &&
+                *p ++ == 'a' &&
+                *p ++ == 't' &&
+                *p ++ == 'e' &&
+                *p ++ == 'r') {
+                switch (*p ++) {
+                case 'E':
+                    if (*p ++ == 'q' &&
+                        *p ++ == 'u' &&
+                        *p ++ == 'a' &&
+                        *p ++ == 'l') {
+                        r = 768;
+                        if (*p ++ == 'L' &&
+                            *p ++ == 'e' &&
+                            *p ++ == 's' &&
+                            *p ++ == 's') {
+                            return 773;
+                        }
+                        return r;
+                    }
+                    return r;
+                case 'F':
+                    if (*p ++ == 'u' &&
+                        *p ++ == 'l' &&
+                        *p ++ == 'l' &&
+                        *p ++ == 'E' &&
+                        *p ++ == 'q' &&
+                        *p ++ == 'u' &&
+                        *p ++ == 'a' &&
+                        *p ++ == 'l') {
+                        return 778;
+                    }
+                    return r;
+                case 'G':
+                    if (*p ++ == 'r' &&
+                        *p ++ == 'e' &&
+                        *p ++ == 'a' &&
+                        *p ++ == 't' &&
+                        *p ++ == 'e' &&
+                        *p ++ == 'r') {
+                        return 783;
+                    }
+                    return r;
+                case 'L':
+                    if (*p ++ == 'e' &&
+                        *p ++ == 's' &&
+                        *p ++ == 's') {
+                        return 788;
+                    }
+                    return r;
+                case 'S':
+                    if (*p ++ == 'l' &&
+                        *p ++ == 'a' &&
+                        *p ++ == 'n' &&
+                        *p ++ == 't' &&
+                        *p ++ == 'E' &&
+                        *p ++ == 'q' &&
+                        *p ++ == 'u' &&
+                        *p ++ == 'a' &&
+                        *p ++ == 'l') {
+                        return 793;
+                    }
+                    return r;
+                case 'T':
+                    if (*p ++ == 'i' &&
+                        *p ++ == 'l' &&
+                        *p ++ == 'd' &&
+                        *p ++ == 'e') {
+                        return 798;
+                    }
+                    return r;
+                }
+                return r;
+            }
+            return r;
+        case 's':
+            if (*p ++ == 'c' &&
+                *p ++ == 'r') {
+                return 803;
+            }
+            return r;
+        case 't':
+            return 809;
+        }
+        return r;
+    case 'H':
+        switch (*p ++) {
+        case 'A':
+            if (*p ++ == 'R' &&
+                *p ++ == 'D' &&
+                *p ++ == 'c' &&
+                *p ++ == 'y') {
+                return 814;
+            }
+            return r;
+        case 'a':
+            switch (*p ++) {
+            case 'c':
+                if (*p ++ == 'e' &&
+                    *p ++ == 'k') {
+                    return 818;
+                }
+                return r;
+            case 't':
+                return 822;
+            }
+            return r;
+        case 'c':
+            if (*p ++ == 'i' &&
+                *p ++ == 'r' &&
+                *p ++ == 'c') {
+                return 825;
+            }
+            return r;
+        case 'f':
+            if (*p ++ == 'r') {
+                return 829;
+            }
+            return r;
+        case 'i':
+            if (*p ++ == 'l' &&
+                *p ++ == 'b' &&
+                *p ++ == 'e' &&
+                *p ++ == 'r' &&
+                *p ++ == 't' &&
+                *p ++ == 'S' &&
+                *p ++ == 'p' &&
+                *p ++ == 'a' &&
+                *p ++ == 'c' &&
+                *p ++ == 'e') {
+                return 834;
+            }
+            return r;
+        case 'o':
+            switch (*p ++) {
+            case 'p':
+                if (*p ++ == 'f') {
+                    return 839;
+                }
+                return r;
+            case 'r':
+                if (*p ++ == 'i' &&
+                    *p ++ == 'z' &&
+                    *p ++ == 'o' &&
+                    *p ++ == 'n' &&
+                    *p ++ == 't' &&
+                    *p ++ == 'a' &&
+                    *p ++ == 'l' &&
+                    *p ++ == 'L' &&
+                    *p ++ == 'i' &&
+                    *p ++ == 'n' &&
+                    *p ++ == 'e') {
+                    return 844;
+                }
+                return r;
+            }
+            return r;
+        case 's':
+            switch (*p ++) {
+            case 'c':
+                if (*p ++ == 'r') {
+                    return 849;
+                }
+                return r;
+            case 't':
+                if (*p ++ == 'r' &&
+                    *p ++ == 'o' &&
+                    *p ++ == 'k') {
+                    return 854;
+                }
+                return r;
+            }
+            return r;
+        case 'u':
+            if (*p ++ == 'm' &&
+                *p ++ == 'p') {
+                switch (*p ++) {
+                case 'D':
+                    if (*p ++ == 'o' &&
+                        *p ++ == 'w' &&
+                        *p ++ == 'n' &&
+                        *p ++ == 'H' &&
+                        *p ++ == 'u' &&
+                        *p ++ == 'm' &&
+                        *p ++ == 'p') {
+                        return 858;
+                    }
+                    return r;
+                case 'E':
+                    if (*p ++ == 'q' &&
+                        *p ++ == 'u' &&
+                        *p ++ == 'a' &&
+                        *p ++ == 'l') {
+                        return 863;
+                    }
+                    return r;
+                }
+                return r;
+            }
+            return r;
+        }
+        return r;
+    case 'I':
+        switch (*p ++) {
+        case 'E':
+            if (*p ++ == 'c' &&
+                *p ++ == 'y') {
+                return 868;
+            }
+            return r;
+        case 'J':
+            if (*p ++ == 'l' &&
+                *p ++ == 'i' &&
+                *p ++ == 'g') {
+                return 872;
+            }
+            return r;
+        case 'O':
+            if (*p ++ == 'c' &&
+                *p ++ == 'y') {
+                return 876;
+            }
+            return r;
+        case 'a':
+            if (*p ++ == 'c' &&
+                *p ++ == 'u' &&
+                *p ++ == 't' &&
+                *p ++ == 'e') {
+                return 880;
+            }
+            return r;
+        case 'c':
+            switch (*p ++) {
+            case 'i':
+                if (*p ++ == 'r' &&
+                    *p ++ == 'c') {
+                    return 884;
+                }
+                return r;
+            case 'y':
+                return 888;
+            }
+            return r;
+        case 'd':
+            if (*p ++ == 'o' &&
+                *p ++ == 't') {
+                return 892;
+            }
+            return r;
+        case 'f':
+            if (*p ++ == 'r') {
+                return 896;
+            }
+            return r;
+        case 'g':
+            if (*p ++ == 'r' &&
+                *p ++ == 'a' &&
+                *p ++ == 'v' &&
+                *p ++ == 'e') {
+                return 901;
+            }
+            return r;
+        case 'm':
+            r = 905;
+            switch (*p ++) {
+            case 'a':
+                switch (*p ++) {
+                case 'c':
+                    if (*p ++ == 'r') {
+                        return 910;
+                    }
+                    return r;
+                case 'g':
+                    if (*p ++ == 'i' &&
+                        *p ++ == 'n' &&
+                        *p ++ == 'a' &&
+                        *p ++ == 'r' &&
+                        *p ++ == 'y' &&
+                        *p ++ == 'I') {
+                        return 914;
+                    }
+                    return r;
+                }
+                return r;
+            case 'p':
+                if (*p ++ == 'l' &&
+                    *p ++ == 'i' &&
+                    *p ++ == 'e' &&
+                    *p ++ == 's') {
+                    return 919;
+                }
+                return r;
+            }
+            return r;
+        case 'n':
+            switch (*p ++) {
+            case 't':
+                r = 924;
+                if (*p ++ == 'e') {
+                    switch (*p ++) {
+                    case 'g':
+                        if (*p ++ == 'r' &&
+                            *p ++ == 'a' &&
+                            *p ++ == 'l') {
+                            return 929;
+                        }
+                        return r;
+                    case 'r':
+                        if (*p ++ == 's' &&
+                            *p ++ == 'e' &&
+                            *p ++ == 'c' &&
+                            *p ++ == 't' &&
+                            *p ++ == 'i' &&
+                            *p ++ == 'o' &&
+                            *p ++ == 'n') {
+                            return 934;
+                        }
+                        return r;
+                    }
+                    return r;
+                }
+                return r;
+            case 'v':
+                if (*p ++ == 'i' &&
+                    *p ++ == 's' &&
+                    *p ++ == 'i' &&
+                    *p ++ == 'b' &&
+                    *p ++ == 'l' &&
+                    *p ++ == 'e') {
+                    switch (*p ++) {
+                    case 'C':
+                        if (*p ++ == 'o' &&
+                            *p ++ == 'm' &&
+                            *p ++ == 'm' &&
+                            *p ++ == 'a') {
+                            return 939;
+                        }
+                        return r;
+                    case 'T':
+                        if (*p ++ == 'i' &&
+                            *p ++ == 'm' &&
+                            *p ++ == 'e' &&
+                            *p ++ == 's') {
+                            return 944;
+                        }
+                        return r;
+                    }
+                    return r;
+                }
+                return r;
+            }
+            return r;
+        case 'o':
+            switch (*p ++) {
+            case 'g':
+                if (*p ++ == 'o' &&
+                    *p ++ == 'n') {
+                    return 949;
+                }
+                return r;
+            case 'p':
+                if (*p ++ == 'f') {
+                    return 953;
+                }
+                return r;
+            case 't':
+                if (*p ++ == 'a') {
+                    return 959;
+                }
+                return r;
+            }
+            return r;
+        case 's':
+            if (*p ++ == 'c' &&
+                *p ++ == 'r') {
+                return 963;
+            }
+            return r;
+        case 't':
+            if (*p ++ == 'i' &&
+                *p ++ == 'l' &&
+                *p ++ == 'd' &&
+                *p ++ == 'e') {
+                return 968;
+            }
+            return r;
+        case 'u':
+            switch (*p ++) {
+            case 'k':
+                if (*p ++ == 'c' &&
+                    *p ++ == 'y') {
+                    return 972;
+                }
+                return r;
+            case 'm':
+                if (*p ++ == 'l') {
+                    return 976;
+                }
+                return r;
+            }
+            return r;
+        }
+        return r;
+    case 'J':
+        switch (*p ++) {
+        case 'c':
+            switch (*p ++) {
+            case 'i':
+                if (*p ++ == 'r' &&
+                    *p ++ == 'c') {
+                    return 980;
+                }
+                return r;
+            case 'y':
+                return 984;
+            }
+            return r;
+        case 'f':
+            if (*p ++ == 'r') {
+                return 988;
+            }
+            return r;
+        case 'o':
+            if (*p ++ == 'p' &&
+                *p ++ == 'f') {
+                return 994;
+            }
+            return r;
+        case 's':
+            switch (*p ++) {
+            case 'c':
+                if (*p ++ == 'r') {
+                    return 1000;
+                }
+                return r;
+            case 'e':
+                if (*p ++ == 'r' &&
+                    *p ++ == 'c' &&
+                    *p ++ == 'y') {
+                    return 1006;
+                }
+                return r;
+            }
+            return r;
+        case 'u':
+            if (*p ++ == 'k' &&
+                *p ++ == 'c' &&
+                *p ++ == 'y') {
+                return 1010;
+            }
+            return r;
+        }
+        return r;
+    case 'K':
+        switch (*p ++) {
+        case 'H':
+            if (*p ++ == 'c' &&
+                *p ++ == 'y') {
+                return 1014;
+            }
+            return r;
+        case 'J':
+            if (*p ++ == 'c' &&
+                *p ++ == 'y') {
+                return 1018;
+            }
+            return r;
+        case 'a':
+            if (*p ++ == 'p' &&
+                *p ++ == 'p' &&
+                *p ++ == 'a') {
+                return 1022;
+            }
+            return r;
+        case 'c':
+            switch (*p ++) {
+            case 'e':
+                if (*p ++ == 'd' &&
+                    *p ++ == 'i' &&
+                    *p ++ == 'l') {
+                    return 1026;
+                }
+                return r;
+            case 'y':
+                return 1030;
+            }
+            return r;
+        case 'f':
+            if (*p ++ == 'r') {
+                return 1034;
+            }
+            return r;
+        case 'o':
+            if (*p ++ == 'p' &&
+                *p ++ == 'f') {
+                return 1040;
+            }
+            return r;
+        case 's':
+            if (*p ++ == 'c' &&
+                *p ++ == 'r') {
+                return 1046;
+            }
+            return r;
+        }
+        return r;
+    case 'L':
+        switch (*p ++) {
+        case 'J':
+            if (*p ++ == 'c' &&
+                *p ++ == 'y') {
+                return 1052;
+            }
+            return r;
+        case 'T':
+            return 1056;
+        case 'a':
+            switch (*p ++) {
+            case 'c':
+                if (*p ++ == 'u' &&
+                    *p ++ == 't' &&
+                    *p ++ == 'e') {
+                    return 1059;
+                }
+                return r;
+            case 'm':
+                if (*p ++ == 'b' &&
+                    *p ++ == 'd' &&
+                    *p ++ == 'a') {
+                    return 1063;
+                }
+                return r;
+            case 'n':
+                if (*p ++ == 'g') {
+                    return 1067;
+                }
+                return r;
+            case 'p':
+                if (*p ++ == 'l' &&
+                    *p ++ == 'a' &&
+                    *p ++ == 'c' &&
+                    *p ++ == 'e' &&
+                    *p ++ == 't' &&
+                    *p ++ == 'r' &&
+                    *p ++ == 'f') {
+                    return 1072;
+                }
+                return r;
+            case 'r':
+                if (*p ++ == 'r') {
+                    return 1077;
+                }
+                return r;
+            }
+            return r;
+        case 'c':
+            switch (*p ++) {
+            case 'a':
+                if (*p ++ == 'r' &&
+                    *p ++ == 'o' &&
+                    *p ++ == 'n') {
+                    return 1082;
+                }
+                return r;
+            case 'e':
+                if (*p ++ == 'd' &&
+                    *p ++ == 'i' &&
+                    *p ++ == 'l') {
+                    return 1086;
+                }
+                return r;
+            case 'y':
+                return 1090;
+            }
+            return r;
+        case 'e':
+            switch (*p ++) {
+            case 'f':
+                if (*p ++ == 't') {
+                    switch (*p ++) {
+                    case 'A':
+                        switch (*p ++) {
+                        case 'n':
+                            if (*p ++ == 'g' &&
+                                *p ++ == 'l' &&
+                                *p ++ == 'e' &&
+                                *p ++ == 'B' &&
+                                *p ++ == 'r' &&
+                                *p ++ == 'a' &&
+                                *p ++ == 'c' &&
+                                *p ++ == 'k' &&
+                                *p ++ == 'e' &&
+                                *p ++ == 't') {
+                                return 1094;
+                            }
+                            return r;
+                        case 'r':
+                            if (*p ++ == 'r' &&
+                                *p ++ == 'o' &&
+                                *p ++ == 'w') {
+                                r = 1099;
+                                switch (*p ++) {
+                                case 'B':
+                                    if (*p ++ == 'a' &&
+                                        *p ++ == 'r') {
+                                        return 1104;
+                                    }
+                                    return r;
+                                case 'R':
+                                    if (*p ++ == 'i' &&
+                                        *p ++ == 'g' &&
+                                        *p ++ == 'h' &&
+                                        *p ++ == 't' &&
+                                        *p ++ == 'A' &&
+                                        *p ++ == 'r' &&
+                                        *p ++ == 'r' &&
+                                        *p ++ == 'o' &&
+                                        *p ++ == 'w') {
+                                        return 1109;
+                                    }
+                                    return r;
+                                }
+                                return r;
+                            }
+                            return r;
+                        }
+                        return r;
+                    case 'C':
+                        if (*p ++ == 'e' &&
+                            *p ++ == 'i' &&
+                            *p ++ == 'l' &&
+                            *p ++ == 'i' &&
+                            *p ++ == 'n' &&
+                            *p ++ == 'g') {
+                            return 1114;
+                        }
+                        return r;
+                    case 'D':
+                        if (*p ++ == 'o') {
+                            switch (*p ++) {
+                            case 'u':
+                                if (*p ++ == 'b' &&
+                                    *p ++ == 'l' &&
+                                    *p ++ == 'e' &&
+                                    *p ++ == 'B' &&
+                                    *p ++ == 'r' &&
+                                    *p ++ == 'a' &&
+                                    *p ++ == 'c' &&
+                                    *p ++ == 'k' &&
+                                    *p ++ == 'e' &&
+                                    *p ++ == 't') {
+                                    return 1119;
+                                }
+                                return r;
+                            case 'w':
+                                if (*p ++ == 'n') {
+                                    switch (*p ++) {
+                                    case 'T':
+                                        if (*p ++ == 'e' &&
+                                            *p ++ == 'e' &&
+                                            *p ++ == 'V' &&
+                                            *p ++ == 'e' &&
+                                            *p ++ == 'c' &&
+                                            *p ++ == 't' &&
+                                            *p ++ == 'o' &&
+                                            *p ++ == 'r') {
+                                            return 1124;
+                                        }
+                                        return r;
+                                    case 'V':
+                                        if (*p ++ == 'e' &&
+                                            *p ++ == 'c' &&
+                                            *p ++ == 't' &&
+                                            *p ++ == 'o' &&
+                                            *p ++ == 'r') {
+                                            r = 1129;
+                                            if (*p ++ == 'B' &&
+                                                *p ++ == 'a' &&
+                                                *p ++ == 'r') {
+                                                return 1134;
+                                            }
+                                            return r;
+                                        }
+                                        return r;
+                                    }
+                                    return r;
+                                }
+                                return r;
+                            }
+                            return r;
+                        }
+                        return r;
+                    case 'F':
+                        if (*p ++ == 'l' &&
+                            *p ++ == 'o' &&
+                            *p ++ == 'o' &&
+                            *p ++ == 'r') {
+                            return 1139;
+                        }
+                        return r;
+                    case 'R':
+                        if (*p ++ == 'i' &&
+                            *p ++ == 'g' &&
+                            *p ++ == 'h' &&
+                            *p ++ == 't') {
+                            switch (*p ++) {
+                            case 'A':
+                                if (*p ++ == 'r' &&
+                                    *p ++ == 'r' &&
+                                    *p ++ == 'o' &&
+                                    *p ++ == 'w') {
+                                    return 1144;
+                                }
+                                return r;
+                            case 'V':
+                                if (*p ++ == 'e' &&
+                                    *p ++ == 'c' &&
+                                    *p ++ == 't' &&
+                                    *p ++ == 'o' &&
+                                    *p ++ == 'r') {
+                                    return 1149;
+                                }
+                                return r;
+                            }
+                            return r;
+                        }
+                        return r;
+                    case 'T':
+                        switch (*p ++) {
+                        case 'e':
+                            if (*p ++ == 'e') {
+                                r = 1154;
+                                switch (*p ++) {
+                                case 'A':
+                                    if (*p ++ == 'r' &&
+                                        *p ++ == 'r' &&
+                                        *p ++ == 'o' &&
+                                        *p ++ == 'w') {
+                                        return 1159;
+                                    }
+                                    return r;
+                                case 'V':
+                                    if (*p ++ == 'e' &&
+                                        *p ++ == 'c' &&
+                                        *p ++ == 't' &&
+                                        *p ++ == 'o' &&
+                                        *p ++ == 'r') {
+                                        return 1164;
+                                    }
+                                    return r;
+                                }
+                                return r;
+                            }
+                            return r;
+                        case 'r':
+                            if (*p ++ == 'i' &&
+                                *p ++ == 'a' &&
+                                *p ++ == 'n' &&
+                                *p ++ == 'g' &&
+                                *p ++ == 'l' &&
+                                *p ++ == 'e') {
+                                r = 1169;
+                                switch (*p ++) {
+                                case 'B':
+                                    if (*p ++ == 'a' &&
+                                        *p ++ == 'r') {
+                                        return 1174;
+                                    }
+                                    return r;
+                                case 'E':
+                                    if (*p ++ == 'q' &&
+                                        *p ++ == 'u' &&
+                                        *p ++ == 'a' &&
+                                        *p ++ == 'l') {
+                                        return 1179;
+                                    }
+                                    return r;
+                                }
+                                return r;
+                            }
+                            return r;
+                        }
+                        return r;
+                    case 'U':
+                        if (*p ++ == 'p') {
+                            switch (*p ++) {
+                            case 'D':
+                                if (*p ++ == 'o' &&
+                                    *p ++ == 'w' &&
+                                    *p ++ == 'n' &&
+                                    *p ++ == 'V' &&
+                                    *p ++ == 'e' &&
+                                    *p ++ == 'c' &&
+                                    *p ++ == 't' &&
+                                    *p ++ == 'o' &&
+                                    *p ++ == 'r') {
+                                    return 1184;
+                                }
+                                return r;
+                            case 'T':
+                                if (*p ++ == 'e' &&
+                                    *p ++ == 'e' &&
+                                    *p ++ == 'V' &&
+                                    *p ++ == 'e' &&
+                                    *p ++ == 'c' &&
+                                    *p ++ == 't' &&
+                                    *p ++ == 'o' &&
+                                    *p ++ == 'r') {
+                                    return 1189;
+                                }
+                                return r;
+                            case 'V':
+                                if (*p ++ == 'e' &&
+                                    *p ++ == 'c' &&
+                                    *p ++ == 't' &&
+                                    *p ++ == 'o' &&
+                                    *p ++ == 'r') {
+                                    r = 1194;
+                                    if (*p ++ == 'B' &&
+                                        *p ++ == 'a' &&
+                                        *p ++ == 'r') {
+                                        return 1199;
+                                    }
+                                    return r;
+                                }
+                                return r;
+                            }
+                            return r;
+                        }
+                        return r;
+                    case 'V':
+                        if (*p ++ == 'e' &&
+                            *p ++ == 'c' &&
+                            *p ++ == 't' &&
+                            *p ++ == 'o' &&
+                            *p ++ == 'r') {
+                            r = 1204;
+                            if (*p ++ == 'B' &&
+                                *p ++ == 'a' &&
+                                *p ++ == 'r') {
+                                return 1209;
+                            }
+                            return r;
+                        }
+                        return r;
+                    case 'a':
+                        if (*p ++ == 'r' &&
+                            *p ++ == 'r' &&
+                            *p ++ == 'o' &&
+                            *p ++ == 'w') {
+                            return 1214;
+                        }
+                        return r;
+                    case 'r':
+                        if (*p ++ == 'i' &&
+                            *p ++ == 'g' &&
+                            *p ++ == 'h' &&
+                            *p ++ == 't' &&
+                            *p ++ == 'a' &&
+                            *p ++ == 'r' &&
+                            *p ++ == 'r' &&
+                            *p ++ == 'o' &&
+                            *p ++ == 'w') {
+                            return 1219;
+                        }
+                        return r;
+                    }
+                    return r;
+                }
+                return r;
+            case 's':
+                if (*p ++ == 's') {
+                    switch (*p ++) {
+                    case 'E':
+                        if (*p ++ == 'q' &&
+                            *p ++ == 'u' &&
+                            *p ++ == 'a' &&
+                            *p ++ == 'l' &&
+                            *p ++ == 'G' &&
+                            *p ++ == 'r' &&
+                            *p ++ == 'e' &&
+                            *p ++ == 'a' &&
+                            *p ++ == 't' &&
+                            *p ++ == 'e' &&
+                            *p ++ == 'r') {
+                            return 1224;
+                        }
+                        return r;
+                    case 'F':
+                        if (*p ++ == 'u' &&
+                            *p ++ == 'l' &&
+                            *p ++ == 'l' &&
+                            *p ++ == 'E' &&
+                            *p ++ == 'q' &&
+                            *p ++ == 'u' &&
+                            *p ++ == 'a' &&
+                            *p ++ == 'l') {
+                            return 1229;
+                        }
+                        return r;
+                    case 'G':
+                        if (*p ++ == 'r' &&
+                            *p ++ == 'e' &&
+                            *p ++ == 'a' &&
+                            *p ++ == 't' &&
+                            *p ++ == 'e' &&
+                            *p ++ == 'r') {
+                            return 1234;
+                        }
+                        return r;
+                    case 'L':
+                        if (*p ++ == 'e' &&
+                            *p ++ == 's' &&
+                            *p ++ == 's') {
+                            return 1239;
+                        }
+                        return r;
+                    case 'S':
+                        if (*p ++ == 'l' &&
+                            *p ++ == 'a' &&
+                            *p ++ == 'n' &&
+                            *p ++ == 't' &&
+                            *p ++ == 'E' &&
+                            *p ++ == 'q' &&
+                            *p ++ == 'u' &&
+                            *p ++ == 'a' &&
+                            *p ++ == 'l') {
+                            return 1244;
+                        }
+                        return r;
+                    case 'T':
+                        if (*p ++ == 'i' &&
+                            *p ++ == 'l' &&
+                            *p ++ == 'd' &&
+                            *p ++ == 'e') {
+                            return 1249;
+                        }
+                        return r;
+                    }
+                    return r;
+                }
+                return r;
+            }
+            return r;
+        case 'f':
+            if (*p ++ == 'r') {
+                return 1254;
+            }
+            return r;
+        case 'l':
+            r = 1260;
+            if (*p ++ == 'e' &&
+                *p ++ == 'f' &&
+                *p ++ == 't' &&
+                *p ++ == 'a' &&
+                *p ++ == 'r' &&
+                *p ++ == 'r' &&
+                *p ++ == 'o' &&
+                *p ++ == 'w') {
+                return 1265;
+            }
+            return r;
+        case 'm':
+            if (*p ++ == 'i' &&
+                *p ++ == 'd' &&
+                *p ++ == 'o' &&
+                *p ++ == 't') {
+                return 1270;
+            }
+            return r;
+        case 'o':
+            switch (*p ++) {
+            case 'n':
+                if (*p ++ == 'g') {
+                    switch (*p ++) {
+                    case 'L':
+                        if (*p ++ == 'e' &&
+                            *p ++ == 'f' &&
+                            *p ++ == 't') {
+                            switch (*p ++) {
+                            case 'A':
+                                if (*p ++ == 'r' &&
+                                    *p ++ == 'r' &&
+                                    *p ++ == 'o' &&
+                                    *p ++ == 'w') {
+                                    return 1274;
+                                }
+                                return r;
+                            case 'R':
+                                if (*p ++ == 'i' &&
+                                    *p ++ == 'g' &&
+                                    *p ++ == 'h' &&
+                                    *p ++ == 't' &&
+                                    *p ++ == 'A' &&
+                                    *p ++ == 'r' &&
+                                    *p ++ == 'r' &&
+                                    *p ++ == 'o' &&
+                                    *p ++ == 'w') {
+                                    return 1279;
+                                }
+                                return r;
+                            }
+                            return r;
+                        }
+                        return r;
+                    case 'R':
+                        if (*p ++ == 'i' &&
+                            *p ++ == 'g' &&
+                            *p ++ == 'h' &&
+                            *p ++ == 't' &&
+                            *p ++ == 'A' &&
+                            *p ++ == 'r' &&
+                            *p ++ == 'r' &&
+                            *p ++ == 'o' &&
+                            *p ++ == 'w') {
+                            return 1284;
+                        }
+                        return r;
+                    case 'l':
+                        if (*p ++ == 'e' &&
+                            *p ++ == 'f' &&
+                            *p ++ == 't') {
+                            switch (*p ++) {
+                            case 'a':
+                                if (*p ++ == 'r' &&
+                                    *p ++ == 'r' &&
+                                    *p ++ == 'o' &&
+                                    *p ++ == 'w') {
+                                    return 1289;
+                                }
+                                return r;
+                            case 'r':
+                                if (*p ++ == 'i' &&
+                                    *p ++ == 'g' &&
+                                    *p ++ == 'h' &&
+                                    *p ++ == 't' &&
+                                    *p ++ == 'a' &&
+                                    *p ++ == 'r' &&
+                                    *p ++ == 'r' &&
+                                    *p ++ == 'o' &&
+                                    *p ++ == 'w') {
+                                    return 1294;
+                                }
+                                return r;
+                            }
+                            return r;
+                        }
+                        return r;
+                    case 'r':
+                        if (*p ++ == 'i' &&
+                            *p ++ == 'g' &&
+                            *p ++ == 'h' &&
+                            *p ++ == 't' &&
+                            *p ++ == 'a' &&
+                            *p ++ == 'r' &&
+                            *p ++ == 'r' &&
+                            *p ++ == 'o' &&
+                            *p ++ == 'w') {
+                            return 1299;
+                        }
+                        return r;
+                    }
+                    return r;
+                }
+                return r;
+            case 'p':
+                if (*p ++ == 'f') {
+                    return 1304;
+                }
+                return r;
+            case 'w':
+                if (*p ++ == 'e' &&
+                    *p ++ == 'r') {
+                    switch (*p ++) {
+                    case 'L':
+                        if (*p ++ == 'e' &&
+                            *p ++ == 'f' &&
+                            *p ++ == 't' &&
+                            *p ++ == 'A' &&
+                            *p ++ == 'r' &&
+                            *p ++ == 'r' &&
+                            *p ++ == 'o' &&
+                            *p ++ == 'w') {
+                            return 1310;
+                        }
+                        return r;
+                    case 'R':
+                        if (*p ++ == 'i' &&
+                            *p ++ == 'g' &&
+                            *p ++ == 'h' &&
+                            *p ++ == 't' &&
+                            *p ++ == 'A' &&
+                            *p ++ == 'r' &&
+                            *p ++ == 'r' &&
+                            *p ++ == 'o' &&
+                            *p ++ == 'w') {
+                            return 1315;
+                        }
+                        return r;
+                    }
+                    return r;
+                }
+                return r;
+            }
+            return r;
+        case 's':
+            switch (*p ++) {
+            case 'c':
+                if (*p ++ == 'r') {
+                    return 1320;
+                }
+                return r;
+            case 'h':
+                return 1325;
+            case 't':
+                if (*p ++ == 'r' &&
+                    *p ++ == 'o' &&
+                    *p ++ == 'k') {
+                    return 1330;
+                }
+                return r;
+            }
+            return r;
+        case 't':
+            return 1334;
+        }
+        return r;
+    case 'M':
+        switch (*p ++) {
+        case 'a':
+            if (*p ++ == 'p') {
+                return 1339;
+            }
+            return r;
+        case 'c':
+            if (*p ++ == 'y') {
+                return 1344;
+            }
+            return r;
+        case 'e':
+            switch (*p ++) {
+            case 'd':
+                if (*p ++ == 'i' &&
+                    *p ++ == 'u' &&
+                    *p ++ == 'm' &&
+                    *p ++ == 'S' &&
+                    *p ++ == 'p' &&
+                    *p ++ == 'a' &&
+                    *p ++ == 'c' &&
+                    *p ++ == 'e') {
+                    return 1348;
+                }
+                return r;
+            case 'l':
+                if (*p ++ == 'l' &&
+                    *p ++ == 'i' &&
+                    *p ++ == 'n' &&
+                    *p ++ == 't' &&
+                    *p ++ == 'r' &&
+                    *p ++ == 'f') {
+                    return 1353;
+                }
+                return r;
+            }
+            return r;
+        case 'f':
+            if (*p ++ == 'r') {
+                return 1358;
+            }
+            return r;
+        case 'i':
+            if (*p ++ == 'n' &&
+                *p ++ == 'u' &&
+                *p ++ == 's' &&
+                *p ++ == 'P' &&
+                *p ++ == 'l' &&
+                *p ++ == 'u' &&
+                *p ++ == 's') {
+                return 1364;
+            }
+            return r;
+        case 'o':
+            if (*p ++ == 'p' &&
+                *p ++ == 'f') {
+                return 1369;
+            }
+            return r;
+        case 's':
+            if (*p ++ == 'c' &&
+                *p ++ == 'r') {
+                return 1375;
+            }
+            return r;
+        case 'u':
+            return 1380;
+        }
+        return r;
+    case 'N':
+        switch (*p ++) {
+        case 'J':
+            if (*p ++ == 'c' &&
+                *p ++ == 'y') {
+                return 1384;
+            }
+            return r;
+        case 'a':
+            if (*p ++ == 'c' &&
+                *p ++ == 'u' &&
+                *p ++ == 't' &&
+                *p ++ == 'e') {
+                return 1388;
+            }
+            return r;
+        case 'c':
+            switch (*p ++) {
+            case 'a':
+                if (*p ++ == 'r' &&
+                    *p ++ == 'o' &&
+                    *p ++ == 'n') {
+                    return 1392;
+                }
+                return r;
+            case 'e':
+                if (*p ++ == 'd' &&
+                    *p ++ == 'i' &&
+                    *p ++ == 'l') {
+                    return 1396;
+                }
+                return r;
+            case 'y':
+                return 1400;
+            }
+            return r;
+        case 'e':
+            switch (*p ++) {
+            case 'g':
+                if (*p ++ == 'a' &&
+                    *p ++ == 't' &&
+                    *p ++ == 'i' &&
+                    *p ++ == 'v' &&
+                    *p ++ == 'e') {
+                    switch (*p ++) {
+                    case 'M':
+                        if (*p ++ == 'e' &&
+                            *p ++ == 'd' &&
+                            *p ++ == 'i' &&
+                            *p ++ == 'u' &&
+                            *p ++ == 'm' &&
+                            *p ++ == 'S' &&
+                            *p ++ == 'p' &&
+                            *p ++ == 'a' &&
+                            *p ++ == 'c' &&
+                            *p ++ == 'e') {
+                            return 1404;
+                        }
+                        return r;
+                    case 'T':
+                        if (*p ++ == 'h' &&
+                            *p ++ == 'i') {
+                            switch (*p ++) {
+                            case 'c':
+                                if (*p ++ == 'k' &&
+                                    *p ++ == 'S' &&
+                                    *p ++ == 'p' &&
+                                    *p ++ == 'a' &&
+                                    *p ++ == 'c' &&
+                                    *p ++ == 'e') {
+                                    return 1409;
+                                }
+                                return r;
+                            case 'n':
+                                if (*p ++ == 'S' &&
+                                    *p ++ == 'p' &&
+                                    *p ++ == 'a' &&
+                                    *p ++ == 'c' &&
+                                    *p ++ == 'e') {
+                                    return 1414;
+                                }
+                                return r;
+                            }
+                            return r;
+                        }
+                        return r;
+                    case 'V':
+                        if (*p ++ == 'e' &&
+                            *p ++ == 'r' &&
+                            *p ++ == 'y' &&
+                            *p ++ == 'T' &&
+                            *p ++ == 'h' &&
+                            *p ++ == 'i' &&
+                            *p ++ == 'n' &&
+                            *p ++ == 'S' &&
+                            *p ++ == 'p' &&
+                            *p ++ == 'a' &&
+                            *p ++ == 'c' &&
+                            *p ++ == 'e') {
+                            return 1419;
+                        }
+                        return r;
+                    }
+                    return r;
+                }
+                return r;
+            case 's':
+                if (*p ++ == 't' &&
+                    *p ++ == 'e' &&
+                    *p ++ == 'd') {
+                    switch (*p ++) {
+                    case 'G':
+                        if (*p ++ == 'r' &&
+                            *p ++ == 'e' &&
+                            *p ++ == 'a' &&
+                            *p ++ == 't' &&
+                            *p ++ == 'e' &&
+                            *p ++ == 'r' &&
+                            *p ++ == 'G' &&
+                            *p ++ == 'r' &&
+                            *p ++ == 'e' &&
+                            *p ++ == 'a' &&
+                            *p ++ == 't' &&
+                            *p ++ == 'e' &&
+                            *p ++ == 'r') {
+                            return 1424;
+                        }
+                        return r;
+                    case 'L':
+                        if (*p ++ == 'e' &&
+                            *p ++ == 's' &&
+                            *p ++ == 's' &&
+                            *p ++ == 'L' &&
+                            *p ++ == 'e' &&
+                            *p ++ == 's' &&
+                            *p ++ == 's') {
+                            return 1429;
+                        }
+                        return r;
+                    }
+                    return r;
+                }
+                return r;
+            case 'w':
+                if (*p ++ == 'L' &&
+                    *p ++ == 'i' &&
+                    *p ++ == 'n' &&
+                    *p ++ == 'e') {
+                    return 1434;
+                }
+                return r;
+            }
+            return r;
+        case 'f':
+            if (*p ++ == 'r') {
+                return 1437;
+            }
+            return r;
+        case 'o':
+            switch (*p ++) {
+            case 'B':
+                if (*p ++ == 'r' &&
+                    *p ++ == 'e' &&
+                    *p ++ == 'a' &&
+                    *p ++ == 'k') {
+                    return 1443;
+                }
+                return r;
+            case 'n':
+                if (*p ++ == 'B' &&
+                    *p ++ == 'r' &&
+                    *p ++ == 'e' &&
+                    *p ++ == 'a' &&
+                    *p ++ == 'k' &&
+                    *p ++ == 'i' &&
+                    *p ++ == 'n' &&
+                    *p ++ == 'g' &&
+                    *p ++ == 'S' &&
+                    *p ++ == 'p' &&
+                    *p ++ == 'a' &&
+                    *p ++ == 'c' &&
+                    *p ++ == 'e') {
+                    return 1448;
+                }
+                return r;
+            case 'p':
+                if (*p ++ == 'f') {
+                    return 1452;
+                }
+                return r;
+            case 't':
+                r = 1457;
+                switch (*p ++) {
+                case 'C':
+                    switch (*p ++) {
+                    case 'o':
+                        if (*p ++ == 'n' &&
+                            *p ++ == 'g' &&
+                            *p ++ == 'r' &&
+                            *p ++ == 'u' &&
+                            *p ++ == 'e' &&
+                            *p ++ == 'n' &&
+                            *p ++ == 't') {
+                            return 1462;
+                        }
+                        return r;
+                    case 'u':
+                        if (*p ++ == 'p' &&
+                            *p ++ == 'C' &&
+                            *p ++ == 'a' &&
+                            *p ++ == 'p') {
+                            return 1467;
+                        }
+                        return r;
+                    }
+                    return r;
+                case 'D':
+                    if (*p ++ == 'o' &&
+                        *p ++ == 'u' &&
+                        *p ++ == 'b' &&
+                        *p ++ == 'l' &&
+                        *p ++ == 'e' &&
+                        *p ++ == 'V' &&
+                        *p ++ == 'e' &&
+                        *p ++ == 'r' &&
+                        *p ++ == 't' &&
+                        *p ++ == 'i' &&
+                        *p ++ == 'c' &&
+                        *p ++ == 'a' &&
+                        *p ++ == 'l' &&
+                        *p ++ == 'B' &&
+                        *p ++ == 'a' &&
+                        *p ++ == 'r') {
+                        return 1472;
+                    }
+                    return r;
+                case 'E':
+                    switch (*p ++) {
+                    case 'l':
+                        if (*p ++ == 'e' &&
+                            *p ++ == 'm' &&
+                            *p ++ == 'e' &&
+                            *p ++ == 'n' &&
+                            *p ++ == 't') {
+                            return 1477;
+                        }
+                        return r;
+                    case 'q':
+                        if (*p ++ == 'u' &&
+                            *p ++ == 'a' &&
+                            *p ++ == 'l') {
+                            r = 1482;
+                            if (*p ++ == 'T' &&
+                                *p ++ == 'i' &&
+                                *p ++ == 'l' &&
+                                *p ++ == 'd' &&
+                                *p ++ == 'e') {
+                                return 1487;
+                            }
+                            return r;
+                        }
+                        return r;
+                    case 'x':
+                        if (*p ++ == 'i' &&
+                            *p ++ == 's' &&
+                            *p ++ == 't' &&
+                            *p ++ == 's') {
+                            return 1494;
+                        }
+                        return r;
+                    }
+                    return r;
+                case 'G':
+                    if (*p ++ == 'r' &&
+                        *p ++ == 'e' &&
+                        *p ++ == 'a' &&
+                        *p ++ == 't' &&
+                        *p ++ == 'e' &&
+                        *p ++ == 'r') {
+                        r = 1499;
+                        switch (*p ++) {
+                        case 'E':
+                            if (*p ++ == 'q' &&
+                                *p ++ == 'u' &&
+                                *p ++ == 'a' &&
+                                *p ++ == 'l') {
+                                return 1504;
+                            }
+                            return r;
+                        case 'F':
+                            if (*p ++ == 'u' &&
+                                *p ++ == 'l' &&
+                                *p ++ == 'l' &&
+                                *p ++ == 'E' &&
+                                *p ++ == 'q' &&
+                                *p ++ == 'u' &&
+                                *p ++ == 'a' &&
+                                *p ++ == 'l') {
+                                return 1509;
+                            }
+                            return r;
+                        case 'G':
+                            if (*p ++ == 'r' &&
+                                *p ++ == 'e' &&
+                                *p ++ == 'a' &&
+                                *p ++ == 't' &&
+                                *p ++ == 'e' &&
+                                *p ++ == 'r') {
+                                return 1516;
+                            }
+                            return r;
+                        case 'L':
+                            if (*p ++ == 'e' &&
+                                *p ++ == 's' &&
+                                *p ++ == 's') {
+                                return 1523;
+                            }
+                            return r;
+                        case 'S':
+                            if (*p ++ == 'l' &&
+                                *p ++ == 'a' &&
+                                *p ++ == 'n' &&
+                                *p ++ == 't' &&
+                                *p ++ == 'E' &&
+                                *p ++ == 'q' &&
+                                *p ++ == 'u' &&
+                                *p ++ == 'a' &&
+                                *p ++ == 'l') {
+                                return 1528;
+                            }
+                            return r;
+                        case 'T':
+                            if (*p ++ == 'i' &&
+                                *p ++ == 'l' &&
+                                *p ++ == 'd' &&
+                                *p ++ == 'e') {
+                                return 1535;
+                            }
+                            return r;
+                        }
+                        return r;
+                    }
+                    return r;
+                case 'H':
+                    if (*p ++ == 'u' &&
+                        *p ++ == 'm' &&
+                        *p ++ == 'p') {
+                        switch (*p ++) {
+                        case 'D':
+                            if (*p ++ == 'o' &&
+                                *p ++ == 'w' &&
+                                *p ++ == 'n' &&
+                                *p ++ == 'H' &&
+                                *p ++ == 'u' &&
+                                *p ++ == 'm' &&
+                                *p ++ == 'p') {
+                                return 1540;
+                            }
+                            return r;
+                        case 'E':
+                            if (*p ++ == 'q' &&
+                                *p ++ == 'u' &&
+                                *p ++ == 'a' &&
+                                *p ++ == 'l') {
+                                return 1547;
+                            }
+                            return r;
+                        }
+                        return r;
+                    }
+                    return r;
+                case 'L':
+                    if (*p ++ == 'e') {
+                        switch (*p ++) {
+                        case 'f':
+                            if (*p ++ == 't' &&
+                                *p ++ == 'T' &&
+                                *p ++ == 'r' &&
+                                *p ++ == 'i' &&
+                                *p ++ == 'a' &&
+                                *p ++ == 'n' &&
+                                *p ++ == 'g' &&
+                                *p ++ == 'l' &&
+                                *p ++ == 'e') {
+                                r = 1554;
+                                switch (*p ++) {
+                                case 'B':
+                                    if (*p ++ == 'a' &&
+                                        *p ++ == 'r') {
+                                        return 1559;
+                                    }
+                                    return r;
+                                case 'E':
+                                    if (*p ++ == 'q' &&
+                                        *p ++ == 'u' &&
+                                        *p ++ == 'a' &&
+                                        *p ++ == 'l') {
+                                        return 1566;
+                                    }
+                                    return r;
+                                }
+                                return r;
+                            }
+                            return r;
+                        case 's':
+                            if (*p ++ == 's') {
+                                r = 1571;
+                                switch (*p ++) {
+                                case 'E':
+                                    if (*p ++ == 'q' &&
+                                        *p ++ == 'u' &&
+                                        *p ++ == 'a' &&
+                                        *p ++ == 'l') {
+                                        return 1576;
+                                    }
+                                    return r;
+                                case 'G':
+                                    if (*p ++ == 'r' &&
+                                        *p ++ == 'e' &&
+                                        *p ++ == 'a' &&
+                                        *p ++ == 't' &&
+                                        *p ++ == 'e' &&
+                                        *p ++ == 'r') {
+                                        return 1581;
+                                    }
+                                    return r;
+                                case 'L':
+                                    if (*p ++ == 'e' &&
+                                        *p ++ == 's' &&
+                                        *p ++ == 's') {
+                                        return 1586;
+                                    }
+                                    return r;
+                                case 'S':
+                                    if (*p ++ == 'l' &&
+                                        *p ++ == 'a' &&
+                                        *p ++ == 'n' &&
+                                        *p ++ == 't' &&
+                                        *p ++ == 'E' &&
+                                        *p ++ == 'q' &&
+                                        *p ++ == 'u' &&
+                                        *p ++ == 'a' &&
+                                        *p ++ == 'l') {
+                                        return 1593;
+                                    }
+                                    return r;
+                                case 'T':
+                                    if (*p ++ == 'i' &&
+                                        *p ++ == 'l' &&
+                                        *p ++ == 'd' &&
+                                        *p ++ == 'e') {
+                                        return 1600;
+                                    }
+                                    return r;
+                                }
+                                return r;
+                            }
+                            return r;
+                        }
+                        return r;
+                    }
+                    return r;
+                case 'N':
+                    if (*p ++ == 'e' &&
+                        *p ++ == 's' &&
+                        *p ++ == 't' &&
+                        *p ++ == 'e' &&
+                        *p ++ == 'd') {
+                        switch (*p ++) {
+                        case 'G':
+                            if (*p ++ == 'r' &&
+                                *p ++ == 'e' &&
+                                *p ++ == 'a' &&
+                                *p ++ == 't' &&
+                                *p ++ == 'e' &&
+                                *p ++ == 'r' &&
+                                *p ++ == 'G' &&
+                                *p ++ == 'r' &&
+                                *p ++ == 'e' &&
+                                *p ++ == 'a' &&
+                                *p ++ == 't' &&
+                                *p ++ == 'e' &&
+                                *p ++ == 'r') {
+                                return 1605;
+                            }
+                            return r;
+                        case 'L':
+                            if (*p ++ == 'e' &&
+                                *p ++ == 's' &&
+                                *p ++ == 's' &&
+                                *p ++ == 'L' &&
+                                *p ++ == 'e' &&
+                                *p ++ == 's' &&
+                                *p ++ == 's') {
+                                return 1612;
+                            }
+                            return r;
+                        }
+                        return r;
+                    }
+                    return r;
+                case 'P':
+                    if (*p ++ == 'r' &&
+                        *p ++ == 'e' &&
+                        *p ++ == 'c' &&
+                        *p ++ == 'e' &&
+                        *p ++ == 'd' &&
+                        *p ++ == 'e' &&
+                        *p ++ == 's') {
+                        r = 1619;
+                        switch (*p ++) {
+                        case 'E':
+                            if (*p ++ == 'q' &&
+                                *p ++ == 'u' &&
+                                *p ++ == 'a' &&
+                                *p ++ == 'l') {
+                                return 1624;
+                            }
+                            return r;
+                        case 'S':
+                            if (*p ++ == 'l' &&
+                                *p ++ == 'a' &&
+                                *p ++ == 'n' &&
+                                *p ++ == 't' &&
+                                *p ++ == 'E' &&
+                                *p ++ == 'q' &&
+                                *p ++ == 'u' &&
+                                *p ++ == 'a' &&
+                                *p ++ == 'l') {
+                                return 1631;
+                            }
+                            return r;
+                        }
+                        return r;
+                    }
+                    return r;
+                case 'R':
+                    switch (*p ++) {
+                    case 'e':
+                        if (*p ++ == 'v' &&
+                            *p ++ == 'e' &&
+                            *p ++ == 'r' &&
+                            *p ++ == 's' &&
+                            *p ++ == 'e' &&
+                            *p ++ == 'E' &&
+                            *p ++ == 'l' &&
+                            *p ++ == 'e' &&
+                            *p ++ == 'm' &&
+                            *p ++ == 'e' &&
+                            *p ++ == 'n' &&
+                            *p ++ == 't') {
+                            return 1636;
+                        }
+                        return r;
+                    case 'i':
+                        if (*p ++ == 'g' &&
+                            *p ++ == 'h' &&
+                            *p ++ == 't' &&
+                            *p ++ == 'T' &&
+                            *p ++ == 'r' &&
+                            *p ++ == 'i' &&
+                            *p ++ == 'a' &&
+                            *p ++ == 'n' &&
+                            *p ++ == 'g' &&
+                            *p ++ == 'l' &&
+                            *p ++ == 'e') {
+                            r = 1641;
+                            switch (*p ++) {
+                            case 'B':
+                                if (*p ++ == 'a' &&
+                                    *p ++ == 'r') {
+                                    return 1646;
+                                }
+                                return r;
+                            case 'E':
+                                if (*p ++ == 'q' &&
+                                    *p ++ == 'u' &&
+                                    *p ++ == 'a' &&
+                                    *p ++ == 'l') {
+                                    return 1653;
+                                }
+                                return r;
+                            }
+                            return r;
+                        }
+                        return r;
+                    }
+                    return r;
+                case 'S':
+                    switch (*p ++) {
+                    case 'q':
+                        if (*p ++ == 'u' &&
+                            *p ++ == 'a' &&
+                            *p ++ == 'r' &&
+                            *p ++ == 'e' &&
+                            *p ++ == 'S' &&
+                            *p ++ == 'u') {
+                            switch (*p ++) {
+                            case 'b':
+                                if (*p ++ == 's' &&
+                                    *p ++ == 'e' &&
+                                    *p ++ == 't') {
+                                    r = 1658;
+                                    if (*p ++ == 'E' &&
+                                        *p ++ == 'q' &&
+                                        *p ++ == 'u' &&
+                                        *p ++ == 'a' &&
+                                        *p ++ == 'l') {
+                                        return 1665;
+                                    }
+                                    return r;
+                                }
+                                return r;
+                            case 'p':
+                                if (*p ++ == 'e' &&
+                                    *p ++ == 'r' &&
+                                    *p ++ == 's' &&
+                                    *p ++ == 'e' &&
+                                    *p ++ == 't') {
+                                    r = 1670;
+                                    if (*p ++ == 'E' &&
+                                        *p ++ == 'q' &&
+                                        *p ++ == 'u' &&
+                                        *p ++ == 'a' &&
+                                        *p ++ == 'l') {
+                                        return 1677;
+                                    }
+                                    return r;
+                                }
+                                return r;
+                            }
+                            return r;
+                        }
+                        return r;
+                    case 'u':
+                        switch (*p ++) {
+                        case 'b':
+                            if (*p ++ == 's' &&
+                                *p ++ == 'e' &&
+                                *p ++ == 't') {
+                                r = 1682;
+                                if (*p ++ == 'E' &&
+                                    *p ++ == 'q' &&
+                                    *p ++ == 'u' &&
+                                    *p ++ == 'a' &&
+                                    *p ++ == 'l') {
+                                    return 1690;
+                                }
+                                return r;
+                            }
+                            return r;
+                        case 'c':
+                            if (*p ++ == 'c' &&
+                                *p ++ == 'e' &&
+                                *p ++ == 'e' &&
+                                *p ++ == 'd' &&
+                                *p ++ == 's') {
+                                r = 1695;
+                                switch (*p ++) {
+                                case 'E':
+                                    if (*p ++ == 'q' &&
+                                        *p ++ == 'u' &&
+                                        *p ++ == 'a' &&
+                                        *p ++ == 'l') {
+                                        return 1700;
+                                    }
+                                    return r;
+                                case 'S':
+                                    if (*p ++ == 'l' &&
+                                        *p ++ == 'a' &&
+                                        *p ++ == 'n' &&
+                                        *p ++ == 't' &&
+                                        *p ++ == 'E' &&
+                                        *p ++ == 'q' &&
+                                        *p ++ == 'u' &&
+                                        *p ++ == 'a' &&
+                                        *p ++ == 'l') {
+                                        return 1707;
+                                    }
+                                    return r;
+                                case 'T':
+                                    if (*p ++ == 'i' &&
+                                        *p ++ == 'l' &&
+                                        *p ++ == 'd' &&
+                                        *p ++ == 'e') {
+                                        return 1712;
+                                    }
+                                    return r;
+                                }
+                                return r;
+                            }
+                            return r;
+                        case 'p':
+                            if (*p ++ == 'e' &&
+                                *p ++ == 'r' &&
+                                *p ++ == 's' &&
+                                *p ++ == 'e' &&
+                                *p ++ == 't') {
+                                r = 1719;
+                                if (*p ++ == 'E' &&
+                                    *p ++ == 'q' &&
+                                    *p ++ == 'u' &&
+                                    *p ++ == 'a' &&
+                                    *p ++ == 'l') {
+                                    return 1727;
+                                }
+                                return r;
+                            }
+                            return r;
+                        }
+                        return r;
+                    }
+                    return r;
+                case 'T':
+                    if (*p ++ == 'i' &&
+                        *p ++ == 'l' &&
+                        *p ++ == 'd' &&
+                        *p ++ == 'e') {
+                        r = 1732;
+                        switch (*p ++) {
+                        case 'E':
+                            if (*p ++ == 'q' &&
+                                *p ++ == 'u' &&
+                                *p ++ == 'a' &&
+                                *p ++ == 'l') {
+                                return 1737;
+                            }
+                            return r;
+                        case 'F':
+                            if (*p ++ == 'u' &&
+                                *p ++ == 'l' &&
+                                *p ++ == 'l' &&
+                                *p ++ == 'E' &&
+                                *p ++ == 'q' &&
+                                *p ++ == 'u' &&
+                                *p ++ == 'a' &&
+                                *p ++ == 'l') {
+                                return 1742;
+                            }
+                            return r;
+                        case 'T':
+                            if (*p ++ == 'i' &&
+                                *p ++ == 'l' &&
+                                *p ++ == 'd' &&
+                                *p ++ == 'e') {
+                                return 1747;
+                            }
+                            return r;
+                        }
+                        return r;
+                    }
+                    return r;
+                case 'V':
+                    if (*p ++ == 'e' &&
+                        *p ++ == 'r' &&
+                        *p ++ == 't' &&
+                        *p ++ == 'i' &&
+                        *p ++ == 'c' &&
+                        *p ++ == 'a' &&
+                        *p ++ == 'l' &&
+                        *p ++ == 'B' &&
+                        *p ++ == 'a' &&
+                        *p ++ == 'r') {
+                        return 1752;
+                    }
+                    return r;
+                }
+                return r;
+            }
+            return r;
+        case 's':
+            if (*p ++ == 'c' &&
+                *p ++ == 'r') {
+                return 1757;
+            }
+            return r;
+        case 't':
+            if (*p ++ == 'i' &&
+                *p ++ == 'l' &&
+                *p ++ == 'd' &&
+                *p ++ == 'e') {
+                return 1763;
+            }
+            return r;
+        case 'u':
+            return 1767;
+        }
+        return r;
+    case 'O':
+        switch (*p ++) {
+        case 'E':
+            if (*p ++ == 'l' &&
+                *p ++ == 'i' &&
+                *p ++ == 'g') {
+                return 1771;
+            }
+            return r;
+        case 'a':
+            if (*p ++ == 'c' &&
+                *p ++ == 'u' &&
+                *p ++ == 't' &&
+                *p ++ == 'e') {
+                return 1775;
+            }
+            return r;
+        case 'c':
+            switch (*p ++) {
+            case 'i':
+                if (*p ++ == 'r' &&
+                    *p ++ == 'c') {
+                    return 1779;
+                }
+                return r;
+            case 'y':
+                return 1783;
+            }
+            return r;
+        case 'd':
+            if (*p ++ == 'b' &&
+                *p ++ == 'l' &&
+                *p ++ == 'a' &&
+                *p ++ == 'c') {
+                return 1787;
+            }
+            return r;
+        case 'f':
+            if (*p ++ == 'r') {
+                return 1791;
+            }
+            return r;
+        case 'g':
+            if (*p ++ == 'r' &&
+                *p ++ == 'a' &&
+                *p ++ == 'v' &&
+                *p ++ == 'e') {
+                return 1797;
+            }
+            return r;
+        case 'm':
+            switch (*p ++) {
+            case 'a':
+                if (*p ++ == 'c' &&
+                    *p ++ == 'r') {
+                    return 1801;
+                }
+                return r;
+            case 'e':
+                if (*p ++ == 'g' &&
+                    *p ++ == 'a') {
+                    return 1805;
+                }
+                return r;
+            case 'i':
+                if (*p ++ == 'c' &&
+                    *p ++ == 'r' &&
+                    *p ++ == 'o' &&
+                    *p ++ == 'n') {
+                    return 1809;
+                }
+                return r;
+            }
+            return r;
+        case 'o':
+            if (*p ++ == 'p' &&
+                *p ++ == 'f') {
+                return 1813;
+            }
+            return r;
+        case 'p':
+            if (*p ++ == 'e' &&
+                *p ++ == 'n' &&
+                *p ++ == 'C' &&
+                *p ++ == 'u' &&
+                *p ++ == 'r' &&
+                *p ++ == 'l' &&
+                *p ++ == 'y') {
+                switch (*p ++) {
+                case 'D':
+                    if (*p ++ == 'o' &&
+                        *p ++ == 'u' &&
+                        *p ++ == 'b' &&
+                        *p ++ == 'l' &&
+                        *p ++ == 'e' &&
+                        *p ++ == 'Q' &&
+                        *p ++ == 'u' &&
+                        *p ++ == 'o' &&
+                        *p ++ == 't' &&
+                        *p ++ == 'e') {
+                        return 1819;
+                    }
+                    return r;
+                case 'Q':
+                    if (*p ++ == 'u' &&
+                        *p ++ == 'o' &&
+                        *p ++ == 't' &&
+                        *p ++ == 'e') {
+                        return 1824;
+                    }
+                    return r;
+                }
+                return r;
+            }
+            return r;
+        case 'r':
+            return 1829;
+        case 's':
+            switch (*p ++) {
+            case 'c':
+                if (*p ++ == 'r') {
+                    return 1834;
+                }
+                return r;
+            case 'l':
+                if (*p ++ == 'a' &&
+                    *p ++ == 's' &&
+                    *p ++ == 'h') {
+                    return 1840;
+                }
+                return r;
+            }
+            return r;
+        case 't':
+            if (*p ++ == 'i') {
+                switch (*p ++) {
+                case 'l':
+                    if (*p ++ == 'd' &&
+                        *p ++ == 'e') {
+                        return 1844;
+                    }
+                    return r;
+                case 'm':
+                    if (*p ++ == 'e' &&
+                        *p ++ == 's') {
+                        return 1848;
+                    }
+                    return r;
+                }
+                return r;
+            }
+            return r;
+        case 'u':
+            if (*p ++ == 'm' &&
+                *p ++ == 'l') {
+                return 1853;
+            }
+            return r;
+        case 'v':
+            if (*p ++ == 'e' &&
+                *p ++ == 'r') {
+                switch (*p ++) {
+                case 'B':
+                    switch (*p ++) {
+                    case 'a':
+                        if (*p ++ == 'r') {
+                            return 1857;
+                        }
+                        return r;
+                    case 'r':
+                        if (*p ++ == 'a' &&
+                            *p ++ == 'c') {
+                            switch (*p ++) {
+                            case 'e':
+                                return 1862;
+                            case 'k':
+                                if (*p ++ == 'e' &&
+                                    *p ++ == 't') {
+                                    return 1867;
+                                }
+                                return r;
+                            }
+                            return r;
+                        }
+                        return r;
+                    }
+                    return r;
+                case 'P':
+                    if (*p ++ == 'a' &&
+                        *p ++ == 'r' &&
+                        *p ++ == 'e' &&
+                        *p ++ == 'n' &&
+                        *p ++ == 't' &&
+                        *p ++ == 'h' &&
+                        *p ++ == 'e' &&
+                        *p ++ == 's' &&
+                        *p ++ == 'i' &&
+                        *p ++ == 's') {
+                        return 1872;
+                    }
+                    return r;
+                }
+                return r;
+            }
+            return r;
+        }
+        return r;
+    case 'P':
+        switch (*p ++) {
+        case 'a':
+            if (*p ++ == 'r' &&
+                *p ++ == 't' &&
+                *p ++ == 'i' &&
+                *p ++ == 'a' &&
+                *p ++ == 'l' &&
+                *p ++ == 'D') {
+                return 1877;
+            }
+            return r;
+        case 'c':
+            if (*p ++ == 'y') {
+                return 1882;
+            }
+            return r;
+        case 'f':
+            if (*p ++ == 'r') {
+                return 1886;
+            }
+            return r;
+        case 'h':
+            if (*p ++ == 'i') {
+                return 1892;
+            }
+            return r;
+        case 'i':
+            return 1896;
+        case 'l':
+            if (*p ++ == 'u' &&
+                *p ++ == 's' &&
+                *p ++ == 'M' &&
+                *p ++ == 'i' &&
+                *p ++ == 'n' &&
+                *p ++ == 'u' &&
+                *p ++ == 's') {
+                return 1900;
+            }
+            return r;
+        case 'o':
+            switch (*p ++) {
+            case 'i':
+                if (*p ++ == 'n' &&
+                    *p ++ == 'c' &&
+                    *p ++ == 'a' &&
+                    *p ++ == 'r' &&
+                    *p ++ == 'e' &&
+                    *p ++ == 'p' &&
+                    *p ++ == 'l' &&
+                    *p ++ == 'a' &&
+                    *p ++ == 'n' &&
+                    *p ++ == 'e') {
+                    return 1904;
+                }
+                return r;
+            case 'p':
+                if (*p ++ == 'f') {
+                    return 1909;
+                }
+                return r;
+            }
+            return r;
+        case 'r':
+            r = 1914;
+            switch (*p ++) {
+            case 'e':
+                if (*p ++ == 'c' &&
+                    *p ++ == 'e' &&
+                    *p ++ == 'd' &&
+                    *p ++ == 'e' &&
+                    *p ++ == 's') {
+                    r = 1919;
+                    switch (*p ++) {
+                    case 'E':
+                        if (*p ++ == 'q' &&
+                            *p ++ == 'u' &&
+                            *p ++ == 'a' &&
+                            *p ++ == 'l') {
+                            return 1924;
+                        }
+                        return r;
+                    case 'S':
+                        if (*p ++ == 'l' &&
+                            *p ++ == 'a' &&
+                            *p ++ == 'n' &&
+                            *p ++ == 't' &&
+                            *p ++ == 'E' &&
+                            *p ++ == 'q' &&
+                            *p ++ == 'u' &&
+                            *p ++ == 'a' &&
+                            *p ++ == 'l') {
+                            return 1929;
+                        }
+                        return r;
+                    case 'T':
+                        if (*p ++ == 'i' &&
+                            *p ++ == 'l' &&
+                            *p ++ == 'd' &&
+                            *p ++ == 'e') {
+                            return 1934;
+                        }
+                        return r;
+                    }
+                    return r;
+                }
+                return r;
+            case 'i':
+                if (*p ++ == 'm' &&
+                    *p ++ == 'e') {
+                    return 1939;
+                }
+                return r;
+            case 'o':
+                switch (*p ++) {
+                case 'd':
+                    if (*p ++ == 'u' &&
+                        *p ++ == 'c' &&
+                        *p ++ == 't') {
+                        return 1944;
+                    }
+                    return r;
+                case 'p':
+                    if (*p ++ == 'o' &&
+                        *p ++ == 'r' &&
+                        *p ++ == 't' &&
+                        *p ++ == 'i' &&
+                        *p ++ == 'o' &&
+                        *p ++ == 'n') {
+                        r = 1949;
+                        if (*p ++ == 'a' &&
+                            *p ++ == 'l') {
+                            return 1954;
+                        }
+                        return r;
+                    }
+                    return r;
+                }
+                return r;
+            }
+            return r;
+        case 's':
+            switch (*p ++) {
+            case 'c':
+                if (*p ++ == 'r') {
+                    return 1959;
+                }
+                return r;
+            case 'i':
+                return 1965;
+            }
+            return r;
+        }
+        return r;
+    case 'Q':
+        switch (*p ++) {
+        case 'U':
+            if (*p ++ == 'O' &&
+                *p ++ == 'T') {
+                return 1969;
+            }
+            return r;
+        case 'f':
+            if (*p ++ == 'r') {
+                return 1972;
+            }
+            return r;
+        case 'o':
+            if (*p ++ == 'p' &&
+                *p ++ == 'f') {
+                return 1978;
+            }
+            return r;
+        case 's':
+            if (*p ++ == 'c' &&
+                *p ++ == 'r') {
+                return 1983;
+            }
+            return r;
+        }
+        return r;
+    case 'R':
+        switch (*p ++) {
+        case 'B':
+            if (*p ++ == 'a' &&
+                *p ++ == 'r' &&
+                *p ++ == 'r') {
+                return 1989;
+            }
+            return r;
+        case 'E':
+            if (*p ++ == 'G') {
+                return 1994;
+            }
+            return r;
+        case 'a':
+            switch (*p ++) {
+            case 'c':
+                if (*p ++ == 'u' &&
+                    *p ++ == 't' &&
+                    *p ++ == 'e') {
+                    return 1998;
+                }
+                return r;
+            case 'n':
+                if (*p ++ == 'g') {
+                    return 2002;
+                }
+                return r;
+            case 'r':
+                if (*p ++ == 'r') {
+                    r = 2007;
+                    if (*p ++ == 't' &&
+                        *p ++ == 'l') {
+                        return 2012;
+                    }
+                    return r;
+                }
+                return r;
+            }
+            return r;
+        case 'c':
+            switch (*p ++) {
+            case 'a':
+                if (*p ++ == 'r' &&
+                    *p ++ == 'o' &&
+                    *p ++ == 'n') {
+                    return 2017;
+                }
+                return r;
+            case 'e':
+                if (*p ++ == 'd' &&
+                    *p ++ == 'i' &&
+                    *p ++ == 'l') {
+                    return 2021;
+                }
+                return r;
+            case 'y':
+                return 2025;
+            }
+            return r;
+        case 'e':
+            r = 2029;
+            if (*p ++ == 'v' &&
+                *p ++ == 'e' &&
+                *p ++ == 'r' &&
+                *p ++ == 's' &&
+                *p ++ == 'e') {
+                switch (*p ++) {
+                case 'E':
+                    switch (*p ++) {
+                    case 'l':
+                        if (*p ++ == 'e' &&
+                            *p ++ == 'm' &&
+                            *p ++ == 'e' &&
+                            *p ++ == 'n' &&
+                            *p ++ == 't') {
+                            return 2034;
+                        }
+                        return r;
+                    case 'q':
+                        if (*p ++ == 'u' &&
+                            *p ++ == 'i' &&
+                            *p ++ == 'l' &&
+                            *p ++ == 'i' &&
+                            *p ++ == 'b' &&
+                            *p ++ == 'r' &&
+                            *p ++ == 'i' &&
+                            *p ++ == 'u' &&
+                            *p ++ == 'm') {
+                            return 2039;
+                        }
+                        return r;
+                    }
+                    return r;
+                case 'U':
+                    if (*p ++ == 'p' &&
+                        *p ++ == 'E' &&
+                        *p ++ == 'q' &&
+                        *p ++ == 'u' &&
+                        *p ++ == 'i' &&
+                        *p ++ == 'l' &&
+                        *p ++ == 'i' &&
+                        *p ++ == 'b' &&
+                        *p ++ == 'r' &&
+                        *p ++ == 'i' &&
+                        *p ++ == 'u' &&
+                        *p ++ == 'm') {
+                        return 2044;
+                    }
+                    return r;
+                }
+                return r;
+            }
+            return r;
+        case 'f':
+            if (*p ++ == 'r') {
+                return 2049;
+            }
+            return r;
+        case 'h':
+            if (*p ++ == 'o') {
+                return 2054;
+            }
+            return r;
+        case 'i':
+            if (*p ++ == 'g' &&
+                *p ++ == 'h' &&
+                *p ++ == 't') {
+                switch (*p ++) {
+                case 'A':
+                    switch (*p ++) {
+                    case 'n':
+                        if (*p ++ == 'g' &&
+                            *p ++ == 'l' &&
+                            *p ++ == 'e' &&
+                            *p ++ == 'B' &&
+                            *p ++ == 'r' &&
+                            *p ++ == 'a' &&
+                            *p ++ == 'c' &&
+                            *p ++ == 'k' &&
+                            *p ++ == 'e' &&
+                            *p ++ == 't') {
+                            return 2058;
+                        }
+                        return r;
+                    case 'r':
+                        if (*p ++ == 'r' &&
+                            *p ++ == 'o' &&
+                            *p ++ == 'w') {
+                            r = 2063;
+                            switch (*p ++) {
+                            case 'B':
+                                if (*p ++ == 'a' &&
+                                    *p ++ == 'r') {
+                                    return 2068;
+                                }
+                                return r;
+                            case 'L':
+                                if (*p ++ == 'e' &&
+                                    *p ++ == 'f' &&
+                                    *p ++ == 't' &&
+                                    *p ++ == 'A' &&
+                                    *p ++ == 'r' &&
+                                    *p ++ == 'r' &&
+                                    *p ++ == 'o' &&
+                                    *p ++ == 'w') {
+                                    return 2073;
+                                }
+                                return r;
+                            }
+                            return r;
+                        }
+                        return r;
+                    }
+                    return r;
+                case 'C':
+                    if (*p ++ == 'e' &&
+                        *p ++ == 'i' &&
+                        *p ++ == 'l' &&
+                        *p ++ == 'i' &&
+                        *p ++ == 'n' &&
+                        *p ++ == 'g') {
+                        return 2078;
+                    }
+                    return r;
+                case 'D':
+                    if (*p ++ == 'o') {
+                        switch (*p ++) {
+                        case 'u':
+                            if (*p ++ == 'b' &&
+                                *p ++ == 'l' &&
+                                *p ++ == 'e' &&
+                                *p ++ == 'B' &&
+                                *p ++ == 'r' &&
+                                *p ++ == 'a' &&
+                                *p ++ == 'c' &&
+                                *p ++ == 'k' &&
+                                *p ++ == 'e' &&
+                                *p ++ == 't') {
+                                return 2083;
+                            }
+                            return r;
+                        case 'w':
+                            if (*p ++ == 'n') {
+                                switch (*p ++) {
+                                case 'T':
+                                    if (*p ++ == 'e' &&
+                                        *p ++ == 'e' &&
+                                        *p ++ == 'V' &&
+                                        *p ++ == 'e' &&
+                                        *p ++ == 'c' &&
+                                        *p ++ == 't' &&
+                                        *p ++ == 'o' &&
+                                        *p ++ == 'r') {
+                                        return 2088;
+                                    }
+                                    return r;
+                                case 'V':
+                                    if (*p ++ == 'e' &&
+                                        *p ++ == 'c' &&
+                                        *p ++ == 't' &&
+                                        *p ++ == 'o' &&
+                                        *p ++ == 'r') {
+                                        r = 2093;
+                                        if (*p ++ == 'B' &&
+                                            *p ++ == 'a' &&
+                                            *p ++ == 'r') {
+                                            return 2098;
+                                        }
+                                        return r;
+                                    }
+                                    return r;
+                                }
+                                return r;
+                            }
+                            return r;
+                        }
+                        return r;
+                    }
+                    return r;
+                case 'F':
+                    if (*p ++ == 'l' &&
+                        *p ++ == 'o' &&
+                        *p ++ == 'o' &&
+                        *p ++ == 'r') {
+                        return 2103;
+                    }
+                    return r;
+                case 'T':
+                    switch (*p ++) {
+                    case 'e':
+                        if (*p ++ == 'e') {
+                            r = 2108;
+                            switch (*p ++) {
+                            case 'A':
+                                if (*p ++ == 'r' &&
+                                    *p ++ == 'r' &&
+                                    *p ++ == 'o' &&
+                                    *p ++ == 'w') {
+                                    return 2113;
+                                }
+                                return r;
+                            case 'V':
+                                if (*p ++ == 'e' &&
+                                    *p ++ == 'c' &&
+                                    *p ++ == 't' &&
+                                    *p ++ == 'o' &&
+                                    *p ++ == 'r') {
+                                    return 2118;
+                                }
+                                return r;
+                            }
+                            return r;
+                        }
+                        return r;
+                    case 'r':
+                        if (*p ++ == 'i' &&
+                            *p ++ == 'a' &&
+                            *p ++ == 'n' &&
+                            *p ++ == 'g' &&
+                            *p ++ == 'l' &&
+                            *p ++ == 'e') {
+                            r = 2123;
+                            switch (*p ++) {
+                            case 'B':
+                                if (*p ++ == 'a' &&
+                                    *p ++ == 'r') {
+                                    return 2128;
+                                }
+                                return r;
+                            case 'E':
+                                if (*p ++ == 'q' &&
+                                    *p ++ == 'u' &&
+                                    *p ++ == 'a' &&
+                                    *p ++ == 'l') {
+                                    return 2133;
+                                }
+                                return r;
+                            }
+                            return r;
+                        }
+                        return r;
+                    }
+                    return r;
+                case 'U':
+                    if (*p ++ == 'p') {
+                        switch (*p ++) {
+                        case 'D':
+                            if (*p ++ == 'o' &&
+                                *p ++ == 'w' &&
+                                *p ++ == 'n' &&
+                                *p ++ == 'V' &&
+                                *p ++ == 'e' &&
+                                *p ++ == 'c' &&
+                                *p ++ == 't' &&
+                                *p ++ == 'o' &&
+                                *p ++ == 'r') {
+                                return 2138;
+                            }
+                            return r;
+                        case 'T':
+                            if (*p ++ == 'e' &&
+                                *p ++ == 'e' &&
+                                *p ++ == 'V' &&
+                                *p ++ == 'e' &&
+                                *p ++ == 'c' &&
+                                *p ++ == 't' &&
+                                *p ++ == 'o' &&
+                                *p ++ == 'r') {
+                                return 2143;
+                            }
+                            return r;
+                        case 'V':
+                            if (*p ++ == 'e' &&
+                                *p ++ == 'c' &&
+                                *p ++ == 't' &&
+                                *p ++ == 'o' &&
+                                *p ++ == 'r') {
+                                r = 2148;
+                                if (*p ++ == 'B' &&
+                                    *p ++ == 'a' &&
+                                    *p ++ == 'r') {
+                                    return 2153;
+                                }
+                                return r;
+                            }
+                            return r;
+                        }
+                        return r;
+                    }
+                    return r;
+                case 'V':
+                    if (*p ++ == 'e' &&
+                        *p ++ == 'c' &&
+                        *p ++ == 't' &&
+                        *p ++ == 'o' &&
+                        *p ++ == 'r') {
+                        r = 2158;
+                        if (*p ++ == 'B' &&
+                            *p ++ == 'a' &&
+                            *p ++ == 'r') {
+                            return 2163;
+                        }
+                        return r;
+                    }
+                    return r;
+                case 'a':
+                    if (*p ++ == 'r' &&
+                        *p ++ == 'r' &&
+                        *p ++ == 'o' &&
+                        *p ++ == 'w') {
+                        return 2168;
+                    }
+                    return r;
+                }
+                return r;
+            }
+            return r;
+        case 'o':
+            switch (*p ++) {
+            case 'p':
+                if (*p ++ == 'f') {
+                    return 2173;
+                }
+                return r;
+            case 'u':
+                if (*p ++ == 'n' &&
+                    *p ++ == 'd' &&
+                    *p ++ == 'I' &&
+                    *p ++ == 'm' &&
+                    *p ++ == 'p' &&
+                    *p ++ == 'l' &&
+                    *p ++ == 'i' &&
+                    *p ++ == 'e' &&
+                    *p ++ == 's') {
+                    return 2178;
+                }
+                return r;
+            }
+            return r;
+        case 'r':
+            if (*p ++ == 'i' &&
+                *p ++ == 'g' &&
+                *p ++ == 'h' &&
+                *p ++ == 't' &&
+                *p ++ == 'a' &&
+                *p ++ == 'r' &&
+                *p ++ == 'r' &&
+                *p ++ == 'o' &&
+                *p ++ == 'w') {
+                return 2183;
+            }
+            return r;
+        case 's':
+            switch (*p ++) {
+            case 'c':
+                if (*p ++ == 'r') {
+                    return 2188;
+                }
+                return r;
+            case 'h':
+                return 2193;
+            }
+            return r;
+        case 'u':
+            if (*p ++ == 'l' &&
+                *p ++ == 'e' &&
+                *p ++ == 'D' &&
+                *p ++ == 'e' &&
+                *p ++ == 'l' &&
+                *p ++ == 'a' &&
+                *p ++ == 'y' &&
+                *p ++ == 'e' &&
+                *p ++ == 'd') {
+                return 2198;
+            }
+            return r;
+        }
+        return r;
+    case 'S':
+        switch (*p ++) {
+        case 'H':
+            switch (*p ++) {
+            case 'C':
+                if (*p ++ == 'H' &&
+                    *p ++ == 'c' &&
+                    *p ++ == 'y') {
+                    return 2203;
+                }
+                return r;
+            case 'c':
+                if (*p ++ == 'y') {
+                    return 2207;
+                }
+                return r;
+            }
+            return r;
+        case 'O':
+            if (*p ++ == 'F' &&
+                *p ++ == 'T' &&
+                *p ++ == 'c' &&
+                *p ++ == 'y') {
+                return 2211;
+            }
+            return r;
+        case 'a':
+            if (*p ++ == 'c' &&
+                *p ++ == 'u' &&
+                *p ++ == 't' &&
+                *p ++ == 'e') {
+                return 2215;
+            }
+            return r;
+        case 'c':
+            r = 2219;
+            switch (*p ++) {
+            case 'a':
+                if (*p ++ == 'r' &&
+                    *p ++ == 'o' &&
+                    *p ++ == 'n') {
+                    return 2224;
+                }
+                return r;
+            case 'e':
+                if (*p ++ == 'd' &&
+                    *p ++ == 'i' &&
+                    *p ++ == 'l') {
+                    return 2228;
+                }
+                return r;
+            case 'i':
+                if (*p ++ == 'r' &&
+                    *p ++ == 'c') {
+                    return 2232;
+                }
+                return r;
+            case 'y':
+                return 2236;
+            }
+            return r;
+        case 'f':
+            if (*p ++ == 'r') {
+                return 2240;
+            }
+            return r;
+        case 'h':
+            if (*p ++ == 'o' &&
+                *p ++ == 'r' &&
+                *p ++ == 't') {
+                switch (*p ++) {
+                case 'D':
+                    if (*p ++ == 'o' &&
+                        *p ++ == 'w' &&
+                        *p ++ == 'n' &&
+                        *p ++ == 'A' &&
+                        *p ++ == 'r' &&
+                        *p ++ == 'r' &&
+                        *p ++ == 'o' &&
+                        *p ++ == 'w') {
+                        return 2246;
+                    }
+                    return r;
+                case 'L':
+                    if (*p ++ == 'e' &&
+                        *p ++ == 'f' &&
+                        *p ++ == 't' &&
+                        *p ++ == 'A' &&
+                        *p ++ == 'r' &&
+                        *p ++ == 'r' &&
+                        *p ++ == 'o' &&
+                        *p ++ == 'w') {
+                        return 2251;
+                    }
+                    return r;
+                case 'R':
+                    if (*p ++ == 'i' &&
+                        *p ++ == 'g' &&
+                        *p ++ == 'h' &&
+                        *p ++ == 't' &&
+                        *p ++ == 'A' &&
+                        *p ++ == 'r' &&
+                        *p ++ == 'r' &&
+                        *p ++ == 'o' &&
+                        *p ++ == 'w') {
+                        return 2256;
+                    }
+                    return r;
+                case 'U':
+                    if (*p ++ == 'p' &&
+                        *p ++ == 'A' &&
+                        *p ++ == 'r' &&
+                        *p ++ == 'r' &&
+                        *p ++ == 'o' &&
+                        *p ++ == 'w') {
+                        return 2261;
+                    }
+                    return r;
+                }
+                return r;
+            }
+            return r;
+        case 'i':
+            if (*p ++ == 'g' &&
+                *p ++ == 'm' &&
+                *p ++ == 'a') {
+                return 2266;
+            }
+            return r;
+        case 'm':
+            if (*p ++ == 'a' &&
+                *p ++ == 'l' &&
+                *p ++ == 'l' &&
+                *p ++ == 'C' &&
+                *p ++ == 'i' &&
+                *p ++ == 'r' &&
+                *p ++ == 'c' &&
+                *p ++ == 'l' &&
+                *p ++ == 'e') {
+                return 2270;
+            }
+            return r;
+        case 'o':
+            if (*p ++ == 'p' &&
+                *p ++ == 'f') {
+                return 2275;
+            }
+            return r;
+        case 'q':
+            switch (*p ++) {
+            case 'r':
+                if (*p ++ == 't') {
+                    return 2281;
+                }
+                return r;
+            case 'u':
+                if (*p ++ == 'a' &&
+                    *p ++ == 'r' &&
+                    *p ++ == 'e') {
+                    r = 2286;
+                    switch (*p ++) {
+                    case 'I':
+                        if (*p ++ == 'n' &&
+                            *p ++ == 't' &&
+                            *p ++ == 'e' &&
+                            *p ++ == 'r' &&
+                            *p ++ == 's' &&
+                            *p ++ == 'e' &&
+                            *p ++ == 'c' &&
+                            *p ++ == 't' &&
+                            *p ++ == 'i' &&
+                            *p ++ == 'o' &&
+                            *p ++ == 'n') {
+                            return 2291;
+                        }
+                        return r;
+                    case 'S':
+                        if (*p ++ == 'u') {
+                            switch (*p ++) {
+                            case 'b':
+                                if (*p ++ == 's' &&
+                                    *p ++ == 'e' &&
+                                    *p ++ == 't') {
+                                    r = 2296;
+                                    if (*p ++ == 'E' &&
+                                        *p ++ == 'q' &&
+                                        *p ++ == 'u' &&
+                                        *p ++ == 'a' &&
+                                        *p ++ == 'l') {
+                                        return 2301;
+                                    }
+                                    return r;
+                                }
+                                return r;
+                            case 'p':
+                                if (*p ++ == 'e' &&
+                                    *p ++ == 'r' &&
+                                    *p ++ == 's' &&
+                                    *p ++ == 'e' &&
+                                    *p ++ == 't') {
+                                    r = 2306;
+                                    if (*p ++ == 'E' &&
+                                        *p ++ == 'q' &&
+                                        *p ++ == 'u' &&
+                                        *p ++ == 'a' &&
+                                        *p ++ == 'l') {
+                                        return 2311;
+                                    }
+                                    return r;
+                                }
+                                return r;
+                            }
+                            return r;
+                        }
+                        return r;
+                    case 'U':
+                        if (*p ++ == 'n' &&
+                            *p ++ == 'i' &&
+                            *p ++ == 'o' &&
+                            *p ++ == 'n') {
+                            return 2316;
+                        }
+                        return r;
+                    }
+                    return r;
+                }
+                return r;
+            }
+            return r;
+        case 's':
+            if (*p ++ == 'c' &&
+                *p ++ == 'r') {
+                return 2321;
+            }
+            return r;
+        case 't':
+            if (*p ++ == 'a' &&
+                *p ++ == 'r') {
+                return 2327;
+            }
+            return r;
+        case 'u':
+            switch (*p ++) {
+            case 'b':
+                r = 2332;
+                if (*p ++ == 's' &&
+                    *p ++ == 'e' &&
+                    *p ++ == 't') {
+                    r = 2337;
+                    if (*p ++ == 'E' &&
+                        *p ++ == 'q' &&
+                        *p ++ == 'u' &&
+                        *p ++ == 'a' &&
+                        *p ++ == 'l') {
+                        return 2342;
+                    }
+                    return r;
+                }
+                return r;
+            case 'c':
+                switch (*p ++) {
+                case 'c':
+                    if (*p ++ == 'e' &&
+                        *p ++ == 'e' &&
+                        *p ++ == 'd' &&
+                        *p ++ == 's') {
+                        r = 2347;
+                        switch (*p ++) {
+                        case 'E':
+                            if (*p ++ == 'q' &&
+                                *p ++ == 'u' &&
+                                *p ++ == 'a' &&
+                                *p ++ == 'l') {
+                                return 2352;
+                            }
+                            return r;
+                        case 'S':
+                            if (*p ++ == 'l' &&
+                                *p ++ == 'a' &&
+                                *p ++ == 'n' &&
+                                *p ++ == 't' &&
+                                *p ++ == 'E' &&
+                                *p ++ == 'q' &&
+                                *p ++ == 'u' &&
+                                *p ++ == 'a' &&
+                                *p ++ == 'l') {
+                                return 2357;
+                            }
+                            return r;
+                        case 'T':
+                            if (*p ++ == 'i' &&
+                                *p ++ == 'l' &&
+                                *p ++ == 'd' &&
+                                *p ++ == 'e') {
+                                return 2362;
+                            }
+                            return r;
+                        }
+                        return r;
+                    }
+                    return r;
+                case 'h':
+                    if (*p ++ == 'T' &&
+                        *p ++ == 'h' &&
+                        *p ++ == 'a' &&
+                        *p ++ == 't') {
+                        return 2367;
+                    }
+                    return r;
+                }
+                return r;
+            case 'm':
+                return 2372;
+            case 'p':
+                r = 2377;
+                switch (*p ++) {
+                case 'e':
+                    if (*p ++ == 'r' &&
+                        *p ++ == 's' &&
+                        *p ++ == 'e' &&
+                        *p ++ == 't') {
+                        r = 2382;
+                        if (*p ++ == 'E' &&
+                            *p ++ == 'q' &&
+                            *p ++ == 'u' &&
+                            *p ++ == 'a' &&
+                            *p ++ == 'l') {
+                            return 2387;
+                        }
+                        return r;
+                    }
+                    return r;
+                case 's':
+                    if (*p ++ == 'e' &&
+                        *p ++ == 't') {
+                        return 2392;
+                    }
+                    return r;
+                }
+                return r;
+            }
+            return r;
+        }
+        return r;
+    case 'T':
+        switch (*p ++) {
+        case 'H':
+            if (*p ++ == 'O' &&
+                *p ++ == 'R' &&
+                *p ++ == 'N') {
+                return 2397;
+            }
+            return r;
+        case 'R':
+            if (*p ++ == 'A' &&
+                *p ++ == 'D' &&
+                *p ++ == 'E') {
+                return 2401;
+            }
+            return r;
+        case 'S':
+            switch (*p ++) {
+            case 'H':
+                if (*p ++ == 'c' &&
+                    *p ++ == 'y') {
+                    return 2406;
+                }
+                return r;
+            case 'c':
+                if (*p ++ == 'y') {
+                    return 2410;
+                }
+                return r;
+            }
+            return r;
+        case 'a':
+            switch (*p ++) {
+            case 'b':
+                return 2414;
+            case 'u':
+                return 2417;
+            }
+            return r;
+        case 'c':
+            switch (*p ++) {
+            case 'a':
+                if (*p ++ == 'r' &&
+                    *p ++ == 'o' &&
+                    *p ++ == 'n') {
+                    return 2421;
+                }
+                return r;
+            case 'e':
+                if (*p ++ == 'd' &&
+                    *p ++ == 'i' &&
+                    *p ++ == 'l') {
+                    return 2425;
+                }
+                return r;
+            case 'y':
+                return 2429;
+            }
+            return r;
+        case 'f':
+            if (*p ++ == 'r') {
+                return 2433;
+            }
+            return r;
+        case 'h':
+            switch (*p ++) {
+            case 'e':
+                switch (*p ++) {
+                case 'r':
+                    if (*p ++ == 'e' &&
+                        *p ++ == 'f' &&
+                        *p ++ == 'o' &&
+                        *p ++ == 'r' &&
+                        *p ++ == 'e') {
+                        return 2439;
+                    }
+                    return r;
+                case 't':
+                    if (*p ++ == 'a') {
+                        return 2444;
+                    }
+                    return r;
+                }
+                return r;
+            case 'i':
+                switch (*p ++) {
+                case 'c':
+                    if (*p ++ == 'k' &&
+                        *p ++ == 'S' &&
+                        *p ++ == 'p' &&
+                        *p ++ == 'a' &&
+                        *p ++ == 'c' &&
+                        *p ++ == 'e') {
+                        return 2448;
+                    }
+                    return r;
+                case 'n':
+                    if (*p ++ == 'S' &&
+                        *p ++ == 'p' &&
+                        *p ++ == 'a' &&
+                        *p ++ == 'c' &&
+                        *p ++ == 'e') {
+                        return 2456;
+                    }
+                    return r;
+                }
+                return r;
+            }
+            return r;
+        case 'i':
+            if (*p ++ == 'l' &&
+                *p ++ == 'd' &&
+                *p ++ == 'e') {
+                r = 2461;
+                switch (*p ++) {
+                case 'E':
+                    if (*p ++ == 'q' &&
+                        *p ++ == 'u' &&
+                        *p ++ == 'a' &&
+                        *p ++ == 'l') {
+                        return 2466;
+                    }
+                    return r;
+                case 'F':
+                    if (*p ++ == 'u' &&
+                        *p ++ == 'l' &&
+                        *p ++ == 'l' &&
+                        *p ++ == 'E' &&
+                        *p ++ == 'q' &&
+                        *p ++ == 'u' &&
+                        *p ++ == 'a' &&
+                        *p ++ == 'l') {
+                        return 2471;
+                    }
+                    return r;
+                case 'T':
+                    if (*p ++ == 'i' &&
+                        *p ++ == 'l' &&
+                        *p ++ == 'd' &&
+                        *p ++ == 'e') {
+                        return 2476;
+                    }
+                    return r;
+                }
+                return r;
+            }
+            return r;
+        case 'o':
+            if (*p ++ == 'p' &&
+                *p ++ == 'f') {
+                return 2481;
+            }
+            return r;
+        case 'r':
+            if (*p ++ == 'i' &&
+                *p ++ == 'p' &&
+                *p ++ == 'l' &&
+                *p ++ == 'e' &&
+                *p ++ == 'D' &&
+                *p ++ == 'o' &&
+                *p ++ == 't') {
+                return 2487;
+            }
+            return r;
+        case 's':
+            switch (*p ++) {
+            case 'c':
+                if (*p ++ == 'r') {
+                    return 2492;
+                }
+                return r;
+            case 't':
+                if (*p ++ == 'r' &&
+                    *p ++ == 'o' &&
+                    *p ++ == 'k') {
+                    return 2498;
+                }
+                return r;
+            }
+            return r;
+        }
+        return r;
+    case 'U':
+        switch (*p ++) {
+        case 'a':
+            switch (*p ++) {
+            case 'c':
+                if (*p ++ == 'u' &&
+                    *p ++ == 't' &&
+                    *p ++ == 'e') {
+                    return 2502;
+                }
+                return r;
+            case 'r':
+                if (*p ++ == 'r') {
+                    r = 2506;
+                    if (*p ++ == 'o' &&
+                        *p ++ == 'c' &&
+                        *p ++ == 'i' &&
+                        *p ++ == 'r') {
+                        return 2511;
+                    }
+                    return r;
+                }
+                return r;
+            }
+            return r;
+        case 'b':
+            if (*p ++ == 'r') {
+                switch (*p ++) {
+                case 'c':
+                    if (*p ++ == 'y') {
+                        return 2516;
+                    }
+                    return r;
+                case 'e':
+                    if (*p ++ == 'v' &&
+                        *p ++ == 'e') {
+                        return 2520;
+                    }
+                    return r;
+                }
+                return r;
+            }
+            return r;
+        case 'c':
+            switch (*p ++) {
+            case 'i':
+                if (*p ++ == 'r' &&
+                    *p ++ == 'c') {
+                    return 2524;
+                }
+                return r;
+            case 'y':
+                return 2528;
+            }
+            return r;
+        case 'd':
+            if (*p ++ == 'b' &&
+                *p ++ == 'l' &&
+                *p ++ == 'a' &&
+                *p ++ == 'c') {
+                return 2532;
+            }
+            return r;
+        case 'f':
+            if (*p ++ == 'r') {
+                return 2536;
+            }
+            return r;
+        case 'g':
+            if (*p ++ == 'r' &&
+                *p ++ == 'a' &&
+                *p ++ == 'v' &&
+                *p ++ == 'e') {
+                return 2542;
+            }
+            return r;
+        case 'm':
+            if (*p ++ == 'a' &&
+                *p ++ == 'c' &&
+                *p ++ == 'r') {
+                return 2546;
+            }
+            return r;
+        case 'n':
+            switch (*p ++) {
+            case 'd':
+                if (*p ++ == 'e' &&
+                    *p ++ == 'r') {
+                    switch (*p ++) {
+                    case 'B':
+                        switch (*p ++) {
+                        case 'a':
+                            if (*p ++ == 'r') {
+                                return 2550;
+                            }
+                            return r;
+                        case 'r':
+                            if (*p ++ == 'a' &&
+                                *p ++ == 'c') {
+                                switch (*p ++) {
+                                case 'e':
+                                    return 2553;
+                                case 'k':
+                                    if (*p ++ == 'e' &&
+                                        *p ++ == 't') {
+                                        return 2558;
+                                    }
+                                    return r;
+                                }
+                                return r;
+                            }
+                            return r;
+                        }
+                        return r;
+                    case 'P':
+                        if (*p ++ == 'a' &&
+                            *p ++ == 'r' &&
+                            *p ++ == 'e' &&
+                            *p ++ == 'n' &&
+                            *p ++ == 't' &&
+                            *p ++ == 'h' &&
+                            *p ++ == 'e' &&
+                            *p ++ == 's' &&
+                            *p ++ == 'i' &&
+                            *p ++ == 's') {
+                            return 2563;
+                        }
+                        return r;
+                    }
+                    return r;
+                }
+                return r;
+            case 'i':
+                if (*p ++ == 'o' &&
+                    *p ++ == 'n') {
+                    r = 2568;
+                    if (*p ++ == 'P' &&
+                        *p ++ == 'l' &&
+                        *p ++ == 'u' &&
+                        *p ++ == 's') {
+                        return 2573;
+                    }
+                    return r;
+                }
+                return r;
+            }
+            return r;
+        case 'o':
+            switch (*p ++) {
+            case 'g':
+                if (*p ++ == 'o' &&
+                    *p ++ == 'n') {
+                    return 2578;
+                }
+                return r;
+            case 'p':
+                if (*p ++ == 'f') {
+                    return 2582;
+                }
+                return r;
+            }
+            return r;
+        case 'p':
+            switch (*p ++) {
+            case 'A':
+                if (*p ++ == 'r' &&
+                    *p ++ == 'r' &&
+                    *p ++ == 'o' &&
+                    *p ++ == 'w') {
+                    r = 2588;
+                    switch (*p ++) {
+                    case 'B':
+                        if (*p ++ == 'a' &&
+                            *p ++ == 'r') {
+                            return 2593;
+                        }
+                        return r;
+                    case 'D':
+                        if (*p ++ == 'o' &&
+                            *p ++ == 'w' &&
+                            *p ++ == 'n' &&
+                            *p ++ == 'A' &&
+                            *p ++ == 'r' &&
+                            *p ++ == 'r' &&
+                            *p ++ == 'o' &&
+                            *p ++ == 'w') {
+                            return 2598;
+                        }
+                        return r;
+                    }
+                    return r;
+                }
+                return r;
+            case 'D':
+                if (*p ++ == 'o' &&
+                    *p ++ == 'w' &&
+                    *p ++ == 'n' &&
+                    *p ++ == 'A' &&
+                    *p ++ == 'r' &&
+                    *p ++ == 'r' &&
+                    *p ++ == 'o' &&
+                    *p ++ == 'w') {
+                    return 2603;
+                }
+                return r;
+            case 'E':
+                if (*p ++ == 'q' &&
+                    *p ++ == 'u' &&
+                    *p ++ == 'i' &&
+                    *p ++ == 'l' &&
+                    *p ++ == 'i' &&
+                    *p ++ == 'b' &&
+                    *p ++ == 'r' &&
+                    *p ++ == 'i' &&
+                    *p ++ == 'u' &&
+                    *p ++ == 'm') {
+                    return 2608;
+                }
+                return r;
+            case 'T':
+                if (*p ++ == 'e' &&
+                    *p ++ == 'e') {
+                    r = 2613;
+                    if (*p ++ == 'A' &&
+                        *p ++ == 'r' &&
+                        *p ++ == 'r' &&
+                        *p ++ == 'o' &&
+                        *p ++ == 'w') {
+                        return 2618;
+                    }
+                    return r;
+                }
+                return r;
+            case 'a':
+                if (*p ++ == 'r' &&
+                    *p ++ == 'r' &&
+                    *p ++ == 'o' &&
+                    *p ++ == 'w') {
+                    return 2623;
+                }
+                return r;
+            case 'd':
+                if (*p ++ == 'o' &&
+                    *p ++ == 'w' &&
+                    *p ++ == 'n' &&
+                    *p ++ == 'a' &&
+                    *p ++ == 'r' &&
+                    *p ++ == 'r' &&
+                    *p ++ == 'o' &&
+                    *p ++ == 'w') {
+                    return 2628;
+                }
+                return r;
+            case 'p':
+                if (*p ++ == 'e' &&
+                    *p ++ == 'r') {
+                    switch (*p ++) {
+                    case 'L':
+                        if (*p ++ == 'e' &&
+                            *p ++ == 'f' &&
+                            *p ++ == 't' &&
+                            *p ++ == 'A' &&
+                            *p ++ == 'r' &&
+                            *p ++ == 'r' &&
+                            *p ++ == 'o' &&
+                            *p ++ == 'w') {
+                            return 2633;
+                        }
+                        return r;
+                    case 'R':
+                        if (*p ++ == 'i' &&
+                            *p ++ == 'g' &&
+                            *p ++ == 'h' &&
+                            *p ++ == 't' &&
+                            *p ++ == 'A' &&
+                            *p ++ == 'r' &&
+                            *p ++ == 'r' &&
+                            *p ++ == 'o' &&
+                            *p ++ == 'w') {
+                            return 2638;
+                        }
+                        return r;
+                    }
+                    return r;
+                }
+                return r;
+            case 's':
+                if (*p ++ == 'i') {
+                    r = 2643;
+                    if (*p ++ == 'l' &&
+                        *p ++ == 'o' &&
+                        *p ++ == 'n') {
+                        return 2647;
+                    }
+                    return r;
+                }
+                return r;
+            }
+            return r;
+        case 'r':
+            if (*p ++ == 'i' &&
+                *p ++ == 'n' &&
+                *p ++ == 'g') {
+                return 2651;
+            }
+            return r;
+        case 's':
+            if (*p ++ == 'c' &&
+                *p ++ == 'r') {
+                return 2655;
+            }
+            return r;
+        case 't':
+            if (*p ++ == 'i' &&
+                *p ++ == 'l' &&
+                *p ++ == 'd' &&
+                *p ++ == 'e') {
+                return 2661;
+            }
+            return r;
+        case 'u':
+            if (*p ++ == 'm' &&
+                *p ++ == 'l') {
+                return 2665;
+            }
+            return r;
+        }
+        return r;
+    case 'V':
+        switch (*p ++) {
+        case 'D':
+            if (*p ++ == 'a' &&
+                *p ++ == 's' &&
+                *p ++ == 'h') {
+                return 2669;
+            }
+            return r;
+        case 'b':
+            if (*p ++ == 'a' &&
+                *p ++ == 'r') {
+                return 2674;
+            }
+            return r;
+        case 'c':
+            if (*p ++ == 'y') {
+                return 2679;
+            }
+            return r;
+        case 'd':
+            if (*p ++ == 'a' &&
+                *p ++ == 's' &&
+                *p ++ == 'h') {
+                r = 2683;
+                if (*p ++ == 'l') {
+                    return 2688;
+                }
+                return r;
+            }
+            return r;
+        case 'e':
+            switch (*p ++) {
+            case 'e':
+                return 2693;
+            case 'r':
+                switch (*p ++) {
+                case 'b':
+                    if (*p ++ == 'a' &&
+                        *p ++ == 'r') {
+                        return 2698;
+                    }
+                    return r;
+                case 't':
+                    r = 2703;
+                    if (*p ++ == 'i' &&
+                        *p ++ == 'c' &&
+                        *p ++ == 'a' &&
+                        *p ++ == 'l') {
+                        switch (*p ++) {
+                        case 'B':
+                            if (*p ++ == 'a' &&
+                                *p ++ == 'r') {
+                                return 2708;
+                            }
+                            return r;
+                        case 'L':
+                            if (*p ++ == 'i' &&
+                                *p ++ == 'n' &&
+                                *p ++ == 'e') {
+                                return 2713;
+                            }
+                            return r;
+                        case 'S':
+                            if (*p ++ == 'e' &&
+                                *p ++ == 'p' &&
+                                *p ++ == 'a' &&
+                                *p ++ == 'r' &&
+                                *p ++ == 'a' &&
+                                *p ++ == 't' &&
+                                *p ++ == 'o' &&
+                                *p ++ == 'r') {
+                                return 2716;
+                            }
+                            return r;
+                        case 'T':
+                            if (*p ++ == 'i' &&
+                                *p ++ == 'l' &&
+                                *p ++ == 'd' &&
+                                *p ++ == 'e') {
+                                return 2721;
+                            }
+                            return r;
+                        }
+                        return r;
+                    }
+                    return r;
+                case 'y':
+                    if (*p ++ == 'T' &&
+                        *p ++ == 'h' &&
+                        *p ++ == 'i' &&
+                        *p ++ == 'n' &&
+                        *p ++ == 'S' &&
+                        *p ++ == 'p' &&
+                        *p ++ == 'a' &&
+                        *p ++ == 'c' &&
+                        *p ++ == 'e') {
+                        return 2726;
+                    }
+                    return r;
+                }
+                return r;
+            }
+            return r;
+        case 'f':
+            if (*p ++ == 'r') {
+                return 2731;
+            }
+            return r;
+        case 'o':
+            if (*p ++ == 'p' &&
+                *p ++ == 'f') {
+                return 2737;
+            }
+            return r;
+        case 's':
+            if (*p ++ == 'c' &&
+                *p ++ == 'r') {
+                return 2743;
+            }
+            return r;
+        case 'v':
+            if (*p ++ == 'd' &&
+                *p ++ == 'a' &&
+                *p ++ == 's' &&
+                *p ++ == 'h') {
+                return 2749;
+            }
+            return r;
+        }
+        return r;
+    case 'W':
+        switch (*p ++) {
+        case 'c':
+            if (*p ++ == 'i' &&
+                *p ++ == 'r' &&
+                *p ++ == 'c') {
+                return 2754;
+            }
+            return r;
+        case 'e':
+            if (*p ++ == 'd' &&
+                *p ++ == 'g' &&
+                *p ++ == 'e') {
+                return 2758;
+            }
+            return r;
+        case 'f':
+            if (*p ++ == 'r') {
+                return 2763;
+            }
+            return r;
+        case 'o':
+            if (*p ++ == 'p' &&
+                *p ++ == 'f') {
+                return 2769;
+            }
+            return r;
+        case 's':
+            if (*p ++ == 'c' &&
+                *p ++ == 'r') {
+                return 2775;
+            }
+            return r;
+        }
+        return r;
+    case 'X':
+        switch (*p ++) {
+        case 'f':
+            if (*p ++ == 'r') {
+                return 2781;
+            }
+            return r;
+        case 'i':
+            return 2787;
+        case 'o':
+            if (*p ++ == 'p' &&
+                *p ++ == 'f') {
+                return 2791;
+            }
+            return r;
+        case 's':
+            if (*p ++ == 'c' &&
+                *p ++ == 'r') {
+                return 2797;
+            }
+            return r;
+        }
+        return r;
+    case 'Y':
+        switch (*p ++) {
+        case 'A':
+            if (*p ++ == 'c' &&
+                *p ++ == 'y') {
+                return 2803;
+            }
+            return r;
+        case 'I':
+            if (*p ++ == 'c' &&
+                *p ++ == 'y') {
+                return 2807;
+            }
+            return r;
+        case 'U':
+            if (*p ++ == 'c' &&
+                *p ++ == 'y') {
+                return 2811;
+            }
+            return r;
+        case 'a':
+            if (*p ++ == 'c' &&
+                *p ++ == 'u' &&
+                *p ++ == 't' &&
+                *p ++ == 'e') {
+                return 2815;
+            }
+            return r;
+        case 'c':
+            switch (*p ++) {
+            case 'i':
+                if (*p ++ == 'r' &&
+                    *p ++ == 'c') {
+                    return 2819;
+                }
+                return r;
+            case 'y':
+                return 2823;
+            }
+            return r;
+        case 'f':
+            if (*p ++ == 'r') {
+                return 2827;
+            }
+            return r;
+        case 'o':
+            if (*p ++ == 'p' &&
+                *p ++ == 'f') {
+                return 2833;
+            }
+            return r;
+        case 's':
+            if (*p ++ == 'c' &&
+                *p ++ == 'r') {
+                return 2839;
+            }
+            return r;
+        case 'u':
+            if (*p ++ == 'm' &&
+                *p ++ == 'l') {
+                return 2845;
+            }
+            return r;
+        }
+        return r;
+    case 'Z':
+        switch (*p ++) {
+        case 'H':
+            if (*p ++ == 'c' &&
+                *p ++ == 'y') {
+                return 2849;
+            }
+            return r;
+        case 'a':
+            if (*p ++ == 'c' &&
+                *p ++ == 'u' &&
+                *p ++ == 't' &&
+                *p ++ == 'e') {
+                return 2853;
+            }
+            return r;
+        case 'c':
+            switch (*p ++) {
+            case 'a':
+                if (*p ++ == 'r' &&
+                    *p ++ == 'o' &&
+                    *p ++ == 'n') {
+                    return 2857;
+                }
+                return r;
+            case 'y':
+                return 2861;
+            }
+            return r;
+        case 'd':
+            if (*p ++ == 'o' &&
+                *p ++ == 't') {
+                return 2865;
+            }
+            return r;
+        case 'e':
+            switch (*p ++) {
+            case 'r':
+                if (*p ++ == 'o' &&
+                    *p ++ == 'W' &&
+                    *p ++ == 'i' &&
+                    *p ++ == 'd' &&
+                    *p ++ == 't' &&
+                    *p ++ == 'h' &&
+                    *p ++ == 'S' &&
+                    *p ++ == 'p' &&
+                    *p ++ == 'a' &&
+                    *p ++ == 'c' &&
+                    *p ++ == 'e') {
+                    return 2869;
+                }
+                return r;
+            case 't':
+                if (*p ++ == 'a') {
+                    return 2874;
+                }
+                return r;
+            }
+            return r;
+        case 'f':
+            if (*p ++ == 'r') {
+                return 2878;
+            }
+            return r;
+        case 'o':
+            if (*p ++ == 'p' &&
+                *p ++ == 'f') {
+                return 2883;
+            }
+            return r;
+        case 's':
+            if (*p ++ == 'c' &&
+                *p ++ == 'r') {
+                return 2888;
+            }
+            return r;
+        }
+        return r;
+    case 'j':
+        switch (*p ++) {
+        case 'c':
+            switch (*p ++) {
+            case 'i':
+                if (*p ++ == 'r' &&
+                    *p ++ == 'c') {
+                    return 5656;
+                }
+                return r;
+            case 'y':
+                return 5660;
+            }
+            return r;
+        case 'f':
+            if (*p ++ == 'r') {
+                return 5664;
+            }
+            return r;
+        case 'm':
+            if (*p ++ == 'a' &&
+                *p ++ == 't' &&
+                *p ++ == 'h') {
+                return 5670;
+            }
+            return r;
+        case 'o':
+            if (*p ++ == 'p' &&
+                *p ++ == 'f') {
+                return 5674;
+            }
+            return r;
+        case 's':
+            switch (*p ++) {
+            case 'c':
+                if (*p ++ == 'r') {
+                    return 5680;
+                }
+                return r;
+            case 'e':
+                if (*p ++ == 'r' &&
+                    *p ++ == 'c' &&
+                    *p ++ == 'y') {
+                    return 5686;
+                }
+                return r;
+            }
+            return r;
+        case 'u':
+            if (*p ++ == 'k' &&
+                *p ++ == 'c' &&
+                *p ++ == 'y') {
+                return 5690;
+            }
+            return r;
+        }
+        return r;
+    case 'k':
+        switch (*p ++) {
+        case 'a':
+            if (*p ++ == 'p' &&
+                *p ++ == 'p' &&
+                *p ++ == 'a') {
+                r = 5694;
+                if (*p ++ == 'v') {
+                    return 5698;
+                }
+                return r;
+            }
+            return r;
+        case 'c':
+            switch (*p ++) {
+            case 'e':
+                if (*p ++ == 'd' &&
+                    *p ++ == 'i' &&
+                    *p ++ == 'l') {
+                    return 5702;
+                }
+                return r;
+            case 'y':
+                return 5706;
+            }
+            return r;
+        case 'f':
+            if (*p ++ == 'r') {
+                return 5710;
+            }
+            return r;
+        case 'g':
+            if (*p ++ == 'r' &&
+                *p ++ == 'e' &&
+                *p ++ == 'e' &&
+                *p ++ == 'n') {
+                return 5716;
+            }
+            return r;
+        case 'h':
+            if (*p ++ == 'c' &&
+                *p ++ == 'y') {
+                return 5720;
+            }
+            return r;
+        case 'j':
+            if (*p ++ == 'c' &&
+                *p ++ == 'y') {
+                return 5724;
+            }
+            return r;
+        case 'o':
+            if (*p ++ == 'p' &&
+                *p ++ == 'f') {
+                return 5728;
+            }
+            return r;
+        case 's':
+            if (*p ++ == 'c' &&
+                *p ++ == 'r') {
+                return 5734;
+            }
+            return r;
+        }
+        return r;
+    case 'v':
+        switch (*p ++) {
+        case 'A':
+            if (*p ++ == 'r' &&
+                *p ++ == 'r') {
+                return 9944;
+            }
+            return r;
+        case 'B':
+            if (*p ++ == 'a' &&
+                *p ++ == 'r') {
+                r = 9949;
+                if (*p ++ == 'v') {
+                    return 9954;
+                }
+                return r;
+            }
+            return r;
+        case 'D':
+            if (*p ++ == 'a' &&
+                *p ++ == 's' &&
+                *p ++ == 'h') {
+                return 9959;
+            }
+            return r;
+        case 'a':
+            switch (*p ++) {
+            case 'n':
+                if (*p ++ == 'g' &&
+                    *p ++ == 'r' &&
+                    *p ++ == 't') {
+                    return 9964;
+                }
+                return r;
+            case 'r':
+                switch (*p ++) {
+                case 'e':
+                    if (*p ++ == 'p' &&
+                        *p ++ == 's' &&
+                        *p ++ == 'i' &&
+                        *p ++ == 'l' &&
+                        *p ++ == 'o' &&
+                        *p ++ == 'n') {
+                        return 9969;
+                    }
+                    return r;
+                case 'k':
+                    if (*p ++ == 'a' &&
+                        *p ++ == 'p' &&
+                        *p ++ == 'p' &&
+                        *p ++ == 'a') {
+                        return 9973;
+                    }
+                    return r;
+                case 'n':
+                    if (*p ++ == 'o' &&
+                        *p ++ == 't' &&
+                        *p ++ == 'h' &&
+                        *p ++ == 'i' &&
+                        *p ++ == 'n' &&
+                        *p ++ == 'g') {
+                        return 9977;
+                    }
+                    return r;
+                case 'p':
+                    switch (*p ++) {
+                    case 'h':
+                        if (*p ++ == 'i') {
+                            return 9982;
+                        }
+                        return r;
+                    case 'i':
+                        return 9986;
+                    case 'r':
+                        if (*p ++ == 'o' &&
+                            *p ++ == 'p' &&
+                            *p ++ == 't' &&
+                            *p ++ == 'o') {
+                            return 9990;
+                        }
+                        return r;
+                    }
+                    return r;
+                case 'r':
+                    r = 9995;
+                    if (*p ++ == 'h' &&
+                        *p ++ == 'o') {
+                        return 10000;
+                    }
+                    return r;
+                case 's':
+                    switch (*p ++) {
+                    case 'i':
+                        if (*p ++ == 'g' &&
+                            *p ++ == 'm' &&
+                            *p ++ == 'a') {
+                            return 10004;
+                        }
+                        return r;
+                    case 'u':
+                        switch (*p ++) {
+                        case 'b':
+                            if (*p ++ == 's' &&
+                                *p ++ == 'e' &&
+                                *p ++ == 't' &&
+                                *p ++ == 'n' &&
+                                *p ++ == 'e' &&
+                                *p ++ == 'q') {
+                                r = 10008;
+                                if (*p ++ == 'q') {
+                                    return 10016;
+                                }
+                                return r;
+                            }
+                            return r;
+                        case 'p':
+                            if (*p ++ == 's' &&
+                                *p ++ == 'e' &&
+                                *p ++ == 't' &&
+                                *p ++ == 'n' &&
+                                *p ++ == 'e' &&
+                                *p ++ == 'q') {
+                                r = 10024;
+                                if (*p ++ == 'q') {
+                                    return 10032;
+                                }
+                                return r;
+                            }
+                            return r;
+                        }
+                        return r;
+                    }
+                    return r;
+                case 't':
+                    switch (*p ++) {
+                    case 'h':
+                        if (*p ++ == 'e' &&
+                            *p ++ == 't' &&
+                            *p ++ == 'a') {
+                            return 10040;
+                        }
+                        return r;
+                    case 'r':
+                        if (*p ++ == 'i' &&
+                            *p ++ == 'a' &&
+                            *p ++ == 'n' &&
+                            *p ++ == 'g' &&
+                            *p ++ == 'l' &&
+                            *p ++ == 'e') {
+                            switch (*p ++) {
+                            case 'l':
+                                if (*p ++ == 'e' &&
+                                    *p ++ == 'f' &&
+                                    *p ++ == 't') {
+                                    return 10044;
+                                }
+                                return r;
+                            case 'r':
+                                if (*p ++ == 'i' &&
+                                    *p ++ == 'g' &&
+                                    *p ++ == 'h' &&
+                                    *p ++ == 't') {
+                                    return 10049;
+                                }
+                                return r;
+                            }
+                            return r;
+                        }
+                        return r;
+                    }
+                    return r;
+                }
+                return r;
+            }
+            return r;
+        case 'c':
+            if (*p ++ == 'y') {
+                return 10054;
+            }
+            return r;
+        case 'd':
+            if (*p ++ == 'a' &&
+                *p ++ == 's' &&
+                *p ++ == 'h') {
+                return 10058;
+            }
+            return r;
+        case 'e':
+            switch (*p ++) {
+            case 'e':
+                r = 10063;
+                switch (*p ++) {
+                case 'b':
+                    if (*p ++ == 'a' &&
+                        *p ++ == 'r') {
+                        return 10068;
+                    }
+                    return r;
+                case 'e':
+                    if (*p ++ == 'q') {
+                        return 10073;
+                    }
+                    return r;
+                }
+                return r;
+            case 'l':
+                if (*p ++ == 'l' &&
+                    *p ++ == 'i' &&
+                    *p ++ == 'p') {
+                    return 10078;
+                }
+                return r;
+            case 'r':
+                switch (*p ++) {
+                case 'b':
+                    if (*p ++ == 'a' &&
+                        *p ++ == 'r') {
+                        return 10083;
+                    }
+                    return r;
+                case 't':
+                    return 10086;
+                }
+                return r;
+            }
+            return r;
+        case 'f':
+            if (*p ++ == 'r') {
+                return 10089;
+            }
+            return r;
+        case 'l':
+            if (*p ++ == 't' &&
+                *p ++ == 'r' &&
+                *p ++ == 'i') {
+                return 10095;
+            }
+            return r;
+        case 'n':
+            if (*p ++ == 's' &&
+                *p ++ == 'u') {
+                switch (*p ++) {
+                case 'b':
+                    return 10100;
+                case 'p':
+                    return 10108;
+                }
+                return r;
+            }
+            return r;
+        case 'o':
+            if (*p ++ == 'p' &&
+                *p ++ == 'f') {
+                return 10116;
+            }
+            return r;
+        case 'p':
+            if (*p ++ == 'r' &&
+                *p ++ == 'o' &&
+                *p ++ == 'p') {
+                return 10122;
+            }
+            return r;
+        case 'r':
+            if (*p ++ == 't' &&
+                *p ++ == 'r' &&
+                *p ++ == 'i') {
+                return 10127;
+            }
+            return r;
+        case 's':
+            switch (*p ++) {
+            case 'c':
+                if (*p ++ == 'r') {
+                    return 10132;
+                }
+                return r;
+            case 'u':
+                switch (*p ++) {
+                case 'b':
+                    if (*p ++ == 'n') {
+                        switch (*p ++) {
+                        case 'E':
+                            return 10138;
+                        case 'e':
+                            return 10146;
+                        }
+                        return r;
+                    }
+                    return r;
+                case 'p':
+                    if (*p ++ == 'n') {
+                        switch (*p ++) {
+                        case 'E':
+                            return 10154;
+                        case 'e':
+                            return 10162;
+                        }
+                        return r;
+                    }
+                    return r;
+                }
+                return r;
+            }
+            return r;
+        case 'z':
+            if (*p ++ == 'i' &&
+                *p ++ == 'g' &&
+                *p ++ == 'z' &&
+                *p ++ == 'a' &&
+                *p ++ == 'g') {
+                return 10170;
+            }
+            return r;
+        }
+        return r;
+    case 'w':
+        switch (*p ++) {
+        case 'c':
+            if (*p ++ == 'i' &&
+                *p ++ == 'r' &&
+                *p ++ == 'c') {
+                return 10175;
+            }
+            return r;
+        case 'e':
+            switch (*p ++) {
+            case 'd':
+                switch (*p ++) {
+                case 'b':
+                    if (*p ++ == 'a' &&
+                        *p ++ == 'r') {
+                        return 10179;
+                    }
+                    return r;
+                case 'g':
+                    if (*p ++ == 'e') {
+                        r = 10184;
+                        if (*p ++ == 'q') {
+                            return 10189;
+                        }
+                        return r;
+                    }
+                    return r;
+                }
+                return r;
+            case 'i':
+                if (*p ++ == 'e' &&
+                    *p ++ == 'r' &&
+                    *p ++ == 'p') {
+                    return 10194;
+                }
+                return r;
+            }
+            return r;
+        case 'f':
+            if (*p ++ == 'r') {
+                return 10199;
+            }
+            return r;
+        case 'o':
+            if (*p ++ == 'p' &&
+                *p ++ == 'f') {
+                return 10205;
+            }
+            return r;
+        case 'p':
+            return 10211;
+        case 'r':
+            r = 10216;
+            if (*p ++ == 'e' &&
+                *p ++ == 'a' &&
+                *p ++ == 't' &&
+                *p ++ == 'h') {
+                return 10221;
+            }
+            return r;
+        case 's':
+            if (*p ++ == 'c' &&
+                *p ++ == 'r') {
+                return 10226;
+            }
+            return r;
+        }
+        return r;
+    case 'x':
+        switch (*p ++) {
+        case 'c':
+            switch (*p ++) {
+            case 'a':
+                if (*p ++ == 'p') {
+                    return 10232;
+                }
+                return r;
+            case 'i':
+                if (*p ++ == 'r' &&
+                    *p ++ == 'c') {
+                    return 10237;
+                }
+                return r;
+            case 'u':
+                if (*p ++ == 'p') {
+                    return 10242;
+                }
+                return r;
+            }
+            return r;
+        case 'd':
+            if (*p ++ == 't' &&
+                *p ++ == 'r' &&
+                *p ++ == 'i') {
+                return 10247;
+            }
+            return r;
+        case 'f':
+            if (*p ++ == 'r') {
+                return 10252;
+            }
+            return r;
+        case 'h':
+            switch (*p ++) {
+            case 'A':
+                if (*p ++ == 'r' &&
+                    *p ++ == 'r') {
+                    return 10258;
+                }
+                return r;
+            case 'a':
+                if (*p ++ == 'r' &&
+                    *p ++ == 'r') {
+                    return 10263;
+                }
+                return r;
+            }
+            return r;
+        case 'i':
+            return 10268;
+        case 'l':
+            switch (*p ++) {
+            case 'A':
+                if (*p ++ == 'r' &&
+                    *p ++ == 'r') {
+                    return 10272;
+                }
+                return r;
+            case 'a':
+                if (*p ++ == 'r' &&
+                    *p ++ == 'r') {
+                    return 10277;
+                }
+                return r;
+            }
+            return r;
+        case 'm':
+            if (*p ++ == 'a' &&
+                *p ++ == 'p') {
+                return 10282;
+            }
+            return r;
+        case 'n':
+            if (*p ++ == 'i' &&
+                *p ++ == 's') {
+                return 10287;
+            }
+            return r;
+        case 'o':
+            switch (*p ++) {
+            case 'd':
+                if (*p ++ == 'o' &&
+                    *p ++ == 't') {
+                    return 10292;
+                }
+                return r;
+            case 'p':
+                switch (*p ++) {
+                case 'f':
+                    return 10297;
+                case 'l':
+                    if (*p ++ == 'u' &&
+                        *p ++ == 's') {
+                        return 10303;
+                    }
+                    return r;
+                }
+                return r;
+            case 't':
+                if (*p ++ == 'i' &&
+                    *p ++ == 'm' &&
+                    *p ++ == 'e') {
+                    return 10308;
+                }
+                return r;
+            }
+            return r;
+        case 'r':
+            switch (*p ++) {
+            case 'A':
+                if (*p ++ == 'r' &&
+                    *p ++ == 'r') {
+                    return 10313;
+                }
+                return r;
+            case 'a':
+                if (*p ++ == 'r' &&
+                    *p ++ == 'r') {
+                    return 10318;
+                }
+                return r;
+            }
+            return r;
+        case 's':
+            switch (*p ++) {
+            case 'c':
+                if (*p ++ == 'r') {
+                    return 10323;
+                }
+                return r;
+            case 'q':
+                if (*p ++ == 'c' &&
+                    *p ++ == 'u' &&
+                    *p ++ == 'p') {
+                    return 10329;
+                }
+                return r;
+            }
+            return r;
+        case 'u':
+            switch (*p ++) {
+            case 'p':
+                if (*p ++ == 'l' &&
+                    *p ++ == 'u' &&
+                    *p ++ == 's') {
+                    return 10334;
+                }
+                return r;
+            case 't':
+                if (*p ++ == 'r' &&
+                    *p ++ == 'i') {
+                    return 10339;
+                }
+                return r;
+            }
+            return r;
+        case 'v':
+            if (*p ++ == 'e' &&
+                *p ++ == 'e') {
+                return 10344;
+            }
+            return r;
+        case 'w':
+            if (*p ++ == 'e' &&
+                *p ++ == 'd' &&
+                *p ++ == 'g' &&
+                *p ++ == 'e') {
+                return 10349;
+            }
+            return r;
+        }
+        return r;
+    }
+    return r;
+}
+
+HTML_CREF_FTRIE_HOT
+int html_cref_ftrie_parse(const char* p)
+{
+    int r = -1;
+
+    switch (*p ++) {
+    case 'a':
+        switch (__builtin_expect(*p ++, 'm')) {
+        case 'm':
+            switch (__builtin_expect(*p ++, 'p')) {
+            case 'p':
+                return 2973;
+            default:
+                return html_cref_ftrie_cold_1(p - 1, r);
+            }
+            return r;
+        case 'p':
+            r = 3100;
+            switch (__builtin_expect(*p ++, 'o')) {
+            case 'o':
+                if (__builtin_expect(*p ++ == 's', 1)) {
+                    return 3125;
+                }
+                return r;
+            default:
+                return html_cref_ftrie_cold_2(p - 1, r);
+            }
+            return r;
+        case 'a':
+            if (__builtin_expect(*p ++ == 'c' &&
+                *p ++ == 'u' &&
+                *p ++ == 't' &&
+                *p ++ == 'e', 1)) {
+                return 2894;
+            }
+            return r;
+        case 'u':
+            if (__builtin_expect(*p ++ == 'm' &&
+                *p ++ == 'l', 1)) {
+                return 3165;
+            }
+            return r;
+        case 'g':
+            if (__builtin_expect(*p ++ == 'r' &&
+                *p ++ == 'a' &&
+                *p ++ == 'v' &&
+                *p ++ == 'e', 1)) {
+                return 2946;
+            }
+            return r;
+        case 'c':
+            r = 2902;
+            switch (__builtin_expect(*p ++, 'i')) {
+            case 'i':
+                if (__builtin_expect(*p ++ == 'r' &&
+                    *p ++ == 'c', 1)) {
+                    return 2919;
+                }
+                return r;
+            default:
+                return html_cref_ftrie_cold_3(p - 1, r);
+            }
+            return r;
+        case 'l':
+            switch (__builtin_expect(*p ++, 'p')) {
+            case 'p':
+                if (__builtin_expect(*p ++ == 'h' &&
+                    *p ++ == 'a', 1)) {
+                    return 2960;
+                }
+                return r;
+            default:
+                return html_cref_ftrie_cold_4(p - 1, r);
+            }
+            return r;
+        default:
+            return html_cref_ftrie_cold_5(p - 1, r);
+        }
+        return r;
+    case 'n':
+        switch (__builtin_expect(*p ++, 'b')) {
+        case 'b':
+            switch (__builtin_expect(*p ++, 's')) {
+            case 's':
+                if (__builtin_expect(*p ++ == 'p', 1)) {
+                    return 6802;
+                }
+                return r;
+            default:
+                return html_cref_ftrie_cold_6(p - 1, r);
+            }
+            return r;
+        case 'd':
+            if (__builtin_expect(*p ++ == 'a' &&
+                *p ++ == 's' &&
+                *p ++ == 'h', 1)) {
+                return 6854;
+            }
+            return r;
+        case 't':
+            switch (__builtin_expect(*p ++, 'i')) {
+            case 'i':
+                if (__builtin_expect(*p ++ == 'l' &&
+                    *p ++ == 'd' &&
+                    *p ++ == 'e', 1)) {
+                    return 7430;
+                }
+                return r;
+            default:
+                return html_cref_ftrie_cold_7(p - 1, r);
+            }
+            return r;
+        case 'e':
+            r = 6859;
+            return html_cref_ftrie_cold_8(p, r);
+        default:
+            return html_cref_ftrie_cold_9(p - 1, r);
+        }
+        return r;
+    case 'q':
+        switch (__builtin_expect(*p ++, 'u')) {
+        case 'u':
+            switch (__builtin_expect(*p ++, 'o')) {
+            case 'o':
+                if (__builtin_expect(*p ++ == 't', 1)) {
+                    return 8205;
+                }
+                return r;
+            default:
+                return html_cref_ftrie_cold_10(p - 1, r);
+            }
+            return r;
+        default:
+            return html_cref_ftrie_cold_11(p - 1, r);
+        }
+        return r;
+    case 'l':
+        switch (__builtin_expect(*p ++, 't')) {
+        case 't':
+            r = 6408;
+            return html_cref_ftrie_cold_12(p, r);
+        case 'a':
+            switch (__builtin_expect(*p ++, 'q')) {
+            case 'q':
+                if (__builtin_expect(*p ++ == 'u' &&
+                    *p ++ == 'o', 1)) {
+                    return 5813;
+                }
+                return r;
+            case 'r':
+                if (__builtin_expect(*p ++ == 'r', 1)) {
+                    r = 5817;
+                    return html_cref_ftrie_cold_13(p, r);
+                }
+                return r;
+            default:
+                return html_cref_ftrie_cold_14(p - 1, r);
+            }
+            return r;
+        case 'd':
+            switch (__builtin_expect(*p ++, 'q')) {
+            case 'q':
+                if (__builtin_expect(*p ++ == 'u' &&
+                    *p ++ == 'o', 1)) {
+                    r = 5941;
+                    return html_cref_ftrie_cold_15(p, r);
+                }
+                return r;
+            default:
+                return html_cref_ftrie_cold_16(p - 1, r);
+            }
+            return r;
+        case 's':
+            switch (__builtin_expect(*p ++, 'q')) {
+            case 'q':
+                switch (__builtin_expect(*p ++, 'u')) {
+                case 'u':
+                    if (__builtin_expect(*p ++ == 'o', 1)) {
+                        r = 6394;
+                        return html_cref_ftrie_cold_17(p, r);
+                    }
+                    return r;
+                default:
+                    return html_cref_ftrie_cold_18(p - 1, r);
+                }
+                return r;
+            default:
+                return html_cref_ftrie_cold_19(p - 1, r);
+            }
+            return r;
+        case 'e':
+            r = 5966;
+            return html_cref_ftrie_cold_20(p, r);
+        default:
+            return html_cref_ftrie_cold_21(p - 1, r);
+        }
+        return r;
+    case 'g':
+        switch (__builtin_expect(*p ++, 't')) {
+        case 't':
+            r = 5203;
+            return html_cref_ftrie_cold_22(p, r);
+        case 'e':
+            r = 5031;
+            return html_cref_ftrie_cold_23(p, r);
+        default:
+            return html_cref_ftrie_cold_24(p - 1, r);
+        }
+        return r;
+    case 'r':
+        switch (__builtin_expect(*p ++, 'a')) {
+        case 'a':
+            switch (__builtin_expect(*p ++, 'q')) {
+            case 'q':
+                if (__builtin_expect(*p ++ == 'u' &&
+                    *p ++ == 'o', 1)) {
+                    return 8274;
+                }
+                return r;
+            case 'r':
+                if (__builtin_expect(*p ++ == 'r', 1)) {
+                    r = 8278;
+                    return html_cref_ftrie_cold_25(p, r);
+                }
+                return r;
+            default:
+                return html_cref_ftrie_cold_26(p - 1, r);
+            }
+            return r;
+        case 's':
+            switch (__builtin_expect(*p ++, 'q')) {
+            case 'q':
+                switch (__builtin_expect(*p ++, 'u')) {
+                case 'u':
+                    if (__builtin_expect(*p ++ == 'o', 1)) {
+                        r = 8654;
+                        return html_cref_ftrie_cold_27(p, r);
+                    }
+                    return r;
+                default:
+                    return html_cref_ftrie_cold_28(p - 1, r);
+                }
+                return r;
+            default:
+                return html_cref_ftrie_cold_29(p - 1, r);
+            }
+            return r;
+        case 'd':
+            switch (__builtin_expect(*p ++, 'q')) {
+            case 'q':
+                if (__builtin_expect(*p ++ == 'u' &&
+                    *p ++ == 'o', 1)) {
+                    r = 8414;
+                    return html_cref_ftrie_cold_30(p, r);
+                }
+                return r;
+            default:
+                return html_cref_ftrie_cold_31(p - 1, r);
+            }
+            return r;
+        case 'e':
+            switch (__builtin_expect(*p ++, 'g')) {
+            case 'g':
+                return 8454;
+            default:
+                return html_cref_ftrie_cold_32(p - 1, r);
+            }
+            return r;
+        default:
+            return html_cref_ftrie_cold_33(p - 1, r);
+        }
+        return r;
+    case 'c':
+        switch (__builtin_expect(*p ++, 'o')) {
+        case 'o':
+            switch (__builtin_expect(*p ++, 'p')) {
+            case 'p':
+                switch (__builtin_expect(*p ++, 'y')) {
+                case 'y':
+                    r = 4024;
+                    return html_cref_ftrie_cold_34(p, r);
+                default:
+                    return html_cref_ftrie_cold_35(p - 1, r);
+                }
+                return r;
+            default:
+                return html_cref_ftrie_cold_36(p - 1, r);
+            }
+            return r;
+        case 'c':
+            switch (__builtin_expect(*p ++, 'e')) {
+            case 'e':
+                if (__builtin_expect(*p ++ == 'd' &&
+                    *p ++ == 'i' &&
+                    *p ++ == 'l', 1)) {
+                    return 3813;
+                }
+                return r;
+            default:
+                return html_cref_ftrie_cold_37(p - 1, r);
+            }
+            return r;
+        case 'e':
+            switch (__builtin_expect(*p ++, 'n')) {
+            case 'n':
+                if (__builtin_expect(*p ++ == 't', 1)) {
+                    r = 3844;
+                    return html_cref_ftrie_cold_38(p, r);
+                }
+                return r;
+            default:
+                return html_cref_ftrie_cold_39(p - 1, r);
+            }
+            return r;
+        default:
+            return html_cref_ftrie_cold_40(p - 1, r);
+        }
+        return r;
+    case 'm':
+        switch (__builtin_expect(*p ++, 'd')) {
+        case 'd':
+            if (__builtin_expect(*p ++ == 'a' &&
+                *p ++ == 's' &&
+                *p ++ == 'h', 1)) {
+                return 6555;
+            }
+            return r;
+        case 'i':
+            switch (__builtin_expect(*p ++, 'd')) {
+            case 'd':
+                r = 6580;
+                switch (__builtin_expect(*p ++, 'd')) {
+                case 'd':
+                    if (__builtin_expect(*p ++ == 'o' &&
+                        *p ++ == 't', 1)) {
+                        return 6593;
+                    }
+                    return r;
+                default:
+                    return html_cref_ftrie_cold_41(p - 1, r);
+                }
+                return r;
+            case 'c':
+                if (__builtin_expect(*p ++ == 'r' &&
+                    *p ++ == 'o', 1)) {
+                    return 6576;
+                }
+                return r;
+            default:
+                return html_cref_ftrie_cold_42(p - 1, r);
+            }
+            return r;
+        default:
+            return html_cref_ftrie_cold_43(p - 1, r);
+        }
+        return r;
+    case 'h':
+        switch (__builtin_expect(*p ++, 'e')) {
+        case 'e':
+            switch (__builtin_expect(*p ++, 'l')) {
+            case 'l':
+                if (__builtin_expect(*p ++ == 'l' &&
+                    *p ++ == 'i' &&
+                    *p ++ == 'p', 1)) {
+                    return 5339;
+                }
+                return r;
+            case 'a':
+                if (__builtin_expect(*p ++ == 'r' &&
+                    *p ++ == 't' &&
+                    *p ++ == 's', 1)) {
+                    r = 5329;
+                    return html_cref_ftrie_cold_44(p, r);
+                }
+                return r;
+            default:
+                return html_cref_ftrie_cold_45(p - 1, r);
+            }
+            return r;
+        default:
+            return html_cref_ftrie_cold_46(p - 1, r);
+        }
+        return r;
+    case 'e':
+        switch (__builtin_expect(*p ++, 'a')) {
+        case 'a':
+            switch (__builtin_expect(*p ++, 'c')) {
+            case 'c':
+                if (__builtin_expect(*p ++ == 'u' &&
+                    *p ++ == 't' &&
+                    *p ++ == 'e', 1)) {
+                    return 4528;
+                }
+                return r;
+            default:
+                return html_cref_ftrie_cold_47(p - 1, r);
+            }
+            return r;
+        case 'u':
+            switch (__builtin_expect(*p ++, 'r')) {
+            case 'r':
+                if (__builtin_expect(*p ++ == 'o', 1)) {
+                    return 4788;
+                }
+                return r;
+            default:
+                return html_cref_ftrie_cold_48(p - 1, r);
+            }
+            return r;
+        case 'g':
+            r = 4579;
+            switch (__builtin_expect(*p ++, 'r')) {
+            case 'r':
+                if (__builtin_expect(*p ++ == 'a' &&
+                    *p ++ == 'v' &&
+                    *p ++ == 'e', 1)) {
+                    return 4584;
+                }
+                return r;
+            default:
+                return html_cref_ftrie_cold_49(p - 1, r);
+            }
+            return r;
+        case 'c':
+            switch (__builtin_expect(*p ++, 'i')) {
+            case 'i':
+                if (__builtin_expect(*p ++ == 'r', 1)) {
+                    r = 4541;
+                    if (__builtin_expect(*p ++ == 'c', 1)) {
+                        return 4546;
+                    }
+                    return r;
+                }
+                return r;
+            default:
+                return html_cref_ftrie_cold_50(p - 1, r);
+            }
+            return r;
+        case 'm':
+            switch (__builtin_expect(*p ++, 's')) {
+            case 's':
+                if (__builtin_expect(*p ++ == 'p', 1)) {
+                    r = 4642;
+                    return html_cref_ftrie_cold_51(p, r);
+                }
+                return r;
+            default:
+                return html_cref_ftrie_cold_52(p - 1, r);
+            }
+            return r;
+        case 'n':
+            switch (__builtin_expect(*p ++, 's')) {
+            case 's':
+                if (__builtin_expect(*p ++ == 'p', 1)) {
+                    return 4661;
+                }
+                return r;
+            default:
+                return html_cref_ftrie_cold_53(p - 1, r);
+            }
+            return r;
+        default:
+            return html_cref_ftrie_cold_54(p - 1, r);
+        }
+        return r;
+    case 't':
+        switch (__builtin_expect(*p ++, 'r')) {
+        case 'r':
+            switch (__builtin_expect(*p ++, 'a')) {
+            case 'a':
+                if (__builtin_expect(*p ++ == 'd' &&
+                    *p ++ == 'e', 1)) {
+                    return 9614;
+                }
+                return r;
+            default:
+                return html_cref_ftrie_cold_55(p - 1, r);
+            }
+            return r;
+        case 'i':
+            switch (__builtin_expect(*p ++, 'm')) {
+            case 'm':
+                if (__builtin_expect(*p ++ == 'e' &&
+                    *p ++ == 's', 1)) {
+                    r = 9549;
+                    return html_cref_ftrie_cold_56(p, r);
+                }
+                return r;
+            default:
+                return html_cref_ftrie_cold_57(p - 1, r);
+            }
+            return r;
+        case 'h':
+            switch (__builtin_expect(*p ++, 'i')) {
+            case 'i':
+                switch (__builtin_expect(*p ++, 'n')) {
+                case 'n':
+                    if (__builtin_expect(*p ++ == 's' &&
+                        *p ++ == 'p', 1)) {
+                        return 9526;
+                    }
+                    return r;
+                default:
+                    return html_cref_ftrie_cold_58(p - 1, r);
+                }
+                return r;
+            default:
+                return html_cref_ftrie_cold_59(p - 1, r);
+            }
+            return r;
+        default:
+            return html_cref_ftrie_cold_60(p - 1, r);
+        }
+        return r;
+    case 'b':
+        switch (__builtin_expect(*p ++, 'u')) {
+        case 'u':
+            switch (__builtin_expect(*p ++, 'l')) {
+            case 'l':
+                if (__builtin_expect(*p ++ == 'l', 1)) {
+                    r = 3723;
+                    return html_cref_ftrie_cold_61(p, r);
+                }
+                return r;
+            default:
+                return html_cref_ftrie_cold_62(p - 1, r);
+            }
+            return r;
+        case 'e':
+            switch (__builtin_expect(*p ++, 't')) {
+            case 't':
+                switch (__builtin_expect(*p ++, 'a')) {
+                case 'a':
+                    return 3271;
+                default:
+                    return html_cref_ftrie_cold_63(p - 1, r);
+                }
+                return r;
+            default:
+                return html_cref_ftrie_cold_64(p - 1, r);
+            }
+            return r;
+        default:
+            return html_cref_ftrie_cold_65(p - 1, r);
+        }
+        return r;
+    case 'o':
+        switch (__builtin_expect(*p ++, 'a')) {
+        case 'a':
+            switch (__builtin_expect(*p ++, 'c')) {
+            case 'c':
+                if (__builtin_expect(*p ++ == 'u' &&
+                    *p ++ == 't' &&
+                    *p ++ == 'e', 1)) {
+                    return 7596;
+                }
+                return r;
+            default:
+                return html_cref_ftrie_cold_66(p - 1, r);
+            }
+            return r;
+        case 'u':
+            if (__builtin_expect(*p ++ == 'm' &&
+                *p ++ == 'l', 1)) {
+                return 7833;
+            }
+            return r;
+        default:
+            return html_cref_ftrie_cold_67(p - 1, r);
+        }
+        return r;
+    case 'd':
+        switch (__builtin_expect(*p ++, 'e')) {
+        case 'e':
+            switch (__builtin_expect(*p ++, 'g')) {
+            case 'g':
+                return 4283;
+            default:
+                return html_cref_ftrie_cold_68(p - 1, r);
+            }
+            return r;
+        case 'a':
+            switch (__builtin_expect(*p ++, 'r')) {
+            case 'r':
+                if (__builtin_expect(*p ++ == 'r', 1)) {
+                    return 4231;
+                }
+                return r;
+            case 'g':
+                if (__builtin_expect(*p ++ == 'g' &&
+                    *p ++ == 'e' &&
+                    *p ++ == 'r', 1)) {
+                    return 4221;
+                }
+                return r;
+            default:
+                return html_cref_ftrie_cold_69(p - 1, r);
+            }
+            return r;
+        default:
+            return html_cref_ftrie_cold_70(p - 1, r);
+        }
+        return r;
+    case 'u':
+        switch (__builtin_expect(*p ++, 'a')) {
+        case 'a':
+            switch (__builtin_expect(*p ++, 'c')) {
+            case 'c':
+                if (__builtin_expect(*p ++ == 'u' &&
+                    *p ++ == 't' &&
+                    *p ++ == 'e', 1)) {
+                    return 9732;
+                }
+                return r;
+            case 'r':
+                if (__builtin_expect(*p ++ == 'r', 1)) {
+                    return 9736;
+                }
+                return r;
+            }
+            return r;
+        case 'u':
+            switch (__builtin_expect(*p ++, 'm')) {
+            case 'm':
+                if (__builtin_expect(*p ++ == 'l', 1)) {
+                    return 9935;
+                }
+                return r;
+            default:
+                return html_cref_ftrie_cold_71(p - 1, r);
+            }
+            return r;
+        default:
+            return html_cref_ftrie_cold_72(p - 1, r);
+        }
+        return r;
+    case 'p':
+        switch (__builtin_expect(*p ++, 'o')) {
+        case 'o':
+            switch (__builtin_expect(*p ++, 'u')) {
+            case 'u':
+                if (__builtin_expect(*p ++ == 'n' &&
+                    *p ++ == 'd', 1)) {
+                    return 8010;
+                }
+                return r;
+            default:
+                return html_cref_ftrie_cold_73(p - 1, r);
+            }
+            return r;
+        case 'l':
+            switch (__builtin_expect(*p ++, 'u')) {
+            case 'u':
+                if (__builtin_expect(*p ++ == 's', 1)) {
+                    r = 7948;
+                    switch (__builtin_expect(*p ++, 'm')) {
+                    case 'm':
+                        if (__builtin_expect(*p ++ == 'n', 1)) {
+                            return 7981;
+                        }
+                        return r;
+                    default:
+                        return html_cref_ftrie_cold_74(p - 1, r);
+                    }
+                    return r;
+                }
+                return r;
+            default:
+                return html_cref_ftrie_cold_75(p - 1, r);
+            }
+            return r;
+        case 'a':
+            if (__builtin_expect(*p ++ == 'r', 1)) {
+                r = 7842;
+                switch (__builtin_expect(*p ++, 'a')) {
+                case 'a':
+                    r = 7847;
+                    return html_cref_ftrie_cold_76(p, r);
+                default:
+                    return html_cref_ftrie_cold_77(p - 1, r);
+                }
+                return r;
+            }
+            return r;
+        case 'r':
+            r = 8014;
+            switch (__builtin_expect(*p ++, 'i')) {
+            case 'i':
+                if (__builtin_expect(*p ++ == 'm' &&
+                    *p ++ == 'e', 1)) {
+                    r = 8079;
+                    return html_cref_ftrie_cold_78(p, r);
+                }
+                return r;
+            default:
+                return html_cref_ftrie_cold_79(p - 1, r);
+            }
+            return r;
+        default:
+            return html_cref_ftrie_cold_80(p - 1, r);
+        }
+        return r;
+    case 'i':
+        switch (__builtin_expect(*p ++, 'a')) {
+        case 'a':
+            if (__builtin_expect(*p ++ == 'c' &&
+                *p ++ == 'u' &&
+                *p ++ == 't' &&
+                *p ++ == 'e', 1)) {
+                return 5421;
+            }
+            return r;
+        case 'n':
+            r = 5522;
+            switch (__builtin_expect(*p ++, 'f')) {
+            case 'f':
+                if (__builtin_expect(*p ++ == 'i' &&
+                    *p ++ == 'n', 1)) {
+                    r = 5532;
+                    return html_cref_ftrie_cold_81(p, r);
+                }
+                return r;
+            default:
+                return html_cref_ftrie_cold_82(p - 1, r);
+            }
+            return r;
+        default:
+            return html_cref_ftrie_cold_83(p - 1, r);
+        }
+        return r;
+    case 's':
+        switch (__builtin_expect(*p ++, 'z')) {
+        case 'z':
+            if (__builtin_expect(*p ++ == 'l' &&
+                *p ++ == 'i' &&
+                *p ++ == 'g', 1)) {
+                return 9448;
+            }
+            return r;
+        case 'e':
+            switch (__builtin_expect(*p ++, 'c')) {
+            case 'c':
+                if (__builtin_expect(*p ++ == 't', 1)) {
+                    return 8814;
+                }
+                return r;
+            default:
+                return html_cref_ftrie_cold_84(p - 1, r);
+            }
+            return r;
+        case 'h':
+            switch (__builtin_expect(*p ++, 'y')) {
+            case 'y':
+                return 8875;
+            default:
+                return html_cref_ftrie_cold_85(p - 1, r);
+            }
+            return r;
+        case 'u':
+            switch (__builtin_expect(*p ++, 'p')) {
+            case 'p':
+                r = 9306;
+                switch (__builtin_expect(*p ++, '2')) {
+                case '2':
+                    return 9315;
+                default:
+                    return html_cref_ftrie_cold_86(p - 1, r);
+                }
+                return r;
+            default:
+                return html_cref_ftrie_cold_87(p - 1, r);
+            }
+            return r;
+        default:
+            return html_cref_ftrie_cold_88(p - 1, r);
+        }
+        return r;
+    case 'f':
+        switch (__builtin_expect(*p ++, 'r')) {
+        case 'r':
+            switch (__builtin_expect(*p ++, 'a')) {
+            case 'a':
+                switch (__builtin_expect(*p ++, 'c')) {
+                case 'c':
+                    switch (__builtin_expect(*p ++, '1')) {
+                    case '1':
+                        switch (__builtin_expect(*p ++, '2')) {
+                        case '2':
+                            return 4900;
+                        default:
+                            return html_cref_ftrie_cold_89(p - 1, r);
+                        }
+                        return r;
+                    default:
+                        return html_cref_ftrie_cold_90(p - 1, r);
+                    }
+                    return r;
+                default:
+                    return html_cref_ftrie_cold_91(p - 1, r);
+                }
+                return r;
+            default:
+                return html_cref_ftrie_cold_92(p - 1, r);
+            }
+            return r;
+        default:
+            return html_cref_ftrie_cold_93(p - 1, r);
+        }
+        return r;
+    case 'z':
+        switch (__builtin_expect(*p ++, 'w')) {
+        case 'w':
+            switch (__builtin_expect(*p ++, 'n')) {
+            case 'n':
+                if (__builtin_expect(*p ++ == 'j', 1)) {
+                    return 10461;
+                }
+                return r;
+            case 'j':
+                return 10456;
+            }
+            return r;
+        default:
+            return html_cref_ftrie_cold_94(p - 1, r);
+        }
+        return r;
+    case 'y':
+        switch (__builtin_expect(*p ++, 'e')) {
+        case 'e':
+            if (__builtin_expect(*p ++ == 'n', 1)) {
+                return 10370;
+            }
+            return r;
+        default:
+            return html_cref_ftrie_cold_95(p - 1, r);
+        }
+        return r;
+    default:
+        return html_cref_ftrie_cold_96(p - 1, r);
+    }
+    return r;
+}
+
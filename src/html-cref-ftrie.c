@@ -0,0 +1,57 @@
+// Copyright (C) 2019  Stefan Vargyas
+// 
+// This file is part of Html-Cref.
+// 
+// Html-Cref is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// 
+// Html-Cref is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+// 
+// You should have received a copy of the GNU General Public License
+// along with Html-Cref.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "config.h"
+
+#include <stddef.h>
+#include <stdbool.h>
+
+#include "common.h"
+#include "int-traits.h"
+
+#ifdef TIMINGS
+#include "clocks-impl.h"
+#endif
+
+#include "html-cref.h"
+#include "html-cref-ftrie.h"
+
+size_t html_cref_ftrie_get_version(void)
+{ return HTML_CREF_VERSION; }
+
+// stev: the parse function is generated upon the
+// frequency histogram 'html-cref-freqs.txt': its hot
+// paths are kept together in the '.text.hot' section,
+// while the subtries of the names that were not seen
+// in the histogram are moved out into cold functions
+// (which GCC places in the '.text.unlikely' section)
+
+#define HTML_CREF_FTRIE_HOT __attribute__ ((hot))
+
+// $ html-cref-gen --gen-ftrie-func --heading > html-cref-ftrie-impl.h
+
+#include "html-cref-ftrie-impl.h"
+
+HTML_CREF_FTRIE_HOT
+API_ALIAS(ftrie, parse, lookup)
+
+#ifdef TIMINGS
+HTML_CREF_FUNC_DEF(ftrie, lookup)
+HTML_CREF_FUNC_DEF(ftrie, parse)
+#endif
+
+
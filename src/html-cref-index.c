@@ -0,0 +1,169 @@
+// Copyright (C) 2019  Stefan Vargyas
+// 
+// This file is part of Html-Cref.
+// 
+// Html-Cref is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// 
+// Html-Cref is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+// 
+// You should have received a copy of the GNU General Public License
+// along with Html-Cref.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "config.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+
+#include "common.h"
+
+#include "html-cref-index.h"
+
+#define HTML_CREF_INDEX_ERROR(e)                   \
+    ({                                             \
+        error->type = html_cref_index_error_ ## e; \
+        false;                                     \
+    })
+#define HTML_CREF_INDEX_SYS_ERROR()                \
+    ({                                             \
+        error->sys_error = errno;                  \
+        HTML_CREF_INDEX_ERROR(sys);                \
+    })
+
+// stev: a section is 'n' elements of 'm' bytes at the
+// offset 'o' of the file; it must not overlap the head
+// and must end within the file
+
+static bool html_cref_index_section(
+    const struct html_cref_index_head_t* h,
+    uint32_t o, uint32_t n, size_t m)
+{
+    return
+        o % html_cref_index_align == 0 &&
+        o >= sizeof(*h) &&
+        o <= h->size &&
+        n <= (h->size - o) / m;
+}
+
+static bool html_cref_index_check(
+    const struct html_cref_index_head_t* h,
+    size_t size,
+    struct html_cref_index_error_info_t* error)
+{
+    if (size < sizeof(*h))
+        return HTML_CREF_INDEX_ERROR(size);
+    if (memcmp(h->magic, HTML_CREF_INDEX_MAGIC,
+            sizeof(h->magic)))
+        return HTML_CREF_INDEX_ERROR(magic);
+    if (h->order != html_cref_index_order)
+        return HTML_CREF_INDEX_ERROR(order);
+    if (h->version != html_cref_index_version)
+        return HTML_CREF_INDEX_ERROR(version);
+    if (h->size != size)
+        return HTML_CREF_INDEX_ERROR(size);
+
+    if (h->n_nodes == 0 ||
+        h->n_names == 0 ||
+        h->table_size == 0 ||
+        !html_cref_index_section(h, h->nodes, h->n_nodes,
+            sizeof(struct html_cref_index_node_t)) ||
+        !html_cref_index_section(h, h->slots, h->n_slots,
+            sizeof(uint32_t)) ||
+        !html_cref_index_section(h, h->table, h->table_size,
+            1))
+        return HTML_CREF_INDEX_ERROR(layout);
+
+    return true;
+}
+
+bool html_cref_index_load(
+    struct html_cref_index_t* index,
+    const char* file_name,
+    struct html_cref_index_error_info_t* error)
+{
+    const struct html_cref_index_head_t* h;
+    struct stat s;
+    void* p;
+    int f;
+
+    memset(index, 0, sizeof(*index));
+    error->type = html_cref_index_error_none;
+    error->sys_error = 0;
+
+    if ((f = open(file_name, O_RDONLY)) < 0)
+        return HTML_CREF_INDEX_SYS_ERROR();
+
+    if (fstat(f, &s) < 0) {
+        close(f);
+        return HTML_CREF_INDEX_SYS_ERROR();
+    }
+    if (s.st_size < (off_t) sizeof(*h) ||
+        (uintmax_t) s.st_size > UINT32_MAX) {
+        close(f);
+        return HTML_CREF_INDEX_ERROR(size);
+    }
+
+    p = mmap(NULL, s.st_size, PROT_READ,
+            MAP_PRIVATE, f, 0);
+    close(f);
+    if (p == MAP_FAILED)
+        return HTML_CREF_INDEX_SYS_ERROR();
+
+    h = p;
+    if (!html_cref_index_check(h, s.st_size, error)) {
+        munmap(p, s.st_size);
+        return false;
+    }
+
+    index->head = h;
+    index->nodes = (const void*)
+        ((const char*) p + h->nodes);
+    index->slots = (const void*)
+        ((const char*) p + h->slots);
+    index->table = (const unsigned char*) p +
+        h->table;
+    index->size = s.st_size;
+
+    return true;
+}
+
+void html_cref_index_unload(
+    struct html_cref_index_t* index)
+{
+    if (index->head != NULL)
+        munmap((void*) index->head, index->size);
+    memset(index, 0, sizeof(*index));
+}
+
+const char* html_cref_index_error_desc(
+    const struct html_cref_index_error_info_t* error)
+{
+#undef  CASE
+#define CASE(n, d) \
+    case html_cref_index_error_ ## n: return d
+
+    switch (error->type) {
+    CASE(none, "no error");
+    case html_cref_index_error_sys:
+        return strerror(error->sys_error);
+    CASE(size, "invalid file size");
+    CASE(magic, "not an index file");
+    CASE(order, "index file of other byte order");
+    CASE(version, "index file of other version");
+    CASE(layout, "invalid index file layout");
+    }
+    return "unknown error";
+}
+
@@ -0,0 +1,121 @@
+// Copyright (C) 2019  Stefan Vargyas
+// 
+// This file is part of Html-Cref.
+// 
+// Html-Cref is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// 
+// Html-Cref is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+// 
+// You should have received a copy of the GNU General Public License
+// along with Html-Cref.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef __HTML_CREF_INDEX_H
+#define __HTML_CREF_INDEX_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+// stev: an index file is the compiled form of a set of
+// named char references: a header followed by the nodes
+// of a trie of the names, the slots of the nodes and a
+// table of the char references of the same layout as
+// 'html_cref_table'; the file is used in place, as it
+// is mapped in memory by 'mmap(2)', thus its integers
+// are of the byte order of the host that compiled it
+// -- field 'order' tells apart the files of the other
+// byte order -- and each section is aligned to eight
+// bytes
+
+#define HTML_CREF_INDEX_MAGIC "HCREFIDX"
+
+enum {
+    html_cref_index_version = 1,
+    html_cref_index_order = 0x01020304,
+    html_cref_index_align = 8,
+};
+
+struct html_cref_index_head_t
+{
+    char     magic[8];
+    uint32_t version;
+    uint32_t order;
+    uint32_t size;
+    uint32_t n_names;
+    uint32_t n_nodes;
+    uint32_t n_slots;
+    uint32_t table_size;
+    uint32_t nodes;
+    uint32_t slots;
+    uint32_t table;
+};
+
+// stev: the children of a node are indexed by their
+// chars: the child of char 'c' is found in the slot
+// 'slots + c - lo', if 'c - lo' is less than 'n'; the
+// slots hold indices of nodes, zero meaning no child
+// -- the root is node zero, which is nobody's child --;
+// 'value' is the offset in the table of the entry of
+// the name that ends at the node, or -1 if there is no
+// such name
+
+struct html_cref_index_node_t
+{
+    int32_t  value;
+    uint32_t slots;
+    uint8_t  lo;
+    uint8_t  n;
+    uint16_t reserved;
+};
+
+struct html_cref_index_t
+{
+    const struct html_cref_index_head_t* head;
+    const struct html_cref_index_node_t* nodes;
+    const uint32_t* slots;
+    const unsigned char* table;
+    size_t size;
+};
+
+enum html_cref_index_error_t
+{
+    html_cref_index_error_none,
+    html_cref_index_error_sys,
+    html_cref_index_error_size,
+    html_cref_index_error_magic,
+    html_cref_index_error_order,
+    html_cref_index_error_version,
+    html_cref_index_error_layout,
+};
+
+struct html_cref_index_error_info_t
+{
+    enum html_cref_index_error_t type;
+    int sys_error;
+};
+
+// stev: map the named index file in memory and check
+// its header; the contents of the sections are trusted
+// to be as 'html-cref-mkindex' has written them, such
+// that the loading costs no more than an 'mmap(2)' and
+// a few comparisons
+
+bool html_cref_index_load(
+    struct html_cref_index_t* index,
+    const char* file_name,
+    struct html_cref_index_error_info_t* error);
+
+void html_cref_index_unload(
+    struct html_cref_index_t* index);
+
+const char* html_cref_index_error_desc(
+    const struct html_cref_index_error_info_t* error);
+
+#endif /* __HTML_CREF_INDEX_H */
+
@@ -0,0 +1,1046 @@
+// Copyright (C) 2019  Stefan Vargyas
+// 
+// This file is part of Html-Cref.
+// 
+// Html-Cref is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// 
+// Html-Cref is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+// 
+// You should have received a copy of the GNU General Public License
+// along with Html-Cref.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "config.h"
+
+#define _GNU_SOURCE
+#include <getopt.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdio.h>
+#include <errno.h>
+
+#include "common.h"
+#include "ptr-traits.h"
+#include "char-traits.h"
+#include "pretty-print.h"
+#include "file-buf.h"
+#include "su-size.h"
+
+#include "html-cref.h"
+#include "html-cref-unicode.h"
+#include "html-cref-index.h"
+
+#define ISASCII CHAR_IS_ASCII
+#define ISALNUM CHAR_IS_ALNUM
+
+#define ISXDIGIT(c)                      \
+    (                                    \
+        CHAR_IS_DIGIT(c) ||              \
+        (((c) | 0x20) >= 'a' &&          \
+         ((c) | 0x20) <= 'f')            \
+    )
+
+const char program[] = STRINGIFY(PROGRAM);
+const char verdate[] = "0.1 -- 2019-05-05 10:58"; // $ date +'%F %R'
+
+const char license[] =
+"Copyright (C) 2019  Stefan Vargyas.\n"
+"License GPLv3+: GNU GPL version 3 or later <http://gnu.org/licenses/gpl.html>.\n"
+"This is free software: you are free to change and redistribute it.\n"
+"There is NO WARRANTY, to the extent permitted by law.\n";
+
+const char help[] =
+"usage: %s [OPTION]... FILE\n"
+"       %s -D|--dump-index [OPTION]... FILE\n"
+"compile the named char references defined by the JSON\n"
+"file FILE into an index file, to be loaded by the parser\n"
+"module 'mtrie'; the JSON file is either of the format of\n"
+"'html-mathml.json' -- an object of which member named\n"
+"'characters' maps names to texts and member named\n"
+"'optional-;' lists the names that are allowed to not be\n"
+"terminated by semicolon -- or of the format of WHATWG's\n"
+"'entities.json' -- an object mapping each '&NAME;' and\n"
+"each '&NAME' to an object of which member 'characters'\n"
+"is the text of NAME; the options are:\n"
+"  -o|--output-file=FILE       write the index to the named file (the\n"
+"                                default is 'html-cref.idx')\n"
+"  -D|--dump-index             instead of compiling FILE, load it as an\n"
+"                                index file and print out its entries,\n"
+"                                one per line, in the format of option\n"
+"                                `--print-format=tsv' of 'html-cref'\n"
+"     --dump-options           print options and exit\n"
+"     --version                print version numbers and exit\n"
+"  -?|--help                   display this help info and exit\n";
+
+struct options_t
+{
+    const char* input_file;
+    const char* output_file;
+    bool        dump_index;
+
+    size_t      argc;
+    char* const *argv;
+};
+
+static void options_version(void)
+{
+    fprintf(stdout,
+        "%s: version %s\n\n%s",
+        program, verdate,
+        license);
+}
+
+static void options_usage(void)
+{
+    fprintf(stdout, help, program, program);
+}
+
+static void options_dump(const struct options_t* opts)
+{
+    static const char* const noyes[] = {
+        [0] "no", [1] "yes"
+    };
+
+#define NNUL(x)  (opts->x ? opts->x : "-")
+#define NOYES(x) (noyes[opts->x])
+
+    fprintf(stdout,
+        "input-file:  %s\n"
+        "output-file: %s\n"
+        "dump-index:  %s\n"
+        "argc:        %zu\n",
+        NNUL(input_file),
+        NNUL(output_file),
+        NOYES(dump_index),
+        opts->argc);
+
+    pretty_print_strings(stdout,
+        PTR_CONST_PTR_CAST(opts->argv, char),
+        opts->argc, "argv", 13, 0);
+}
+
+static const struct options_t* options(
+    int argc, char* argv[])
+{
+    static struct options_t opts = {
+        .output_file = "html-cref.idx",
+    };
+
+    enum {
+        // stev: options:
+        output_file_opt = 'o',
+        dump_index_opt  = 'D',
+        help_opt        = '?',
+        dump_opt        = 128,
+        version_opt,
+    };
+
+    static const struct option longs[] = {
+        { "output-file",  1,       0, output_file_opt },
+        { "dump-index",   0,       0, dump_index_opt },
+        { "dump-options", 0,       0, dump_opt },
+        { "version",      0,       0, version_opt },
+        { "help",         0, &optopt, help_opt },
+        { 0,              0,       0, 0 }
+    };
+    static const char shorts[] = ":" "Do:";
+
+    struct bits_opts_t
+    {
+        bits_t dump: 1;
+        bits_t usage: 1;
+        bits_t version: 1;
+    };
+    struct bits_opts_t bits = {
+        .dump    = false,
+        .usage   = false,
+        .version = false
+    };
+    int opt;
+
+#define argv_optind()                      \
+    ({                                     \
+        size_t i = INT_AS_SIZE(optind);    \
+        ASSERT_SIZE_DEC_NO_OVERFLOW(i);    \
+        ASSERT(i - 1 < INT_AS_SIZE(argc)); \
+        argv[i - 1];                       \
+    })
+
+#define optopt_char()                   \
+    ({                                  \
+        ASSERT(ISASCII((char) optopt)); \
+        (char) optopt;                  \
+    })
+
+#define missing_opt_arg_str(n) \
+    error("argument for option '%s' not found", n)
+#define missing_opt_arg_ch(n) \
+    error("argument for option '-%c' not found", n);
+#define not_allowed_opt_arg(n) \
+    error("option '%s' does not allow an argument", n)
+#define invalid_opt_str(n) \
+    error("invalid command line option '%s'", n)
+#define invalid_opt_ch(n) \
+    error("invalid command line option '-%c'", n)
+
+    opterr = 0;
+    optind = 1;
+    while ((opt = getopt_long(
+        argc, argv, shorts, longs, 0)) != EOF) {
+        switch (opt) {
+        case output_file_opt:
+            if (!*optarg)
+                error("invalid argument for 'output-file' "
+                    "option: ''");
+            opts.output_file = optarg;
+            break;
+        case dump_index_opt:
+            opts.dump_index = true;
+            break;
+        case dump_opt:
+            bits.dump = true;
+            break;
+        case version_opt:
+            bits.version = true;
+            break;
+        case 0:
+            bits.usage = true;
+            break;
+        case ':': {
+            const char* opt = argv_optind();
+            if (opt[0] == '-' && opt[1] == '-')
+                missing_opt_arg_str(opt);
+            else
+                missing_opt_arg_ch(optopt_char());
+            break;
+        }
+        case '?':
+        default:
+            if (optopt == 0)
+                invalid_opt_str(argv_optind());
+            else
+            if (optopt != '?') {
+                char* opt = argv_optind();
+                if (opt[0] == '-' && opt[1] == '-') {
+                    char* end = strchr(opt, '=');
+                    if (end) *end = '\0';
+                    not_allowed_opt_arg(opt);
+                }
+                else
+                    invalid_opt_ch(optopt_char());
+            }
+            else
+                bits.usage = true;
+            break;
+        }
+    }
+
+    ASSERT(optind > 0);
+    ASSERT(optind <= argc);
+
+    argc -= optind;
+    argv += optind;
+
+    opts.argc = INT_AS_SIZE(argc);
+    opts.argv = argv;
+
+    if (opts.argc > 0) {
+        opts.input_file = *opts.argv ++;
+        opts.argc --;
+    }
+
+    if (bits.version)
+        options_version();
+    if (bits.dump)
+        options_dump(&opts);
+    if (bits.usage)
+        options_usage();
+
+    if (bits.dump ||
+        bits.version ||
+        bits.usage)
+        exit(0);
+
+    if (opts.input_file == NULL)
+        error("input file not given");
+
+    return &opts;
+}
+
+#undef  CASE
+#define CASE(n) [file_buf_error_file_ ## n] = #n
+
+static void input_error(
+    const struct file_buf_t* input)
+    NORETURN;
+
+static void input_error(
+    const struct file_buf_t* input)
+{
+    static const char* const types[] = {
+        CASE(open),
+        CASE(stat),
+        CASE(read),
+        CASE(close),
+    };
+    const char* t = ARRAY_NULL_ELEM(types,
+        input->error_info.type);
+
+    ASSERT(t != NULL);
+
+    error("%s: %s error: %s",
+        input->file_name, t,
+        strerror(input->error_info.sys_error));
+}
+
+// stev: the JSON parser below is not general: it knows
+// of the values that the two formats of entity files
+// are made of -- objects, arrays, strings and numbers
+// --, and skips over the values it has no use of
+
+struct json_t
+{
+    const char* file;
+    const char* beg;
+    const char* ptr;
+    const char* end;
+};
+
+struct json_str_t
+{
+    char*  ptr;
+    size_t len;
+    size_t max;
+};
+
+static void json_error(
+    const struct json_t* json, const char* msg)
+    NORETURN;
+
+static void json_error(
+    const struct json_t* json, const char* msg)
+{
+    const char *p, *l = json->beg;
+    size_t n = 1;
+
+    for (p = json->beg; p < json->ptr; p ++) {
+        if (*p == '\n') {
+            l = p + 1;
+            n ++;
+        }
+    }
+
+    error("%s:%zu:%zu: %s", json->file, n,
+        PTR_DIFF(json->ptr, l) + 1, msg);
+}
+
+static void json_space(struct json_t* json)
+{
+    while (json->ptr < json->end && (
+            *json->ptr == ' ' ||
+            *json->ptr == '\t' ||
+            *json->ptr == '\n' ||
+            *json->ptr == '\r'))
+        json->ptr ++;
+}
+
+static bool json_char(struct json_t* json, char c)
+{
+    json_space(json);
+    if (json->ptr < json->end && *json->ptr == c) {
+        json->ptr ++;
+        return true;
+    }
+    return false;
+}
+
+static void json_expect(struct json_t* json, char c)
+{
+    char m[32];
+
+    if (!json_char(json, c)) {
+        snprintf(m, sizeof m, "'%c' expected", c);
+        json_error(json, m);
+    }
+}
+
+static void json_str_add(
+    struct json_str_t* str, const void* ptr, size_t len)
+{
+    if (str->ptr == NULL ||
+        len > str->max - str->len) {
+        str->max = str->max ? 2 * str->max : 64;
+        if (str->max - str->len < len)
+            str->max = str->len + len;
+        str->ptr = realloc(str->ptr, str->max + 1);
+        ASSERT(str->ptr != NULL);
+    }
+    memcpy(str->ptr + str->len, ptr, len);
+    str->len += len;
+    str->ptr[str->len] = 0;
+}
+
+static code_point_t json_hex4(struct json_t* json)
+{
+    code_point_t c = 0;
+    size_t i;
+
+    for (i = 0; i < 4; i ++) {
+        char d = json->ptr < json->end
+            ? *json->ptr : 0;
+
+        if (!ISXDIGIT(d))
+            json_error(json, "invalid '\\u' escape");
+        c = 16 * c + (d <= '9' ? d - '0'
+            : (d | 0x20) - 'a' + 10);
+        json->ptr ++;
+    }
+    return c;
+}
+
+// stev: the string is decoded into UTF-8; the escapes
+// '\uXXXX' of the surrogate pairs are combined into the
+// code points they stand for, while the lone surrogates
+// are errors
+
+static void json_string(
+    struct json_t* json, struct json_str_t* str)
+{
+    code_point_t c, d;
+    utf8_t u;
+    char e;
+
+    str->len = 0;
+    json_str_add(str, "", 0);
+
+    json_expect(json, '"');
+    for (;;) {
+        if (json->ptr >= json->end)
+            json_error(json, "unterminated string");
+        e = *json->ptr ++;
+        if (e == '"')
+            break;
+        if ((uchar_t) e < 0x20)
+            json_error(json, "control char in string");
+        if (e != '\\') {
+            json_str_add(str, &e, 1);
+            continue;
+        }
+
+        e = json->ptr < json->end
+            ? *json->ptr ++ : 0;
+        switch (e) {
+        case '"':
+        case '\\':
+        case '/':
+            break;
+        case 'b': e = '\b'; break;
+        case 'f': e = '\f'; break;
+        case 'n': e = '\n'; break;
+        case 'r': e = '\r'; break;
+        case 't': e = '\t'; break;
+        case 'u':
+            c = json_hex4(json);
+            if (c >= 0xdc00u && c <= 0xdfffu)
+                json_error(json, "lone low surrogate");
+            if (c >= 0xd800u && c <= 0xdbffu) {
+                if (json->end - json->ptr < 2 ||
+                    json->ptr[0] != '\\' ||
+                    json->ptr[1] != 'u')
+                    json_error(json, "lone high surrogate");
+                json->ptr += 2;
+                d = json_hex4(json);
+                if (d < 0xdc00u || d > 0xdfffu)
+                    json_error(json, "lone high surrogate");
+                c = 0x10000u + ((c - 0xd800u) << 10) +
+                    (d - 0xdc00u);
+            }
+            json_str_add(str, u,
+                html_cref_unicode_encode_utf8(c, u));
+            continue;
+        default:
+            json_error(json, "invalid escape");
+        }
+        json_str_add(str, &e, 1);
+    }
+}
+
+static void json_skip(struct json_t* json)
+{
+    struct json_str_t s = { NULL, 0, 0 };
+
+    json_space(json);
+    if (json->ptr >= json->end)
+        json_error(json, "value expected");
+
+    switch (*json->ptr) {
+    case '"':
+        json_string(json, &s);
+        free(s.ptr);
+        break;
+    case '{':
+        json->ptr ++;
+        if (json_char(json, '}'))
+            break;
+        do {
+            json_string(json, &s);
+            json_expect(json, ':');
+            json_skip(json);
+        } while (json_char(json, ','));
+        json_expect(json, '}');
+        free(s.ptr);
+        break;
+    case '[':
+        json->ptr ++;
+        if (json_char(json, ']'))
+            break;
+        do {
+            json_skip(json);
+        } while (json_char(json, ','));
+        json_expect(json, ']');
+        break;
+    default:
+        if (json->ptr < json->end &&
+            (*json->ptr == '-' ||
+             ISALNUM(*json->ptr) ||
+             *json->ptr == '.' ||
+             *json->ptr == '+'))
+            while (json->ptr < json->end &&
+                (*json->ptr == '-' ||
+                 ISALNUM(*json->ptr) ||
+                 *json->ptr == '.' ||
+                 *json->ptr == '+'))
+                json->ptr ++;
+        else
+            json_error(json, "value expected");
+    }
+}
+
+// stev: the entities are collected in a growing
+// array; 'legacy' is set for the names that are
+// allowed to not be terminated by semicolon
+
+struct mkindex_entry_t
+{
+    char*  name;
+    char*  text;
+    size_t len;
+    size_t text_len;
+    size_t offset;
+    bool   legacy;
+    bool   defined;
+};
+
+struct mkindex_t
+{
+    struct mkindex_entry_t* ptr;
+    size_t size;
+    size_t max;
+};
+
+static struct mkindex_entry_t* mkindex_entry(
+    struct mkindex_t* index, struct json_t* json,
+    const char* name, size_t len)
+{
+    struct mkindex_entry_t *p, *e;
+    size_t i;
+
+    if (len == 0 || len > html_cref_max_name_len)
+        json_error(json, "invalid name length");
+    for (i = 0; i < len; i ++) {
+        if (!ISALNUM(name[i]))
+            json_error(json, "invalid name char");
+    }
+
+    for (p = index->ptr,
+         e = p + index->size;
+         p < e;
+         p ++) {
+        if (p->len == len &&
+            !memcmp(p->name, name, len))
+            return p;
+    }
+
+    if (index->size == index->max) {
+        index->max = index->max
+            ? 2 * index->max : 256;
+        index->ptr = realloc(index->ptr,
+            index->max * sizeof(*index->ptr));
+        ASSERT(index->ptr != NULL);
+    }
+    p = index->ptr + index->size ++;
+    memset(p, 0, sizeof(*p));
+    p->name = strndup(name, len);
+    ASSERT(p->name != NULL);
+    p->len = len;
+
+    return p;
+}
+
+// stev: the leading spaces of the texts are dropped,
+// just as 'html-cref.awk' drops them when generating
+// 'html_cref_table': 'html-mathml.json' defines four
+// combining marks -- 'DotDot', 'DownBreve', 'TripleDot'
+// and 'tdot' -- preceded by a space, which WHATWG's
+// 'entities.json' does not
+
+static void mkindex_define(
+    struct mkindex_entry_t* entry, struct json_t* json,
+    const struct json_str_t* text)
+{
+    const char* p = text->ptr;
+    size_t n = text->len;
+
+    while (n > 1 && *p == ' ') {
+        p ++;
+        n --;
+    }
+
+    if (n == 0 || n > UCHAR_MAX)
+        json_error(json, "invalid text length");
+
+    if (entry->defined) {
+        if (entry->text_len != n ||
+            memcmp(entry->text, p, n))
+            json_error(json, "name redefined");
+        return;
+    }
+
+    entry->text = malloc(n);
+    ASSERT(entry->text != NULL);
+    memcpy(entry->text, p, n);
+    entry->text_len = n;
+    entry->defined = true;
+}
+
+// stev: the value of each WHATWG member is an object
+// of which member 'characters' is the text of the name
+
+static void mkindex_parse_whatwg(
+    struct mkindex_t* index, struct json_t* json,
+    const struct json_str_t* key, struct json_str_t* str)
+{
+    struct mkindex_entry_t* e;
+    struct json_str_t k = { NULL, 0, 0 };
+    bool s, t = false;
+    size_t n;
+
+    n = key->len - 1;
+    s = n > 0 && key->ptr[n] == ';';
+    if (s) n --;
+
+    e = mkindex_entry(index, json, key->ptr + 1, n);
+    if (!s)
+        e->legacy = true;
+
+    json_expect(json, '{');
+    if (!json_char(json, '}')) {
+        do {
+            json_string(json, &k);
+            json_expect(json, ':');
+            if (!strcmp(k.ptr, "characters")) {
+                json_string(json, str);
+                mkindex_define(e, json, str);
+                t = true;
+            }
+            else
+                json_skip(json);
+        } while (json_char(json, ','));
+        json_expect(json, '}');
+    }
+    free(k.ptr);
+
+    if (!t)
+        json_error(json, "member 'characters' not found");
+}
+
+static void mkindex_parse(
+    struct mkindex_t* index, struct json_t* json)
+{
+    struct json_str_t k = { NULL, 0, 0 };
+    struct json_str_t s = { NULL, 0, 0 };
+    struct mkindex_entry_t* e;
+
+    json_expect(json, '{');
+    if (!json_char(json, '}')) {
+        do {
+            json_string(json, &k);
+            json_expect(json, ':');
+
+            if (k.len > 0 && k.ptr[0] == '&')
+                mkindex_parse_whatwg(index, json, &k, &s);
+            else
+            if (!strcmp(k.ptr, "characters")) {
+                json_expect(json, '{');
+                if (json_char(json, '}'))
+                    continue;
+                do {
+                    json_string(json, &k);
+                    e = mkindex_entry(index, json,
+                            k.ptr, k.len);
+                    json_expect(json, ':');
+                    json_string(json, &s);
+                    mkindex_define(e, json, &s);
+                } while (json_char(json, ','));
+                json_expect(json, '}');
+            }
+            else
+            if (!strcmp(k.ptr, "optional-;")) {
+                json_expect(json, '[');
+                if (json_char(json, ']'))
+                    continue;
+                do {
+                    json_string(json, &s);
+                    e = mkindex_entry(index, json,
+                            s.ptr, s.len);
+                    e->legacy = true;
+                } while (json_char(json, ','));
+                json_expect(json, ']');
+            }
+            else
+                json_skip(json);
+        } while (json_char(json, ','));
+        json_expect(json, '}');
+    }
+
+    json_space(json);
+    if (json->ptr < json->end)
+        json_error(json, "end of input expected");
+
+    free(k.ptr);
+    free(s.ptr);
+}
+
+static int mkindex_compare(
+    const void* a, const void* b)
+{
+    const struct mkindex_entry_t* x = a;
+    const struct mkindex_entry_t* y = b;
+
+    return strcmp(x->name, y->name);
+}
+
+// stev: the nodes of the trie are built first with
+// the full range of children, then numbered in the
+// breadth-first order -- such that the nodes of the
+// upper levels of the trie, which all lookups go
+// through, be close to each other -- and laid out
+// with the ranges of their children trimmed
+
+enum { mkindex_n_chars = 128 };
+
+struct mkindex_node_t
+{
+    int32_t  value;
+    uint32_t id;
+    uint32_t children[mkindex_n_chars];
+};
+
+struct mkindex_trie_t
+{
+    struct mkindex_node_t* ptr;
+    size_t size;
+    size_t max;
+};
+
+static uint32_t mkindex_trie_node(
+    struct mkindex_trie_t* trie)
+{
+    struct mkindex_node_t* n;
+
+    if (trie->size == trie->max) {
+        trie->max = trie->max
+            ? 2 * trie->max : 1024;
+        trie->ptr = realloc(trie->ptr,
+            trie->max * sizeof(*trie->ptr));
+        ASSERT(trie->ptr != NULL);
+    }
+    ASSERT(trie->size < UINT32_MAX);
+
+    n = trie->ptr + trie->size;
+    memset(n, 0, sizeof(*n));
+    n->value = -1;
+
+    return trie->size ++;
+}
+
+static void mkindex_trie_add(
+    struct mkindex_trie_t* trie,
+    const struct mkindex_entry_t* entry)
+{
+    uint32_t k = 0, c;
+    size_t i;
+
+    for (i = 0; i < entry->len; i ++) {
+        c = (uchar_t) entry->name[i];
+        ASSERT(c < mkindex_n_chars);
+
+        if (trie->ptr[k].children[c] == 0) {
+            uint32_t n = mkindex_trie_node(trie);
+            trie->ptr[k].children[c] = n;
+        }
+        k = trie->ptr[k].children[c];
+    }
+    ASSERT(trie->ptr[k].value < 0);
+    ASSERT(entry->offset <= INT32_MAX);
+    trie->ptr[k].value = entry->offset;
+}
+
+static void mkindex_write(
+    FILE* file, const char* name,
+    const void* ptr, size_t len)
+{
+    static const char z[html_cref_index_align];
+
+    if (fwrite(ptr, 1, len, file) != len)
+        error("%s: write error: %s", name,
+            strerror(errno));
+    if ((len %= html_cref_index_align) &&
+        fwrite(z, 1, sizeof z - len, file) !=
+            sizeof z - len)
+        error("%s: write error: %s", name,
+            strerror(errno));
+}
+
+static size_t mkindex_align(size_t n)
+{
+    return (n + html_cref_index_align - 1) /
+        html_cref_index_align *
+        html_cref_index_align;
+}
+
+static void mkindex_compile(
+    const struct options_t* opts)
+{
+    struct mkindex_t index = { NULL, 0, 0 };
+    struct mkindex_trie_t trie = { NULL, 0, 0 };
+    struct html_cref_index_head_t h;
+    struct html_cref_index_node_t* n;
+    struct mkindex_entry_t *p, *e;
+    uint32_t *q, *s, i, j, k, l;
+    struct file_buf_t buf;
+    struct json_t json;
+    uchar_t *t, *u;
+    size_t m, o;
+    FILE* f;
+
+    file_buf_init(&buf, opts->input_file, MB(64));
+    if (buf.error_info.type != file_buf_error_none)
+        input_error(&buf);
+
+    json.file = opts->input_file;
+    json.beg = json.ptr = PTR_CHAR_CAST(buf.ptr);
+    json.end = json.ptr + buf.size;
+    mkindex_parse(&index, &json);
+    file_buf_done(&buf);
+
+    if (index.size == 0)
+        error("%s: no names found", opts->input_file);
+
+    qsort(index.ptr, index.size, sizeof(*index.ptr),
+        mkindex_compare);
+
+    // stev: the table is laid out as 'html_cref_table':
+    // one entry for each name, made of the length of the
+    // name -- having the most significant bit set for
+    // the legacy names --, the length of the text and
+    // the text itself
+    m = 0;
+    for (p = index.ptr,
+         e = p + index.size;
+         p < e;
+         p ++) {
+        if (!p->defined)
+            error("%s: name '%s' has no text",
+                opts->input_file, p->name);
+        p->offset = m;
+        m += p->text_len + 2;
+    }
+    if (m > INT32_MAX)
+        error("%s: table too large", opts->input_file);
+
+    t = u = malloc(m);
+    ASSERT(t != NULL);
+    for (p = index.ptr; p < e; p ++) {
+        *u ++ = p->len | (p->legacy ? 0x80 : 0);
+        *u ++ = p->text_len;
+        memcpy(u, p->text, p->text_len);
+        u += p->text_len;
+    }
+
+    mkindex_trie_node(&trie);
+    for (p = index.ptr; p < e; p ++)
+        mkindex_trie_add(&trie, p);
+
+    // stev: 'q' is the queue of the breadth-first
+    // traversal, which assigns the final node ids
+    q = malloc(trie.size * sizeof(*q));
+    ASSERT(q != NULL);
+    q[0] = 0;
+    trie.ptr[0].id = 0;
+    for (i = 0, j = 1; i < j; i ++) {
+        const struct mkindex_node_t* r =
+            trie.ptr + q[i];
+
+        for (k = 0; k < mkindex_n_chars; k ++) {
+            if (r->children[k] == 0)
+                continue;
+            trie.ptr[r->children[k]].id = j;
+            q[j ++] = r->children[k];
+        }
+    }
+    ASSERT(j == trie.size);
+
+    n = calloc(trie.size, sizeof(*n));
+    ASSERT(n != NULL);
+    s = NULL;
+    o = 0;
+    for (i = 0; i < trie.size; i ++) {
+        const struct mkindex_node_t* r =
+            trie.ptr + q[i];
+
+        for (k = 0; k < mkindex_n_chars &&
+            !r->children[k]; k ++);
+        for (l = mkindex_n_chars; l > k &&
+            !r->children[l - 1]; l --);
+
+        n[i].value = r->value;
+        n[i].slots = o;
+        n[i].lo = k < l ? k : 0;
+        n[i].n = l - k;
+
+        if (l > k) {
+            s = realloc(s, (o + l - k) * sizeof(*s));
+            ASSERT(s != NULL);
+            for (; k < l; k ++)
+                s[o ++] = r->children[k]
+                    ? trie.ptr[r->children[k]].id
+                    : 0;
+        }
+    }
+
+    memset(&h, 0, sizeof h);
+    memcpy(h.magic, HTML_CREF_INDEX_MAGIC, sizeof h.magic);
+    h.version = html_cref_index_version;
+    h.order = html_cref_index_order;
+    h.n_names = index.size;
+    h.n_nodes = trie.size;
+    h.n_slots = o;
+    h.table_size = m;
+    h.nodes = mkindex_align(sizeof h);
+    h.slots = h.nodes + mkindex_align(
+        trie.size * sizeof(*n));
+    h.table = h.slots + mkindex_align(
+        o * sizeof(*s));
+    h.size = h.table + mkindex_align(m);
+
+    if ((f = fopen(opts->output_file, "w")) == NULL)
+        error("%s: open error: %s", opts->output_file,
+            strerror(errno));
+    mkindex_write(f, opts->output_file, &h, sizeof h);
+    mkindex_write(f, opts->output_file, n,
+        trie.size * sizeof(*n));
+    mkindex_write(f, opts->output_file, s,
+        o * sizeof(*s));
+    mkindex_write(f, opts->output_file, t, m);
+    if (fclose(f))
+        error("%s: close error: %s", opts->output_file,
+            strerror(errno));
+
+    for (p = index.ptr; p < e; p ++) {
+        free(p->name);
+        free(p->text);
+    }
+    free(index.ptr);
+    free(trie.ptr);
+    free(q);
+    free(n);
+    free(s);
+    free(t);
+}
+
+// stev: the entries are printed out in the order of
+// the names, by a depth-first traversal of the trie
+
+static void mkindex_dump_node(
+    const struct html_cref_index_t* index,
+    uint32_t k, char* name, size_t len)
+{
+    const struct html_cref_index_node_t* n =
+        index->nodes + k;
+    const uchar_t *t, *p, *e;
+    code_point_t c;
+    size_t i, l;
+
+    ASSERT(k < index->head->n_nodes);
+
+    if (n->value >= 0) {
+        ASSERT((size_t) n->value <
+            index->head->table_size);
+        t = index->table + n->value;
+        ASSERT((*t & 0x7f) == len);
+
+        fwrite(name, 1, len, stdout);
+        fputc('\t', stdout);
+        for (p = t + 2,
+             e = p + t[1];
+             p < e;
+             p += l) {
+            l = html_cref_unicode_decode_utf8(
+                    PTR_CHAR_CAST_CONST(p),
+                    PTR_DIFF(e, p), &c);
+            ASSERT(l > 0);
+            fprintf(stdout, "%sU+%04X",
+                p > t + 2 ? " " : "", c);
+        }
+        fprintf(stdout, "\t%d\n", !!(*t & 0x80));
+    }
+
+    ASSERT(len < html_cref_max_name_len || n->n == 0);
+    for (i = 0; i < n->n; i ++) {
+        k = index->slots[n->slots + i];
+        if (k == 0)
+            continue;
+        name[len] = n->lo + i;
+        mkindex_dump_node(index, k, name, len + 1);
+    }
+}
+
+static void mkindex_dump(
+    const struct options_t* opts)
+{
+    struct html_cref_index_error_info_t e;
+    struct html_cref_index_t index;
+    char n[html_cref_max_name_len];
+
+    if (!html_cref_index_load(&index,
+            opts->input_file, &e))
+        error("%s: %s", opts->input_file,
+            html_cref_index_error_desc(&e));
+
+    mkindex_dump_node(&index, 0, n, 0);
+
+    html_cref_index_unload(&index);
+}
+
+int main(int argc, char* argv[])
+{
+    const struct options_t* opts =
+        options(argc, argv);
+
+    if (opts->dump_index)
+        mkindex_dump(opts);
+    else
+        mkindex_compile(opts);
+
+    return 0;
+}
+
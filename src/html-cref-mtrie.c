@@ -0,0 +1,205 @@
+// Copyright (C) 2019  Stefan Vargyas
+// 
+// This file is part of Html-Cref.
+// 
+// Html-Cref is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// 
+// Html-Cref is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+// 
+// You should have received a copy of the GNU General Public License
+// along with Html-Cref.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "config.h"
+
+#define _GNU_SOURCE
+#include <stddef.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdio.h>
+#include <limits.h>
+#include <unistd.h>
+#include <dlfcn.h>
+
+#include "common.h"
+#include "int-traits.h"
+
+#ifdef TIMINGS
+#include "clocks-impl.h"
+#endif
+
+#include "html-cref.h"
+#include "html-cref-index.h"
+#include "html-cref-mtrie.h"
+
+size_t html_cref_mtrie_get_version(void)
+{ return HTML_CREF_VERSION; }
+
+// stev: unlike all the other parsers, 'mtrie' is not
+// generated code: it is a generic matcher, driven by
+// the index file that 'html-cref-mkindex' compiled of
+// the JSON definitions of the named char references;
+// the file is named by the environment variable
+// $HTML_CREF_INDEX, or else is the file 'html-cref.idx'
+// of the directory of the module (or of the program,
+// when 'mtrie' is builtin)
+
+#define HTML_CREF_MTRIE_INDEX_ENV  "HTML_CREF_INDEX"
+#define HTML_CREF_MTRIE_INDEX_FILE "html-cref.idx"
+
+static struct html_cref_index_t html_cref_mtrie_index;
+
+// stev: the module cannot call 'error': the symbols of
+// the main program are not visible to the modules;
+// moreover, a module that failed loading its index must
+// not stop the program -- 'html-cref -A' skips it --,
+// thus the error is kept for 'html_cref_mtrie_get_error'
+// to return and the index left empty, that is of one
+// node which ends no name and has no children
+
+static char html_cref_mtrie_error_buf[PATH_MAX + 64];
+static const char* html_cref_mtrie_error;
+
+static const struct html_cref_index_head_t
+    html_cref_mtrie_empty_head;
+static const struct html_cref_index_node_t
+    html_cref_mtrie_empty_node = {
+        .value = -1
+    };
+
+static void html_cref_mtrie_set_error(
+    const char* file, const char* desc)
+{
+    snprintf(html_cref_mtrie_error_buf,
+        sizeof html_cref_mtrie_error_buf,
+        "%s: %s", file, desc);
+    html_cref_mtrie_error =
+        html_cref_mtrie_error_buf;
+
+    html_cref_mtrie_index.head =
+        &html_cref_mtrie_empty_head;
+    html_cref_mtrie_index.nodes =
+        &html_cref_mtrie_empty_node;
+    html_cref_mtrie_index.slots = NULL;
+    html_cref_mtrie_index.table =
+        (const unsigned char*) "";
+    html_cref_mtrie_index.size = 0;
+}
+
+static const char* html_cref_mtrie_index_file(
+    char* buf, size_t size)
+{
+    const char *f, *p;
+    Dl_info i;
+    ssize_t n;
+    int r;
+
+    if ((f = getenv(HTML_CREF_MTRIE_INDEX_ENV)) && *f)
+        return f;
+
+    if (dladdr((void*) html_cref_mtrie_index_file, &i) &&
+        i.dli_fname != NULL && *i.dli_fname)
+        f = i.dli_fname;
+    else
+    if ((n = readlink("/proc/self/exe", buf, size - 1)) > 0) {
+        buf[n] = 0;
+        f = buf;
+    }
+    else
+        return HTML_CREF_MTRIE_INDEX_FILE;
+
+    p = strrchr(f, '/');
+    r = p == NULL
+        ? snprintf(buf, size, "%s",
+            HTML_CREF_MTRIE_INDEX_FILE)
+        : snprintf(buf, size, "%.*s/%s",
+            (int) (p - f), f,
+            HTML_CREF_MTRIE_INDEX_FILE);
+    if (r < 0 || (size_t) r >= size) {
+        html_cref_mtrie_set_error(
+            HTML_CREF_MTRIE_INDEX_FILE,
+            "path name too long");
+        return NULL;
+    }
+
+    return buf;
+}
+
+static void html_cref_mtrie_init(void)
+    __attribute__ ((constructor));
+
+static void html_cref_mtrie_init(void)
+{
+    struct html_cref_index_error_info_t e;
+    char b[PATH_MAX];
+    const char* f;
+
+    f = html_cref_mtrie_index_file(b, sizeof b);
+    if (f != NULL && !html_cref_index_load(
+            &html_cref_mtrie_index, f, &e))
+        html_cref_mtrie_set_error(f,
+            html_cref_index_error_desc(&e));
+}
+
+static void html_cref_mtrie_done(void)
+    __attribute__ ((destructor));
+
+static void html_cref_mtrie_done(void)
+{
+    if (html_cref_mtrie_error == NULL)
+        html_cref_index_unload(&html_cref_mtrie_index);
+}
+
+const char* html_cref_mtrie_get_error(void)
+{
+    return html_cref_mtrie_error;
+}
+
+const uchar_t* html_cref_mtrie_get_table(size_t* size)
+{
+    *size = html_cref_mtrie_index.head->table_size;
+    return html_cref_mtrie_index.table;
+}
+
+// stev: the walk down the trie remembers the value of
+// the last node passed through that ends a name, such
+// that the result is the longest name that prefixes
+// the input -- as required by the legacy names; the
+// input ends at the latest at the NUL char, which no
+// node has a child for
+
+int html_cref_mtrie_parse(const char* p)
+{
+    const struct html_cref_index_node_t* b =
+        html_cref_mtrie_index.nodes;
+    const uint32_t* s =
+        html_cref_mtrie_index.slots;
+    const struct html_cref_index_node_t* n = b;
+    uint32_t c, k;
+    int r = -1;
+
+    for (;;) {
+        if (n->value >= 0)
+            r = n->value;
+        c = (uchar_t) *p ++ - n->lo;
+        if (c >= n->n ||
+            !(k = s[n->slots + c]))
+            return r;
+        n = b + k;
+    }
+}
+
+API_ALIAS(mtrie, parse, lookup)
+
+#ifdef TIMINGS
+HTML_CREF_FUNC_DEF(mtrie, lookup)
+HTML_CREF_FUNC_DEF(mtrie, parse)
+#endif
+
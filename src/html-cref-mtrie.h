@@ -0,0 +1,46 @@
+// Copyright (C) 2019  Stefan Vargyas
+// 
+// This file is part of Html-Cref.
+// 
+// Html-Cref is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// 
+// Html-Cref is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+// 
+// You should have received a copy of the GNU General Public License
+// along with Html-Cref.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef __HTML_CREF_MTRIE_H
+#define __HTML_CREF_MTRIE_H
+
+API size_t html_cref_mtrie_get_version(void);
+
+API int html_cref_mtrie_lookup(const char*);
+API int html_cref_mtrie_parse(const char*);
+
+#ifdef TIMINGS
+API int html_cref_mtrie_lookup2(const char*);
+API int html_cref_mtrie_parse2(const char*);
+#endif
+
+// stev: the table of the char references that the
+// values returned by 'html_cref_mtrie_parse' are the
+// offsets of: it is read from the index file, thus
+// it may differ from 'html_cref_table'
+
+API const uchar_t* html_cref_mtrie_get_table(size_t*);
+
+// stev: the description of the error that occurred
+// when loading the index file, or NULL if there was
+// none; 'html_cref_mtrie_parse' finds no name at all
+// when the index file could not be loaded
+
+API const char* html_cref_mtrie_get_error(void);
+
+#endif /* __HTML_CREF_MTRIE_H */
+
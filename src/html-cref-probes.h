@@ -0,0 +1,81 @@
+// Copyright (C) 2019  Stefan Vargyas
+// 
+// This file is part of Html-Cref.
+// 
+// Html-Cref is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// 
+// Html-Cref is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+// 
+// You should have received a copy of the GNU General Public License
+// along with Html-Cref.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef __HTML_CREF_PROBES_H
+#define __HTML_CREF_PROBES_H
+
+// stev: the USDT (user-level statically defined
+// tracing) probes of the decoding path; they are
+// compiled in only when building with 'SDT=yes',
+// case in which each probe is a single NOP in the
+// code and an ELF note describing its arguments;
+// tools like 'bpftrace' or 'perf' replace the NOP
+// with a trap once they get attached to the probe
+
+// stev: the probes of provider 'html_cref' are:
+//   ref_start(ptr, offset):
+//     an '&' was found at 'ptr', 'offset' bytes off
+//     the start of the buffer being decoded;
+//   ref_resolved(name, len, index):
+//     a named reference was decoded; 'name' is not
+//     NUL-terminated, 'index' is the offset of the
+//     reference's entry in the table of the parser
+//     module in use -- that is 'html_cref_table',
+//     unless the module loads its own table, as
+//     'mtrie' does --, thus is not comparable across
+//     modules; 'name' is;
+//   ref_numeric(code_point):
+//     a numeric reference was decoded;
+//   ref_invalid(ptr, len):
+//     the 'len' chars at 'ptr' are not a valid char
+//     reference;
+//   parse_entry(name), parse_return(result):
+//     the call of the module's parse function;
+//   numeric_parse(digits, len, value):
+//     'html_cref_unicode_parse_html' converted the
+//     'len' digits at 'digits' to 'value';
+//   buffer_done(buf, len):
+//     the buffer of 'len' bytes was decoded
+
+#ifdef HTML_CREF_SDT
+
+#include <sys/sdt.h>
+
+#define HTML_CREF_PROBE(n) \
+    DTRACE_PROBE(html_cref, n)
+#define HTML_CREF_PROBE1(n, a1) \
+    DTRACE_PROBE1(html_cref, n, a1)
+#define HTML_CREF_PROBE2(n, a1, a2) \
+    DTRACE_PROBE2(html_cref, n, a1, a2)
+#define HTML_CREF_PROBE3(n, a1, a2, a3) \
+    DTRACE_PROBE3(html_cref, n, a1, a2, a3)
+
+#else // HTML_CREF_SDT
+
+#define HTML_CREF_PROBE(n) \
+    do {} while (0)
+#define HTML_CREF_PROBE1(n, a1) \
+    do {} while (0)
+#define HTML_CREF_PROBE2(n, a1, a2) \
+    do {} while (0)
+#define HTML_CREF_PROBE3(n, a1, a2, a3) \
+    do {} while (0)
+
+#endif // HTML_CREF_SDT
+
+#endif /* __HTML_CREF_PROBES_H */
+
@@ -0,0 +1,68 @@
+// Copyright (C) 2019  Stefan Vargyas
+// 
+// This file is part of Html-Cref.
+// 
+// Html-Cref is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// 
+// Html-Cref is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+// 
+// You should have received a copy of the GNU General Public License
+// along with Html-Cref.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "config.h"
+
+#include <stddef.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "common.h"
+#include "ptr-traits.h"
+#include "char-traits.h"
+
+#include "html-cref-refs.h"
+
+#define ISALNUM CHAR_IS_ALNUM
+
+void html_cref_refs_init(
+    struct html_cref_refs_t* refs,
+    const char* buf, size_t len)
+{
+    const char *p, *e = buf + len;
+    size_t n = 0;
+
+    for (p = buf; (p = memchr(p, '&',
+            PTR_DIFF(e, p))); p ++) {
+        if (p + 1 < e && ISALNUM(p[1]))
+            n ++;
+    }
+
+    refs->ptr = NULL;
+    refs->size = 0;
+
+    if (n == 0)
+        return;
+
+    refs->ptr = malloc(n * sizeof(*refs->ptr));
+    ASSERT(refs->ptr != NULL);
+
+    for (p = buf; (p = memchr(p, '&',
+            PTR_DIFF(e, p))); p ++) {
+        if (p + 1 < e && ISALNUM(p[1]))
+            refs->ptr[refs->size ++] = p + 1;
+    }
+    ASSERT(refs->size == n);
+}
+
+void html_cref_refs_done(
+    struct html_cref_refs_t* refs)
+{
+    free(refs->ptr);
+}
+
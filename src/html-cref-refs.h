@@ -0,0 +1,42 @@
+// Copyright (C) 2019  Stefan Vargyas
+// 
+// This file is part of Html-Cref.
+// 
+// Html-Cref is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// 
+// Html-Cref is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+// 
+// You should have received a copy of the GNU General Public License
+// along with Html-Cref.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef __HTML_CREF_REFS_H
+#define __HTML_CREF_REFS_H
+
+#include <stddef.h>
+
+// stev: the pointers to the names of all the named
+// char references found in a given text buffer --
+// that is pointers to the chars right after each
+// '&' which is followed by an alphanumeric char
+
+struct html_cref_refs_t
+{
+    const char** ptr;
+    size_t       size;
+};
+
+void html_cref_refs_init(
+    struct html_cref_refs_t* refs,
+    const char* buf, size_t len);
+
+void html_cref_refs_done(
+    struct html_cref_refs_t* refs);
+
+#endif /* __HTML_CREF_REFS_H */
+
@@ -0,0 +1,525 @@
+// Copyright (C) 2019  Stefan Vargyas
+// 
+// This file is part of Html-Cref.
+// 
+// Html-Cref is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// 
+// Html-Cref is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+// 
+// You should have received a copy of the GNU General Public License
+// along with Html-Cref.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "config.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <stdio.h>
+#include <pthread.h>
+
+#include "common.h"
+#include "ptr-traits.h"
+
+#include "html-cref-simd.h"
+
+#ifdef HTML_CREF_SIMD_X86
+#include <immintrin.h>
+#endif
+
+// stev: the selection of the SIMD variants is not done
+// by GNU ifunc resolvers, but lazily, upon the first
+// call of 'html_cref_simd_variant': in the main program
+// the resolvers would run before the C library has set
+// up the environment, thus could not obey 'HTML_CREF_
+// SIMD'; the first call of each dispatched function is
+// going through an initializing stub, which selects the
+// variant and then replaces the pointer by the final one
+
+#undef  CASE
+#define CASE(n) [html_cref_simd_ ## n] = #n
+
+static const char* const html_cref_simd_names[] = {
+    CASE(scalar),
+    CASE(sse42),
+    CASE(avx2),
+    CASE(avx512),
+};
+
+const char* html_cref_simd_name(enum html_cref_simd_t v)
+{
+    const char* n =
+        ARRAY_NULL_ELEM(html_cref_simd_names, v);
+
+    ASSERT(n != NULL);
+    return n;
+}
+
+static enum html_cref_simd_t html_cref_simd_detect(void)
+{
+#ifdef HTML_CREF_SIMD_X86
+    __builtin_cpu_init();
+
+    if (__builtin_cpu_supports("avx512f") &&
+        __builtin_cpu_supports("avx512bw") &&
+        __builtin_cpu_supports("avx512vl"))
+        return html_cref_simd_avx512;
+    if (__builtin_cpu_supports("avx2"))
+        return html_cref_simd_avx2;
+    if (__builtin_cpu_supports("sse4.2"))
+        return html_cref_simd_sse42;
+#endif
+    return html_cref_simd_scalar;
+}
+
+static bool html_cref_simd_lookup(
+    const char* n, enum html_cref_simd_t* v)
+{
+    const char* const *p, * const *e;
+
+    for (p = html_cref_simd_names,
+         e = p + ARRAY_SIZE(html_cref_simd_names);
+         p < e;
+         p ++) {
+        if (!strcmp(*p, n)) {
+            *v = PTR_DIFF(p, html_cref_simd_names);
+            return true;
+        }
+    }
+    return false;
+}
+
+static const char* html_cref_simd_find_amp_scalar(
+    const char* p, size_t n)
+{
+    const char* e;
+
+    for (e = p + n; p < e; p ++) {
+        if (*p == '&')
+            return p;
+    }
+    return NULL;
+}
+
+#ifdef HTML_CREF_SIMD_X86
+
+HTML_CREF_SIMD_TARGET(sse42)
+static const char* html_cref_simd_find_amp_sse42(
+    const char* p, size_t n)
+{
+    const __m128i a = _mm_set1_epi8('&');
+    unsigned m;
+
+    for (; n >= 16; p += 16, n -= 16) {
+        m = _mm_movemask_epi8(_mm_cmpeq_epi8(a,
+                _mm_loadu_si128((const __m128i*) p)));
+        if (m)
+            return p + __builtin_ctz(m);
+    }
+    return html_cref_simd_find_amp_scalar(p, n);
+}
+
+HTML_CREF_SIMD_TARGET(avx2)
+static const char* html_cref_simd_find_amp_avx2(
+    const char* p, size_t n)
+{
+    const __m256i a = _mm256_set1_epi8('&');
+    unsigned m;
+
+    for (; n >= 32; p += 32, n -= 32) {
+        m = _mm256_movemask_epi8(_mm256_cmpeq_epi8(a,
+                _mm256_loadu_si256((const __m256i*) p)));
+        if (m)
+            return p + __builtin_ctz(m);
+    }
+    return html_cref_simd_find_amp_scalar(p, n);
+}
+
+// stev: the tail of the buffer is loaded by a masked
+// load, which does not fault on the masked-off bytes
+
+HTML_CREF_SIMD_TARGET(avx512)
+static const char* html_cref_simd_find_amp_avx512(
+    const char* p, size_t n)
+{
+    const __m512i a = _mm512_set1_epi8('&');
+    __mmask64 k;
+    uint64_t m;
+
+    for (; n >= 64; p += 64, n -= 64) {
+        m = _mm512_cmpeq_epi8_mask(a,
+                _mm512_loadu_si512(p));
+        if (m)
+            return p + __builtin_ctzll(m);
+    }
+    if (n == 0)
+        return NULL;
+
+    k = _cvtu64_mask64((UINT64_C(1) << n) - 1);
+    m = _mm512_mask_cmpeq_epi8_mask(k, a,
+            _mm512_maskz_loadu_epi8(k, p));
+
+    return m ? p + __builtin_ctzll(m) : NULL;
+}
+
+#endif // HTML_CREF_SIMD_X86
+
+static const char* html_cref_simd_find_encode_scalar(
+    const char* p, size_t n)
+{
+    const char* e;
+
+    for (e = p + n; p < e; p ++) {
+        if (*p == '&' || (uchar_t) *p >= 0x80)
+            return p;
+    }
+    return NULL;
+}
+
+#ifdef HTML_CREF_SIMD_X86
+
+// stev: the bytes of the non-ASCII chars are
+// those of which most significant bit is set,
+// which is what 'movemask' collects
+
+HTML_CREF_SIMD_TARGET(sse42)
+static const char* html_cref_simd_find_encode_sse42(
+    const char* p, size_t n)
+{
+    const __m128i a = _mm_set1_epi8('&');
+    __m128i v;
+    unsigned m;
+
+    for (; n >= 16; p += 16, n -= 16) {
+        v = _mm_loadu_si128((const __m128i*) p);
+        m = _mm_movemask_epi8(_mm_or_si128(v,
+                _mm_cmpeq_epi8(a, v)));
+        if (m)
+            return p + __builtin_ctz(m);
+    }
+    return html_cref_simd_find_encode_scalar(p, n);
+}
+
+HTML_CREF_SIMD_TARGET(avx2)
+static const char* html_cref_simd_find_encode_avx2(
+    const char* p, size_t n)
+{
+    const __m256i a = _mm256_set1_epi8('&');
+    __m256i v;
+    unsigned m;
+
+    for (; n >= 32; p += 32, n -= 32) {
+        v = _mm256_loadu_si256((const __m256i*) p);
+        m = _mm256_movemask_epi8(_mm256_or_si256(v,
+                _mm256_cmpeq_epi8(a, v)));
+        if (m)
+            return p + __builtin_ctz(m);
+    }
+    return html_cref_simd_find_encode_scalar(p, n);
+}
+
+HTML_CREF_SIMD_TARGET(avx512)
+static const char* html_cref_simd_find_encode_avx512(
+    const char* p, size_t n)
+{
+    const __m512i a = _mm512_set1_epi8('&');
+    __mmask64 k;
+    __m512i v;
+    uint64_t m;
+
+    for (; n >= 64; p += 64, n -= 64) {
+        v = _mm512_loadu_si512(p);
+        m = _mm512_cmpeq_epi8_mask(a, v) |
+            _mm512_movepi8_mask(v);
+        if (m)
+            return p + __builtin_ctzll(m);
+    }
+    if (n == 0)
+        return NULL;
+
+    k = _cvtu64_mask64((UINT64_C(1) << n) - 1);
+    v = _mm512_maskz_loadu_epi8(k, p);
+    m = _mm512_mask_cmpeq_epi8_mask(k, a, v) |
+        _mm512_movepi8_mask(v);
+
+    return m ? p + __builtin_ctzll(m) : NULL;
+}
+
+#endif // HTML_CREF_SIMD_X86
+
+static const bool html_cref_simd_escape_chars[256] = {
+    ['&'] = true, ['<'] = true, ['>'] = true,
+    ['"'] = true, ['\''] = true,
+};
+
+static const char* html_cref_simd_find_escape_scalar(
+    const char* p, size_t n)
+{
+    const char* e;
+
+    for (e = p + n; p < e; p ++) {
+        if (html_cref_simd_escape_chars[(uchar_t) *p])
+            return p;
+    }
+    return NULL;
+}
+
+#ifdef HTML_CREF_SIMD_X86
+
+// stev: each block is compared against each of the
+// five chars; the five equality masks are or-ed
+
+HTML_CREF_SIMD_TARGET(sse42)
+static const char* html_cref_simd_find_escape_sse42(
+    const char* p, size_t n)
+{
+    const __m128i a = _mm_set1_epi8('&');
+    const __m128i l = _mm_set1_epi8('<');
+    const __m128i g = _mm_set1_epi8('>');
+    const __m128i q = _mm_set1_epi8('"');
+    const __m128i s = _mm_set1_epi8('\'');
+    __m128i v;
+    unsigned m;
+
+    for (; n >= 16; p += 16, n -= 16) {
+        v = _mm_loadu_si128((const __m128i*) p);
+        m = _mm_movemask_epi8(_mm_or_si128(
+                _mm_or_si128(
+                    _mm_or_si128(
+                        _mm_cmpeq_epi8(a, v),
+                        _mm_cmpeq_epi8(l, v)),
+                    _mm_or_si128(
+                        _mm_cmpeq_epi8(g, v),
+                        _mm_cmpeq_epi8(q, v))),
+                _mm_cmpeq_epi8(s, v)));
+        if (m)
+            return p + __builtin_ctz(m);
+    }
+    return html_cref_simd_find_escape_scalar(p, n);
+}
+
+HTML_CREF_SIMD_TARGET(avx2)
+static const char* html_cref_simd_find_escape_avx2(
+    const char* p, size_t n)
+{
+    const __m256i a = _mm256_set1_epi8('&');
+    const __m256i l = _mm256_set1_epi8('<');
+    const __m256i g = _mm256_set1_epi8('>');
+    const __m256i q = _mm256_set1_epi8('"');
+    const __m256i s = _mm256_set1_epi8('\'');
+    __m256i v;
+    unsigned m;
+
+    for (; n >= 32; p += 32, n -= 32) {
+        v = _mm256_loadu_si256((const __m256i*) p);
+        m = _mm256_movemask_epi8(_mm256_or_si256(
+                _mm256_or_si256(
+                    _mm256_or_si256(
+                        _mm256_cmpeq_epi8(a, v),
+                        _mm256_cmpeq_epi8(l, v)),
+                    _mm256_or_si256(
+                        _mm256_cmpeq_epi8(g, v),
+                        _mm256_cmpeq_epi8(q, v))),
+                _mm256_cmpeq_epi8(s, v)));
+        if (m)
+            return p + __builtin_ctz(m);
+    }
+    return html_cref_simd_find_escape_scalar(p, n);
+}
+
+HTML_CREF_SIMD_TARGET(avx512)
+static const char* html_cref_simd_find_escape_avx512(
+    const char* p, size_t n)
+{
+    const __m512i a = _mm512_set1_epi8('&');
+    const __m512i l = _mm512_set1_epi8('<');
+    const __m512i g = _mm512_set1_epi8('>');
+    const __m512i q = _mm512_set1_epi8('"');
+    const __m512i s = _mm512_set1_epi8('\'');
+    __mmask64 k;
+    __m512i v;
+    uint64_t m;
+
+    for (; n >= 64; p += 64, n -= 64) {
+        v = _mm512_loadu_si512(p);
+        m = _mm512_cmpeq_epi8_mask(a, v) |
+            _mm512_cmpeq_epi8_mask(l, v) |
+            _mm512_cmpeq_epi8_mask(g, v) |
+            _mm512_cmpeq_epi8_mask(q, v) |
+            _mm512_cmpeq_epi8_mask(s, v);
+        if (m)
+            return p + __builtin_ctzll(m);
+    }
+    if (n == 0)
+        return NULL;
+
+    k = _cvtu64_mask64((UINT64_C(1) << n) - 1);
+    v = _mm512_maskz_loadu_epi8(k, p);
+    m = _mm512_mask_cmpeq_epi8_mask(k, a, v) |
+        _mm512_mask_cmpeq_epi8_mask(k, l, v) |
+        _mm512_mask_cmpeq_epi8_mask(k, g, v) |
+        _mm512_mask_cmpeq_epi8_mask(k, q, v) |
+        _mm512_mask_cmpeq_epi8_mask(k, s, v);
+
+    return m ? p + __builtin_ctzll(m) : NULL;
+}
+
+#endif // HTML_CREF_SIMD_X86
+
+static const char* html_cref_simd_find_amp_init(
+    const char* p, size_t n)
+{
+    html_cref_simd_variant();
+    return html_cref_simd_find_amp_func(p, n);
+}
+
+html_cref_simd_find_amp_func_t
+    html_cref_simd_find_amp_func =
+    html_cref_simd_find_amp_init;
+
+static const char* html_cref_simd_find_encode_init(
+    const char* p, size_t n)
+{
+    html_cref_simd_variant();
+    return html_cref_simd_find_encode_func(p, n);
+}
+
+html_cref_simd_find_amp_func_t
+    html_cref_simd_find_encode_func =
+    html_cref_simd_find_encode_init;
+
+static const char* html_cref_simd_find_escape_init(
+    const char* p, size_t n)
+{
+    html_cref_simd_variant();
+    return html_cref_simd_find_escape_func(p, n);
+}
+
+html_cref_simd_find_amp_func_t
+    html_cref_simd_find_escape_func =
+    html_cref_simd_find_escape_init;
+
+#undef  CASE
+#define CASE(n) \
+    [html_cref_simd_ ## n] = html_cref_simd_find_amp_ ## n
+
+static const html_cref_simd_find_amp_func_t
+html_cref_simd_find_amp_funcs[] = {
+    CASE(scalar),
+#ifdef HTML_CREF_SIMD_X86
+    CASE(sse42),
+    CASE(avx2),
+    CASE(avx512),
+#endif
+};
+
+#undef  CASE
+#define CASE(n) \
+    [html_cref_simd_ ## n] = html_cref_simd_find_encode_ ## n
+
+static const html_cref_simd_find_amp_func_t
+html_cref_simd_find_encode_funcs[] = {
+    CASE(scalar),
+#ifdef HTML_CREF_SIMD_X86
+    CASE(sse42),
+    CASE(avx2),
+    CASE(avx512),
+#endif
+};
+
+#undef  CASE
+#define CASE(n) \
+    [html_cref_simd_ ## n] = html_cref_simd_find_escape_ ## n
+
+static const html_cref_simd_find_amp_func_t
+html_cref_simd_find_escape_funcs[] = {
+    CASE(scalar),
+#ifdef HTML_CREF_SIMD_X86
+    CASE(sse42),
+    CASE(avx2),
+    CASE(avx512),
+#endif
+};
+
+// stev: a module built with 'html-cref-simd.c' -- as
+// 'vcmp' is -- selects its variant on its own, but
+// leaves the warnings to the main program, which has
+// selected its own variant before loading the module
+
+#ifndef HTML_CREF_MODULE
+extern const char program[];
+
+#define HTML_CREF_SIMD_WARNING(f, ...) \
+    fprintf(stderr, "%s: warning: " f "\n", program, ## __VA_ARGS__)
+#else
+#define HTML_CREF_SIMD_WARNING(f, ...) \
+    do {} while (0)
+#endif
+
+static enum html_cref_simd_t html_cref_simd_selected;
+
+static void html_cref_simd_select(void)
+{
+    enum html_cref_simd_t d, e;
+    const char* n;
+
+    d = html_cref_simd_detect();
+
+    // stev: the variants are ordered such that each
+    // of them requires a superset of the features of
+    // those preceding it
+    if ((n = getenv("HTML_CREF_SIMD")) && *n) {
+        if (!html_cref_simd_lookup(n, &e))
+            HTML_CREF_SIMD_WARNING(
+                "invalid $HTML_CREF_SIMD '%s': "
+                "using '%s'", n,
+                html_cref_simd_name(d));
+        else
+        if (e > d)
+            HTML_CREF_SIMD_WARNING(
+                "$HTML_CREF_SIMD '%s' not supported "
+                "by the CPU: using '%s'", n,
+                html_cref_simd_name(d));
+        else
+            d = e;
+    }
+
+    html_cref_simd_find_amp_func =
+        ARRAY_NULL_ELEM(
+            html_cref_simd_find_amp_funcs, d);
+    ASSERT(html_cref_simd_find_amp_func != NULL);
+
+    html_cref_simd_find_encode_func =
+        ARRAY_NULL_ELEM(
+            html_cref_simd_find_encode_funcs, d);
+    ASSERT(html_cref_simd_find_encode_func != NULL);
+
+    html_cref_simd_find_escape_func =
+        ARRAY_NULL_ELEM(
+            html_cref_simd_find_escape_funcs, d);
+    ASSERT(html_cref_simd_find_escape_func != NULL);
+
+    html_cref_simd_selected = d;
+}
+
+// stev: the first calls of the dispatched functions
+// may come from several threads at once: 'pthread_
+// once' has the selection be done exactly once, and
+// makes its results visible to all those threads
+
+enum html_cref_simd_t html_cref_simd_variant(void)
+{
+    static pthread_once_t o = PTHREAD_ONCE_INIT;
+
+    pthread_once(&o, html_cref_simd_select);
+
+    return html_cref_simd_selected;
+}
+
@@ -0,0 +1,93 @@
+// Copyright (C) 2019  Stefan Vargyas
+// 
+// This file is part of Html-Cref.
+// 
+// Html-Cref is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// 
+// Html-Cref is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+// 
+// You should have received a copy of the GNU General Public License
+// along with Html-Cref.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef __HTML_CREF_SIMD_H
+#define __HTML_CREF_SIMD_H
+
+#include <stddef.h>
+
+// stev: the SIMD variants of the vectorized kernels;
+// the active one is selected once, at run time, upon
+// the features of the host's CPU -- unless variable
+// 'HTML_CREF_SIMD' in the environment names another
+// one (which is obeyed only if the CPU supports it)
+
+enum html_cref_simd_t
+{
+    html_cref_simd_scalar,
+    html_cref_simd_sse42,
+    html_cref_simd_avx2,
+    html_cref_simd_avx512,
+};
+
+#if defined(__x86_64__) || defined(__i386__)
+#define HTML_CREF_SIMD_X86
+#endif
+
+#ifdef HTML_CREF_SIMD_X86
+#define HTML_CREF_SIMD_TARGET_sse42  \
+    __attribute__ ((target("sse4.2")))
+#define HTML_CREF_SIMD_TARGET_avx2   \
+    __attribute__ ((target("avx2")))
+#define HTML_CREF_SIMD_TARGET_avx512 \
+    __attribute__ ((target("avx2,avx512f,avx512bw,avx512vl")))
+#define HTML_CREF_SIMD_TARGET(n) \
+    HTML_CREF_SIMD_TARGET_ ## n
+#endif
+
+enum html_cref_simd_t html_cref_simd_variant(void);
+
+const char* html_cref_simd_name(enum html_cref_simd_t);
+
+typedef const char* (*html_cref_simd_find_amp_func_t)(
+    const char*, size_t);
+
+extern html_cref_simd_find_amp_func_t
+    html_cref_simd_find_amp_func;
+
+// stev: return a pointer to the first '&' char among
+// the first 'n' chars at 'p' or NULL if there is none
+// -- that is the same as 'memchr(p, '&', n)' does
+
+static inline const char* html_cref_simd_find_amp(
+    const char* p, size_t n)
+{ return html_cref_simd_find_amp_func(p, n); }
+
+extern html_cref_simd_find_amp_func_t
+    html_cref_simd_find_encode_func;
+
+// stev: return a pointer to the first char among the
+// first 'n' chars at 'p' which is either '&' or not
+// ASCII, or NULL if there is none
+
+static inline const char* html_cref_simd_find_encode(
+    const char* p, size_t n)
+{ return html_cref_simd_find_encode_func(p, n); }
+
+extern html_cref_simd_find_amp_func_t
+    html_cref_simd_find_escape_func;
+
+// stev: return a pointer to the first char among the
+// first 'n' chars at 'p' which is one of '&', '<', '>',
+// '"' and '\'', or NULL if there is none
+
+static inline const char* html_cref_simd_find_escape(
+    const char* p, size_t n)
+{ return html_cref_simd_find_escape_func(p, n); }
+
+#endif /* __HTML_CREF_SIMD_H */
+
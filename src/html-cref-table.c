@@ -33,4 +33,13 @@ const uchar_t html_cref_table[] =
 const size_t html_cref_table_size =
     ARRAY_SIZE(html_cref_table) - 1;
 
+// $ html-cref-gen --gen-names-table --heading > html-cref-names-impl.h
+
+const char* const html_cref_table_names[] = {
+#include "html-cref-names-impl.h"
+};
+
+const size_t html_cref_table_n_names =
+    ARRAY_SIZE(html_cref_table_names);
+
 
@@ -21,6 +21,12 @@
 extern const uchar_t html_cref_table[];
 extern const size_t html_cref_table_size;
 
+// stev: the names of the entries of 'html_cref_table',
+// in the order of the entries in the table
+
+extern const char* const html_cref_table_names[];
+extern const size_t html_cref_table_n_names;
+
 #endif /* __HTML_CREF_TABLE_H */
 
 
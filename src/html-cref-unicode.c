@@ -28,6 +28,7 @@
 #include "ptr-traits.h"
 
 #include "html-cref-unicode.h"
+#include "html-cref-probes.h"
 
 #define CHAR_IS_XDIGIT_(c)        \
     (                             \
@@ -115,6 +116,8 @@ bool html_cref_unicode_parse_html(
     v = strtoul(q, (char**) p, b);
     ASSERT(*p > q);
 
+    HTML_CREF_PROBE3(numeric_parse, q, PTR_DIFF(*p, q), v);
+
     if (errno || v > html_cref_unicode_max_code_point)
         return false;
 
@@ -143,6 +146,12 @@ bool html_cref_unicode_parse_html(
         return false;
     }
 
+    // not a surrogate, i.e. not in range
+    // U+D800 to U+DFFF, inclusive: these
+    // are not encodable in UTF-8
+    if (v >= 0xd800u && v <= 0xdfffu)
+        return false;
+
     // not in range U+FDD0 to U+FDEF, inclusive
     if (v >= 0xfdd0u && v <= 0xfdefu)
         return false;
@@ -198,4 +207,50 @@ size_t html_cref_unicode_encode_utf8(
     return PTR_DIFF(p, u);
 }
 
+// stev: return the length of the UTF-8 sequence at
+// 'ptr' -- of at most 'len' bytes -- storing in 'c'
+// the code point it encodes, or zero if the sequence
+// is not well-formed, i.e. is truncated, overlong,
+// or encodes a surrogate or a code point beyond the
+// last one
+
+size_t html_cref_unicode_decode_utf8(
+    const char* ptr, size_t len, code_point_t* c)
+{
+    const uchar_t* p = PTR_UCHAR_CAST_CONST(ptr);
+    code_point_t v;
+    size_t n, i;
+
+    if (len == 0)
+        return 0;
+    if (*p < 0x80u) {
+        *c = *p;
+        return 1;
+    }
+
+    n = *p < 0xc2u ? 0
+      : *p < 0xe0u ? 2
+      : *p < 0xf0u ? 3
+      : *p < 0xf5u ? 4
+      : 0;
+    if (n == 0 || n > len)
+        return 0;
+
+    v = *p & (0x7fu >> n);
+    for (i = 1; i < n; i ++) {
+        if ((p[i] & 0xc0u) != 0x80u)
+            return 0;
+        v = (v << 6) | (p[i] & 0x3fu);
+    }
+
+    if ((n == 3 && v < 0x800u) ||
+        (n == 4 && v < 0x10000u) ||
+        (v >= 0xd800u && v <= 0xdfffu) ||
+        v > html_cref_unicode_max_code_point)
+        return 0;
+
+    *c = v;
+    return n;
+}
+
 
@@ -32,6 +32,8 @@ typedef unsigned char utf8_t[4];
 
 size_t html_cref_unicode_encode_utf8(code_point_t, utf8_t);
 
+size_t html_cref_unicode_decode_utf8(const char*, size_t, code_point_t*);
+
 #endif /* __HTML_CREF_UNICODE_H */
 
 
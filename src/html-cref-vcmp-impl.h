@@ -0,0 +1,4984 @@
+// Copyright (C) 2019  Stefan Vargyas
+// 
+// This file is part of Html-Cref.
+// 
+// Html-Cref is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// 
+// Html-Cref is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+// 
+// You should have received a copy of the GNU General Public License
+// along with Html-Cref.  If not, see <http://www.gnu.org/licenses/>.
+
+//
+// This file was generated by a command like:
+// $ html-cref-gen --gen-vcmp-table --heading
+//
+
+enum { html_cref_vcmp_n_chars = 62 };
+
+static const uchar_t
+html_cref_vcmp_chars[256] = {
+    ['0'] =  1,
+    ['1'] =  2,
+    ['2'] =  3,
+    ['3'] =  4,
+    ['4'] =  5,
+    ['5'] =  6,
+    ['6'] =  7,
+    ['7'] =  8,
+    ['8'] =  9,
+    ['9'] = 10,
+    ['A'] = 11,
+    ['B'] = 12,
+    ['C'] = 13,
+    ['D'] = 14,
+    ['E'] = 15,
+    ['F'] = 16,
+    ['G'] = 17,
+    ['H'] = 18,
+    ['I'] = 19,
+    ['J'] = 20,
+    ['K'] = 21,
+    ['L'] = 22,
+    ['M'] = 23,
+    ['N'] = 24,
+    ['O'] = 25,
+    ['P'] = 26,
+    ['Q'] = 27,
+    ['R'] = 28,
+    ['S'] = 29,
+    ['T'] = 30,
+    ['U'] = 31,
+    ['V'] = 32,
+    ['W'] = 33,
+    ['X'] = 34,
+    ['Y'] = 35,
+    ['Z'] = 36,
+    ['a'] = 37,
+    ['b'] = 38,
+    ['c'] = 39,
+    ['d'] = 40,
+    ['e'] = 41,
+    ['f'] = 42,
+    ['g'] = 43,
+    ['h'] = 44,
+    ['i'] = 45,
+    ['j'] = 46,
+    ['k'] = 47,
+    ['l'] = 48,
+    ['m'] = 49,
+    ['n'] = 50,
+    ['o'] = 51,
+    ['p'] = 52,
+    ['q'] = 53,
+    ['r'] = 54,
+    ['s'] = 55,
+    ['t'] = 56,
+    ['u'] = 57,
+    ['v'] = 58,
+    ['w'] = 59,
+    ['x'] = 60,
+    ['y'] = 61,
+    ['z'] = 62,
+};
+
+static const struct html_cref_vcmp_bucket_t
+html_cref_vcmp_buckets[
+    html_cref_vcmp_n_chars *
+    html_cref_vcmp_n_chars] = {
+    [ 634] = {    0,  1 }, // AE
+    [ 642] = {    1,  1 }, // AM
+    [ 656] = {    2,  1 }, // Aa
+    [ 657] = {    3,  1 }, // Ab
+    [ 658] = {    4,  2 }, // Ac
+    [ 661] = {    6,  1 }, // Af
+    [ 662] = {    7,  1 }, // Ag
+    [ 667] = {    8,  1 }, // Al
+    [ 668] = {    9,  1 }, // Am
+    [ 669] = {   10,  1 }, // An
+    [ 670] = {   11,  2 }, // Ao
+    [ 671] = {   13,  1 }, // Ap
+    [ 673] = {   14,  1 }, // Ar
+    [ 674] = {   15,  2 }, // As
+    [ 675] = {   17,  1 }, // At
+    [ 676] = {   18,  1 }, // Au
+    [ 718] = {   19,  3 }, // Ba
+    [ 720] = {   22,  1 }, // Bc
+    [ 722] = {   23,  3 }, // Be
+    [ 723] = {   26,  1 }, // Bf
+    [ 732] = {   27,  1 }, // Bo
+    [ 735] = {   28,  1 }, // Br
+    [ 736] = {   29,  1 }, // Bs
+    [ 738] = {   30,  1 }, // Bu
+    [ 761] = {   31,  1 }, // CH
+    [ 768] = {   32,  1 }, // CO
+    [ 780] = {   33,  4 }, // Ca
+    [ 782] = {   37,  4 }, // Cc
+    [ 783] = {   41,  1 }, // Cd
+    [ 784] = {   42,  2 }, // Ce
+    [ 785] = {   44,  1 }, // Cf
+    [ 787] = {   45,  1 }, // Ch
+    [ 788] = {   46,  4 }, // Ci
+    [ 791] = {   50,  3 }, // Cl
+    [ 794] = {   53,  8 }, // Co
+    [ 797] = {   61,  1 }, // Cr
+    [ 798] = {   62,  1 }, // Cs
+    [ 800] = {   63,  2 }, // Cu
+    [ 819] = {   65,  2 }, // DD
+    [ 825] = {   67,  1 }, // DJ
+    [ 834] = {   68,  1 }, // DS
+    [ 841] = {   69,  1 }, // DZ
+    [ 842] = {   70,  3 }, // Da
+    [ 844] = {   73,  2 }, // Dc
+    [ 846] = {   75,  2 }, // De
+    [ 847] = {   77,  1 }, // Df
+    [ 850] = {   78,  7 }, // Di
+    [ 856] = {   85, 32 }, // Do
+    [ 860] = {  117,  2 }, // Ds
+    [ 891] = {  119,  1 }, // EN
+    [ 897] = {  120,  1 }, // ET
+    [ 904] = {  121,  1 }, // Ea
+    [ 906] = {  122,  3 }, // Ec
+    [ 907] = {  125,  1 }, // Ed
+    [ 909] = {  126,  1 }, // Ef
+    [ 910] = {  127,  1 }, // Eg
+    [ 915] = {  128,  1 }, // El
+    [ 916] = {  129,  3 }, // Em
+    [ 918] = {  132,  2 }, // Eo
+    [ 919] = {  134,  1 }, // Ep
+    [ 920] = {  135,  3 }, // Eq
+    [ 922] = {  138,  2 }, // Es
+    [ 923] = {  140,  1 }, // Et
+    [ 924] = {  141,  1 }, // Eu
+    [ 927] = {  142,  2 }, // Ex
+    [ 968] = {  144,  1 }, // Fc
+    [ 971] = {  145,  1 }, // Ff
+    [ 974] = {  146,  2 }, // Fi
+    [ 980] = {  148,  3 }, // Fo
+    [ 984] = {  151,  1 }, // Fs
+    [1011] = {  152,  1 }, // GJ
+    [1021] = {  153,  1 }, // GT
+    [1028] = {  154,  2 }, // Ga
+    [1029] = {  156,  1 }, // Gb
+    [1030] = {  157,  3 }, // Gc
+    [1031] = {  160,  1 }, // Gd
+    [1033] = {  161,  1 }, // Gf
+    [1034] = {  162,  1 }, // Gg
+    [1042] = {  163,  1 }, // Go
+    [1045] = {  164,  7 }, // Gr
+    [1046] = {  171,  1 }, // Gs
+    [1047] = {  172,  1 }, // Gt
+    [1064] = {  173,  1 }, // HA
+    [1090] = {  174,  2 }, // Ha
+    [1092] = {  176,  1 }, // Hc
+    [1095] = {  177,  1 }, // Hf
+    [1098] = {  178,  1 }, // Hi
+    [1104] = {  179,  2 }, // Ho
+    [1108] = {  181,  2 }, // Hs
+    [1110] = {  183,  2 }, // Hu
+    [1130] = {  185,  1 }, // IE
+    [1135] = {  186,  1 }, // IJ
+    [1140] = {  187,  1 }, // IO
+    [1152] = {  188,  1 }, // Ia
+    [1154] = {  189,  2 }, // Ic
+    [1155] = {  191,  1 }, // Id
+    [1157] = {  192,  1 }, // If
+    [1158] = {  193,  1 }, // Ig
+    [1164] = {  194,  4 }, // Im
+    [1165] = {  198,  5 }, // In
+    [1166] = {  203,  3 }, // Io
+    [1170] = {  206,  1 }, // Is
+    [1171] = {  207,  1 }, // It
+    [1172] = {  208,  2 }, // Iu
+    [1216] = {  210,  2 }, // Jc
+    [1219] = {  212,  1 }, // Jf
+    [1228] = {  213,  1 }, // Jo
+    [1232] = {  214,  2 }, // Js
+    [1234] = {  216,  1 }, // Ju
+    [1257] = {  217,  1 }, // KH
+    [1259] = {  218,  1 }, // KJ
+    [1276] = {  219,  1 }, // Ka
+    [1278] = {  220,  2 }, // Kc
+    [1281] = {  222,  1 }, // Kf
+    [1290] = {  223,  1 }, // Ko
+    [1294] = {  224,  1 }, // Ks
+    [1321] = {  225,  1 }, // LJ
+    [1331] = {  226,  1 }, // LT
+    [1338] = {  227,  5 }, // La
+    [1340] = {  232,  3 }, // Lc
+    [1342] = {  235, 32 }, // Le
+    [1343] = {  267,  1 }, // Lf
+    [1349] = {  268,  2 }, // Ll
+    [1350] = {  270,  1 }, // Lm
+    [1352] = {  271,  9 }, // Lo
+    [1356] = {  280,  3 }, // Ls
+    [1357] = {  283,  1 }, // Lt
+    [1400] = {  284,  1 }, // Ma
+    [1402] = {  285,  1 }, // Mc
+    [1404] = {  286,  2 }, // Me
+    [1405] = {  288,  1 }, // Mf
+    [1408] = {  289,  1 }, // Mi
+    [1414] = {  290,  1 }, // Mo
+    [1418] = {  291,  1 }, // Ms
+    [1420] = {  292,  1 }, // Mu
+    [1445] = {  293,  1 }, // NJ
+    [1462] = {  294,  1 }, // Na
+    [1464] = {  295,  3 }, // Nc
+    [1466] = {  298,  7 }, // Ne
+    [1467] = {  305,  1 }, // Nf
+    [1476] = {  306, 55 }, // No
+    [1480] = {  361,  1 }, // Ns
+    [1481] = {  362,  1 }, // Nt
+    [1482] = {  363,  1 }, // Nu
+    [1502] = {  364,  1 }, // OE
+    [1524] = {  365,  1 }, // Oa
+    [1526] = {  366,  2 }, // Oc
+    [1527] = {  368,  1 }, // Od
+    [1529] = {  369,  1 }, // Of
+    [1530] = {  370,  1 }, // Og
+    [1536] = {  371,  3 }, // Om
+    [1538] = {  374,  1 }, // Oo
+    [1539] = {  375,  2 }, // Op
+    [1541] = {  377,  1 }, // Or
+    [1542] = {  378,  2 }, // Os
+    [1543] = {  380,  2 }, // Ot
+    [1544] = {  382,  1 }, // Ou
+    [1545] = {  383,  4 }, // Ov
+    [1586] = {  387,  1 }, // Pa
+    [1588] = {  388,  1 }, // Pc
+    [1591] = {  389,  1 }, // Pf
+    [1593] = {  390,  1 }, // Ph
+    [1594] = {  391,  1 }, // Pi
+    [1597] = {  392,  1 }, // Pl
+    [1600] = {  393,  2 }, // Po
+    [1603] = {  395,  9 }, // Pr
+    [1604] = {  404,  2 }, // Ps
+    [1642] = {  406,  1 }, // QU
+    [1653] = {  407,  1 }, // Qf
+    [1662] = {  408,  1 }, // Qo
+    [1666] = {  409,  1 }, // Qs
+    [1685] = {  410,  1 }, // RB
+    [1688] = {  411,  1 }, // RE
+    [1710] = {  412,  4 }, // Ra
+    [1712] = {  416,  3 }, // Rc
+    [1714] = {  419,  4 }, // Re
+    [1715] = {  423,  1 }, // Rf
+    [1717] = {  424,  1 }, // Rh
+    [1718] = {  425, 23 }, // Ri
+    [1724] = {  448,  2 }, // Ro
+    [1727] = {  450,  1 }, // Rr
+    [1728] = {  451,  2 }, // Rs
+    [1730] = {  453,  1 }, // Ru
+    [1753] = {  454,  2 }, // SH
+    [1760] = {  456,  1 }, // SO
+    [1772] = {  457,  1 }, // Sa
+    [1774] = {  458,  5 }, // Sc
+    [1777] = {  463,  1 }, // Sf
+    [1779] = {  464,  4 }, // Sh
+    [1780] = {  468,  1 }, // Si
+    [1784] = {  469,  1 }, // Sm
+    [1786] = {  470,  1 }, // So
+    [1788] = {  471,  8 }, // Sq
+    [1790] = {  479,  1 }, // Ss
+    [1791] = {  480,  1 }, // St
+    [1792] = {  481, 13 }, // Su
+    [1815] = {  494,  1 }, // TH
+    [1825] = {  495,  1 }, // TR
+    [1826] = {  496,  2 }, // TS
+    [1834] = {  498,  2 }, // Ta
+    [1836] = {  500,  3 }, // Tc
+    [1839] = {  503,  1 }, // Tf
+    [1841] = {  504,  4 }, // Th
+    [1842] = {  508,  4 }, // Ti
+    [1848] = {  512,  1 }, // To
+    [1851] = {  513,  1 }, // Tr
+    [1852] = {  514,  2 }, // Ts
+    [1896] = {  516,  3 }, // Ua
+    [1897] = {  519,  2 }, // Ub
+    [1898] = {  521,  2 }, // Uc
+    [1899] = {  523,  1 }, // Ud
+    [1901] = {  524,  1 }, // Uf
+    [1902] = {  525,  1 }, // Ug
+    [1908] = {  526,  1 }, // Um
+    [1909] = {  527,  6 }, // Un
+    [1910] = {  533,  2 }, // Uo
+    [1911] = {  535, 13 }, // Up
+    [1913] = {  548,  1 }, // Ur
+    [1914] = {  549,  1 }, // Us
+    [1915] = {  550,  1 }, // Ut
+    [1916] = {  551,  1 }, // Uu
+    [1935] = {  552,  1 }, // VD
+    [1959] = {  553,  1 }, // Vb
+    [1960] = {  554,  1 }, // Vc
+    [1961] = {  555,  2 }, // Vd
+    [1962] = {  557,  8 }, // Ve
+    [1963] = {  565,  1 }, // Vf
+    [1972] = {  566,  1 }, // Vo
+    [1976] = {  567,  1 }, // Vs
+    [1979] = {  568,  1 }, // Vv
+    [2022] = {  569,  1 }, // Wc
+    [2024] = {  570,  1 }, // We
+    [2025] = {  571,  1 }, // Wf
+    [2034] = {  572,  1 }, // Wo
+    [2038] = {  573,  1 }, // Ws
+    [2087] = {  574,  1 }, // Xf
+    [2090] = {  575,  1 }, // Xi
+    [2096] = {  576,  1 }, // Xo
+    [2100] = {  577,  1 }, // Xs
+    [2118] = {  578,  1 }, // YA
+    [2126] = {  579,  1 }, // YI
+    [2138] = {  580,  1 }, // YU
+    [2144] = {  581,  1 }, // Ya
+    [2146] = {  582,  2 }, // Yc
+    [2149] = {  584,  1 }, // Yf
+    [2158] = {  585,  1 }, // Yo
+    [2162] = {  586,  1 }, // Ys
+    [2164] = {  587,  1 }, // Yu
+    [2187] = {  588,  1 }, // ZH
+    [2206] = {  589,  1 }, // Za
+    [2208] = {  590,  2 }, // Zc
+    [2209] = {  592,  1 }, // Zd
+    [2210] = {  593,  2 }, // Ze
+    [2211] = {  595,  1 }, // Zf
+    [2220] = {  596,  1 }, // Zo
+    [2224] = {  597,  1 }, // Zs
+    [2268] = {  598,  1 }, // aa
+    [2269] = {  599,  1 }, // ab
+    [2270] = {  600,  6 }, // ac
+    [2272] = {  606,  1 }, // ae
+    [2273] = {  607,  2 }, // af
+    [2274] = {  609,  1 }, // ag
+    [2279] = {  610,  3 }, // al
+    [2280] = {  613,  3 }, // am
+    [2281] = {  616, 23 }, // an
+    [2282] = {  639,  2 }, // ao
+    [2283] = {  641,  8 }, // ap
+    [2285] = {  649,  1 }, // ar
+    [2286] = {  650,  4 }, // as
+    [2287] = {  654,  1 }, // at
+    [2288] = {  655,  1 }, // au
+    [2290] = {  656,  2 }, // aw
+    [2317] = {  658,  1 }, // bN
+    [2330] = {  659,  8 }, // ba
+    [2331] = {  667,  2 }, // bb
+    [2332] = {  669,  2 }, // bc
+    [2333] = {  671,  1 }, // bd
+    [2334] = {  672,  8 }, // be
+    [2335] = {  680,  1 }, // bf
+    [2338] = {  681, 13 }, // bi
+    [2340] = {  694,  1 }, // bk
+    [2341] = {  695, 11 }, // bl
+    [2343] = {  706,  3 }, // bn
+    [2344] = {  709, 48 }, // bo
+    [2345] = {  757,  1 }, // bp
+    [2347] = {  758,  2 }, // br
+    [2348] = {  760,  7 }, // bs
+    [2350] = {  767,  6 }, // bu
+    [2392] = {  773, 10 }, // ca
+    [2394] = {  783,  6 }, // cc
+    [2395] = {  789,  1 }, // cd
+    [2396] = {  790,  4 }, // ce
+    [2397] = {  794,  1 }, // cf
+    [2399] = {  795,  4 }, // ch
+    [2400] = {  799, 15 }, // ci
+    [2403] = {  814,  2 }, // cl
+    [2406] = {  816, 16 }, // co
+    [2409] = {  832,  2 }, // cr
+    [2410] = {  834,  5 }, // cs
+    [2411] = {  839,  1 }, // ct
+    [2412] = {  840, 24 }, // cu
+    [2414] = {  864,  2 }, // cw
+    [2416] = {  866,  1 }, // cy
+    [2428] = {  867,  1 }, // dA
+    [2435] = {  868,  1 }, // dH
+    [2454] = {  869,  5 }, // da
+    [2455] = {  874,  2 }, // db
+    [2456] = {  876,  2 }, // dc
+    [2457] = {  878,  4 }, // dd
+    [2458] = {  882,  3 }, // de
+    [2459] = {  885,  2 }, // df
+    [2461] = {  887,  2 }, // dh
+    [2462] = {  889, 11 }, // di
+    [2463] = {  900,  1 }, // dj
+    [2465] = {  901,  2 }, // dl
+    [2468] = {  903, 13 }, // do
+    [2471] = {  916,  3 }, // dr
+    [2472] = {  919,  4 }, // ds
+    [2473] = {  923,  3 }, // dt
+    [2474] = {  926,  2 }, // du
+    [2476] = {  928,  1 }, // dw
+    [2479] = {  929,  2 }, // dz
+    [2493] = {  931,  2 }, // eD
+    [2516] = {  933,  2 }, // ea
+    [2518] = {  935,  5 }, // ec
+    [2519] = {  940,  1 }, // ed
+    [2520] = {  941,  1 }, // ee
+    [2521] = {  942,  2 }, // ef
+    [2522] = {  944,  4 }, // eg
+    [2527] = {  948,  5 }, // el
+    [2528] = {  953,  7 }, // em
+    [2529] = {  960,  2 }, // en
+    [2530] = {  962,  2 }, // eo
+    [2531] = {  964,  6 }, // ep
+    [2532] = {  970, 10 }, // eq
+    [2533] = {  980,  2 }, // er
+    [2534] = {  982,  3 }, // es
+    [2535] = {  985,  2 }, // et
+    [2536] = {  987,  2 }, // eu
+    [2539] = {  989,  4 }, // ex
+    [2578] = {  993,  1 }, // fa
+    [2580] = {  994,  1 }, // fc
+    [2582] = {  995,  1 }, // fe
+    [2583] = {  996,  4 }, // ff
+    [2586] = { 1000,  1 }, // fi
+    [2587] = { 1001,  1 }, // fj
+    [2589] = { 1002,  3 }, // fl
+    [2591] = { 1005,  1 }, // fn
+    [2592] = { 1006,  4 }, // fo
+    [2593] = { 1010,  1 }, // fp
+    [2595] = { 1011, 17 }, // fr
+    [2596] = { 1028,  1 }, // fs
+    [2618] = { 1029,  2 }, // gE
+    [2640] = { 1031,  4 }, // ga
+    [2641] = { 1035,  1 }, // gb
+    [2642] = { 1036,  2 }, // gc
+    [2643] = { 1038,  1 }, // gd
+    [2644] = { 1039, 12 }, // ge
+    [2645] = { 1051,  1 }, // gf
+    [2646] = { 1052,  2 }, // gg
+    [2648] = { 1054,  1 }, // gi
+    [2649] = { 1055,  1 }, // gj
+    [2651] = { 1056,  4 }, // gl
+    [2653] = { 1060,  7 }, // gn
+    [2654] = { 1067,  1 }, // go
+    [2657] = { 1068,  1 }, // gr
+    [2658] = { 1069,  4 }, // gs
+    [2659] = { 1073, 13 }, // gt
+    [2661] = { 1086,  2 }, // gv
+    [2676] = { 1088,  1 }, // hA
+    [2702] = { 1089,  7 }, // ha
+    [2703] = { 1096,  1 }, // hb
+    [2704] = { 1097,  1 }, // hc
+    [2706] = { 1098,  4 }, // he
+    [2707] = { 1102,  1 }, // hf
+    [2712] = { 1103,  2 }, // hk
+    [2716] = { 1105,  6 }, // ho
+    [2720] = { 1111,  3 }, // hs
+    [2726] = { 1114,  2 }, // hy
+    [2764] = { 1116,  1 }, // ia
+    [2766] = { 1117,  3 }, // ic
+    [2768] = { 1120,  2 }, // ie
+    [2769] = { 1122,  2 }, // if
+    [2770] = { 1124,  1 }, // ig
+    [2772] = { 1125,  5 }, // ii
+    [2773] = { 1130,  1 }, // ij
+    [2776] = { 1131,  7 }, // im
+    [2777] = { 1138, 11 }, // in
+    [2778] = { 1149,  4 }, // io
+    [2779] = { 1153,  1 }, // ip
+    [2780] = { 1154,  1 }, // iq
+    [2782] = { 1155,  7 }, // is
+    [2783] = { 1162,  2 }, // it
+    [2784] = { 1164,  2 }, // iu
+    [2828] = { 1166,  2 }, // jc
+    [2831] = { 1168,  1 }, // jf
+    [2838] = { 1169,  1 }, // jm
+    [2840] = { 1170,  1 }, // jo
+    [2844] = { 1171,  2 }, // js
+    [2846] = { 1173,  1 }, // ju
+    [2888] = { 1174,  2 }, // ka
+    [2890] = { 1176,  2 }, // kc
+    [2893] = { 1178,  1 }, // kf
+    [2894] = { 1179,  1 }, // kg
+    [2895] = { 1180,  1 }, // kh
+    [2897] = { 1181,  1 }, // kj
+    [2902] = { 1182,  1 }, // ko
+    [2906] = { 1183,  1 }, // ks
+    [2924] = { 1184,  3 }, // lA
+    [2925] = { 1187,  1 }, // lB
+    [2928] = { 1188,  2 }, // lE
+    [2931] = { 1190,  1 }, // lH
+    [2950] = { 1191, 22 }, // la
+    [2951] = { 1213,  7 }, // lb
+    [2952] = { 1220,  5 }, // lc
+    [2953] = { 1225,  6 }, // ld
+    [2954] = { 1231, 28 }, // le
+    [2955] = { 1259,  3 }, // lf
+    [2956] = { 1262,  2 }, // lg
+    [2957] = { 1264,  4 }, // lh
+    [2959] = { 1268,  1 }, // lj
+    [2961] = { 1269,  5 }, // ll
+    [2962] = { 1274,  3 }, // lm
+    [2963] = { 1277,  7 }, // ln
+    [2964] = { 1284, 18 }, // lo
+    [2965] = { 1302,  2 }, // lp
+    [2967] = { 1304,  6 }, // lr
+    [2968] = { 1310, 10 }, // ls
+    [2969] = { 1320, 12 }, // lt
+    [2970] = { 1332,  2 }, // lu
+    [2971] = { 1334,  2 }, // lv
+    [2989] = { 1336,  1 }, // mD
+    [3012] = { 1337, 10 }, // ma
+    [3014] = { 1347,  2 }, // mc
+    [3015] = { 1349,  1 }, // md
+    [3016] = { 1350,  1 }, // me
+    [3017] = { 1351,  1 }, // mf
+    [3019] = { 1352,  1 }, // mh
+    [3020] = { 1353,  9 }, // mi
+    [3023] = { 1362,  2 }, // ml
+    [3025] = { 1364,  1 }, // mn
+    [3026] = { 1365,  2 }, // mo
+    [3027] = { 1367,  1 }, // mp
+    [3030] = { 1368,  2 }, // ms
+    [3032] = { 1370,  3 }, // mu
+    [3054] = { 1373,  3 }, // nG
+    [3059] = { 1376,  5 }, // nL
+    [3065] = { 1381,  1 }, // nR
+    [3069] = { 1382,  2 }, // nV
+    [3074] = { 1384, 11 }, // na
+    [3075] = { 1395,  3 }, // nb
+    [3076] = { 1398,  7 }, // nc
+    [3077] = { 1405,  1 }, // nd
+    [3078] = { 1406, 11 }, // ne
+    [3079] = { 1417,  1 }, // nf
+    [3080] = { 1418,  9 }, // ng
+    [3081] = { 1427,  3 }, // nh
+    [3082] = { 1430,  4 }, // ni
+    [3083] = { 1434,  1 }, // nj
+    [3085] = { 1435, 16 }, // nl
+    [3086] = { 1451,  1 }, // nm
+    [3088] = { 1452, 12 }, // no
+    [3089] = { 1464, 10 }, // np
+    [3091] = { 1474,  7 }, // nr
+    [3092] = { 1481, 27 }, // ns
+    [3093] = { 1508,  7 }, // nt
+    [3094] = { 1515,  4 }, // nu
+    [3095] = { 1519, 14 }, // nv
+    [3096] = { 1533,  5 }, // nw
+    [3128] = { 1538,  1 }, // oS
+    [3136] = { 1539,  2 }, // oa
+    [3138] = { 1541,  3 }, // oc
+    [3139] = { 1544,  5 }, // od
+    [3140] = { 1549,  1 }, // oe
+    [3141] = { 1550,  2 }, // of
+    [3142] = { 1552,  3 }, // og
+    [3143] = { 1555,  2 }, // oh
+    [3144] = { 1557,  1 }, // oi
+    [3147] = { 1558,  5 }, // ol
+    [3148] = { 1563,  5 }, // om
+    [3150] = { 1568,  1 }, // oo
+    [3151] = { 1569,  3 }, // op
+    [3153] = { 1572, 11 }, // or
+    [3154] = { 1583,  3 }, // os
+    [3155] = { 1586,  3 }, // ot
+    [3156] = { 1589,  1 }, // ou
+    [3157] = { 1590,  1 }, // ov
+    [3198] = { 1591,  6 }, // pa
+    [3200] = { 1597,  1 }, // pc
+    [3202] = { 1598,  5 }, // pe
+    [3203] = { 1603,  1 }, // pf
+    [3205] = { 1604,  4 }, // ph
+    [3206] = { 1608,  3 }, // pi
+    [3209] = { 1611, 13 }, // pl
+    [3210] = { 1624,  1 }, // pm
+    [3212] = { 1625,  3 }, // po
+    [3215] = { 1628, 26 }, // pr
+    [3216] = { 1654,  2 }, // ps
+    [3218] = { 1656,  1 }, // pu
+    [3265] = { 1657,  1 }, // qf
+    [3268] = { 1658,  1 }, // qi
+    [3274] = { 1659,  1 }, // qo
+    [3275] = { 1660,  1 }, // qp
+    [3278] = { 1661,  1 }, // qs
+    [3280] = { 1662,  5 }, // qu
+    [3296] = { 1667,  3 }, // rA
+    [3297] = { 1670,  1 }, // rB
+    [3303] = { 1671,  1 }, // rH
+    [3322] = { 1672, 24 }, // ra
+    [3323] = { 1696,  7 }, // rb
+    [3324] = { 1703,  5 }, // rc
+    [3325] = { 1708,  5 }, // rd
+    [3326] = { 1713,  6 }, // re
+    [3327] = { 1719,  3 }, // rf
+    [3329] = { 1722,  5 }, // rh
+    [3330] = { 1727, 11 }, // ri
+    [3333] = { 1738,  3 }, // rl
+    [3334] = { 1741,  2 }, // rm
+    [3335] = { 1743,  1 }, // rn
+    [3336] = { 1744,  7 }, // ro
+    [3337] = { 1751,  3 }, // rp
+    [3339] = { 1754,  1 }, // rr
+    [3340] = { 1755,  6 }, // rs
+    [3341] = { 1761,  6 }, // rt
+    [3342] = { 1767,  1 }, // ru
+    [3345] = { 1768,  1 }, // rx
+    [3384] = { 1769,  1 }, // sa
+    [3385] = { 1770,  1 }, // sb
+    [3386] = { 1771, 14 }, // sc
+    [3387] = { 1785,  3 }, // sd
+    [3388] = { 1788, 10 }, // se
+    [3389] = { 1798,  2 }, // sf
+    [3391] = { 1800,  6 }, // sh
+    [3392] = { 1806, 14 }, // si
+    [3395] = { 1820,  1 }, // sl
+    [3396] = { 1821,  8 }, // sm
+    [3398] = { 1829,  5 }, // so
+    [3399] = { 1834,  3 }, // sp
+    [3400] = { 1837, 16 }, // sq
+    [3401] = { 1853,  1 }, // sr
+    [3402] = { 1854,  4 }, // ss
+    [3403] = { 1858,  5 }, // st
+    [3404] = { 1863, 52 }, // su
+    [3406] = { 1915,  5 }, // sw
+    [3409] = { 1920,  1 }, // sz
+    [3446] = { 1921,  2 }, // ta
+    [3447] = { 1923,  1 }, // tb
+    [3448] = { 1924,  3 }, // tc
+    [3449] = { 1927,  1 }, // td
+    [3450] = { 1928,  1 }, // te
+    [3451] = { 1929,  1 }, // tf
+    [3453] = { 1930, 11 }, // th
+    [3454] = { 1941,  6 }, // ti
+    [3460] = { 1947,  7 }, // to
+    [3461] = { 1954,  1 }, // tp
+    [3463] = { 1955, 15 }, // tr
+    [3464] = { 1970,  4 }, // ts
+    [3468] = { 1974,  3 }, // tw
+    [3482] = { 1977,  1 }, // uA
+    [3489] = { 1978,  1 }, // uH
+    [3508] = { 1979,  2 }, // ua
+    [3509] = { 1981,  2 }, // ub
+    [3510] = { 1983,  2 }, // uc
+    [3511] = { 1985,  3 }, // ud
+    [3513] = { 1988,  2 }, // uf
+    [3514] = { 1990,  1 }, // ug
+    [3515] = { 1991,  3 }, // uh
+    [3519] = { 1994,  4 }, // ul
+    [3520] = { 1998,  2 }, // um
+    [3522] = { 2000,  2 }, // uo
+    [3523] = { 2002,  9 }, // up
+    [3525] = { 2011,  5 }, // ur
+    [3526] = { 2016,  1 }, // us
+    [3527] = { 2017,  4 }, // ut
+    [3528] = { 2021,  2 }, // uu
+    [3530] = { 2023,  1 }, // uw
+    [3544] = { 2024,  1 }, // vA
+    [3545] = { 2025,  2 }, // vB
+    [3547] = { 2027,  1 }, // vD
+    [3570] = { 2028, 17 }, // va
+    [3572] = { 2045,  1 }, // vc
+    [3573] = { 2046,  1 }, // vd
+    [3574] = { 2047,  6 }, // ve
+    [3575] = { 2053,  1 }, // vf
+    [3581] = { 2054,  1 }, // vl
+    [3583] = { 2055,  2 }, // vn
+    [3584] = { 2057,  1 }, // vo
+    [3585] = { 2058,  1 }, // vp
+    [3587] = { 2059,  1 }, // vr
+    [3588] = { 2060,  5 }, // vs
+    [3595] = { 2065,  1 }, // vz
+    [3634] = { 2066,  1 }, // wc
+    [3636] = { 2067,  4 }, // we
+    [3637] = { 2071,  1 }, // wf
+    [3646] = { 2072,  1 }, // wo
+    [3647] = { 2073,  1 }, // wp
+    [3649] = { 2074,  2 }, // wr
+    [3650] = { 2076,  1 }, // ws
+    [3696] = { 2077,  3 }, // xc
+    [3697] = { 2080,  1 }, // xd
+    [3699] = { 2081,  1 }, // xf
+    [3701] = { 2082,  2 }, // xh
+    [3702] = { 2084,  1 }, // xi
+    [3705] = { 2085,  2 }, // xl
+    [3706] = { 2087,  1 }, // xm
+    [3707] = { 2088,  1 }, // xn
+    [3708] = { 2089,  4 }, // xo
+    [3711] = { 2093,  2 }, // xr
+    [3712] = { 2095,  2 }, // xs
+    [3714] = { 2097,  2 }, // xu
+    [3715] = { 2099,  1 }, // xv
+    [3716] = { 2100,  1 }, // xw
+    [3756] = { 2101,  2 }, // ya
+    [3758] = { 2103,  2 }, // yc
+    [3760] = { 2105,  1 }, // ye
+    [3761] = { 2106,  1 }, // yf
+    [3764] = { 2107,  1 }, // yi
+    [3770] = { 2108,  1 }, // yo
+    [3774] = { 2109,  1 }, // ys
+    [3776] = { 2110,  2 }, // yu
+    [3818] = { 2112,  1 }, // za
+    [3820] = { 2113,  2 }, // zc
+    [3821] = { 2115,  1 }, // zd
+    [3822] = { 2116,  2 }, // ze
+    [3823] = { 2118,  1 }, // zf
+    [3825] = { 2119,  1 }, // zh
+    [3826] = { 2120,  1 }, // zi
+    [3832] = { 2121,  1 }, // zo
+    [3836] = { 2122,  1 }, // zs
+    [3840] = { 2123,  2 }, // zw
+};
+
+static const html_cref_vcmp_name_t
+html_cref_vcmp_names[] = {
+    "AElig",
+    "AMP",
+    "Aacute",
+    "Abreve",
+    "Acirc",
+    "Acy",
+    "Afr",
+    "Agrave",
+    "Alpha",
+    "Amacr",
+    "And",
+    "Aogon",
+    "Aopf",
+    "ApplyFunction",
+    "Aring",
+    "Assign",
+    "Ascr",
+    "Atilde",
+    "Auml",
+    "Backslash",
+    "Barwed",
+    "Barv",
+    "Bcy",
+    "Bernoullis",
+    "Because",
+    "Beta",
+    "Bfr",
+    "Bopf",
+    "Breve",
+    "Bscr",
+    "Bumpeq",
+    "CHcy",
+    "COPY",
+    "CapitalDifferentialD",
+    "Cayleys",
+    "Cacute",
+    "Cap",
+    "Cconint",
+    "Ccaron",
+    "Ccedil",
+    "Ccirc",
+    "Cdot",
+    "CenterDot",
+    "Cedilla",
+    "Cfr",
+    "Chi",
+    "CircleMinus",
+    "CircleTimes",
+    "CirclePlus",
+    "CircleDot",
+    "ClockwiseContourIntegral",
+    "CloseCurlyDoubleQuote",
+    "CloseCurlyQuote",
+    "CounterClockwiseContourIntegral",
+    "ContourIntegral",
+    "Congruent",
+    "Coproduct",
+    "Colone",
+    "Conint",
+    "Colon",
+    "Copf",
+    "Cross",
+    "Cscr",
+    "CupCap",
+    "Cup",
+    "DDotrahd",
+    "DD",
+    "DJcy",
+    "DScy",
+    "DZcy",
+    "Dagger",
+    "Dashv",
+    "Darr",
+    "Dcaron",
+    "Dcy",
+    "Delta",
+    "Del",
+    "Dfr",
+    "DiacriticalDoubleAcute",
+    "DiacriticalAcute",
+    "DiacriticalGrave",
+    "DiacriticalTilde",
+    "DiacriticalDot",
+    "DifferentialD",
+    "Diamond",
+    "DoubleLongLeftRightArrow",
+    "DoubleContourIntegral",
+    "DoubleLeftRightArrow",
+    "DoubleLongRightArrow",
+    "DoubleLongLeftArrow",
+    "DownLeftRightVector",
+    "DownRightTeeVector",
+    "DownRightVectorBar",
+    "DoubleUpDownArrow",
+    "DoubleVerticalBar",
+    "DownLeftTeeVector",
+    "DownLeftVectorBar",
+    "DoubleRightArrow",
+    "DownArrowUpArrow",
+    "DoubleDownArrow",
+    "DoubleLeftArrow",
+    "DownRightVector",
+    "DoubleRightTee",
+    "DownLeftVector",
+    "DoubleLeftTee",
+    "DoubleUpArrow",
+    "DownArrowBar",
+    "DownTeeArrow",
+    "DoubleDot",
+    "DownArrow",
+    "DownBreve",
+    "Downarrow",
+    "DotEqual",
+    "DownTee",
+    "DotDot",
+    "Dopf",
+    "Dot",
+    "Dstrok",
+    "Dscr",
+    "ENG",
+    "ETH",
+    "Eacute",
+    "Ecaron",
+    "Ecirc",
+    "Ecy",
+    "Edot",
+    "Efr",
+    "Egrave",
+    "Element",
+    "EmptyVerySmallSquare",
+    "EmptySmallSquare",
+    "Emacr",
+    "Eogon",
+    "Eopf",
+    "Epsilon",
+    "Equilibrium",
+    "EqualTilde",
+    "Equal",
+    "Escr",
+    "Esim",
+    "Eta",
+    "Euml",
+    "ExponentialE",
+    "Exists",
+    "Fcy",
+    "Ffr",
+    "FilledVerySmallSquare",
+    "FilledSmallSquare",
+    "Fouriertrf",
+    "ForAll",
+    "Fopf",
+    "Fscr",
+    "GJcy",
+    "GT",
+    "Gammad",
+    "Gamma",
+    "Gbreve",
+    "Gcedil",
+    "Gcirc",
+    "Gcy",
+    "Gdot",
+    "Gfr",
+    "Gg",
+    "Gopf",
+    "GreaterSlantEqual",
+    "GreaterEqualLess",
+    "GreaterFullEqual",
+    "GreaterGreater",
+    "GreaterEqual",
+    "GreaterTilde",
+    "GreaterLess",
+    "Gscr",
+    "Gt",
+    "HARDcy",
+    "Hacek",
+    "Hat",
+    "Hcirc",
+    "Hfr",
+    "HilbertSpace",
+    "HorizontalLine",
+    "Hopf",
+    "Hstrok",
+    "Hscr",
+    "HumpDownHump",
+    "HumpEqual",
+    "IEcy",
+    "IJlig",
+    "IOcy",
+    "Iacute",
+    "Icirc",
+    "Icy",
+    "Idot",
+    "Ifr",
+    "Igrave",
+    "ImaginaryI",
+    "Implies",
+    "Imacr",
+    "Im",
+    "InvisibleComma",
+    "InvisibleTimes",
+    "Intersection",
+    "Integral",
+    "Int",
+    "Iogon",
+    "Iopf",
+    "Iota",
+    "Iscr",
+    "Itilde",
+    "Iukcy",
+    "Iuml",
+    "Jcirc",
+    "Jcy",
+    "Jfr",
+    "Jopf",
+    "Jsercy",
+    "Jscr",
+    "Jukcy",
+    "KHcy",
+    "KJcy",
+    "Kappa",
+    "Kcedil",
+    "Kcy",
+    "Kfr",
+    "Kopf",
+    "Kscr",
+    "LJcy",
+    "LT",
+    "Laplacetrf",
+    "Lacute",
+    "Lambda",
+    "Lang",
+    "Larr",
+    "Lcaron",
+    "Lcedil",
+    "Lcy",
+    "LeftArrowRightArrow",
+    "LeftDoubleBracket",
+    "LeftDownTeeVector",
+    "LeftDownVectorBar",
+    "LeftTriangleEqual",
+    "LeftAngleBracket",
+    "LeftUpDownVector",
+    "LessEqualGreater",
+    "LeftRightVector",
+    "LeftTriangleBar",
+    "LeftUpTeeVector",
+    "LeftUpVectorBar",
+    "LeftDownVector",
+    "LeftRightArrow",
+    "Leftrightarrow",
+    "LessSlantEqual",
+    "LeftTeeVector",
+    "LeftVectorBar",
+    "LessFullEqual",
+    "LeftArrowBar",
+    "LeftTeeArrow",
+    "LeftTriangle",
+    "LeftUpVector",
+    "LeftCeiling",
+    "LessGreater",
+    "LeftVector",
+    "LeftArrow",
+    "LeftFloor",
+    "Leftarrow",
+    "LessTilde",
+    "LessLess",
+    "LeftTee",
+    "Lfr",
+    "Lleftarrow",
+    "Ll",
+    "Lmidot",
+    "LongLeftRightArrow",
+    "Longleftrightarrow",
+    "LowerRightArrow",
+    "LongRightArrow",
+    "Longrightarrow",
+    "LowerLeftArrow",
+    "LongLeftArrow",
+    "Longleftarrow",
+    "Lopf",
+    "Lstrok",
+    "Lscr",
+    "Lsh",
+    "Lt",
+    "Map",
+    "Mcy",
+    "MediumSpace",
+    "Mellintrf",
+    "Mfr",
+    "MinusPlus",
+    "Mopf",
+    "Mscr",
+    "Mu",
+    "NJcy",
+    "Nacute",
+    "Ncaron",
+    "Ncedil",
+    "Ncy",
+    "NegativeVeryThinSpace",
+    "NestedGreaterGreater",
+    "NegativeMediumSpace",
+    "NegativeThickSpace",
+    "NegativeThinSpace",
+    "NestedLessLess",
+    "NewLine",
+    "Nfr",
+    "NotNestedGreaterGreater",
+    "NotSquareSupersetEqual",
+    "NotPrecedesSlantEqual",
+    "NotRightTriangleEqual",
+    "NotSucceedsSlantEqual",
+    "NotDoubleVerticalBar",
+    "NotGreaterSlantEqual",
+    "NotLeftTriangleEqual",
+    "NotSquareSubsetEqual",
+    "NotGreaterFullEqual",
+    "NotRightTriangleBar",
+    "NotLeftTriangleBar",
+    "NotGreaterGreater",
+    "NotLessSlantEqual",
+    "NotNestedLessLess",
+    "NotReverseElement",
+    "NotSquareSuperset",
+    "NotTildeFullEqual",
+    "NonBreakingSpace",
+    "NotPrecedesEqual",
+    "NotRightTriangle",
+    "NotSucceedsEqual",
+    "NotSucceedsTilde",
+    "NotSupersetEqual",
+    "NotGreaterEqual",
+    "NotGreaterTilde",
+    "NotHumpDownHump",
+    "NotLeftTriangle",
+    "NotSquareSubset",
+    "NotGreaterLess",
+    "NotLessGreater",
+    "NotSubsetEqual",
+    "NotVerticalBar",
+    "NotEqualTilde",
+    "NotTildeEqual",
+    "NotTildeTilde",
+    "NotCongruent",
+    "NotHumpEqual",
+    "NotLessEqual",
+    "NotLessTilde",
+    "NotLessLess",
+    "NotPrecedes",
+    "NotSucceeds",
+    "NotSuperset",
+    "NotElement",
+    "NotGreater",
+    "NotCupCap",
+    "NotExists",
+    "NotSubset",
+    "NotEqual",
+    "NotTilde",
+    "NoBreak",
+    "NotLess",
+    "Nopf",
+    "Not",
+    "Nscr",
+    "Ntilde",
+    "Nu",
+    "OElig",
+    "Oacute",
+    "Ocirc",
+    "Ocy",
+    "Odblac",
+    "Ofr",
+    "Ograve",
+    "Omicron",
+    "Omacr",
+    "Omega",
+    "Oopf",
+    "OpenCurlyDoubleQuote",
+    "OpenCurlyQuote",
+    "Or",
+    "Oslash",
+    "Oscr",
+    "Otilde",
+    "Otimes",
+    "Ouml",
+    "OverParenthesis",
+    "OverBracket",
+    "OverBrace",
+    "OverBar",
+    "PartialD",
+    "Pcy",
+    "Pfr",
+    "Phi",
+    "Pi",
+    "PlusMinus",
+    "Poincareplane",
+    "Popf",
+    "PrecedesSlantEqual",
+    "PrecedesEqual",
+    "PrecedesTilde",
+    "Proportional",
+    "Proportion",
+    "Precedes",
+    "Product",
+    "Prime",
+    "Pr",
+    "Pscr",
+    "Psi",
+    "QUOT",
+    "Qfr",
+    "Qopf",
+    "Qscr",
+    "RBarr",
+    "REG",
+    "Racute",
+    "Rarrtl",
+    "Rang",
+    "Rarr",
+    "Rcaron",
+    "Rcedil",
+    "Rcy",
+    "ReverseUpEquilibrium",
+    "ReverseEquilibrium",
+    "ReverseElement",
+    "Re",
+    "Rfr",
+    "Rho",
+    "RightArrowLeftArrow",
+    "RightDoubleBracket",
+    "RightDownTeeVector",
+    "RightDownVectorBar",
+    "RightTriangleEqual",
+    "RightAngleBracket",
+    "RightUpDownVector",
+    "RightTriangleBar",
+    "RightUpTeeVector",
+    "RightUpVectorBar",
+    "RightDownVector",
+    "RightTeeVector",
+    "RightVectorBar",
+    "RightArrowBar",
+    "RightTeeArrow",
+    "RightTriangle",
+    "RightUpVector",
+    "RightCeiling",
+    "RightVector",
+    "RightArrow",
+    "RightFloor",
+    "Rightarrow",
+    "RightTee",
+    "RoundImplies",
+    "Ropf",
+    "Rrightarrow",
+    "Rscr",
+    "Rsh",
+    "RuleDelayed",
+    "SHCHcy",
+    "SHcy",
+    "SOFTcy",
+    "Sacute",
+    "Scaron",
+    "Scedil",
+    "Scirc",
+    "Scy",
+    "Sc",
+    "Sfr",
+    "ShortRightArrow",
+    "ShortDownArrow",
+    "ShortLeftArrow",
+    "ShortUpArrow",
+    "Sigma",
+    "SmallCircle",
+    "Sopf",
+    "SquareSupersetEqual",
+    "SquareIntersection",
+    "SquareSubsetEqual",
+    "SquareSuperset",
+    "SquareSubset",
+    "SquareUnion",
+    "Square",
+    "Sqrt",
+    "Sscr",
+    "Star",
+    "SucceedsSlantEqual",
+    "SucceedsEqual",
+    "SucceedsTilde",
+    "SupersetEqual",
+    "SubsetEqual",
+    "Succeeds",
+    "SuchThat",
+    "Superset",
+    "Subset",
+    "Supset",
+    "Sub",
+    "Sum",
+    "Sup",
+    "THORN",
+    "TRADE",
+    "TSHcy",
+    "TScy",
+    "Tab",
+    "Tau",
+    "Tcaron",
+    "Tcedil",
+    "Tcy",
+    "Tfr",
+    "ThickSpace",
+    "Therefore",
+    "ThinSpace",
+    "Theta",
+    "TildeFullEqual",
+    "TildeEqual",
+    "TildeTilde",
+    "Tilde",
+    "Topf",
+    "TripleDot",
+    "Tstrok",
+    "Tscr",
+    "Uarrocir",
+    "Uacute",
+    "Uarr",
+    "Ubreve",
+    "Ubrcy",
+    "Ucirc",
+    "Ucy",
+    "Udblac",
+    "Ufr",
+    "Ugrave",
+    "Umacr",
+    "UnderParenthesis",
+    "UnderBracket",
+    "UnderBrace",
+    "UnionPlus",
+    "UnderBar",
+    "Union",
+    "Uogon",
+    "Uopf",
+    "UpArrowDownArrow",
+    "UpperRightArrow",
+    "UpperLeftArrow",
+    "UpEquilibrium",
+    "UpDownArrow",
+    "Updownarrow",
+    "UpArrowBar",
+    "UpTeeArrow",
+    "UpArrow",
+    "Uparrow",
+    "Upsilon",
+    "UpTee",
+    "Upsi",
+    "Uring",
+    "Uscr",
+    "Utilde",
+    "Uuml",
+    "VDash",
+    "Vbar",
+    "Vcy",
+    "Vdashl",
+    "Vdash",
+    "VerticalSeparator",
+    "VerticalTilde",
+    "VeryThinSpace",
+    "VerticalLine",
+    "VerticalBar",
+    "Verbar",
+    "Vert",
+    "Vee",
+    "Vfr",
+    "Vopf",
+    "Vscr",
+    "Vvdash",
+    "Wcirc",
+    "Wedge",
+    "Wfr",
+    "Wopf",
+    "Wscr",
+    "Xfr",
+    "Xi",
+    "Xopf",
+    "Xscr",
+    "YAcy",
+    "YIcy",
+    "YUcy",
+    "Yacute",
+    "Ycirc",
+    "Ycy",
+    "Yfr",
+    "Yopf",
+    "Yscr",
+    "Yuml",
+    "ZHcy",
+    "Zacute",
+    "Zcaron",
+    "Zcy",
+    "Zdot",
+    "ZeroWidthSpace",
+    "Zeta",
+    "Zfr",
+    "Zopf",
+    "Zscr",
+    "aacute",
+    "abreve",
+    "acirc",
+    "acute",
+    "acE",
+    "acd",
+    "acy",
+    "ac",
+    "aelig",
+    "afr",
+    "af",
+    "agrave",
+    "alefsym",
+    "aleph",
+    "alpha",
+    "amacr",
+    "amalg",
+    "amp",
+    "andslope",
+    "angmsdaa",
+    "angmsdab",
+    "angmsdac",
+    "angmsdad",
+    "angmsdae",
+    "angmsdaf",
+    "angmsdag",
+    "angmsdah",
+    "angrtvbd",
+    "angrtvb",
+    "angzarr",
+    "andand",
+    "angmsd",
+    "angsph",
+    "angle",
+    "angrt",
+    "angst",
+    "andd",
+    "andv",
+    "ange",
+    "and",
+    "ang",
+    "aogon",
+    "aopf",
+    "approxeq",
+    "apacir",
+    "approx",
+    "apid",
+    "apos",
+    "apE",
+    "ape",
+    "ap",
+    "aring",
+    "asympeq",
+    "asymp",
+    "ascr",
+    "ast",
+    "atilde",
+    "auml",
+    "awconint",
+    "awint",
+    "bNot",
+    "backepsilon",
+    "backprime",
+    "backsimeq",
+    "backcong",
+    "barwedge",
+    "backsim",
+    "barvee",
+    "barwed",
+    "bbrktbrk",
+    "bbrk",
+    "bcong",
+    "bcy",
+    "bdquo",
+    "because",
+    "bemptyv",
+    "between",
+    "becaus",
+    "bernou",
+    "bepsi",
+    "beta",
+    "beth",
+    "bfr",
+    "bigtriangledown",
+    "bigtriangleup",
+    "bigotimes",
+    "bigoplus",
+    "bigsqcup",
+    "biguplus",
+    "bigwedge",
+    "bigcirc",
+    "bigodot",
+    "bigstar",
+    "bigcap",
+    "bigcup",
+    "bigvee",
+    "bkarow",
+    "blacktriangleright",
+    "blacktriangledown",
+    "blacktriangleleft",
+    "blacktriangle",
+    "blacklozenge",
+    "blacksquare",
+    "blank",
+    "blk12",
+    "blk14",
+    "blk34",
+    "block",
+    "bnequiv",
+    "bnot",
+    "bne",
+    "boxminus",
+    "boxtimes",
+    "boxplus",
+    "bottom",
+    "bowtie",
+    "boxbox",
+    "boxDL",
+    "boxDR",
+    "boxDl",
+    "boxDr",
+    "boxHD",
+    "boxHU",
+    "boxHd",
+    "boxHu",
+    "boxUL",
+    "boxUR",
+    "boxUl",
+    "boxUr",
+    "boxVH",
+    "boxVL",
+    "boxVR",
+    "boxVh",
+    "boxVl",
+    "boxVr",
+    "boxdL",
+    "boxdR",
+    "boxdl",
+    "boxdr",
+    "boxhD",
+    "boxhU",
+    "boxhd",
+    "boxhu",
+    "boxuL",
+    "boxuR",
+    "boxul",
+    "boxur",
+    "boxvH",
+    "boxvL",
+    "boxvR",
+    "boxvh",
+    "boxvl",
+    "boxvr",
+    "bopf",
+    "boxH",
+    "boxV",
+    "boxh",
+    "boxv",
+    "bot",
+    "bprime",
+    "brvbar",
+    "breve",
+    "bsolhsub",
+    "bsemi",
+    "bsime",
+    "bsolb",
+    "bscr",
+    "bsim",
+    "bsol",
+    "bullet",
+    "bumpeq",
+    "bumpE",
+    "bumpe",
+    "bull",
+    "bump",
+    "capbrcup",
+    "cacute",
+    "capand",
+    "capcap",
+    "capcup",
+    "capdot",
+    "caret",
+    "caron",
+    "caps",
+    "cap",
+    "ccupssm",
+    "ccaron",
+    "ccedil",
+    "ccaps",
+    "ccirc",
+    "ccups",
+    "cdot",
+    "centerdot",
+    "cemptyv",
+    "cedil",
+    "cent",
+    "cfr",
+    "checkmark",
+    "check",
+    "chcy",
+    "chi",
+    "circlearrowright",
+    "circlearrowleft",
+    "circledcirc",
+    "circleddash",
+    "circledast",
+    "circledR",
+    "circledS",
+    "cirfnint",
+    "cirscir",
+    "circeq",
+    "cirmid",
+    "cirE",
+    "circ",
+    "cire",
+    "cir",
+    "clubsuit",
+    "clubs",
+    "complement",
+    "complexes",
+    "coloneq",
+    "congdot",
+    "colone",
+    "commat",
+    "compfn",
+    "conint",
+    "coprod",
+    "copysr",
+    "colon",
+    "comma",
+    "comp",
+    "cong",
+    "copf",
+    "copy",
+    "crarr",
+    "cross",
+    "csube",
+    "csupe",
+    "cscr",
+    "csub",
+    "csup",
+    "ctdot",
+    "curvearrowright",
+    "curvearrowleft",
+    "curlyeqprec",
+    "curlyeqsucc",
+    "curlywedge",
+    "cupbrcap",
+    "curlyvee",
+    "cudarrl",
+    "cudarrr",
+    "cularrp",
+    "curarrm",
+    "cularr",
+    "cupcap",
+    "cupcup",
+    "cupdot",
+    "curarr",
+    "curren",
+    "cuepr",
+    "cuesc",
+    "cupor",
+    "cuvee",
+    "cuwed",
+    "cups",
+    "cup",
+    "cwconint",
+    "cwint",
+    "cylcty",
+    "dArr",
+    "dHar",
+    "dagger",
+    "daleth",
+    "dashv",
+    "darr",
+    "dash",
+    "dbkarow",
+    "dblac",
+    "dcaron",
+    "dcy",
+    "ddagger",
+    "ddotseq",
+    "ddarr",
+    "dd",
+    "demptyv",
+    "delta",
+    "deg",
+    "dfisht",
+    "dfr",
+    "dharl",
+    "dharr",
+    "divideontimes",
+    "diamondsuit",
+    "diamond",
+    "digamma",
+    "divide",
+    "divonx",
+    "diams",
+    "disin",
+    "diam",
+    "die",
+    "div",
+    "djcy",
+    "dlcorn",
+    "dlcrop",
+    "downharpoonright",
+    "downharpoonleft",
+    "doublebarwedge",
+    "downdownarrows",
+    "dotsquare",
+    "downarrow",
+    "doteqdot",
+    "dotminus",
+    "dotplus",
+    "dollar",
+    "doteq",
+    "dopf",
+    "dot",
+    "drbkarow",
+    "drcorn",
+    "drcrop",
+    "dstrok",
+    "dscr",
+    "dscy",
+    "dsol",
+    "dtdot",
+    "dtrif",
+    "dtri",
+    "duarr",
+    "duhar",
+    "dwangle",
+    "dzigrarr",
+    "dzcy",
+    "eDDot",
+    "eDot",
+    "eacute",
+    "easter",
+    "ecaron",
+    "ecolon",
+    "ecirc",
+    "ecir",
+    "ecy",
+    "edot",
+    "ee",
+    "efDot",
+    "efr",
+    "egrave",
+    "egsdot",
+    "egs",
+    "eg",
+    "elinters",
+    "elsdot",
+    "ell",
+    "els",
+    "el",
+    "emptyset",
+    "emptyv",
+    "emsp13",
+    "emsp14",
+    "emacr",
+    "empty",
+    "emsp",
+    "ensp",
+    "eng",
+    "eogon",
+    "eopf",
+    "epsilon",
+    "eparsl",
+    "eplus",
+    "epsiv",
+    "epar",
+    "epsi",
+    "eqslantless",
+    "eqslantgtr",
+    "eqvparsl",
+    "eqcolon",
+    "equivDD",
+    "eqcirc",
+    "equals",
+    "equest",
+    "eqsim",
+    "equiv",
+    "erDot",
+    "erarr",
+    "esdot",
+    "escr",
+    "esim",
+    "eta",
+    "eth",
+    "euml",
+    "euro",
+    "exponentiale",
+    "expectation",
+    "exist",
+    "excl",
+    "fallingdotseq",
+    "fcy",
+    "female",
+    "ffilig",
+    "ffllig",
+    "fflig",
+    "ffr",
+    "filig",
+    "fjlig",
+    "fllig",
+    "fltns",
+    "flat",
+    "fnof",
+    "forall",
+    "forkv",
+    "fopf",
+    "fork",
+    "fpartint",
+    "frac12",
+    "frac13",
+    "frac14",
+    "frac15",
+    "frac16",
+    "frac18",
+    "frac23",
+    "frac25",
+    "frac34",
+    "frac35",
+    "frac38",
+    "frac45",
+    "frac56",
+    "frac58",
+    "frac78",
+    "frasl",
+    "frown",
+    "fscr",
+    "gEl",
+    "gE",
+    "gacute",
+    "gammad",
+    "gamma",
+    "gap",
+    "gbreve",
+    "gcirc",
+    "gcy",
+    "gdot",
+    "geqslant",
+    "gesdotol",
+    "gesdoto",
+    "gesdot",
+    "gesles",
+    "gescc",
+    "geqq",
+    "gesl",
+    "gel",
+    "geq",
+    "ges",
+    "ge",
+    "gfr",
+    "ggg",
+    "gg",
+    "gimel",
+    "gjcy",
+    "glE",
+    "gla",
+    "glj",
+    "gl",
+    "gnapprox",
+    "gneqq",
+    "gnsim",
+    "gnap",
+    "gneq",
+    "gnE",
+    "gne",
+    "gopf",
+    "grave",
+    "gsime",
+    "gsiml",
+    "gscr",
+    "gsim",
+    "gtreqqless",
+    "gtrapprox",
+    "gtreqless",
+    "gtquest",
+    "gtrless",
+    "gtlPar",
+    "gtrarr",
+    "gtrdot",
+    "gtrsim",
+    "gtcir",
+    "gtdot",
+    "gtcc",
+    "gt",
+    "gvertneqq",
+    "gvnE",
+    "hArr",
+    "harrcir",
+    "hairsp",
+    "hamilt",
+    "hardcy",
+    "harrw",
+    "half",
+    "harr",
+    "hbar",
+    "hcirc",
+    "heartsuit",
+    "hearts",
+    "hellip",
+    "hercon",
+    "hfr",
+    "hksearow",
+    "hkswarow",
+    "hookrightarrow",
+    "hookleftarrow",
+    "homtht",
+    "horbar",
+    "hoarr",
+    "hopf",
+    "hslash",
+    "hstrok",
+    "hscr",
+    "hybull",
+    "hyphen",
+    "iacute",
+    "icirc",
+    "icy",
+    "ic",
+    "iexcl",
+    "iecy",
+    "iff",
+    "ifr",
+    "igrave",
+    "iiiint",
+    "iinfin",
+    "iiint",
+    "iiota",
+    "ii",
+    "ijlig",
+    "imagline",
+    "imagpart",
+    "imacr",
+    "image",
+    "imath",
+    "imped",
+    "imof",
+    "infintie",
+    "integers",
+    "intercal",
+    "intlarhk",
+    "intprod",
+    "incare",
+    "inodot",
+    "intcal",
+    "infin",
+    "int",
+    "in",
+    "iogon",
+    "iocy",
+    "iopf",
+    "iota",
+    "iprod",
+    "iquest",
+    "isindot",
+    "isinsv",
+    "isinE",
+    "isins",
+    "isinv",
+    "iscr",
+    "isin",
+    "itilde",
+    "it",
+    "iukcy",
+    "iuml",
+    "jcirc",
+    "jcy",
+    "jfr",
+    "jmath",
+    "jopf",
+    "jsercy",
+    "jscr",
+    "jukcy",
+    "kappav",
+    "kappa",
+    "kcedil",
+    "kcy",
+    "kfr",
+    "kgreen",
+    "khcy",
+    "kjcy",
+    "kopf",
+    "kscr",
+    "lAtail",
+    "lAarr",
+    "lArr",
+    "lBarr",
+    "lEg",
+    "lE",
+    "lHar",
+    "laemptyv",
+    "larrbfs",
+    "larrsim",
+    "lacute",
+    "lagran",
+    "lambda",
+    "langle",
+    "larrfs",
+    "larrhk",
+    "larrlp",
+    "larrpl",
+    "larrtl",
+    "latail",
+    "langd",
+    "laquo",
+    "larrb",
+    "lates",
+    "lang",
+    "larr",
+    "late",
+    "lap",
+    "lat",
+    "lbrksld",
+    "lbrkslu",
+    "lbrace",
+    "lbrack",
+    "lbarr",
+    "lbbrk",
+    "lbrke",
+    "lcaron",
+    "lcedil",
+    "lceil",
+    "lcub",
+    "lcy",
+    "ldrushar",
+    "ldrdhar",
+    "ldquor",
+    "ldquo",
+    "ldca",
+    "ldsh",
+    "leftrightsquigarrow",
+    "leftrightharpoons",
+    "leftharpoondown",
+    "leftrightarrows",
+    "leftleftarrows",
+    "leftrightarrow",
+    "leftthreetimes",
+    "leftarrowtail",
+    "leftharpoonup",
+    "lessapprox",
+    "lesseqqgtr",
+    "leftarrow",
+    "lesseqgtr",
+    "leqslant",
+    "lesdotor",
+    "lesdoto",
+    "lessdot",
+    "lessgtr",
+    "lesssim",
+    "lesdot",
+    "lesges",
+    "lescc",
+    "leqq",
+    "lesg",
+    "leg",
+    "leq",
+    "les",
+    "le",
+    "lfisht",
+    "lfloor",
+    "lfr",
+    "lgE",
+    "lg",
+    "lharul",
+    "lhard",
+    "lharu",
+    "lhblk",
+    "ljcy",
+    "llcorner",
+    "llhard",
+    "llarr",
+    "lltri",
+    "ll",
+    "lmoustache",
+    "lmidot",
+    "lmoust",
+    "lnapprox",
+    "lneqq",
+    "lnsim",
+    "lnap",
+    "lneq",
+    "lnE",
+    "lne",
+    "longleftrightarrow",
+    "longrightarrow",
+    "looparrowright",
+    "longleftarrow",
+    "looparrowleft",
+    "longmapsto",
+    "lotimes",
+    "lozenge",
+    "loplus",
+    "lowast",
+    "lowbar",
+    "loang",
+    "loarr",
+    "lobrk",
+    "lopar",
+    "lopf",
+    "lozf",
+    "loz",
+    "lparlt",
+    "lpar",
+    "lrcorner",
+    "lrhard",
+    "lrarr",
+    "lrhar",
+    "lrtri",
+    "lrm",
+    "lsaquo",
+    "lsquor",
+    "lstrok",
+    "lsime",
+    "lsimg",
+    "lsquo",
+    "lscr",
+    "lsim",
+    "lsqb",
+    "lsh",
+    "ltquest",
+    "lthree",
+    "ltimes",
+    "ltlarr",
+    "ltrPar",
+    "ltcir",
+    "ltdot",
+    "ltrie",
+    "ltrif",
+    "ltcc",
+    "ltri",
+    "lt",
+    "lurdshar",
+    "luruhar",
+    "lvertneqq",
+    "lvnE",
+    "mDDot",
+    "mapstodown",
+    "mapstoleft",
+    "mapstoup",
+    "maltese",
+    "mapsto",
+    "marker",
+    "macr",
+    "male",
+    "malt",
+    "map",
+    "mcomma",
+    "mcy",
+    "mdash",
+    "measuredangle",
+    "mfr",
+    "mho",
+    "minusdu",
+    "midast",
+    "midcir",
+    "middot",
+    "minusb",
+    "minusd",
+    "micro",
+    "minus",
+    "mid",
+    "mlcp",
+    "mldr",
+    "mnplus",
+    "models",
+    "mopf",
+    "mp",
+    "mstpos",
+    "mscr",
+    "multimap",
+    "mumap",
+    "mu",
+    "nGtv",
+    "nGg",
+    "nGt",
+    "nLeftrightarrow",
+    "nLeftarrow",
+    "nLtv",
+    "nLl",
+    "nLt",
+    "nRightarrow",
+    "nVDash",
+    "nVdash",
+    "naturals",
+    "napprox",
+    "natural",
+    "nacute",
+    "nabla",
+    "napid",
+    "napos",
+    "natur",
+    "nang",
+    "napE",
+    "nap",
+    "nbumpe",
+    "nbump",
+    "nbsp",
+    "ncongdot",
+    "ncaron",
+    "ncedil",
+    "ncong",
+    "ncap",
+    "ncup",
+    "ncy",
+    "ndash",
+    "nearrow",
+    "nexists",
+    "nearhk",
+    "nequiv",
+    "nesear",
+    "nexist",
+    "neArr",
+    "nearr",
+    "nedot",
+    "nesim",
+    "ne",
+    "nfr",
+    "ngeqslant",
+    "ngeqq",
+    "ngsim",
+    "ngeq",
+    "nges",
+    "ngtr",
+    "ngE",
+    "nge",
+    "ngt",
+    "nhArr",
+    "nharr",
+    "nhpar",
+    "nisd",
+    "nis",
+    "niv",
+    "ni",
+    "njcy",
+    "nleftrightarrow",
+    "nleftarrow",
+    "nleqslant",
+    "nltrie",
+    "nlArr",
+    "nlarr",
+    "nleqq",
+    "nless",
+    "nlsim",
+    "nltri",
+    "nldr",
+    "nleq",
+    "nles",
+    "nlE",
+    "nle",
+    "nlt",
+    "nmid",
+    "notindot",
+    "notinva",
+    "notinvb",
+    "notinvc",
+    "notniva",
+    "notnivb",
+    "notnivc",
+    "notinE",
+    "notin",
+    "notni",
+    "nopf",
+    "not",
+    "nparallel",
+    "npolint",
+    "npreceq",
+    "nparsl",
+    "nprcue",
+    "npart",
+    "nprec",
+    "npar",
+    "npre",
+    "npr",
+    "nrightarrow",
+    "nrarrc",
+    "nrarrw",
+    "nrtrie",
+    "nrArr",
+    "nrarr",
+    "nrtri",
+    "nshortparallel",
+    "nsubseteqq",
+    "nsupseteqq",
+    "nshortmid",
+    "nsubseteq",
+    "nsupseteq",
+    "nsqsube",
+    "nsqsupe",
+    "nsubset",
+    "nsucceq",
+    "nsupset",
+    "nsccue",
+    "nsimeq",
+    "nsime",
+    "nsmid",
+    "nspar",
+    "nsubE",
+    "nsube",
+    "nsucc",
+    "nsupE",
+    "nsupe",
+    "nsce",
+    "nscr",
+    "nsim",
+    "nsub",
+    "nsup",
+    "nsc",
+    "ntrianglerighteq",
+    "ntrianglelefteq",
+    "ntriangleright",
+    "ntriangleleft",
+    "ntilde",
+    "ntgl",
+    "ntlg",
+    "numero",
+    "numsp",
+    "num",
+    "nu",
+    "nvinfin",
+    "nvltrie",
+    "nvrtrie",
+    "nvDash",
+    "nvHarr",
+    "nvdash",
+    "nvlArr",
+    "nvrArr",
+    "nvsim",
+    "nvap",
+    "nvge",
+    "nvgt",
+    "nvle",
+    "nvlt",
+    "nwarrow",
+    "nwarhk",
+    "nwnear",
+    "nwArr",
+    "nwarr",
+    "oS",
+    "oacute",
+    "oast",
+    "ocirc",
+    "ocir",
+    "ocy",
+    "odblac",
+    "odsold",
+    "odash",
+    "odiv",
+    "odot",
+    "oelig",
+    "ofcir",
+    "ofr",
+    "ograve",
+    "ogon",
+    "ogt",
+    "ohbar",
+    "ohm",
+    "oint",
+    "olcross",
+    "olarr",
+    "olcir",
+    "oline",
+    "olt",
+    "omicron",
+    "ominus",
+    "omacr",
+    "omega",
+    "omid",
+    "oopf",
+    "operp",
+    "oplus",
+    "opar",
+    "orderof",
+    "orslope",
+    "origof",
+    "orarr",
+    "order",
+    "ordf",
+    "ordm",
+    "oror",
+    "ord",
+    "orv",
+    "or",
+    "oslash",
+    "oscr",
+    "osol",
+    "otimesas",
+    "otilde",
+    "otimes",
+    "ouml",
+    "ovbar",
+    "parallel",
+    "parsim",
+    "parsl",
+    "para",
+    "part",
+    "par",
+    "pcy",
+    "pertenk",
+    "percnt",
+    "period",
+    "permil",
+    "perp",
+    "pfr",
+    "phmmat",
+    "phone",
+    "phiv",
+    "phi",
+    "pitchfork",
+    "piv",
+    "pi",
+    "plusacir",
+    "planckh",
+    "pluscir",
+    "plussim",
+    "plustwo",
+    "planck",
+    "plankv",
+    "plusdo",
+    "plusdu",
+    "plusmn",
+    "plusb",
+    "pluse",
+    "plus",
+    "pm",
+    "pointint",
+    "pound",
+    "popf",
+    "preccurlyeq",
+    "precnapprox",
+    "precapprox",
+    "precneqq",
+    "precnsim",
+    "profalar",
+    "profline",
+    "profsurf",
+    "precsim",
+    "preceq",
+    "primes",
+    "prnsim",
+    "propto",
+    "prurel",
+    "prcue",
+    "prime",
+    "prnap",
+    "prsim",
+    "prap",
+    "prec",
+    "prnE",
+    "prod",
+    "prop",
+    "prE",
+    "pre",
+    "pr",
+    "pscr",
+    "psi",
+    "puncsp",
+    "qfr",
+    "qint",
+    "qopf",
+    "qprime",
+    "qscr",
+    "quaternions",
+    "quatint",
+    "questeq",
+    "quest",
+    "quot",
+    "rAtail",
+    "rAarr",
+    "rArr",
+    "rBarr",
+    "rHar",
+    "rationals",
+    "raemptyv",
+    "rarrbfs",
+    "rarrsim",
+    "racute",
+    "rangle",
+    "rarrap",
+    "rarrfs",
+    "rarrhk",
+    "rarrlp",
+    "rarrpl",
+    "rarrtl",
+    "ratail",
+    "radic",
+    "rangd",
+    "range",
+    "raquo",
+    "rarrb",
+    "rarrc",
+    "rarrw",
+    "ratio",
+    "race",
+    "rang",
+    "rarr",
+    "rbrksld",
+    "rbrkslu",
+    "rbrace",
+    "rbrack",
+    "rbarr",
+    "rbbrk",
+    "rbrke",
+    "rcaron",
+    "rcedil",
+    "rceil",
+    "rcub",
+    "rcy",
+    "rdldhar",
+    "rdquor",
+    "rdquo",
+    "rdca",
+    "rdsh",
+    "realpart",
+    "realine",
+    "reals",
+    "real",
+    "rect",
+    "reg",
+    "rfisht",
+    "rfloor",
+    "rfr",
+    "rharul",
+    "rhard",
+    "rharu",
+    "rhov",
+    "rho",
+    "rightleftharpoons",
+    "rightharpoondown",
+    "rightrightarrows",
+    "rightleftarrows",
+    "rightsquigarrow",
+    "rightthreetimes",
+    "rightarrowtail",
+    "rightharpoonup",
+    "risingdotseq",
+    "rightarrow",
+    "ring",
+    "rlarr",
+    "rlhar",
+    "rlm",
+    "rmoustache",
+    "rmoust",
+    "rnmid",
+    "rotimes",
+    "roplus",
+    "roang",
+    "roarr",
+    "robrk",
+    "ropar",
+    "ropf",
+    "rppolint",
+    "rpargt",
+    "rpar",
+    "rrarr",
+    "rsaquo",
+    "rsquor",
+    "rsquo",
+    "rscr",
+    "rsqb",
+    "rsh",
+    "rtriltri",
+    "rthree",
+    "rtimes",
+    "rtrie",
+    "rtrif",
+    "rtri",
+    "ruluhar",
+    "rx",
+    "sacute",
+    "sbquo",
+    "scpolint",
+    "scaron",
+    "scedil",
+    "scnsim",
+    "sccue",
+    "scirc",
+    "scnap",
+    "scsim",
+    "scap",
+    "scnE",
+    "scE",
+    "sce",
+    "scy",
+    "sc",
+    "sdotb",
+    "sdote",
+    "sdot",
+    "setminus",
+    "searrow",
+    "searhk",
+    "seswar",
+    "seArr",
+    "searr",
+    "setmn",
+    "sect",
+    "semi",
+    "sext",
+    "sfrown",
+    "sfr",
+    "shortparallel",
+    "shortmid",
+    "shchcy",
+    "sharp",
+    "shcy",
+    "shy",
+    "simplus",
+    "simrarr",
+    "sigmaf",
+    "sigmav",
+    "simdot",
+    "sigma",
+    "simeq",
+    "simgE",
+    "simlE",
+    "simne",
+    "sime",
+    "simg",
+    "siml",
+    "sim",
+    "slarr",
+    "smallsetminus",
+    "smeparsl",
+    "smashp",
+    "smile",
+    "smtes",
+    "smid",
+    "smte",
+    "smt",
+    "softcy",
+    "solbar",
+    "solb",
+    "sopf",
+    "sol",
+    "spadesuit",
+    "spades",
+    "spar",
+    "sqsubseteq",
+    "sqsupseteq",
+    "sqsubset",
+    "sqsupset",
+    "sqcaps",
+    "sqcups",
+    "sqsube",
+    "sqsupe",
+    "square",
+    "squarf",
+    "sqcap",
+    "sqcup",
+    "sqsub",
+    "sqsup",
+    "squf",
+    "squ",
+    "srarr",
+    "ssetmn",
+    "ssmile",
+    "sstarf",
+    "sscr",
+    "straightepsilon",
+    "straightphi",
+    "starf",
+    "strns",
+    "star",
+    "succcurlyeq",
+    "succnapprox",
+    "subsetneqq",
+    "succapprox",
+    "supsetneqq",
+    "subseteqq",
+    "subsetneq",
+    "supseteqq",
+    "supsetneq",
+    "subseteq",
+    "succneqq",
+    "succnsim",
+    "supseteq",
+    "subedot",
+    "submult",
+    "subplus",
+    "subrarr",
+    "succsim",
+    "supdsub",
+    "supedot",
+    "suphsol",
+    "suphsub",
+    "suplarr",
+    "supmult",
+    "supplus",
+    "subdot",
+    "subset",
+    "subsim",
+    "subsub",
+    "subsup",
+    "succeq",
+    "supdot",
+    "supset",
+    "supsim",
+    "supsub",
+    "supsup",
+    "subnE",
+    "subne",
+    "supnE",
+    "supne",
+    "subE",
+    "sube",
+    "succ",
+    "sung",
+    "sup1",
+    "sup2",
+    "sup3",
+    "supE",
+    "supe",
+    "sub",
+    "sum",
+    "sup",
+    "swarrow",
+    "swarhk",
+    "swnwar",
+    "swArr",
+    "swarr",
+    "szlig",
+    "target",
+    "tau",
+    "tbrk",
+    "tcaron",
+    "tcedil",
+    "tcy",
+    "tdot",
+    "telrec",
+    "tfr",
+    "thickapprox",
+    "therefore",
+    "thetasym",
+    "thicksim",
+    "there4",
+    "thetav",
+    "thinsp",
+    "thksim",
+    "theta",
+    "thkap",
+    "thorn",
+    "timesbar",
+    "timesb",
+    "timesd",
+    "tilde",
+    "times",
+    "tint",
+    "topfork",
+    "topbot",
+    "topcir",
+    "toea",
+    "topf",
+    "tosa",
+    "top",
+    "tprime",
+    "trianglerighteq",
+    "trianglelefteq",
+    "triangleright",
+    "triangledown",
+    "triangleleft",
+    "triangleq",
+    "triangle",
+    "triminus",
+    "trpezium",
+    "triplus",
+    "tritime",
+    "tridot",
+    "trade",
+    "trisb",
+    "trie",
+    "tstrok",
+    "tshcy",
+    "tscr",
+    "tscy",
+    "twoheadrightarrow",
+    "twoheadleftarrow",
+    "twixt",
+    "uArr",
+    "uHar",
+    "uacute",
+    "uarr",
+    "ubreve",
+    "ubrcy",
+    "ucirc",
+    "ucy",
+    "udblac",
+    "udarr",
+    "udhar",
+    "ufisht",
+    "ufr",
+    "ugrave",
+    "uharl",
+    "uharr",
+    "uhblk",
+    "ulcorner",
+    "ulcorn",
+    "ulcrop",
+    "ultri",
+    "umacr",
+    "uml",
+    "uogon",
+    "uopf",
+    "upharpoonright",
+    "upharpoonleft",
+    "updownarrow",
+    "upuparrows",
+    "uparrow",
+    "upsilon",
+    "uplus",
+    "upsih",
+    "upsi",
+    "urcorner",
+    "urcorn",
+    "urcrop",
+    "uring",
+    "urtri",
+    "uscr",
+    "utilde",
+    "utdot",
+    "utrif",
+    "utri",
+    "uuarr",
+    "uuml",
+    "uwangle",
+    "vArr",
+    "vBarv",
+    "vBar",
+    "vDash",
+    "vartriangleright",
+    "vartriangleleft",
+    "varsubsetneqq",
+    "varsupsetneqq",
+    "varsubsetneq",
+    "varsupsetneq",
+    "varepsilon",
+    "varnothing",
+    "varpropto",
+    "varkappa",
+    "varsigma",
+    "vartheta",
+    "vangrt",
+    "varphi",
+    "varrho",
+    "varpi",
+    "varr",
+    "vcy",
+    "vdash",
+    "veebar",
+    "vellip",
+    "verbar",
+    "veeeq",
+    "vert",
+    "vee",
+    "vfr",
+    "vltri",
+    "vnsub",
+    "vnsup",
+    "vopf",
+    "vprop",
+    "vrtri",
+    "vsubnE",
+    "vsubne",
+    "vsupnE",
+    "vsupne",
+    "vscr",
+    "vzigzag",
+    "wcirc",
+    "wedbar",
+    "wedgeq",
+    "weierp",
+    "wedge",
+    "wfr",
+    "wopf",
+    "wp",
+    "wreath",
+    "wr",
+    "wscr",
+    "xcirc",
+    "xcap",
+    "xcup",
+    "xdtri",
+    "xfr",
+    "xhArr",
+    "xharr",
+    "xi",
+    "xlArr",
+    "xlarr",
+    "xmap",
+    "xnis",
+    "xoplus",
+    "xotime",
+    "xodot",
+    "xopf",
+    "xrArr",
+    "xrarr",
+    "xsqcup",
+    "xscr",
+    "xuplus",
+    "xutri",
+    "xvee",
+    "xwedge",
+    "yacute",
+    "yacy",
+    "ycirc",
+    "ycy",
+    "yen",
+    "yfr",
+    "yicy",
+    "yopf",
+    "yscr",
+    "yucy",
+    "yuml",
+    "zacute",
+    "zcaron",
+    "zcy",
+    "zdot",
+    "zeetrf",
+    "zeta",
+    "zfr",
+    "zhcy",
+    "zigrarr",
+    "zopf",
+    "zscr",
+    "zwnj",
+    "zwj",
+};
+
+static const struct html_cref_vcmp_cand_t
+html_cref_vcmp_cands[] = {
+    {  5,     0 }, // AElig
+    {  3,     4 }, // AMP
+    {  6,     7 }, // Aacute
+    {  6,    11 }, // Abreve
+    {  5,    15 }, // Acirc
+    {  3,    19 }, // Acy
+    {  3,    23 }, // Afr
+    {  6,    29 }, // Agrave
+    {  5,    33 }, // Alpha
+    {  5,    37 }, // Amacr
+    {  3,    41 }, // And
+    {  5,    46 }, // Aogon
+    {  4,    50 }, // Aopf
+    { 13,    56 }, // ApplyFunction
+    {  5,    61 }, // Aring
+    {  6,    71 }, // Assign
+    {  4,    65 }, // Ascr
+    {  6,    76 }, // Atilde
+    {  4,    80 }, // Auml
+    {  9,    84 }, // Backslash
+    {  6,    94 }, // Barwed
+    {  4,    89 }, // Barv
+    {  3,    99 }, // Bcy
+    { 10,   108 }, // Bernoullis
+    {  7,   103 }, // Because
+    {  4,   113 }, // Beta
+    {  3,   117 }, // Bfr
+    {  4,   123 }, // Bopf
+    {  5,   129 }, // Breve
+    {  4,   133 }, // Bscr
+    {  6,   138 }, // Bumpeq
+    {  4,   143 }, // CHcy
+    {  4,   147 }, // COPY
+    { 20,   160 }, // CapitalDifferentialD
+    {  7,   165 }, // Cayleys
+    {  6,   151 }, // Cacute
+    {  3,   155 }, // Cap
+    {  7,   182 }, // Cconint
+    {  6,   170 }, // Ccaron
+    {  6,   174 }, // Ccedil
+    {  5,   178 }, // Ccirc
+    {  4,   187 }, // Cdot
+    {  9,   195 }, // CenterDot
+    {  7,   191 }, // Cedilla
+    {  3,   199 }, // Cfr
+    {  3,   204 }, // Chi
+    { 11,   213 }, // CircleMinus
+    { 11,   223 }, // CircleTimes
+    { 10,   218 }, // CirclePlus
+    {  9,   208 }, // CircleDot
+    { 24,   228 }, // ClockwiseContourIntegral
+    { 21,   233 }, // CloseCurlyDoubleQuote
+    { 15,   238 }, // CloseCurlyQuote
+    { 31,   278 }, // CounterClockwiseContourIntegral
+    { 15,   263 }, // ContourIntegral
+    {  9,   253 }, // Congruent
+    {  9,   273 }, // Coproduct
+    {  6,   248 }, // Colone
+    {  6,   258 }, // Conint
+    {  5,   243 }, // Colon
+    {  4,   268 }, // Copf
+    {  5,   283 }, // Cross
+    {  4,   288 }, // Cscr
+    {  6,   299 }, // CupCap
+    {  3,   294 }, // Cup
+    {  8,   309 }, // DDotrahd
+    {  2,   304 }, // DD
+    {  4,   314 }, // DJcy
+    {  4,   318 }, // DScy
+    {  4,   322 }, // DZcy
+    {  6,   326 }, // Dagger
+    {  5,   336 }, // Dashv
+    {  4,   331 }, // Darr
+    {  6,   341 }, // Dcaron
+    {  3,   345 }, // Dcy
+    {  5,   354 }, // Delta
+    {  3,   349 }, // Del
+    {  3,   358 }, // Dfr
+    { 22,   372 }, // DiacriticalDoubleAcute
+    { 16,   364 }, // DiacriticalAcute
+    { 16,   376 }, // DiacriticalGrave
+    { 16,   379 }, // DiacriticalTilde
+    { 14,   368 }, // DiacriticalDot
+    { 13,   388 }, // DifferentialD
+    {  7,   383 }, // Diamond
+    { 24,   447 }, // DoubleLongLeftRightArrow
+    { 21,   413 }, // DoubleContourIntegral
+    { 20,   432 }, // DoubleLeftRightArrow
+    { 20,   452 }, // DoubleLongRightArrow
+    { 19,   442 }, // DoubleLongLeftArrow
+    { 19,   501 }, // DownLeftRightVector
+    { 18,   521 }, // DownRightTeeVector
+    { 18,   531 }, // DownRightVectorBar
+    { 17,   472 }, // DoubleUpDownArrow
+    { 17,   477 }, // DoubleVerticalBar
+    { 17,   506 }, // DownLeftTeeVector
+    { 17,   516 }, // DownLeftVectorBar
+    { 16,   457 }, // DoubleRightArrow
+    { 16,   492 }, // DownArrowUpArrow
+    { 15,   422 }, // DoubleDownArrow
+    { 15,   427 }, // DoubleLeftArrow
+    { 15,   526 }, // DownRightVector
+    { 14,   462 }, // DoubleRightTee
+    { 14,   511 }, // DownLeftVector
+    { 13,   437 }, // DoubleLeftTee
+    { 13,   467 }, // DoubleUpArrow
+    { 12,   487 }, // DownArrowBar
+    { 12,   541 }, // DownTeeArrow
+    {  9,   418 }, // DoubleDot
+    {  9,   482 }, // DownArrow
+    {  9,   497 }, // DownBreve
+    {  9,   546 }, // Downarrow
+    {  8,   408 }, // DotEqual
+    {  7,   536 }, // DownTee
+    {  6,   403 }, // DotDot
+    {  4,   393 }, // Dopf
+    {  3,   399 }, // Dot
+    {  6,   557 }, // Dstrok
+    {  4,   551 }, // Dscr
+    {  3,   561 }, // ENG
+    {  3,   565 }, // ETH
+    {  6,   569 }, // Eacute
+    {  6,   573 }, // Ecaron
+    {  5,   577 }, // Ecirc
+    {  3,   581 }, // Ecy
+    {  4,   585 }, // Edot
+    {  3,   589 }, // Efr
+    {  6,   595 }, // Egrave
+    {  7,   599 }, // Element
+    { 20,   613 }, // EmptyVerySmallSquare
+    { 16,   608 }, // EmptySmallSquare
+    {  5,   604 }, // Emacr
+    {  5,   618 }, // Eogon
+    {  4,   622 }, // Eopf
+    {  7,   628 }, // Epsilon
+    { 11,   642 }, // Equilibrium
+    { 10,   637 }, // EqualTilde
+    {  5,   632 }, // Equal
+    {  4,   647 }, // Escr
+    {  4,   652 }, // Esim
+    {  3,   657 }, // Eta
+    {  4,   661 }, // Euml
+    { 12,   670 }, // ExponentialE
+    {  6,   665 }, // Exists
+    {  3,   675 }, // Fcy
+    {  3,   679 }, // Ffr
+    { 21,   690 }, // FilledVerySmallSquare
+    { 17,   685 }, // FilledSmallSquare
+    { 10,   706 }, // Fouriertrf
+    {  6,   701 }, // ForAll
+    {  4,   695 }, // Fopf
+    {  4,   711 }, // Fscr
+    {  4,   716 }, // GJcy
+    {  2,   720 }, // GT
+    {  6,   727 }, // Gammad
+    {  5,   723 }, // Gamma
+    {  6,   731 }, // Gbreve
+    {  6,   735 }, // Gcedil
+    {  5,   739 }, // Gcirc
+    {  3,   743 }, // Gcy
+    {  4,   747 }, // Gdot
+    {  3,   751 }, // Gfr
+    {  2,   757 }, // Gg
+    {  4,   762 }, // Gopf
+    { 17,   793 }, // GreaterSlantEqual
+    { 16,   773 }, // GreaterEqualLess
+    { 16,   778 }, // GreaterFullEqual
+    { 14,   783 }, // GreaterGreater
+    { 12,   768 }, // GreaterEqual
+    { 12,   798 }, // GreaterTilde
+    { 11,   788 }, // GreaterLess
+    {  4,   803 }, // Gscr
+    {  2,   809 }, // Gt
+    {  6,   814 }, // HARDcy
+    {  5,   818 }, // Hacek
+    {  3,   822 }, // Hat
+    {  5,   825 }, // Hcirc
+    {  3,   829 }, // Hfr
+    { 12,   834 }, // HilbertSpace
+    { 14,   844 }, // HorizontalLine
+    {  4,   839 }, // Hopf
+    {  6,   854 }, // Hstrok
+    {  4,   849 }, // Hscr
+    { 12,   858 }, // HumpDownHump
+    {  9,   863 }, // HumpEqual
+    {  4,   868 }, // IEcy
+    {  5,   872 }, // IJlig
+    {  4,   876 }, // IOcy
+    {  6,   880 }, // Iacute
+    {  5,   884 }, // Icirc
+    {  3,   888 }, // Icy
+    {  4,   892 }, // Idot
+    {  3,   896 }, // Ifr
+    {  6,   901 }, // Igrave
+    { 10,   914 }, // ImaginaryI
+    {  7,   919 }, // Implies
+    {  5,   910 }, // Imacr
+    {  2,   905 }, // Im
+    { 14,   939 }, // InvisibleComma
+    { 14,   944 }, // InvisibleTimes
+    { 12,   934 }, // Intersection
+    {  8,   929 }, // Integral
+    {  3,   924 }, // Int
+    {  5,   949 }, // Iogon
+    {  4,   953 }, // Iopf
+    {  4,   959 }, // Iota
+    {  4,   963 }, // Iscr
+    {  6,   968 }, // Itilde
+    {  5,   972 }, // Iukcy
+    {  4,   976 }, // Iuml
+    {  5,   980 }, // Jcirc
+    {  3,   984 }, // Jcy
+    {  3,   988 }, // Jfr
+    {  4,   994 }, // Jopf
+    {  6,  1006 }, // Jsercy
+    {  4,  1000 }, // Jscr
+    {  5,  1010 }, // Jukcy
+    {  4,  1014 }, // KHcy
+    {  4,  1018 }, // KJcy
+    {  5,  1022 }, // Kappa
+    {  6,  1026 }, // Kcedil
+    {  3,  1030 }, // Kcy
+    {  3,  1034 }, // Kfr
+    {  4,  1040 }, // Kopf
+    {  4,  1046 }, // Kscr
+    {  4,  1052 }, // LJcy
+    {  2,  1056 }, // LT
+    { 10,  1072 }, // Laplacetrf
+    {  6,  1059 }, // Lacute
+    {  6,  1063 }, // Lambda
+    {  4,  1067 }, // Lang
+    {  4,  1077 }, // Larr
+    {  6,  1082 }, // Lcaron
+    {  6,  1086 }, // Lcedil
+    {  3,  1090 }, // Lcy
+    { 19,  1109 }, // LeftArrowRightArrow
+    { 17,  1119 }, // LeftDoubleBracket
+    { 17,  1124 }, // LeftDownTeeVector
+    { 17,  1134 }, // LeftDownVectorBar
+    { 17,  1179 }, // LeftTriangleEqual
+    { 16,  1094 }, // LeftAngleBracket
+    { 16,  1184 }, // LeftUpDownVector
+    { 16,  1224 }, // LessEqualGreater
+    { 15,  1149 }, // LeftRightVector
+    { 15,  1174 }, // LeftTriangleBar
+    { 15,  1189 }, // LeftUpTeeVector
+    { 15,  1199 }, // LeftUpVectorBar
+    { 14,  1129 }, // LeftDownVector
+    { 14,  1144 }, // LeftRightArrow
+    { 14,  1219 }, // Leftrightarrow
+    { 14,  1244 }, // LessSlantEqual
+    { 13,  1164 }, // LeftTeeVector
+    { 13,  1209 }, // LeftVectorBar
+    { 13,  1229 }, // LessFullEqual
+    { 12,  1104 }, // LeftArrowBar
+    { 12,  1159 }, // LeftTeeArrow
+    { 12,  1169 }, // LeftTriangle
+    { 12,  1194 }, // LeftUpVector
+    { 11,  1114 }, // LeftCeiling
+    { 11,  1234 }, // LessGreater
+    { 10,  1204 }, // LeftVector
+    {  9,  1099 }, // LeftArrow
+    {  9,  1139 }, // LeftFloor
+    {  9,  1214 }, // Leftarrow
+    {  9,  1249 }, // LessTilde
+    {  8,  1239 }, // LessLess
+    {  7,  1154 }, // LeftTee
+    {  3,  1254 }, // Lfr
+    { 10,  1265 }, // Lleftarrow
+    {  2,  1260 }, // Ll
+    {  6,  1270 }, // Lmidot
+    { 18,  1279 }, // LongLeftRightArrow
+    { 18,  1294 }, // Longleftrightarrow
+    { 15,  1315 }, // LowerRightArrow
+    { 14,  1284 }, // LongRightArrow
+    { 14,  1299 }, // Longrightarrow
+    { 14,  1310 }, // LowerLeftArrow
+    { 13,  1274 }, // LongLeftArrow
+    { 13,  1289 }, // Longleftarrow
+    {  4,  1304 }, // Lopf
+    {  6,  1330 }, // Lstrok
+    {  4,  1320 }, // Lscr
+    {  3,  1325 }, // Lsh
+    {  2,  1334 }, // Lt
+    {  3,  1339 }, // Map
+    {  3,  1344 }, // Mcy
+    { 11,  1348 }, // MediumSpace
+    {  9,  1353 }, // Mellintrf
+    {  3,  1358 }, // Mfr
+    {  9,  1364 }, // MinusPlus
+    {  4,  1369 }, // Mopf
+    {  4,  1375 }, // Mscr
+    {  2,  1380 }, // Mu
+    {  4,  1384 }, // NJcy
+    {  6,  1388 }, // Nacute
+    {  6,  1392 }, // Ncaron
+    {  6,  1396 }, // Ncedil
+    {  3,  1400 }, // Ncy
+    { 21,  1419 }, // NegativeVeryThinSpace
+    { 20,  1424 }, // NestedGreaterGreater
+    { 19,  1404 }, // NegativeMediumSpace
+    { 18,  1409 }, // NegativeThickSpace
+    { 17,  1414 }, // NegativeThinSpace
+    { 14,  1429 }, // NestedLessLess
+    {  7,  1434 }, // NewLine
+    {  3,  1437 }, // Nfr
+    { 23,  1605 }, // NotNestedGreaterGreater
+    { 22,  1677 }, // NotSquareSupersetEqual
+    { 21,  1631 }, // NotPrecedesSlantEqual
+    { 21,  1653 }, // NotRightTriangleEqual
+    { 21,  1707 }, // NotSucceedsSlantEqual
+    { 20,  1472 }, // NotDoubleVerticalBar
+    { 20,  1528 }, // NotGreaterSlantEqual
+    { 20,  1566 }, // NotLeftTriangleEqual
+    { 20,  1665 }, // NotSquareSubsetEqual
+    { 19,  1509 }, // NotGreaterFullEqual
+    { 19,  1646 }, // NotRightTriangleBar
+    { 18,  1559 }, // NotLeftTriangleBar
+    { 17,  1516 }, // NotGreaterGreater
+    { 17,  1593 }, // NotLessSlantEqual
+    { 17,  1612 }, // NotNestedLessLess
+    { 17,  1636 }, // NotReverseElement
+    { 17,  1670 }, // NotSquareSuperset
+    { 17,  1742 }, // NotTildeFullEqual
+    { 16,  1448 }, // NonBreakingSpace
+    { 16,  1624 }, // NotPrecedesEqual
+    { 16,  1641 }, // NotRightTriangle
+    { 16,  1700 }, // NotSucceedsEqual
+    { 16,  1712 }, // NotSucceedsTilde
+    { 16,  1727 }, // NotSupersetEqual
+    { 15,  1504 }, // NotGreaterEqual
+    { 15,  1535 }, // NotGreaterTilde
+    { 15,  1540 }, // NotHumpDownHump
+    { 15,  1554 }, // NotLeftTriangle
+    { 15,  1658 }, // NotSquareSubset
+    { 14,  1523 }, // NotGreaterLess
+    { 14,  1581 }, // NotLessGreater
+    { 14,  1690 }, // NotSubsetEqual
+    { 14,  1752 }, // NotVerticalBar
+    { 13,  1487 }, // NotEqualTilde
+    { 13,  1737 }, // NotTildeEqual
+    { 13,  1747 }, // NotTildeTilde
+    { 12,  1462 }, // NotCongruent
+    { 12,  1547 }, // NotHumpEqual
+    { 12,  1576 }, // NotLessEqual
+    { 12,  1600 }, // NotLessTilde
+    { 11,  1586 }, // NotLessLess
+    { 11,  1619 }, // NotPrecedes
+    { 11,  1695 }, // NotSucceeds
+    { 11,  1719 }, // NotSuperset
+    { 10,  1477 }, // NotElement
+    { 10,  1499 }, // NotGreater
+    {  9,  1467 }, // NotCupCap
+    {  9,  1494 }, // NotExists
+    {  9,  1682 }, // NotSubset
+    {  8,  1482 }, // NotEqual
+    {  8,  1732 }, // NotTilde
+    {  7,  1443 }, // NoBreak
+    {  7,  1571 }, // NotLess
+    {  4,  1452 }, // Nopf
+    {  3,  1457 }, // Not
+    {  4,  1757 }, // Nscr
+    {  6,  1763 }, // Ntilde
+    {  2,  1767 }, // Nu
+    {  5,  1771 }, // OElig
+    {  6,  1775 }, // Oacute
+    {  5,  1779 }, // Ocirc
+    {  3,  1783 }, // Ocy
+    {  6,  1787 }, // Odblac
+    {  3,  1791 }, // Ofr
+    {  6,  1797 }, // Ograve
+    {  7,  1809 }, // Omicron
+    {  5,  1801 }, // Omacr
+    {  5,  1805 }, // Omega
+    {  4,  1813 }, // Oopf
+    { 20,  1819 }, // OpenCurlyDoubleQuote
+    { 14,  1824 }, // OpenCurlyQuote
+    {  2,  1829 }, // Or
+    {  6,  1840 }, // Oslash
+    {  4,  1834 }, // Oscr
+    {  6,  1844 }, // Otilde
+    {  6,  1848 }, // Otimes
+    {  4,  1853 }, // Ouml
+    { 15,  1872 }, // OverParenthesis
+    { 11,  1867 }, // OverBracket
+    {  9,  1862 }, // OverBrace
+    {  7,  1857 }, // OverBar
+    {  8,  1877 }, // PartialD
+    {  3,  1882 }, // Pcy
+    {  3,  1886 }, // Pfr
+    {  3,  1892 }, // Phi
+    {  2,  1896 }, // Pi
+    {  9,  1900 }, // PlusMinus
+    { 13,  1904 }, // Poincareplane
+    {  4,  1909 }, // Popf
+    { 18,  1929 }, // PrecedesSlantEqual
+    { 13,  1924 }, // PrecedesEqual
+    { 13,  1934 }, // PrecedesTilde
+    { 12,  1954 }, // Proportional
+    { 10,  1949 }, // Proportion
+    {  8,  1919 }, // Precedes
+    {  7,  1944 }, // Product
+    {  5,  1939 }, // Prime
+    {  2,  1914 }, // Pr
+    {  4,  1959 }, // Pscr
+    {  3,  1965 }, // Psi
+    {  4,  1969 }, // QUOT
+    {  3,  1972 }, // Qfr
+    {  4,  1978 }, // Qopf
+    {  4,  1983 }, // Qscr
+    {  5,  1989 }, // RBarr
+    {  3,  1994 }, // REG
+    {  6,  1998 }, // Racute
+    {  6,  2012 }, // Rarrtl
+    {  4,  2002 }, // Rang
+    {  4,  2007 }, // Rarr
+    {  6,  2017 }, // Rcaron
+    {  6,  2021 }, // Rcedil
+    {  3,  2025 }, // Rcy
+    { 20,  2044 }, // ReverseUpEquilibrium
+    { 18,  2039 }, // ReverseEquilibrium
+    { 14,  2034 }, // ReverseElement
+    {  2,  2029 }, // Re
+    {  3,  2049 }, // Rfr
+    {  3,  2054 }, // Rho
+    { 19,  2073 }, // RightArrowLeftArrow
+    { 18,  2083 }, // RightDoubleBracket
+    { 18,  2088 }, // RightDownTeeVector
+    { 18,  2098 }, // RightDownVectorBar
+    { 18,  2133 }, // RightTriangleEqual
+    { 17,  2058 }, // RightAngleBracket
+    { 17,  2138 }, // RightUpDownVector
+    { 16,  2128 }, // RightTriangleBar
+    { 16,  2143 }, // RightUpTeeVector
+    { 16,  2153 }, // RightUpVectorBar
+    { 15,  2093 }, // RightDownVector
+    { 14,  2118 }, // RightTeeVector
+    { 14,  2163 }, // RightVectorBar
+    { 13,  2068 }, // RightArrowBar
+    { 13,  2113 }, // RightTeeArrow
+    { 13,  2123 }, // RightTriangle
+    { 13,  2148 }, // RightUpVector
+    { 12,  2078 }, // RightCeiling
+    { 11,  2158 }, // RightVector
+    { 10,  2063 }, // RightArrow
+    { 10,  2103 }, // RightFloor
+    { 10,  2168 }, // Rightarrow
+    {  8,  2108 }, // RightTee
+    { 12,  2178 }, // RoundImplies
+    {  4,  2173 }, // Ropf
+    { 11,  2183 }, // Rrightarrow
+    {  4,  2188 }, // Rscr
+    {  3,  2193 }, // Rsh
+    { 11,  2198 }, // RuleDelayed
+    {  6,  2203 }, // SHCHcy
+    {  4,  2207 }, // SHcy
+    {  6,  2211 }, // SOFTcy
+    {  6,  2215 }, // Sacute
+    {  6,  2224 }, // Scaron
+    {  6,  2228 }, // Scedil
+    {  5,  2232 }, // Scirc
+    {  3,  2236 }, // Scy
+    {  2,  2219 }, // Sc
+    {  3,  2240 }, // Sfr
+    { 15,  2256 }, // ShortRightArrow
+    { 14,  2246 }, // ShortDownArrow
+    { 14,  2251 }, // ShortLeftArrow
+    { 12,  2261 }, // ShortUpArrow
+    {  5,  2266 }, // Sigma
+    { 11,  2270 }, // SmallCircle
+    {  4,  2275 }, // Sopf
+    { 19,  2311 }, // SquareSupersetEqual
+    { 18,  2291 }, // SquareIntersection
+    { 17,  2301 }, // SquareSubsetEqual
+    { 14,  2306 }, // SquareSuperset
+    { 12,  2296 }, // SquareSubset
+    { 11,  2316 }, // SquareUnion
+    {  6,  2286 }, // Square
+    {  4,  2281 }, // Sqrt
+    {  4,  2321 }, // Sscr
+    {  4,  2327 }, // Star
+    { 18,  2357 }, // SucceedsSlantEqual
+    { 13,  2352 }, // SucceedsEqual
+    { 13,  2362 }, // SucceedsTilde
+    { 13,  2387 }, // SupersetEqual
+    { 11,  2342 }, // SubsetEqual
+    {  8,  2347 }, // Succeeds
+    {  8,  2367 }, // SuchThat
+    {  8,  2382 }, // Superset
+    {  6,  2337 }, // Subset
+    {  6,  2392 }, // Supset
+    {  3,  2332 }, // Sub
+    {  3,  2372 }, // Sum
+    {  3,  2377 }, // Sup
+    {  5,  2397 }, // THORN
+    {  5,  2401 }, // TRADE
+    {  5,  2406 }, // TSHcy
+    {  4,  2410 }, // TScy
+    {  3,  2414 }, // Tab
+    {  3,  2417 }, // Tau
+    {  6,  2421 }, // Tcaron
+    {  6,  2425 }, // Tcedil
+    {  3,  2429 }, // Tcy
+    {  3,  2433 }, // Tfr
+    { 10,  2448 }, // ThickSpace
+    {  9,  2439 }, // Therefore
+    {  9,  2456 }, // ThinSpace
+    {  5,  2444 }, // Theta
+    { 14,  2471 }, // TildeFullEqual
+    { 10,  2466 }, // TildeEqual
+    { 10,  2476 }, // TildeTilde
+    {  5,  2461 }, // Tilde
+    {  4,  2481 }, // Topf
+    {  9,  2487 }, // TripleDot
+    {  6,  2498 }, // Tstrok
+    {  4,  2492 }, // Tscr
+    {  8,  2511 }, // Uarrocir
+    {  6,  2502 }, // Uacute
+    {  4,  2506 }, // Uarr
+    {  6,  2520 }, // Ubreve
+    {  5,  2516 }, // Ubrcy
+    {  5,  2524 }, // Ucirc
+    {  3,  2528 }, // Ucy
+    {  6,  2532 }, // Udblac
+    {  3,  2536 }, // Ufr
+    {  6,  2542 }, // Ugrave
+    {  5,  2546 }, // Umacr
+    { 16,  2563 }, // UnderParenthesis
+    { 12,  2558 }, // UnderBracket
+    { 10,  2553 }, // UnderBrace
+    {  9,  2573 }, // UnionPlus
+    {  8,  2550 }, // UnderBar
+    {  5,  2568 }, // Union
+    {  5,  2578 }, // Uogon
+    {  4,  2582 }, // Uopf
+    { 16,  2598 }, // UpArrowDownArrow
+    { 15,  2638 }, // UpperRightArrow
+    { 14,  2633 }, // UpperLeftArrow
+    { 13,  2608 }, // UpEquilibrium
+    { 11,  2603 }, // UpDownArrow
+    { 11,  2628 }, // Updownarrow
+    { 10,  2593 }, // UpArrowBar
+    { 10,  2618 }, // UpTeeArrow
+    {  7,  2588 }, // UpArrow
+    {  7,  2623 }, // Uparrow
+    {  7,  2647 }, // Upsilon
+    {  5,  2613 }, // UpTee
+    {  4,  2643 }, // Upsi
+    {  5,  2651 }, // Uring
+    {  4,  2655 }, // Uscr
+    {  6,  2661 }, // Utilde
+    {  4,  2665 }, // Uuml
+    {  5,  2669 }, // VDash
+    {  4,  2674 }, // Vbar
+    {  3,  2679 }, // Vcy
+    {  6,  2688 }, // Vdashl
+    {  5,  2683 }, // Vdash
+    { 17,  2716 }, // VerticalSeparator
+    { 13,  2721 }, // VerticalTilde
+    { 13,  2726 }, // VeryThinSpace
+    { 12,  2713 }, // VerticalLine
+    { 11,  2708 }, // VerticalBar
+    {  6,  2698 }, // Verbar
+    {  4,  2703 }, // Vert
+    {  3,  2693 }, // Vee
+    {  3,  2731 }, // Vfr
+    {  4,  2737 }, // Vopf
+    {  4,  2743 }, // Vscr
+    {  6,  2749 }, // Vvdash
+    {  5,  2754 }, // Wcirc
+    {  5,  2758 }, // Wedge
+    {  3,  2763 }, // Wfr
+    {  4,  2769 }, // Wopf
+    {  4,  2775 }, // Wscr
+    {  3,  2781 }, // Xfr
+    {  2,  2787 }, // Xi
+    {  4,  2791 }, // Xopf
+    {  4,  2797 }, // Xscr
+    {  4,  2803 }, // YAcy
+    {  4,  2807 }, // YIcy
+    {  4,  2811 }, // YUcy
+    {  6,  2815 }, // Yacute
+    {  5,  2819 }, // Ycirc
+    {  3,  2823 }, // Ycy
+    {  3,  2827 }, // Yfr
+    {  4,  2833 }, // Yopf
+    {  4,  2839 }, // Yscr
+    {  4,  2845 }, // Yuml
+    {  4,  2849 }, // ZHcy
+    {  6,  2853 }, // Zacute
+    {  6,  2857 }, // Zcaron
+    {  3,  2861 }, // Zcy
+    {  4,  2865 }, // Zdot
+    { 14,  2869 }, // ZeroWidthSpace
+    {  4,  2874 }, // Zeta
+    {  3,  2878 }, // Zfr
+    {  4,  2883 }, // Zopf
+    {  4,  2888 }, // Zscr
+    {  6,  2894 }, // aacute
+    {  6,  2898 }, // abreve
+    {  5,  2919 }, // acirc
+    {  5,  2923 }, // acute
+    {  3,  2907 }, // acE
+    {  3,  2914 }, // acd
+    {  3,  2927 }, // acy
+    {  2,  2902 }, // ac
+    {  5,  2931 }, // aelig
+    {  3,  2940 }, // afr
+    {  2,  2935 }, // af
+    {  6,  2946 }, // agrave
+    {  7,  2950 }, // alefsym
+    {  5,  2955 }, // aleph
+    {  5,  2960 }, // alpha
+    {  5,  2964 }, // amacr
+    {  5,  2968 }, // amalg
+    {  3,  2973 }, // amp
+    {  8,  2991 }, // andslope
+    {  8,  3021 }, // angmsdaa
+    {  8,  3026 }, // angmsdab
+    {  8,  3031 }, // angmsdac
+    {  8,  3036 }, // angmsdad
+    {  8,  3041 }, // angmsdae
+    {  8,  3046 }, // angmsdaf
+    {  8,  3051 }, // angmsdag
+    {  8,  3056 }, // angmsdah
+    {  8,  3071 }, // angrtvbd
+    {  7,  3066 }, // angrtvb
+    {  7,  3085 }, // angzarr
+    {  6,  2981 }, // andand
+    {  6,  3016 }, // angmsd
+    {  6,  3076 }, // angsph
+    {  5,  3011 }, // angle
+    {  5,  3061 }, // angrt
+    {  5,  3081 }, // angst
+    {  4,  2986 }, // andd
+    {  4,  2996 }, // andv
+    {  4,  3006 }, // ange
+    {  3,  2976 }, // and
+    {  3,  3001 }, // ang
+    {  5,  3090 }, // aogon
+    {  4,  3094 }, // aopf
+    {  8,  3133 }, // approxeq
+    {  6,  3110 }, // apacir
+    {  6,  3128 }, // approx
+    {  4,  3120 }, // apid
+    {  4,  3125 }, // apos
+    {  3,  3105 }, // apE
+    {  3,  3115 }, // ape
+    {  2,  3100 }, // ap
+    {  5,  3138 }, // aring
+    {  7,  3156 }, // asympeq
+    {  5,  3151 }, // asymp
+    {  4,  3142 }, // ascr
+    {  3,  3148 }, // ast
+    {  6,  3161 }, // atilde
+    {  4,  3165 }, // auml
+    {  8,  3169 }, // awconint
+    {  5,  3174 }, // awint
+    {  4,  3179 }, // bNot
+    { 11,  3189 }, // backepsilon
+    {  9,  3193 }, // backprime
+    {  9,  3203 }, // backsimeq
+    {  8,  3184 }, // backcong
+    {  8,  3218 }, // barwedge
+    {  7,  3198 }, // backsim
+    {  6,  3208 }, // barvee
+    {  6,  3213 }, // barwed
+    {  8,  3228 }, // bbrktbrk
+    {  4,  3223 }, // bbrk
+    {  5,  3233 }, // bcong
+    {  3,  3238 }, // bcy
+    {  5,  3242 }, // bdquo
+    {  7,  3252 }, // because
+    {  7,  3257 }, // bemptyv
+    {  7,  3280 }, // between
+    {  6,  3247 }, // becaus
+    {  6,  3266 }, // bernou
+    {  5,  3262 }, // bepsi
+    {  4,  3271 }, // beta
+    {  4,  3275 }, // beth
+    {  3,  3285 }, // bfr
+    { 15,  3331 }, // bigtriangledown
+    { 13,  3336 }, // bigtriangleup
+    {  9,  3316 }, // bigotimes
+    {  8,  3311 }, // bigoplus
+    {  8,  3321 }, // bigsqcup
+    {  8,  3341 }, // biguplus
+    {  8,  3351 }, // bigwedge
+    {  7,  3296 }, // bigcirc
+    {  7,  3306 }, // bigodot
+    {  7,  3326 }, // bigstar
+    {  6,  3291 }, // bigcap
+    {  6,  3301 }, // bigcup
+    {  6,  3346 }, // bigvee
+    {  6,  3356 }, // bkarow
+    { 18,  3386 }, // blacktriangleright
+    { 17,  3376 }, // blacktriangledown
+    { 17,  3381 }, // blacktriangleleft
+    { 13,  3371 }, // blacktriangle
+    { 12,  3361 }, // blacklozenge
+    { 11,  3366 }, // blacksquare
+    {  5,  3391 }, // blank
+    {  5,  3396 }, // blk12
+    {  5,  3401 }, // blk14
+    {  5,  3406 }, // blk34
+    {  5,  3411 }, // block
+    {  7,  3422 }, // bnequiv
+    {  4,  3430 }, // bnot
+    {  3,  3416 }, // bne
+    {  8,  3606 }, // boxminus
+    {  8,  3616 }, // boxtimes
+    {  7,  3611 }, // boxplus
+    {  6,  3446 }, // bottom
+    {  6,  3451 }, // bowtie
+    {  6,  3556 }, // boxbox
+    {  5,  3456 }, // boxDL
+    {  5,  3461 }, // boxDR
+    {  5,  3466 }, // boxDl
+    {  5,  3471 }, // boxDr
+    {  5,  3481 }, // boxHD
+    {  5,  3486 }, // boxHU
+    {  5,  3491 }, // boxHd
+    {  5,  3496 }, // boxHu
+    {  5,  3501 }, // boxUL
+    {  5,  3506 }, // boxUR
+    {  5,  3511 }, // boxUl
+    {  5,  3516 }, // boxUr
+    {  5,  3526 }, // boxVH
+    {  5,  3531 }, // boxVL
+    {  5,  3536 }, // boxVR
+    {  5,  3541 }, // boxVh
+    {  5,  3546 }, // boxVl
+    {  5,  3551 }, // boxVr
+    {  5,  3561 }, // boxdL
+    {  5,  3566 }, // boxdR
+    {  5,  3571 }, // boxdl
+    {  5,  3576 }, // boxdr
+    {  5,  3586 }, // boxhD
+    {  5,  3591 }, // boxhU
+    {  5,  3596 }, // boxhd
+    {  5,  3601 }, // boxhu
+    {  5,  3621 }, // boxuL
+    {  5,  3626 }, // boxuR
+    {  5,  3631 }, // boxul
+    {  5,  3636 }, // boxur
+    {  5,  3646 }, // boxvH
+    {  5,  3651 }, // boxvL
+    {  5,  3656 }, // boxvR
+    {  5,  3661 }, // boxvh
+    {  5,  3666 }, // boxvl
+    {  5,  3671 }, // boxvr
+    {  4,  3435 }, // bopf
+    {  4,  3476 }, // boxH
+    {  4,  3521 }, // boxV
+    {  4,  3581 }, // boxh
+    {  4,  3641 }, // boxv
+    {  3,  3441 }, // bot
+    {  6,  3676 }, // bprime
+    {  6,  3685 }, // brvbar
+    {  5,  3681 }, // breve
+    {  8,  3718 }, // bsolhsub
+    {  5,  3695 }, // bsemi
+    {  5,  3705 }, // bsime
+    {  5,  3713 }, // bsolb
+    {  4,  3689 }, // bscr
+    {  4,  3700 }, // bsim
+    {  4,  3710 }, // bsol
+    {  6,  3728 }, // bullet
+    {  6,  3748 }, // bumpeq
+    {  5,  3738 }, // bumpE
+    {  5,  3743 }, // bumpe
+    {  4,  3723 }, // bull
+    {  4,  3733 }, // bump
+    {  8,  3767 }, // capbrcup
+    {  6,  3753 }, // cacute
+    {  6,  3762 }, // capand
+    {  6,  3772 }, // capcap
+    {  6,  3777 }, // capcup
+    {  6,  3782 }, // capdot
+    {  5,  3795 }, // caret
+    {  5,  3800 }, // caron
+    {  4,  3787 }, // caps
+    {  3,  3757 }, // cap
+    {  7,  3826 }, // ccupssm
+    {  6,  3809 }, // ccaron
+    {  6,  3813 }, // ccedil
+    {  5,  3804 }, // ccaps
+    {  5,  3817 }, // ccirc
+    {  5,  3821 }, // ccups
+    {  4,  3831 }, // cdot
+    {  9,  3848 }, // centerdot
+    {  7,  3839 }, // cemptyv
+    {  5,  3835 }, // cedil
+    {  4,  3844 }, // cent
+    {  3,  3852 }, // cfr
+    {  9,  3867 }, // checkmark
+    {  5,  3862 }, // check
+    {  4,  3858 }, // chcy
+    {  3,  3872 }, // chi
+    { 16,  3900 }, // circlearrowright
+    { 15,  3895 }, // circlearrowleft
+    { 11,  3919 }, // circledcirc
+    { 11,  3924 }, // circleddash
+    { 10,  3914 }, // circledast
+    {  8,  3905 }, // circledR
+    {  8,  3909 }, // circledS
+    {  8,  3934 }, // cirfnint
+    {  7,  3944 }, // cirscir
+    {  6,  3890 }, // circeq
+    {  6,  3939 }, // cirmid
+    {  4,  3881 }, // cirE
+    {  4,  3886 }, // circ
+    {  4,  3929 }, // cire
+    {  3,  3876 }, // cir
+    {  8,  3954 }, // clubsuit
+    {  5,  3949 }, // clubs
+    { 10,  3988 }, // complement
+    {  9,  3993 }, // complexes
+    {  7,  3967 }, // coloneq
+    {  7,  4003 }, // congdot
+    {  6,  3962 }, // colone
+    {  6,  3975 }, // commat
+    {  6,  3983 }, // compfn
+    {  6,  4008 }, // conint
+    {  6,  4019 }, // coprod
+    {  6,  4028 }, // copysr
+    {  5,  3959 }, // colon
+    {  5,  3972 }, // comma
+    {  4,  3978 }, // comp
+    {  4,  3998 }, // cong
+    {  4,  4013 }, // copf
+    {  4,  4024 }, // copy
+    {  5,  4033 }, // crarr
+    {  5,  4038 }, // cross
+    {  5,  4054 }, // csube
+    {  5,  4064 }, // csupe
+    {  4,  4043 }, // cscr
+    {  4,  4049 }, // csub
+    {  4,  4059 }, // csup
+    {  5,  4069 }, // ctdot
+    { 15,  4181 }, // curvearrowright
+    { 14,  4176 }, // curvearrowleft
+    { 11,  4152 }, // curlyeqprec
+    { 11,  4157 }, // curlyeqsucc
+    { 10,  4167 }, // curlywedge
+    {  8,  4109 }, // cupbrcap
+    {  8,  4162 }, // curlyvee
+    {  7,  4074 }, // cudarrl
+    {  7,  4079 }, // cudarrr
+    {  7,  4099 }, // cularrp
+    {  7,  4147 }, // curarrm
+    {  6,  4094 }, // cularr
+    {  6,  4114 }, // cupcap
+    {  6,  4119 }, // cupcup
+    {  6,  4124 }, // cupdot
+    {  6,  4142 }, // curarr
+    {  6,  4172 }, // curren
+    {  5,  4084 }, // cuepr
+    {  5,  4089 }, // cuesc
+    {  5,  4129 }, // cupor
+    {  5,  4186 }, // cuvee
+    {  5,  4191 }, // cuwed
+    {  4,  4134 }, // cups
+    {  3,  4104 }, // cup
+    {  8,  4196 }, // cwconint
+    {  5,  4201 }, // cwint
+    {  6,  4206 }, // cylcty
+    {  4,  4211 }, // dArr
+    {  4,  4216 }, // dHar
+    {  6,  4221 }, // dagger
+    {  6,  4226 }, // daleth
+    {  5,  4241 }, // dashv
+    {  4,  4231 }, // darr
+    {  4,  4236 }, // dash
+    {  7,  4246 }, // dbkarow
+    {  5,  4251 }, // dblac
+    {  6,  4255 }, // dcaron
+    {  3,  4259 }, // dcy
+    {  7,  4268 }, // ddagger
+    {  7,  4278 }, // ddotseq
+    {  5,  4273 }, // ddarr
+    {  2,  4263 }, // dd
+    {  7,  4291 }, // demptyv
+    {  5,  4287 }, // delta
+    {  3,  4283 }, // deg
+    {  6,  4296 }, // dfisht
+    {  3,  4301 }, // dfr
+    {  5,  4307 }, // dharl
+    {  5,  4312 }, // dharr
+    { 13,  4358 }, // divideontimes
+    { 11,  4327 }, // diamondsuit
+    {  7,  4322 }, // diamond
+    {  7,  4341 }, // digamma
+    {  6,  4354 }, // divide
+    {  6,  4363 }, // divonx
+    {  5,  4332 }, // diams
+    {  5,  4345 }, // disin
+    {  4,  4317 }, // diam
+    {  3,  4337 }, // die
+    {  3,  4350 }, // div
+    {  4,  4368 }, // djcy
+    {  6,  4372 }, // dlcorn
+    {  6,  4377 }, // dlcrop
+    { 16,  4440 }, // downharpoonright
+    { 15,  4435 }, // downharpoonleft
+    { 14,  4420 }, // doublebarwedge
+    { 14,  4430 }, // downdownarrows
+    {  9,  4415 }, // dotsquare
+    {  9,  4425 }, // downarrow
+    {  8,  4400 }, // doteqdot
+    {  8,  4405 }, // dotminus
+    {  7,  4410 }, // dotplus
+    {  6,  4382 }, // dollar
+    {  5,  4395 }, // doteq
+    {  4,  4385 }, // dopf
+    {  3,  4391 }, // dot
+    {  8,  4445 }, // drbkarow
+    {  6,  4450 }, // drcorn
+    {  6,  4455 }, // drcrop
+    {  6,  4475 }, // dstrok
+    {  4,  4460 }, // dscr
+    {  4,  4466 }, // dscy
+    {  4,  4470 }, // dsol
+    {  5,  4479 }, // dtdot
+    {  5,  4489 }, // dtrif
+    {  4,  4484 }, // dtri
+    {  5,  4494 }, // duarr
+    {  5,  4499 }, // duhar
+    {  7,  4504 }, // dwangle
+    {  8,  4513 }, // dzigrarr
+    {  4,  4509 }, // dzcy
+    {  5,  4518 }, // eDDot
+    {  4,  4523 }, // eDot
+    {  6,  4528 }, // eacute
+    {  6,  4532 }, // easter
+    {  6,  4537 }, // ecaron
+    {  6,  4550 }, // ecolon
+    {  5,  4546 }, // ecirc
+    {  4,  4541 }, // ecir
+    {  3,  4555 }, // ecy
+    {  4,  4559 }, // edot
+    {  2,  4563 }, // ee
+    {  5,  4568 }, // efDot
+    {  3,  4573 }, // efr
+    {  6,  4584 }, // egrave
+    {  6,  4593 }, // egsdot
+    {  3,  4588 }, // egs
+    {  2,  4579 }, // eg
+    {  8,  4603 }, // elinters
+    {  6,  4618 }, // elsdot
+    {  3,  4608 }, // ell
+    {  3,  4613 }, // els
+    {  2,  4598 }, // el
+    {  8,  4632 }, // emptyset
+    {  6,  4637 }, // emptyv
+    {  6,  4647 }, // emsp13
+    {  6,  4652 }, // emsp14
+    {  5,  4623 }, // emacr
+    {  5,  4627 }, // empty
+    {  4,  4642 }, // emsp
+    {  4,  4661 }, // ensp
+    {  3,  4657 }, // eng
+    {  5,  4666 }, // eogon
+    {  4,  4670 }, // eopf
+    {  7,  4695 }, // epsilon
+    {  6,  4681 }, // eparsl
+    {  5,  4686 }, // eplus
+    {  5,  4699 }, // epsiv
+    {  4,  4676 }, // epar
+    {  4,  4691 }, // epsi
+    { 11,  4723 }, // eqslantless
+    { 10,  4718 }, // eqslantgtr
+    {  8,  4746 }, // eqvparsl
+    {  7,  4708 }, // eqcolon
+    {  7,  4741 }, // equivDD
+    {  6,  4703 }, // eqcirc
+    {  6,  4728 }, // equals
+    {  6,  4731 }, // equest
+    {  5,  4713 }, // eqsim
+    {  5,  4736 }, // equiv
+    {  5,  4751 }, // erDot
+    {  5,  4756 }, // erarr
+    {  5,  4766 }, // esdot
+    {  4,  4761 }, // escr
+    {  4,  4771 }, // esim
+    {  3,  4776 }, // eta
+    {  3,  4780 }, // eth
+    {  4,  4784 }, // euml
+    {  4,  4788 }, // euro
+    { 12,  4806 }, // exponentiale
+    { 11,  4801 }, // expectation
+    {  5,  4796 }, // exist
+    {  4,  4793 }, // excl
+    { 13,  4811 }, // fallingdotseq
+    {  3,  4816 }, // fcy
+    {  6,  4820 }, // female
+    {  6,  4825 }, // ffilig
+    {  6,  4835 }, // ffllig
+    {  5,  4830 }, // fflig
+    {  3,  4840 }, // ffr
+    {  5,  4846 }, // filig
+    {  5,  4851 }, // fjlig
+    {  5,  4860 }, // fllig
+    {  5,  4865 }, // fltns
+    {  4,  4855 }, // flat
+    {  4,  4870 }, // fnof
+    {  6,  4880 }, // forall
+    {  5,  4890 }, // forkv
+    {  4,  4874 }, // fopf
+    {  4,  4885 }, // fork
+    {  8,  4895 }, // fpartint
+    {  6,  4900 }, // frac12
+    {  6,  4904 }, // frac13
+    {  6,  4909 }, // frac14
+    {  6,  4913 }, // frac15
+    {  6,  4918 }, // frac16
+    {  6,  4923 }, // frac18
+    {  6,  4928 }, // frac23
+    {  6,  4933 }, // frac25
+    {  6,  4938 }, // frac34
+    {  6,  4942 }, // frac35
+    {  6,  4947 }, // frac38
+    {  6,  4952 }, // frac45
+    {  6,  4957 }, // frac56
+    {  6,  4962 }, // frac58
+    {  6,  4967 }, // frac78
+    {  5,  4972 }, // frasl
+    {  5,  4977 }, // frown
+    {  4,  4982 }, // fscr
+    {  3,  4993 }, // gEl
+    {  2,  4988 }, // gE
+    {  6,  4998 }, // gacute
+    {  6,  5006 }, // gammad
+    {  5,  5002 }, // gamma
+    {  3,  5010 }, // gap
+    {  6,  5015 }, // gbreve
+    {  5,  5019 }, // gcirc
+    {  3,  5023 }, // gcy
+    {  4,  5027 }, // gdot
+    {  8,  5051 }, // geqslant
+    {  8,  5076 }, // gesdotol
+    {  7,  5071 }, // gesdoto
+    {  6,  5066 }, // gesdot
+    {  6,  5089 }, // gesles
+    {  5,  5061 }, // gescc
+    {  4,  5046 }, // geqq
+    {  4,  5081 }, // gesl
+    {  3,  5036 }, // gel
+    {  3,  5041 }, // geq
+    {  3,  5056 }, // ges
+    {  2,  5031 }, // ge
+    {  3,  5094 }, // gfr
+    {  3,  5105 }, // ggg
+    {  2,  5100 }, // gg
+    {  5,  5110 }, // gimel
+    {  4,  5115 }, // gjcy
+    {  3,  5124 }, // glE
+    {  3,  5129 }, // gla
+    {  3,  5134 }, // glj
+    {  2,  5119 }, // gl
+    {  8,  5149 }, // gnapprox
+    {  5,  5164 }, // gneqq
+    {  5,  5169 }, // gnsim
+    {  4,  5144 }, // gnap
+    {  4,  5159 }, // gneq
+    {  3,  5139 }, // gnE
+    {  3,  5154 }, // gne
+    {  4,  5174 }, // gopf
+    {  5,  5180 }, // grave
+    {  5,  5193 }, // gsime
+    {  5,  5198 }, // gsiml
+    {  4,  5183 }, // gscr
+    {  4,  5188 }, // gsim
+    { 10,  5251 }, // gtreqqless
+    {  9,  5231 }, // gtrapprox
+    {  9,  5246 }, // gtreqless
+    {  7,  5226 }, // gtquest
+    {  7,  5256 }, // gtrless
+    {  6,  5221 }, // gtlPar
+    {  6,  5236 }, // gtrarr
+    {  6,  5241 }, // gtrdot
+    {  6,  5261 }, // gtrsim
+    {  5,  5211 }, // gtcir
+    {  5,  5216 }, // gtdot
+    {  4,  5206 }, // gtcc
+    {  2,  5203 }, // gt
+    {  9,  5266 }, // gvertneqq
+    {  4,  5274 }, // gvnE
+    {  4,  5282 }, // hArr
+    {  7,  5310 }, // harrcir
+    {  6,  5287 }, // hairsp
+    {  6,  5296 }, // hamilt
+    {  6,  5301 }, // hardcy
+    {  5,  5315 }, // harrw
+    {  4,  5292 }, // half
+    {  4,  5305 }, // harr
+    {  4,  5320 }, // hbar
+    {  5,  5325 }, // hcirc
+    {  9,  5334 }, // heartsuit
+    {  6,  5329 }, // hearts
+    {  6,  5339 }, // hellip
+    {  6,  5344 }, // hercon
+    {  3,  5349 }, // hfr
+    {  8,  5355 }, // hksearow
+    {  8,  5360 }, // hkswarow
+    { 14,  5380 }, // hookrightarrow
+    { 13,  5375 }, // hookleftarrow
+    {  6,  5370 }, // homtht
+    {  6,  5391 }, // horbar
+    {  5,  5365 }, // hoarr
+    {  4,  5385 }, // hopf
+    {  6,  5402 }, // hslash
+    {  6,  5407 }, // hstrok
+    {  4,  5396 }, // hscr
+    {  6,  5411 }, // hybull
+    {  6,  5416 }, // hyphen
+    {  6,  5421 }, // iacute
+    {  5,  5430 }, // icirc
+    {  3,  5434 }, // icy
+    {  2,  5425 }, // ic
+    {  5,  5442 }, // iexcl
+    {  4,  5438 }, // iecy
+    {  3,  5446 }, // iff
+    {  3,  5451 }, // ifr
+    {  6,  5457 }, // igrave
+    {  6,  5466 }, // iiiint
+    {  6,  5476 }, // iinfin
+    {  5,  5471 }, // iiint
+    {  5,  5481 }, // iiota
+    {  2,  5461 }, // ii
+    {  5,  5486 }, // ijlig
+    {  8,  5499 }, // imagline
+    {  8,  5504 }, // imagpart
+    {  5,  5490 }, // imacr
+    {  5,  5494 }, // image
+    {  5,  5509 }, // imath
+    {  5,  5518 }, // imped
+    {  4,  5513 }, // imof
+    {  8,  5537 }, // infintie
+    {  8,  5556 }, // integers
+    {  8,  5561 }, // intercal
+    {  8,  5566 }, // intlarhk
+    {  7,  5571 }, // intprod
+    {  6,  5527 }, // incare
+    {  6,  5542 }, // inodot
+    {  6,  5551 }, // intcal
+    {  5,  5532 }, // infin
+    {  3,  5546 }, // int
+    {  2,  5522 }, // in
+    {  5,  5580 }, // iogon
+    {  4,  5576 }, // iocy
+    {  4,  5584 }, // iopf
+    {  4,  5590 }, // iota
+    {  5,  5594 }, // iprod
+    {  6,  5599 }, // iquest
+    {  7,  5619 }, // isindot
+    {  6,  5629 }, // isinsv
+    {  5,  5614 }, // isinE
+    {  5,  5624 }, // isins
+    {  5,  5634 }, // isinv
+    {  4,  5603 }, // iscr
+    {  4,  5609 }, // isin
+    {  6,  5644 }, // itilde
+    {  2,  5639 }, // it
+    {  5,  5648 }, // iukcy
+    {  4,  5652 }, // iuml
+    {  5,  5656 }, // jcirc
+    {  3,  5660 }, // jcy
+    {  3,  5664 }, // jfr
+    {  5,  5670 }, // jmath
+    {  4,  5674 }, // jopf
+    {  6,  5686 }, // jsercy
+    {  4,  5680 }, // jscr
+    {  5,  5690 }, // jukcy
+    {  6,  5698 }, // kappav
+    {  5,  5694 }, // kappa
+    {  6,  5702 }, // kcedil
+    {  3,  5706 }, // kcy
+    {  3,  5710 }, // kfr
+    {  6,  5716 }, // kgreen
+    {  4,  5720 }, // khcy
+    {  4,  5724 }, // kjcy
+    {  4,  5728 }, // kopf
+    {  4,  5734 }, // kscr
+    {  6,  5750 }, // lAtail
+    {  5,  5740 }, // lAarr
+    {  4,  5745 }, // lArr
+    {  5,  5755 }, // lBarr
+    {  3,  5765 }, // lEg
+    {  2,  5760 }, // lE
+    {  4,  5770 }, // lHar
+    {  8,  5779 }, // laemptyv
+    {  7,  5827 }, // larrbfs
+    {  7,  5852 }, // larrsim
+    {  6,  5775 }, // lacute
+    {  6,  5784 }, // lagran
+    {  6,  5789 }, // lambda
+    {  6,  5803 }, // langle
+    {  6,  5832 }, // larrfs
+    {  6,  5837 }, // larrhk
+    {  6,  5842 }, // larrlp
+    {  6,  5847 }, // larrpl
+    {  6,  5857 }, // larrtl
+    {  6,  5867 }, // latail
+    {  5,  5798 }, // langd
+    {  5,  5813 }, // laquo
+    {  5,  5822 }, // larrb
+    {  5,  5877 }, // lates
+    {  4,  5793 }, // lang
+    {  4,  5817 }, // larr
+    {  4,  5872 }, // late
+    {  3,  5808 }, // lap
+    {  3,  5862 }, // lat
+    {  7,  5906 }, // lbrksld
+    {  7,  5911 }, // lbrkslu
+    {  6,  5895 }, // lbrace
+    {  6,  5898 }, // lbrack
+    {  5,  5885 }, // lbarr
+    {  5,  5890 }, // lbbrk
+    {  5,  5901 }, // lbrke
+    {  6,  5916 }, // lcaron
+    {  6,  5920 }, // lcedil
+    {  5,  5924 }, // lceil
+    {  4,  5929 }, // lcub
+    {  3,  5932 }, // lcy
+    {  8,  5956 }, // ldrushar
+    {  7,  5951 }, // ldrdhar
+    {  6,  5946 }, // ldquor
+    {  5,  5941 }, // ldquo
+    {  4,  5936 }, // ldca
+    {  4,  5961 }, // ldsh
+    { 19,  6011 }, // leftrightsquigarrow
+    { 17,  6006 }, // leftrightharpoons
+    { 15,  5981 }, // leftharpoondown
+    { 15,  6001 }, // leftrightarrows
+    { 14,  5991 }, // leftleftarrows
+    { 14,  5996 }, // leftrightarrow
+    { 14,  6016 }, // leftthreetimes
+    { 13,  5976 }, // leftarrowtail
+    { 13,  5986 }, // leftharpoonup
+    { 10,  6079 }, // lessapprox
+    { 10,  6094 }, // lesseqqgtr
+    {  9,  5971 }, // leftarrow
+    {  9,  6089 }, // lesseqgtr
+    {  8,  6036 }, // leqslant
+    {  8,  6061 }, // lesdotor
+    {  7,  6056 }, // lesdoto
+    {  7,  6084 }, // lessdot
+    {  7,  6099 }, // lessgtr
+    {  7,  6104 }, // lesssim
+    {  6,  6051 }, // lesdot
+    {  6,  6074 }, // lesges
+    {  5,  6046 }, // lescc
+    {  4,  6031 }, // leqq
+    {  4,  6066 }, // lesg
+    {  3,  6021 }, // leg
+    {  3,  6026 }, // leq
+    {  3,  6041 }, // les
+    {  2,  5966 }, // le
+    {  6,  6109 }, // lfisht
+    {  6,  6114 }, // lfloor
+    {  3,  6119 }, // lfr
+    {  3,  6130 }, // lgE
+    {  2,  6125 }, // lg
+    {  6,  6145 }, // lharul
+    {  5,  6135 }, // lhard
+    {  5,  6140 }, // lharu
+    {  5,  6150 }, // lhblk
+    {  4,  6155 }, // ljcy
+    {  8,  6169 }, // llcorner
+    {  6,  6174 }, // llhard
+    {  5,  6164 }, // llarr
+    {  5,  6179 }, // lltri
+    {  2,  6159 }, // ll
+    { 10,  6193 }, // lmoustache
+    {  6,  6184 }, // lmidot
+    {  6,  6188 }, // lmoust
+    {  8,  6208 }, // lnapprox
+    {  5,  6223 }, // lneqq
+    {  5,  6228 }, // lnsim
+    {  4,  6203 }, // lnap
+    {  4,  6218 }, // lneq
+    {  3,  6198 }, // lnE
+    {  3,  6213 }, // lne
+    { 18,  6253 }, // longleftrightarrow
+    { 14,  6263 }, // longrightarrow
+    { 14,  6273 }, // looparrowright
+    { 13,  6248 }, // longleftarrow
+    { 13,  6268 }, // looparrowleft
+    { 10,  6258 }, // longmapsto
+    {  7,  6294 }, // lotimes
+    {  7,  6312 }, // lozenge
+    {  6,  6289 }, // loplus
+    {  6,  6299 }, // lowast
+    {  6,  6304 }, // lowbar
+    {  5,  6233 }, // loang
+    {  5,  6238 }, // loarr
+    {  5,  6243 }, // lobrk
+    {  5,  6278 }, // lopar
+    {  4,  6283 }, // lopf
+    {  4,  6317 }, // lozf
+    {  3,  6307 }, // loz
+    {  6,  6325 }, // lparlt
+    {  4,  6322 }, // lpar
+    {  8,  6335 }, // lrcorner
+    {  6,  6345 }, // lrhard
+    {  5,  6330 }, // lrarr
+    {  5,  6340 }, // lrhar
+    {  5,  6355 }, // lrtri
+    {  3,  6350 }, // lrm
+    {  6,  6360 }, // lsaquo
+    {  6,  6399 }, // lsquor
+    {  6,  6404 }, // lstrok
+    {  5,  6381 }, // lsime
+    {  5,  6386 }, // lsimg
+    {  5,  6394 }, // lsquo
+    {  4,  6365 }, // lscr
+    {  4,  6376 }, // lsim
+    {  4,  6391 }, // lsqb
+    {  3,  6371 }, // lsh
+    {  7,  6441 }, // ltquest
+    {  6,  6426 }, // lthree
+    {  6,  6431 }, // ltimes
+    {  6,  6436 }, // ltlarr
+    {  6,  6446 }, // ltrPar
+    {  5,  6416 }, // ltcir
+    {  5,  6421 }, // ltdot
+    {  5,  6456 }, // ltrie
+    {  5,  6461 }, // ltrif
+    {  4,  6411 }, // ltcc
+    {  4,  6451 }, // ltri
+    {  2,  6408 }, // lt
+    {  8,  6466 }, // lurdshar
+    {  7,  6471 }, // luruhar
+    {  9,  6476 }, // lvertneqq
+    {  4,  6484 }, // lvnE
+    {  5,  6492 }, // mDDot
+    { 10,  6526 }, // mapstodown
+    { 10,  6531 }, // mapstoleft
+    {  8,  6536 }, // mapstoup
+    {  7,  6511 }, // maltese
+    {  6,  6521 }, // mapsto
+    {  6,  6541 }, // marker
+    {  4,  6497 }, // macr
+    {  4,  6501 }, // male
+    {  4,  6506 }, // malt
+    {  3,  6516 }, // map
+    {  6,  6546 }, // mcomma
+    {  3,  6551 }, // mcy
+    {  5,  6555 }, // mdash
+    { 13,  6560 }, // measuredangle
+    {  3,  6565 }, // mfr
+    {  3,  6571 }, // mho
+    {  7,  6612 }, // minusdu
+    {  6,  6585 }, // midast
+    {  6,  6588 }, // midcir
+    {  6,  6593 }, // middot
+    {  6,  6602 }, // minusb
+    {  6,  6607 }, // minusd
+    {  5,  6576 }, // micro
+    {  5,  6597 }, // minus
+    {  3,  6580 }, // mid
+    {  4,  6617 }, // mlcp
+    {  4,  6622 }, // mldr
+    {  6,  6627 }, // mnplus
+    {  6,  6632 }, // models
+    {  4,  6637 }, // mopf
+    {  2,  6643 }, // mp
+    {  6,  6654 }, // mstpos
+    {  4,  6648 }, // mscr
+    {  8,  6663 }, // multimap
+    {  5,  6668 }, // mumap
+    {  2,  6659 }, // mu
+    {  4,  6688 }, // nGtv
+    {  3,  6673 }, // nGg
+    {  3,  6680 }, // nGt
+    { 15,  6700 }, // nLeftrightarrow
+    { 10,  6695 }, // nLeftarrow
+    {  4,  6720 }, // nLtv
+    {  3,  6705 }, // nLl
+    {  3,  6712 }, // nLt
+    { 11,  6727 }, // nRightarrow
+    {  6,  6732 }, // nVDash
+    {  6,  6737 }, // nVdash
+    {  8,  6797 }, // naturals
+    {  7,  6782 }, // napprox
+    {  7,  6792 }, // natural
+    {  6,  6747 }, // nacute
+    {  5,  6742 }, // nabla
+    {  5,  6771 }, // napid
+    {  5,  6778 }, // napos
+    {  5,  6787 }, // natur
+    {  4,  6751 }, // nang
+    {  4,  6764 }, // napE
+    {  3,  6759 }, // nap
+    {  6,  6813 }, // nbumpe
+    {  5,  6806 }, // nbump
+    {  4,  6802 }, // nbsp
+    {  8,  6838 }, // ncongdot
+    {  6,  6825 }, // ncaron
+    {  6,  6829 }, // ncedil
+    {  5,  6833 }, // ncong
+    {  4,  6820 }, // ncap
+    {  4,  6845 }, // ncup
+    {  3,  6850 }, // ncy
+    {  5,  6854 }, // ndash
+    {  7,  6879 }, // nearrow
+    {  7,  6913 }, // nexists
+    {  6,  6869 }, // nearhk
+    {  6,  6891 }, // nequiv
+    {  6,  6896 }, // nesear
+    {  6,  6908 }, // nexist
+    {  5,  6864 }, // neArr
+    {  5,  6874 }, // nearr
+    {  5,  6884 }, // nedot
+    {  5,  6901 }, // nesim
+    {  2,  6859 }, // ne
+    {  3,  6918 }, // nfr
+    {  9,  6948 }, // ngeqslant
+    {  5,  6941 }, // ngeqq
+    {  5,  6962 }, // ngsim
+    {  4,  6936 }, // ngeq
+    {  4,  6955 }, // nges
+    {  4,  6972 }, // ngtr
+    {  3,  6924 }, // ngE
+    {  3,  6931 }, // nge
+    {  3,  6967 }, // ngt
+    {  5,  6977 }, // nhArr
+    {  5,  6982 }, // nharr
+    {  5,  6987 }, // nhpar
+    {  4,  7002 }, // nisd
+    {  3,  6997 }, // nis
+    {  3,  7007 }, // niv
+    {  2,  6992 }, // ni
+    {  4,  7012 }, // njcy
+    { 15,  7048 }, // nleftrightarrow
+    { 10,  7043 }, // nleftarrow
+    {  9,  7065 }, // nleqslant
+    {  6,  7099 }, // nltrie
+    {  5,  7016 }, // nlArr
+    {  5,  7028 }, // nlarr
+    {  5,  7058 }, // nleqq
+    {  5,  7079 }, // nless
+    {  5,  7084 }, // nlsim
+    {  5,  7094 }, // nltri
+    {  4,  7033 }, // nldr
+    {  4,  7053 }, // nleq
+    {  4,  7072 }, // nles
+    {  3,  7021 }, // nlE
+    {  3,  7038 }, // nle
+    {  3,  7089 }, // nlt
+    {  4,  7104 }, // nmid
+    {  8,  7131 }, // notindot
+    {  7,  7138 }, // notinva
+    {  7,  7143 }, // notinvb
+    {  7,  7148 }, // notinvc
+    {  7,  7158 }, // notniva
+    {  7,  7163 }, // notnivb
+    {  7,  7168 }, // notnivc
+    {  6,  7124 }, // notinE
+    {  5,  7119 }, // notin
+    {  5,  7153 }, // notni
+    {  4,  7109 }, // nopf
+    {  3,  7115 }, // not
+    {  9,  7178 }, // nparallel
+    {  7,  7198 }, // npolint
+    {  7,  7225 }, // npreceq
+    {  6,  7183 }, // nparsl
+    {  6,  7208 }, // nprcue
+    {  5,  7191 }, // npart
+    {  5,  7220 }, // nprec
+    {  4,  7173 }, // npar
+    {  4,  7213 }, // npre
+    {  3,  7203 }, // npr
+    { 11,  7256 }, // nrightarrow
+    {  6,  7242 }, // nrarrc
+    {  6,  7249 }, // nrarrw
+    {  6,  7266 }, // nrtrie
+    {  5,  7232 }, // nrArr
+    {  5,  7237 }, // nrarr
+    {  5,  7261 }, // nrtri
+    { 14,  7299 }, // nshortparallel
+    { 10,  7369 }, // nsubseteqq
+    { 10,  7418 }, // nsupseteqq
+    {  9,  7294 }, // nshortmid
+    {  9,  7364 }, // nsubseteq
+    {  9,  7413 }, // nsupseteq
+    {  7,  7329 }, // nsqsube
+    {  7,  7334 }, // nsqsupe
+    {  7,  7356 }, // nsubset
+    {  7,  7381 }, // nsucceq
+    {  7,  7405 }, // nsupset
+    {  6,  7276 }, // nsccue
+    {  6,  7314 }, // nsimeq
+    {  5,  7309 }, // nsime
+    {  5,  7319 }, // nsmid
+    {  5,  7324 }, // nspar
+    {  5,  7344 }, // nsubE
+    {  5,  7351 }, // nsube
+    {  5,  7376 }, // nsucc
+    {  5,  7393 }, // nsupE
+    {  5,  7400 }, // nsupe
+    {  4,  7281 }, // nsce
+    {  4,  7288 }, // nscr
+    {  4,  7304 }, // nsim
+    {  4,  7339 }, // nsub
+    {  4,  7388 }, // nsup
+    {  3,  7271 }, // nsc
+    { 16,  7454 }, // ntrianglerighteq
+    { 15,  7444 }, // ntrianglelefteq
+    { 14,  7449 }, // ntriangleright
+    { 13,  7439 }, // ntriangleleft
+    {  6,  7430 }, // ntilde
+    {  4,  7425 }, // ntgl
+    {  4,  7434 }, // ntlg
+    {  6,  7466 }, // numero
+    {  5,  7471 }, // numsp
+    {  3,  7463 }, // num
+    {  2,  7459 }, // nu
+    {  7,  7513 }, // nvinfin
+    {  7,  7537 }, // nvltrie
+    {  7,  7550 }, // nvrtrie
+    {  6,  7476 }, // nvDash
+    {  6,  7481 }, // nvHarr
+    {  6,  7494 }, // nvdash
+    {  6,  7518 }, // nvlArr
+    {  6,  7545 }, // nvrArr
+    {  5,  7558 }, // nvsim
+    {  4,  7486 }, // nvap
+    {  4,  7499 }, // nvge
+    {  4,  7507 }, // nvgt
+    {  4,  7523 }, // nvle
+    {  4,  7531 }, // nvlt
+    {  7,  7581 }, // nwarrow
+    {  6,  7571 }, // nwarhk
+    {  6,  7586 }, // nwnear
+    {  5,  7566 }, // nwArr
+    {  5,  7576 }, // nwarr
+    {  2,  7591 }, // oS
+    {  6,  7596 }, // oacute
+    {  4,  7600 }, // oast
+    {  5,  7610 }, // ocirc
+    {  4,  7605 }, // ocir
+    {  3,  7614 }, // ocy
+    {  6,  7623 }, // odblac
+    {  6,  7637 }, // odsold
+    {  5,  7618 }, // odash
+    {  4,  7627 }, // odiv
+    {  4,  7632 }, // odot
+    {  5,  7642 }, // oelig
+    {  5,  7646 }, // ofcir
+    {  3,  7651 }, // ofr
+    {  6,  7661 }, // ograve
+    {  4,  7657 }, // ogon
+    {  3,  7665 }, // ogt
+    {  5,  7670 }, // ohbar
+    {  3,  7675 }, // ohm
+    {  4,  7679 }, // oint
+    {  7,  7694 }, // olcross
+    {  5,  7684 }, // olarr
+    {  5,  7689 }, // olcir
+    {  5,  7699 }, // oline
+    {  3,  7704 }, // olt
+    {  7,  7717 }, // omicron
+    {  6,  7726 }, // ominus
+    {  5,  7709 }, // omacr
+    {  5,  7713 }, // omega
+    {  4,  7721 }, // omid
+    {  4,  7731 }, // oopf
+    {  5,  7742 }, // operp
+    {  5,  7747 }, // oplus
+    {  4,  7737 }, // opar
+    {  7,  7772 }, // orderof
+    {  7,  7795 }, // orslope
+    {  6,  7785 }, // origof
+    {  5,  7757 }, // orarr
+    {  5,  7767 }, // order
+    {  4,  7777 }, // ordf
+    {  4,  7781 }, // ordm
+    {  4,  7790 }, // oror
+    {  3,  7762 }, // ord
+    {  3,  7800 }, // orv
+    {  2,  7752 }, // or
+    {  6,  7810 }, // oslash
+    {  4,  7805 }, // oscr
+    {  4,  7814 }, // osol
+    {  8,  7828 }, // otimesas
+    {  6,  7819 }, // otilde
+    {  6,  7823 }, // otimes
+    {  4,  7833 }, // ouml
+    {  5,  7837 }, // ovbar
+    {  8,  7851 }, // parallel
+    {  6,  7856 }, // parsim
+    {  5,  7861 }, // parsl
+    {  4,  7847 }, // para
+    {  4,  7866 }, // part
+    {  3,  7842 }, // par
+    {  3,  7871 }, // pcy
+    {  7,  7891 }, // pertenk
+    {  6,  7875 }, // percnt
+    {  6,  7878 }, // period
+    {  6,  7881 }, // permil
+    {  4,  7886 }, // perp
+    {  3,  7896 }, // pfr
+    {  6,  7910 }, // phmmat
+    {  5,  7915 }, // phone
+    {  4,  7906 }, // phiv
+    {  3,  7902 }, // phi
+    {  9,  7924 }, // pitchfork
+    {  3,  7929 }, // piv
+    {  2,  7920 }, // pi
+    {  8,  7951 }, // plusacir
+    {  7,  7938 }, // planckh
+    {  7,  7961 }, // pluscir
+    {  7,  7985 }, // plussim
+    {  7,  7990 }, // plustwo
+    {  6,  7933 }, // planck
+    {  6,  7943 }, // plankv
+    {  6,  7966 }, // plusdo
+    {  6,  7971 }, // plusdu
+    {  6,  7981 }, // plusmn
+    {  5,  7956 }, // plusb
+    {  5,  7976 }, // pluse
+    {  4,  7948 }, // plus
+    {  2,  7995 }, // pm
+    {  8,  7999 }, // pointint
+    {  5,  8010 }, // pound
+    {  4,  8004 }, // popf
+    { 11,  8049 }, // preccurlyeq
+    { 11,  8059 }, // precnapprox
+    { 10,  8044 }, // precapprox
+    {  8,  8064 }, // precneqq
+    {  8,  8069 }, // precnsim
+    {  8,  8109 }, // profalar
+    {  8,  8114 }, // profline
+    {  8,  8119 }, // profsurf
+    {  7,  8074 }, // precsim
+    {  6,  8054 }, // preceq
+    {  6,  8084 }, // primes
+    {  6,  8099 }, // prnsim
+    {  6,  8129 }, // propto
+    {  6,  8139 }, // prurel
+    {  5,  8029 }, // prcue
+    {  5,  8079 }, // prime
+    {  5,  8094 }, // prnap
+    {  5,  8134 }, // prsim
+    {  4,  8024 }, // prap
+    {  4,  8039 }, // prec
+    {  4,  8089 }, // prnE
+    {  4,  8104 }, // prod
+    {  4,  8124 }, // prop
+    {  3,  8019 }, // prE
+    {  3,  8034 }, // pre
+    {  2,  8014 }, // pr
+    {  4,  8144 }, // pscr
+    {  3,  8150 }, // psi
+    {  6,  8154 }, // puncsp
+    {  3,  8159 }, // qfr
+    {  4,  8165 }, // qint
+    {  4,  8170 }, // qopf
+    {  6,  8176 }, // qprime
+    {  4,  8181 }, // qscr
+    { 11,  8187 }, // quaternions
+    {  7,  8192 }, // quatint
+    {  7,  8200 }, // questeq
+    {  5,  8197 }, // quest
+    {  4,  8205 }, // quot
+    {  6,  8218 }, // rAtail
+    {  5,  8208 }, // rAarr
+    {  4,  8213 }, // rArr
+    {  5,  8223 }, // rBarr
+    {  4,  8228 }, // rHar
+    {  9,  8348 }, // rationals
+    {  8,  8249 }, // raemptyv
+    {  7,  8293 }, // rarrbfs
+    {  7,  8323 }, // rarrsim
+    {  6,  8240 }, // racute
+    {  6,  8269 }, // rangle
+    {  6,  8283 }, // rarrap
+    {  6,  8303 }, // rarrfs
+    {  6,  8308 }, // rarrhk
+    {  6,  8313 }, // rarrlp
+    {  6,  8318 }, // rarrpl
+    {  6,  8328 }, // rarrtl
+    {  6,  8338 }, // ratail
+    {  5,  8244 }, // radic
+    {  5,  8259 }, // rangd
+    {  5,  8264 }, // range
+    {  5,  8274 }, // raquo
+    {  5,  8288 }, // rarrb
+    {  5,  8298 }, // rarrc
+    {  5,  8333 }, // rarrw
+    {  5,  8343 }, // ratio
+    {  4,  8233 }, // race
+    {  4,  8254 }, // rang
+    {  4,  8278 }, // rarr
+    {  7,  8374 }, // rbrksld
+    {  7,  8379 }, // rbrkslu
+    {  6,  8363 }, // rbrace
+    {  6,  8366 }, // rbrack
+    {  5,  8353 }, // rbarr
+    {  5,  8358 }, // rbbrk
+    {  5,  8369 }, // rbrke
+    {  6,  8384 }, // rcaron
+    {  6,  8388 }, // rcedil
+    {  5,  8392 }, // rceil
+    {  4,  8397 }, // rcub
+    {  3,  8400 }, // rcy
+    {  7,  8409 }, // rdldhar
+    {  6,  8419 }, // rdquor
+    {  5,  8414 }, // rdquo
+    {  4,  8404 }, // rdca
+    {  4,  8424 }, // rdsh
+    {  8,  8439 }, // realpart
+    {  7,  8434 }, // realine
+    {  5,  8444 }, // reals
+    {  4,  8429 }, // real
+    {  4,  8449 }, // rect
+    {  3,  8454 }, // reg
+    {  6,  8458 }, // rfisht
+    {  6,  8463 }, // rfloor
+    {  3,  8468 }, // rfr
+    {  6,  8484 }, // rharul
+    {  5,  8474 }, // rhard
+    {  5,  8479 }, // rharu
+    {  4,  8493 }, // rhov
+    {  3,  8489 }, // rho
+    { 17,  8522 }, // rightleftharpoons
+    { 16,  8507 }, // rightharpoondown
+    { 16,  8527 }, // rightrightarrows
+    { 15,  8517 }, // rightleftarrows
+    { 15,  8532 }, // rightsquigarrow
+    { 15,  8537 }, // rightthreetimes
+    { 14,  8502 }, // rightarrowtail
+    { 14,  8512 }, // rightharpoonup
+    { 12,  8546 }, // risingdotseq
+    { 10,  8497 }, // rightarrow
+    {  4,  8542 }, // ring
+    {  5,  8551 }, // rlarr
+    {  5,  8556 }, // rlhar
+    {  3,  8561 }, // rlm
+    { 10,  8571 }, // rmoustache
+    {  6,  8566 }, // rmoust
+    {  5,  8576 }, // rnmid
+    {  7,  8612 }, // rotimes
+    {  6,  8607 }, // roplus
+    {  5,  8581 }, // roang
+    {  5,  8586 }, // roarr
+    {  5,  8591 }, // robrk
+    {  5,  8596 }, // ropar
+    {  4,  8601 }, // ropf
+    {  8,  8625 }, // rppolint
+    {  6,  8620 }, // rpargt
+    {  4,  8617 }, // rpar
+    {  5,  8630 }, // rrarr
+    {  6,  8635 }, // rsaquo
+    {  6,  8659 }, // rsquor
+    {  5,  8654 }, // rsquo
+    {  4,  8640 }, // rscr
+    {  4,  8651 }, // rsqb
+    {  3,  8646 }, // rsh
+    {  8,  8689 }, // rtriltri
+    {  6,  8664 }, // rthree
+    {  6,  8669 }, // rtimes
+    {  5,  8679 }, // rtrie
+    {  5,  8684 }, // rtrif
+    {  4,  8674 }, // rtri
+    {  7,  8694 }, // ruluhar
+    {  2,  8699 }, // rx
+    {  6,  8704 }, // sacute
+    {  5,  8708 }, // sbquo
+    {  8,  8765 }, // scpolint
+    {  6,  8728 }, // scaron
+    {  6,  8742 }, // scedil
+    {  6,  8760 }, // scnsim
+    {  5,  8732 }, // sccue
+    {  5,  8746 }, // scirc
+    {  5,  8755 }, // scnap
+    {  5,  8770 }, // scsim
+    {  4,  8723 }, // scap
+    {  4,  8750 }, // scnE
+    {  3,  8718 }, // scE
+    {  3,  8737 }, // sce
+    {  3,  8775 }, // scy
+    {  2,  8713 }, // sc
+    {  5,  8784 }, // sdotb
+    {  5,  8789 }, // sdote
+    {  4,  8779 }, // sdot
+    {  8,  8826 }, // setminus
+    {  7,  8809 }, // searrow
+    {  6,  8799 }, // searhk
+    {  6,  8821 }, // seswar
+    {  5,  8794 }, // seArr
+    {  5,  8804 }, // searr
+    {  5,  8831 }, // setmn
+    {  4,  8814 }, // sect
+    {  4,  8818 }, // semi
+    {  4,  8836 }, // sext
+    {  6,  8847 }, // sfrown
+    {  3,  8841 }, // sfr
+    { 13,  8870 }, // shortparallel
+    {  8,  8865 }, // shortmid
+    {  6,  8857 }, // shchcy
+    {  5,  8852 }, // sharp
+    {  4,  8861 }, // shcy
+    {  3,  8875 }, // shy
+    {  7,  8936 }, // simplus
+    {  7,  8941 }, // simrarr
+    {  6,  8883 }, // sigmaf
+    {  6,  8887 }, // sigmav
+    {  6,  8896 }, // simdot
+    {  5,  8879 }, // sigma
+    {  5,  8906 }, // simeq
+    {  5,  8916 }, // simgE
+    {  5,  8926 }, // simlE
+    {  5,  8931 }, // simne
+    {  4,  8901 }, // sime
+    {  4,  8911 }, // simg
+    {  4,  8921 }, // siml
+    {  3,  8891 }, // sim
+    {  5,  8946 }, // slarr
+    { 13,  8951 }, // smallsetminus
+    {  8,  8961 }, // smeparsl
+    {  6,  8956 }, // smashp
+    {  5,  8971 }, // smile
+    {  5,  8986 }, // smtes
+    {  4,  8966 }, // smid
+    {  4,  8981 }, // smte
+    {  3,  8976 }, // smt
+    {  6,  8994 }, // softcy
+    {  6,  9006 }, // solbar
+    {  4,  9001 }, // solb
+    {  4,  9011 }, // sopf
+    {  3,  8998 }, // sol
+    {  9,  9022 }, // spadesuit
+    {  6,  9017 }, // spades
+    {  4,  9027 }, // spar
+    { 10,  9073 }, // sqsubseteq
+    { 10,  9093 }, // sqsupseteq
+    {  8,  9068 }, // sqsubset
+    {  8,  9088 }, // sqsupset
+    {  6,  9037 }, // sqcaps
+    {  6,  9050 }, // sqcups
+    {  6,  9063 }, // sqsube
+    {  6,  9083 }, // sqsupe
+    {  6,  9103 }, // square
+    {  6,  9108 }, // squarf
+    {  5,  9032 }, // sqcap
+    {  5,  9045 }, // sqcup
+    {  5,  9058 }, // sqsub
+    {  5,  9078 }, // sqsup
+    {  4,  9113 }, // squf
+    {  3,  9098 }, // squ
+    {  5,  9118 }, // srarr
+    {  6,  9129 }, // ssetmn
+    {  6,  9134 }, // ssmile
+    {  6,  9139 }, // sstarf
+    {  4,  9123 }, // sscr
+    { 15,  9154 }, // straightepsilon
+    { 11,  9158 }, // straightphi
+    {  5,  9149 }, // starf
+    {  5,  9162 }, // strns
+    {  4,  9144 }, // star
+    { 11,  9266 }, // succcurlyeq
+    { 11,  9276 }, // succnapprox
+    { 10,  9236 }, // subsetneqq
+    { 10,  9261 }, // succapprox
+    { 10,  9403 }, // supsetneqq
+    {  9,  9226 }, // subseteqq
+    {  9,  9231 }, // subsetneq
+    {  9,  9393 }, // supseteqq
+    {  9,  9398 }, // supsetneq
+    {  8,  9221 }, // subseteq
+    {  8,  9281 }, // succneqq
+    {  8,  9286 }, // succnsim
+    {  8,  9388 }, // supseteq
+    {  7,  9186 }, // subedot
+    {  7,  9191 }, // submult
+    {  7,  9206 }, // subplus
+    {  7,  9211 }, // subrarr
+    {  7,  9291 }, // succsim
+    {  7,  9333 }, // supdsub
+    {  7,  9343 }, // supedot
+    {  7,  9348 }, // suphsol
+    {  7,  9353 }, // suphsub
+    {  7,  9358 }, // suplarr
+    {  7,  9363 }, // supmult
+    {  7,  9378 }, // supplus
+    {  6,  9176 }, // subdot
+    {  6,  9216 }, // subset
+    {  6,  9241 }, // subsim
+    {  6,  9246 }, // subsub
+    {  6,  9251 }, // subsup
+    {  6,  9271 }, // succeq
+    {  6,  9328 }, // supdot
+    {  6,  9383 }, // supset
+    {  6,  9408 }, // supsim
+    {  6,  9413 }, // supsub
+    {  6,  9418 }, // supsup
+    {  5,  9196 }, // subnE
+    {  5,  9201 }, // subne
+    {  5,  9368 }, // supnE
+    {  5,  9373 }, // supne
+    {  4,  9171 }, // subE
+    {  4,  9181 }, // sube
+    {  4,  9256 }, // succ
+    {  4,  9301 }, // sung
+    {  4,  9311 }, // sup1
+    {  4,  9315 }, // sup2
+    {  4,  9319 }, // sup3
+    {  4,  9323 }, // supE
+    {  4,  9338 }, // supe
+    {  3,  9166 }, // sub
+    {  3,  9296 }, // sum
+    {  3,  9306 }, // sup
+    {  7,  9438 }, // swarrow
+    {  6,  9428 }, // swarhk
+    {  6,  9443 }, // swnwar
+    {  5,  9423 }, // swArr
+    {  5,  9433 }, // swarr
+    {  5,  9448 }, // szlig
+    {  6,  9452 }, // target
+    {  3,  9457 }, // tau
+    {  4,  9461 }, // tbrk
+    {  6,  9466 }, // tcaron
+    {  6,  9470 }, // tcedil
+    {  3,  9474 }, // tcy
+    {  4,  9478 }, // tdot
+    {  6,  9483 }, // telrec
+    {  3,  9488 }, // tfr
+    { 11,  9516 }, // thickapprox
+    {  9,  9499 }, // therefore
+    {  8,  9508 }, // thetasym
+    {  8,  9521 }, // thicksim
+    {  6,  9494 }, // there4
+    {  6,  9512 }, // thetav
+    {  6,  9526 }, // thinsp
+    {  6,  9536 }, // thksim
+    {  5,  9504 }, // theta
+    {  5,  9531 }, // thkap
+    {  5,  9541 }, // thorn
+    {  8,  9558 }, // timesbar
+    {  6,  9553 }, // timesb
+    {  6,  9563 }, // timesd
+    {  5,  9545 }, // tilde
+    {  5,  9549 }, // times
+    {  4,  9568 }, // tint
+    {  7,  9599 }, // topfork
+    {  6,  9583 }, // topbot
+    {  6,  9588 }, // topcir
+    {  4,  9573 }, // toea
+    {  4,  9593 }, // topf
+    {  4,  9604 }, // tosa
+    {  3,  9578 }, // top
+    {  6,  9609 }, // tprime
+    { 15,  9649 }, // trianglerighteq
+    { 14,  9634 }, // trianglelefteq
+    { 13,  9644 }, // triangleright
+    { 12,  9624 }, // triangledown
+    { 12,  9629 }, // triangleleft
+    {  9,  9639 }, // triangleq
+    {  8,  9619 }, // triangle
+    {  8,  9664 }, // triminus
+    {  8,  9684 }, // trpezium
+    {  7,  9669 }, // triplus
+    {  7,  9679 }, // tritime
+    {  6,  9654 }, // tridot
+    {  5,  9614 }, // trade
+    {  5,  9674 }, // trisb
+    {  4,  9659 }, // trie
+    {  6,  9703 }, // tstrok
+    {  5,  9699 }, // tshcy
+    {  4,  9689 }, // tscr
+    {  4,  9695 }, // tscy
+    { 17,  9717 }, // twoheadrightarrow
+    { 16,  9712 }, // twoheadleftarrow
+    {  5,  9707 }, // twixt
+    {  4,  9722 }, // uArr
+    {  4,  9727 }, // uHar
+    {  6,  9732 }, // uacute
+    {  4,  9736 }, // uarr
+    {  6,  9745 }, // ubreve
+    {  5,  9741 }, // ubrcy
+    {  5,  9749 }, // ucirc
+    {  3,  9753 }, // ucy
+    {  6,  9762 }, // udblac
+    {  5,  9757 }, // udarr
+    {  5,  9766 }, // udhar
+    {  6,  9771 }, // ufisht
+    {  3,  9776 }, // ufr
+    {  6,  9782 }, // ugrave
+    {  5,  9786 }, // uharl
+    {  5,  9791 }, // uharr
+    {  5,  9796 }, // uhblk
+    {  8,  9806 }, // ulcorner
+    {  6,  9801 }, // ulcorn
+    {  6,  9811 }, // ulcrop
+    {  5,  9816 }, // ultri
+    {  5,  9821 }, // umacr
+    {  3,  9825 }, // uml
+    {  5,  9829 }, // uogon
+    {  4,  9833 }, // uopf
+    { 14,  9854 }, // upharpoonright
+    { 13,  9849 }, // upharpoonleft
+    { 11,  9844 }, // updownarrow
+    { 10,  9876 }, // upuparrows
+    {  7,  9839 }, // uparrow
+    {  7,  9872 }, // upsilon
+    {  5,  9859 }, // uplus
+    {  5,  9868 }, // upsih
+    {  4,  9864 }, // upsi
+    {  8,  9886 }, // urcorner
+    {  6,  9881 }, // urcorn
+    {  6,  9891 }, // urcrop
+    {  5,  9896 }, // uring
+    {  5,  9900 }, // urtri
+    {  4,  9905 }, // uscr
+    {  6,  9916 }, // utilde
+    {  5,  9911 }, // utdot
+    {  5,  9925 }, // utrif
+    {  4,  9920 }, // utri
+    {  5,  9930 }, // uuarr
+    {  4,  9935 }, // uuml
+    {  7,  9939 }, // uwangle
+    {  4,  9944 }, // vArr
+    {  5,  9954 }, // vBarv
+    {  4,  9949 }, // vBar
+    {  5,  9959 }, // vDash
+    { 16, 10049 }, // vartriangleright
+    { 15, 10044 }, // vartriangleleft
+    { 13, 10016 }, // varsubsetneqq
+    { 13, 10032 }, // varsupsetneqq
+    { 12, 10008 }, // varsubsetneq
+    { 12, 10024 }, // varsupsetneq
+    { 10,  9969 }, // varepsilon
+    { 10,  9977 }, // varnothing
+    {  9,  9990 }, // varpropto
+    {  8,  9973 }, // varkappa
+    {  8, 10004 }, // varsigma
+    {  8, 10040 }, // vartheta
+    {  6,  9964 }, // vangrt
+    {  6,  9982 }, // varphi
+    {  6, 10000 }, // varrho
+    {  5,  9986 }, // varpi
+    {  4,  9995 }, // varr
+    {  3, 10054 }, // vcy
+    {  5, 10058 }, // vdash
+    {  6, 10068 }, // veebar
+    {  6, 10078 }, // vellip
+    {  6, 10083 }, // verbar
+    {  5, 10073 }, // veeeq
+    {  4, 10086 }, // vert
+    {  3, 10063 }, // vee
+    {  3, 10089 }, // vfr
+    {  5, 10095 }, // vltri
+    {  5, 10100 }, // vnsub
+    {  5, 10108 }, // vnsup
+    {  4, 10116 }, // vopf
+    {  5, 10122 }, // vprop
+    {  5, 10127 }, // vrtri
+    {  6, 10138 }, // vsubnE
+    {  6, 10146 }, // vsubne
+    {  6, 10154 }, // vsupnE
+    {  6, 10162 }, // vsupne
+    {  4, 10132 }, // vscr
+    {  7, 10170 }, // vzigzag
+    {  5, 10175 }, // wcirc
+    {  6, 10179 }, // wedbar
+    {  6, 10189 }, // wedgeq
+    {  6, 10194 }, // weierp
+    {  5, 10184 }, // wedge
+    {  3, 10199 }, // wfr
+    {  4, 10205 }, // wopf
+    {  2, 10211 }, // wp
+    {  6, 10221 }, // wreath
+    {  2, 10216 }, // wr
+    {  4, 10226 }, // wscr
+    {  5, 10237 }, // xcirc
+    {  4, 10232 }, // xcap
+    {  4, 10242 }, // xcup
+    {  5, 10247 }, // xdtri
+    {  3, 10252 }, // xfr
+    {  5, 10258 }, // xhArr
+    {  5, 10263 }, // xharr
+    {  2, 10268 }, // xi
+    {  5, 10272 }, // xlArr
+    {  5, 10277 }, // xlarr
+    {  4, 10282 }, // xmap
+    {  4, 10287 }, // xnis
+    {  6, 10303 }, // xoplus
+    {  6, 10308 }, // xotime
+    {  5, 10292 }, // xodot
+    {  4, 10297 }, // xopf
+    {  5, 10313 }, // xrArr
+    {  5, 10318 }, // xrarr
+    {  6, 10329 }, // xsqcup
+    {  4, 10323 }, // xscr
+    {  6, 10334 }, // xuplus
+    {  5, 10339 }, // xutri
+    {  4, 10344 }, // xvee
+    {  6, 10349 }, // xwedge
+    {  6, 10354 }, // yacute
+    {  4, 10358 }, // yacy
+    {  5, 10362 }, // ycirc
+    {  3, 10366 }, // ycy
+    {  3, 10370 }, // yen
+    {  3, 10374 }, // yfr
+    {  4, 10380 }, // yicy
+    {  4, 10384 }, // yopf
+    {  4, 10390 }, // yscr
+    {  4, 10396 }, // yucy
+    {  4, 10400 }, // yuml
+    {  6, 10404 }, // zacute
+    {  6, 10408 }, // zcaron
+    {  3, 10412 }, // zcy
+    {  4, 10416 }, // zdot
+    {  6, 10420 }, // zeetrf
+    {  4, 10425 }, // zeta
+    {  3, 10429 }, // zfr
+    {  4, 10435 }, // zhcy
+    {  7, 10439 }, // zigrarr
+    {  4, 10444 }, // zopf
+    {  4, 10450 }, // zscr
+    {  4, 10461 }, // zwnj
+    {  3, 10456 }, // zwj
+};
+
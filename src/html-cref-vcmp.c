@@ -0,0 +1,309 @@
+// Copyright (C) 2019  Stefan Vargyas
+// 
+// This file is part of Html-Cref.
+// 
+// Html-Cref is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// 
+// Html-Cref is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+// 
+// You should have received a copy of the GNU General Public License
+// along with Html-Cref.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#include "config.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <pthread.h>
+
+#include "common.h"
+#include "int-traits.h"
+#include "ptr-traits.h"
+
+#ifdef TIMINGS
+#include "clocks-impl.h"
+#endif
+
+#include "html-cref.h"
+#include "html-cref-simd.h"
+#include "html-cref-vcmp.h"
+
+#ifdef HTML_CREF_SIMD_X86
+#include <immintrin.h>
+#endif
+
+size_t html_cref_vcmp_get_version(void)
+{ return HTML_CREF_VERSION; }
+
+// stev: each name is stored in a zero-padded template
+// of 'html_cref_vcmp_width' bytes, such that the input
+// text following '&' gets compared with a candidate by
+// a single vector instruction; a candidate of length
+// 'n' matches the input text when the lower 'n' bits
+// of the resulting comparison mask are all set
+
+enum {
+    html_cref_vcmp_width = 32,
+    html_cref_vcmp_page = 4096,
+};
+
+typedef char html_cref_vcmp_name_t[html_cref_vcmp_width]
+    __attribute__ ((aligned(html_cref_vcmp_width)));
+
+struct html_cref_vcmp_bucket_t
+{
+    uint16_t start;
+    uint8_t  count;
+};
+
+struct html_cref_vcmp_cand_t
+{
+    uint8_t  len;
+    uint16_t offset;
+};
+
+// $ html-cref-gen --gen-vcmp-table --heading > html-cref-vcmp-impl.h
+
+#include "html-cref-vcmp-impl.h"
+
+static inline const struct html_cref_vcmp_bucket_t*
+    html_cref_vcmp_bucket(const char* p)
+{
+    const struct html_cref_vcmp_bucket_t* b;
+    size_t i, j;
+
+    STATIC(html_cref_max_name_len < (int) html_cref_vcmp_width);
+    STATIC(html_cref_min_name_len >= 2);
+
+    if (!(i = html_cref_vcmp_chars[(uchar_t) p[0]]) ||
+        !(j = html_cref_vcmp_chars[(uchar_t) p[1]]))
+        return NULL;
+
+    b = &html_cref_vcmp_buckets[
+        (i - 1) * html_cref_vcmp_n_chars + (j - 1)];
+
+    return b->count ? b : NULL;
+}
+
+// stev: the candidates of a bucket are sorted by
+// length in decreasing order, thus the first one
+// that matches is the longest prefix of the input
+// -- as required by the legacy semicolon-less refs;
+// 'm' is the name of a macro 'm(n, l)' that tells
+// whether the candidate name 'n' of length 'l' is
+// matching the input text
+
+#define HTML_CREF_VCMP_SEARCH(b, m)                     \
+    ({                                                  \
+        const struct html_cref_vcmp_cand_t *__c, *__e;  \
+        const html_cref_vcmp_name_t* __n;               \
+        int __r = -1;                                   \
+                                                        \
+        for (__c = html_cref_vcmp_cands + (b)->start,   \
+             __n = html_cref_vcmp_names + (b)->start,   \
+             __e = __c + (b)->count;                    \
+             __c < __e;                                 \
+             __c ++,                                    \
+             __n ++) {                                  \
+            if (m(*__n, __c->len)) {                    \
+                __r = __c->offset;                      \
+                break;                                  \
+            }                                           \
+        }                                               \
+        __r;                                            \
+    })
+
+#define HTML_CREF_VCMP_LEN_MASK(l) \
+    ((UINT32_C(1) << (l)) - 1)
+
+static int html_cref_vcmp_parse_scalar(const char* p)
+{
+    const struct html_cref_vcmp_bucket_t* b;
+
+    if (!(b = html_cref_vcmp_bucket(p)))
+        return -1;
+
+#undef  MATCH
+#define MATCH(n, l) prefix(n, p)
+
+    return HTML_CREF_VCMP_SEARCH(b, MATCH);
+}
+
+#ifdef HTML_CREF_SIMD_X86
+
+// stev: loading 'html_cref_vcmp_width' bytes starting
+// at 'p' is safe as long as the loaded range does not
+// cross a page boundary (the input text is required to
+// be NUL-terminated, yet not to be padded); otherwise
+// copy the bytes of the input text up to its NUL char
+// to the zero-initialized local buffer 'b'
+
+static inline const char* html_cref_vcmp_load(
+    const char* p, char* b)
+{
+    const char* e;
+    char* q;
+
+    if (((uintptr_t) p & (html_cref_vcmp_page - 1)) <=
+            html_cref_vcmp_page - html_cref_vcmp_width)
+        return p;
+
+    for (q = b,
+         e = b + html_cref_vcmp_width - 1;
+         q < e && *p;
+         q ++,
+         p ++)
+        *q = *p;
+
+    return b;
+}
+
+HTML_CREF_SIMD_TARGET(sse42)
+static int html_cref_vcmp_parse_sse42(const char* p)
+{
+    const struct html_cref_vcmp_bucket_t* b;
+    html_cref_vcmp_name_t t = {0};
+    __m128i v0, v1;
+
+    if (!(b = html_cref_vcmp_bucket(p)))
+        return -1;
+
+    p = html_cref_vcmp_load(p, t);
+    v0 = _mm_loadu_si128((const __m128i*) p);
+    v1 = _mm_loadu_si128((const __m128i*) p + 1);
+
+#undef  MATCH
+#define MATCH(n, l)                                 \
+    ({                                              \
+        const __m128i* __t = (const __m128i*) (n);  \
+        uint32_t __m = (uint32_t)                   \
+            _mm_movemask_epi8(                      \
+                _mm_cmpeq_epi8(v0, __t[0]));        \
+        if ((l) > 16)                               \
+            __m |= (uint32_t)                       \
+            _mm_movemask_epi8(                      \
+                _mm_cmpeq_epi8(v1, __t[1])) << 16;  \
+        !(~__m & HTML_CREF_VCMP_LEN_MASK(l));       \
+    })
+
+    return HTML_CREF_VCMP_SEARCH(b, MATCH);
+}
+
+HTML_CREF_SIMD_TARGET(avx2)
+static int html_cref_vcmp_parse_avx2(const char* p)
+{
+    const struct html_cref_vcmp_bucket_t* b;
+    html_cref_vcmp_name_t t = {0};
+    __m256i v;
+
+    if (!(b = html_cref_vcmp_bucket(p)))
+        return -1;
+
+    v = _mm256_loadu_si256((const __m256i*)
+            html_cref_vcmp_load(p, t));
+
+#undef  MATCH
+#define MATCH(n, l)                                 \
+    ({                                              \
+        __m256i __t = _mm256_load_si256(            \
+            (const __m256i*) (n));                  \
+        uint32_t __m = (uint32_t)                   \
+            _mm256_movemask_epi8(                   \
+                _mm256_cmpeq_epi8(v, __t));         \
+        !(~__m & HTML_CREF_VCMP_LEN_MASK(l));       \
+    })
+
+    return HTML_CREF_VCMP_SEARCH(b, MATCH);
+}
+
+// stev: the comparison is masked by the candidate's
+// length, such that there is no need for the resulting
+// comparison mask to be post-processed
+
+HTML_CREF_SIMD_TARGET(avx512)
+static int html_cref_vcmp_parse_avx512(const char* p)
+{
+    const struct html_cref_vcmp_bucket_t* b;
+    html_cref_vcmp_name_t t = {0};
+    __m256i v;
+
+    if (!(b = html_cref_vcmp_bucket(p)))
+        return -1;
+
+    v = _mm256_loadu_si256((const __m256i*)
+            html_cref_vcmp_load(p, t));
+
+#undef  MATCH
+#define MATCH(n, l)                                 \
+    (                                               \
+        !_mm256_mask_cmpneq_epi8_mask(              \
+            _cvtu32_mask32(                         \
+                HTML_CREF_VCMP_LEN_MASK(l)), v,     \
+            _mm256_load_si256(                      \
+                (const __m256i*) (n)))              \
+    )
+
+    return HTML_CREF_VCMP_SEARCH(b, MATCH);
+}
+
+#endif // HTML_CREF_SIMD_X86
+
+typedef int (*html_cref_vcmp_parse_func_t)(const char*);
+
+static int html_cref_vcmp_parse_init(const char*);
+
+static html_cref_vcmp_parse_func_t
+    html_cref_vcmp_parse_func =
+    html_cref_vcmp_parse_init;
+
+#undef  CASE
+#define CASE(n) \
+    [html_cref_simd_ ## n] = html_cref_vcmp_parse_ ## n
+
+static const html_cref_vcmp_parse_func_t
+html_cref_vcmp_parse_funcs[] = {
+    CASE(scalar),
+#ifdef HTML_CREF_SIMD_X86
+    CASE(sse42),
+    CASE(avx2),
+    CASE(avx512),
+#endif
+};
+
+static void html_cref_vcmp_parse_select(void)
+{
+    html_cref_vcmp_parse_func =
+        ARRAY_NULL_ELEM(html_cref_vcmp_parse_funcs,
+            html_cref_simd_variant());
+    ASSERT(html_cref_vcmp_parse_func != NULL);
+}
+
+// stev: the worker threads of '-j|--threads' may all
+// be calling the stub at once
+
+static int html_cref_vcmp_parse_init(const char* p)
+{
+    static pthread_once_t o = PTHREAD_ONCE_INIT;
+
+    pthread_once(&o, html_cref_vcmp_parse_select);
+
+    return html_cref_vcmp_parse_func(p);
+}
+
+int html_cref_vcmp_parse(const char* p)
+{ return html_cref_vcmp_parse_func(p); }
+
+API_ALIAS(vcmp, parse, lookup)
+
+#ifdef TIMINGS
+HTML_CREF_FUNC_DEF(vcmp, lookup)
+HTML_CREF_FUNC_DEF(vcmp, parse)
+#endif
+
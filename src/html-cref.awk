@@ -55,6 +55,11 @@ function gen_map_entry(o)
     printf("%s %d\n", FNR - 1, o)
 }
 
+function gen_names_entry(n)
+{
+    printf("\t\"%s\",\n", n)
+}
+
 function gen_re2c_entry(n, o)
 {
     printf("\t\"%s\" { return %d; }\n", n, o)
@@ -96,6 +101,9 @@ function gen_re2c_entry(n, o)
         gen_re2c_entry(n, o)
         o += w + 2
     }
+    else
+    if (act == "gen-names-table")
+        gen_names_entry(n)
     else
         assert(0, sprintf( \
             "invalid act='%s'", act))
@@ -28,7 +28,10 @@
 #include <errno.h>
 #include <sys/types.h>
 #include <sys/stat.h>
+#include <sys/resource.h>
 #include <unistd.h>
+#include <time.h>
+#include <pthread.h>
 
 #include "common.h"
 #include "ptr-traits.h"
@@ -38,7 +41,11 @@
 #include "su-size.h"
 
 #ifndef BUILTIN
+#include <dlfcn.h>
+
 #include "dyn-lib.h"
+#include "cpu-info.h"
+#include "html-cref-refs.h"
 #endif
 
 #ifdef TIMINGS
@@ -48,6 +55,10 @@
 #include "html-cref.h"
 #include "html-cref-table.h"
 #include "html-cref-unicode.h"
+#include "html-cref-encode.h"
+#include "html-cref-escape.h"
+#include "html-cref-simd.h"
+#include "html-cref-probes.h"
 
 #ifdef BUILTIN
 #include BUILTIN_HEADER
@@ -75,6 +86,39 @@ const char help[] =
 "  -P|--print-cref             print out the HTML char references for each\n"
 "                                named reference; take the names from the\n"
 "                                input file, each given on a separate line\n"
+"  -V|--validate-cref          validate all HTML char references in the\n"
+"                                given input file without substituting\n"
+"                                them: print out the number of bytes of\n"
+"                                input and of the output the substitution\n"
+"                                would produce, and the counts of valid,\n"
+"                                invalid and legacy (i.e. valid, yet not\n"
+"                                terminated by semicolon) references; the\n"
+"                                exit status is 1 when invalid references\n"
+"                                were found\n"
+"  -E|--encode-cref            encode the given UTF-8 input file for ASCII\n"
+"                                only consumers: substitute each '&' and\n"
+"                                each non-ASCII char by the preferred named\n"
+"                                char reference that stands for it -- or,\n"
+"                                when there is none, by a hex numeric char\n"
+"                                reference --; the bytes that are not part\n"
+"                                of well-formed UTF-8 sequences are each\n"
+"                                substituted by `&#xFFFD;'\n"
+"  -X|--escape-cref            escape the given input file for inclusion\n"
+"                                in HTML text or attribute values: each of\n"
+"                                the chars `&', `<', `>', `\"' and `\'' is\n"
+"                                substituted by the char reference that\n"
+"                                stands for it\n"
+#ifndef BUILTIN
+"  -A|--autotune               time each of the parser modules built along\n"
+"                                with the program on the input file -- or,\n"
+"                                when no input file was given, on a builtin\n"
+"                                sample text --, print out the time spent\n"
+"                                per char reference by each of them and then\n"
+"                                store the name of the fastest one into the\n"
+"                                autotune cache file, keyed by the model name\n"
+"                                of the host's CPU and by the build of the\n"
+"                                program\n"
+#endif
 "the options are:\n"
 "  -f|--input-file=FILE        take input from the named file (the default\n"
 "                                is '-', aka stdin)\n"
@@ -88,7 +132,15 @@ const char help[] =
 "                                parser: that is load the external module\n"
 "                                `html-cref-NAME.so' (a shared library)\n"
 "                                that defines proper parse functions\n"
-"                                (the default is 'ietrie')\n"
+"                                (the default is 'etrie', unless there is\n"
+"                                an entry for the host's CPU and for this\n"
+"                                build in the autotune cache file; see the\n"
+"                                action `-A|--autotune')\n"
+"     --autotune-cache=FILE    use the named file as autotune cache file;\n"
+"                                '-' means not to use any such file at all\n"
+"                                (the default is '$XDG_CACHE_HOME/html-cref-\n"
+"                                autotune' or '$HOME/.cache/html-cref-auto-\n"
+"                                tune' when $XDG_CACHE_HOME is not set)\n"
 #endif
 "  -e|--[no-]semicolons        when action is `-S|--subst-cref', require\n"
 "                                that all char references be terminated\n"
@@ -98,6 +150,26 @@ const char help[] =
 "  -s|--sponge-max=NUM[KM]     the maximum size of the input buffer when\n"
 "                                the input type is 'sponge' (by default\n"
 "                                is 5M; not allowed to be more than 10M)\n"
+"  -j|--threads=NUM            when the input type is 'sponge' and action\n"
+"                                is `-S|--subst-cref', split the input\n"
+"                                buffer at line boundaries in NUM chunks\n"
+"                                and substitute these on as many threads\n"
+"                                at once, the output keeping the order of\n"
+"                                the input; NUM is a positive integer less\n"
+"                                than or equal to 64 (the default is 1)\n"
+"     --print-format=FORMAT    when action is `-P|--print-cref', print out\n"
+"                                the char references found in the format\n"
+"                                given: 'text' for lines `NAME REF[ *]',\n"
+"                                where REF is the escaped text of the char\n"
+"                                reference and ` *' marks legacy names;\n"
+"                                'tsv' for lines `NAME<TAB>CODES<TAB>FLAG',\n"
+"                                where CODES are the code points of REF in\n"
+"                                form `U+XXXX' separated by spaces and FLAG\n"
+"                                is 1 for legacy names and 0 otherwise; or\n"
+"                                'binary' for records made of one byte of\n"
+"                                name length, the name, one byte of length\n"
+"                                of the UTF-8 text of REF, that text and one\n"
+"                                byte of FLAG (the default is 'text')\n"
 #ifdef TIMINGS
 "  -m|--timings[=NUM,NUM,NUM]  print out on stderr the total amount of\n"
 "     --real-timings[=NUM]       nanoseconds spent by the HTML character\n"
@@ -111,7 +183,15 @@ const char help[] =
 "                                and CLOCK_THREAD_CPUTIME_ID; the options\n"
 "                                `--{real,process,thread}-timings' are to\n"
 "                                be used to specify timings on subsets of\n"
-"                                the mentioned three clock types\n"
+"                                the mentioned three clock types; each of\n"
+"                                NUM,NUM,NUM or NUM can also be given as\n"
+"                                'auto' -- the same holds for the cycles\n"
+"                                and performance counters options below\n"
+"                                --, case in which the overheads get to be\n"
+"                                calibrated by the program itself, at its\n"
+"                                start and again at its end, the values\n"
+"                                obtained being printed out on stderr in\n"
+"                                the form `MEDIAN +- MAD'\n"
 #ifdef CLOCK_CYCLES
 "  -c|--[clock-]cycles[=NUM]   print out on stderr the total amount of\n"
 "                                CPU cycles spent by the HTML character\n"
@@ -122,8 +202,60 @@ const char help[] =
 "                                stamp counter; note that these options\n"
 "                                and `--{real,process,thread}-timings'\n"
 "                                are cancelling each other\n"
+"     --histogram[=WHAT]       along with `-c|--[clock-]cycles', print out\n"
+"     --no-histogram             on stderr the percentiles p50, p90, p99,\n"
+"                                p99.9 and the maximum of the amounts of\n"
+"                                CPU cycles spent by the calls of the HTML\n"
+"                                character reference parser (default do\n"
+"                                not); WHAT is either 'total' or 'length';\n"
+"                                the latter breaks down the percentiles by\n"
+"                                the lengths of the names parsed (the\n"
+"                                default is 'total')\n"
 #endif // CLOCK_CYCLES
+#ifdef CLOCK_PERF
+"     --instructions[=NUM]     print out on stderr the total amount of\n"
+"     --branch-misses[=NUM]      the named hardware performance counter\n"
+"     --icache-misses[=NUM]      events -- instructions retired, branch\n"
+"     --cache-misses[=NUM]       mispredictions, L1 instruction cache\n"
+"                                read misses and last level cache misses\n"
+"                                -- that occurred in user mode inside the\n"
+"                                HTML character reference parser (default\n"
+"                                do not); use the given number as the\n"
+"                                amount of counted events of overhead per\n"
+"                                each reading of the performance counters;\n"
+"                                the counters which are not available on\n"
+"                                the host are left out with a warning;\n"
+"                                note that these options and the timings\n"
+"                                and cycles options are cancelling each\n"
+"                                other\n"
+#endif // CLOCK_PERF
+"     --sample=NUM             when timing the HTML character reference\n"
+"     --random-sample=NUM        parser, time only every NUM-th call of\n"
+"     --no-sample                it, or, respectively, only calls that\n"
+"                                are NUM calls apart on average, though\n"
+"                                at pseudo-random distances; the totals\n"
+"                                printed out are then estimates obtained\n"
+"                                by extrapolating the sums of timings of\n"
+"                                the calls sampled, and are followed by\n"
+"                                their standard errors, as in `+- ERR';\n"
+"                                NUM is a positive integer less than or\n"
+"                                equal to 1M (the default is to time all\n"
+"                                calls, i.e. `--sample=1')\n"
 #endif // TIMINGS
+"     --stats[=FORMAT]         when action is `-S|--subst-cref', print out\n"
+"     --no-stats                 on stderr statistics of the input: the\n"
+"                                counts of the named, legacy (i.e. not\n"
+"                                terminated by semicolon), decimal, hex\n"
+"                                and invalid char references, the number\n"
+"                                of bytes in and out, the density of the\n"
+"                                char references, the wall time, the MB/s\n"
+"                                throughput, the peak resident set size\n"
+"                                and the count of each named reference\n"
+"                                found (default do not); FORMAT is either\n"
+"                                'text' or 'json'; the text format is the\n"
+"                                one of 'html-cref-freqs.txt', i.e. lines\n"
+"                                `NAME COUNT' preceded by comment lines\n"
+"                                (the default is 'text')\n"
 "  -w|--warnings[-only]        print out a warning message on stderr for\n"
 "     --no-warnings              each invalid HTML char reference found\n"
 "                                in the input given (default not); the\n"
@@ -131,6 +263,21 @@ const char help[] =
 "                                program to produce anything, but these\n"
 "                                warning messages on stdout; `-w' cuts\n"
 "                                short option `--warnings-only'\n"
+"     --diagnostics[=FORMAT]   collect the warning messages of `-w|--warn-\n"
+"     --no-diagnostics           ings[-only]' in memory -- deduplicated by\n"
+"                                the text of the char reference, each of\n"
+"                                them along with the byte offset, the line\n"
+"                                and the column of its first occurrence,\n"
+"                                and the number of its occurrences --, for\n"
+"                                printing them out once the input has been\n"
+"                                processed, followed by a summary line\n"
+"                                (default not); FORMAT is either 'text' or\n"
+"                                'json', the latter meaning JSON lines (the\n"
+"                                default is 'text')\n"
+"     --diagnostics-max=NUM    collect at most NUM distinct warnings; the\n"
+"                                occurrences of the others are counted as\n"
+"                                suppressed; NUM is a positive integer less\n"
+"                                than or equal to 1M (default 100)\n"
 "     --dump-options           print options and exit\n"
 "     --version                print version numbers and exit\n"
 "  -?|--help                   display this help info and exit\n";
@@ -152,10 +299,22 @@ static void error_fmt(const char* fmt, ...)
 }
 #endif
 
+enum { options_threads_max = 64 };
+
+#ifndef BUILTIN
+static const char options_cref_parser_default[] = "etrie";
+#endif
+
 enum options_action_t
 {
     options_subst_cref_action,
     options_print_cref_action,
+    options_validate_cref_action,
+    options_encode_cref_action,
+    options_escape_cref_action,
+#ifndef BUILTIN
+    options_autotune_action,
+#endif
 };
 
 enum options_input_type_t
@@ -164,6 +323,29 @@ enum options_input_type_t
     options_input_type_sponge
 };
 
+enum options_print_format_t
+{
+    options_print_format_text,
+    options_print_format_tsv,
+    options_print_format_binary
+};
+
+enum options_stats_t
+{
+    options_stats_none,
+    options_stats_text,
+    options_stats_json
+};
+
+#ifdef CLOCK_CYCLES
+enum options_histogram_t
+{
+    options_histogram_none,
+    options_histogram_total,
+    options_histogram_length
+};
+#endif
+
 struct options_t
 {
     enum options_action_t
@@ -173,19 +355,40 @@ struct options_t
     const char*  input_file;
 #ifndef BUILTIN
     const char*  cref_parser;
+    const char*  autotune_cache;
+    bits_t       autotuned: 1;
 #endif
     size_t       sponge_max;
+    size_t       threads;
+    enum options_print_format_t
+                 print_format;
 #ifdef TIMINGS
-#ifdef CLOCK_CYCLES
+#if defined(CLOCK_PERF)
+    bits_t       timings: 8;
+    bits_t       calibrate: 8;
+    size_t       overhead[8];
+#elif defined(CLOCK_CYCLES)
     bits_t       timings: 4;
+    bits_t       calibrate: 4;
     size_t       overhead[4];
 #else
     bits_t       timings: 3;
+    bits_t       calibrate: 3;
     size_t       overhead[3];
+#endif
+    size_t       sample;
+    bits_t       random_sample: 1;
+#ifdef CLOCK_CYCLES
+    bits_t       histogram: 2;
 #endif
 #endif
     bits_t       semicolons: 1;
+    bits_t       stats: 2;
     bits_t       warnings: 2;
+    // stev: the formats of the diagnostics
+    // are those of the statistics
+    bits_t       diagnostics: 2;
+    size_t       diagnostics_max;
 
     size_t       argc;
     char* const *argv;
@@ -213,17 +416,17 @@ static void options_usage(void)
 #ifdef TIMINGS
 
 static char* options_dump_timings(
-    const struct options_t* opts)
+    clock_types_t timings)
 {
     char* b = NULL;
     size_t n = 0;
     FILE* f;
 
-    if (opts->timings == 0)
+    if (timings == 0)
         return strdup("-");
 
     f = open_memstream(&b, &n);
-    clocks_print_names(opts->timings, f);
+    clocks_print_names(timings, f);
 
     fclose(f);
     ASSERT(n > 0);
@@ -241,12 +444,35 @@ static void options_dump(const struct options_t* opts)
     static const char* const warnings[] = {
         [0] "no", [1] "yes", [2] "only"
     };
+    static const char* const print_formats[] = {
+        [options_print_format_text]   = "text",
+        [options_print_format_tsv]    = "tsv",
+        [options_print_format_binary] = "binary",
+    };
+    static const char* const stats_formats[] = {
+        [options_stats_none] = "-",
+        [options_stats_text] = "text",
+        [options_stats_json] = "json",
+    };
 #define CASE2(n0, n1) \
     [options_ ## n0 ## _ ## n1 ## _action] = #n0 "-" #n1
     static const char* const actions[] = {
         CASE2(subst, cref),
         CASE2(print, cref),
+        CASE2(validate, cref),
+        CASE2(encode, cref),
+        CASE2(escape, cref),
+#ifndef BUILTIN
+        [options_autotune_action] = "autotune",
+#endif
     };
+#ifdef CLOCK_CYCLES
+    static const char* const histograms[] = {
+        [options_histogram_none]   = "-",
+        [options_histogram_total]  = "total",
+        [options_histogram_length] = "length",
+    };
+#endif
 #define CASE(n) \
     [options_input_type_ ## n] = #n
     static const char* const input_types[] = {
@@ -256,7 +482,7 @@ static void options_dump(const struct options_t* opts)
     struct su_size_t sponge_su = su_size(
         opts->sponge_max);
 #ifdef TIMINGS
-    char b[128], *c;
+    char b[128], *c, *a, d[32];
 #endif
 
 #define NAME_(x, t)                  \
@@ -274,7 +500,11 @@ static void options_dump(const struct options_t* opts)
         b, ARRAY_SIZE(b), opts->overhead,
         ARRAY_SIZE(opts->overhead),
         ",", true);
-    c = options_dump_timings(opts);
+    c = options_dump_timings(opts->timings);
+    a = options_dump_timings(opts->calibrate);
+    snprintf(d, sizeof d, "%s%zu",
+        opts->random_sample ? "random:" : "",
+        opts->sample);
 #endif
 
     fprintf(stdout,
@@ -283,33 +513,57 @@ static void options_dump(const struct options_t* opts)
         "input-type:  %s\n"
 #ifndef BUILTIN
         "cref-parser: %s\n"
+        "autotune:    %s\n"
 #endif
         "sponge-max:  %zu%s\n"
+        "threads:     %zu\n"
+        "print-fmt:   %s\n"
         "semicolons:  %s\n"
+        "simd:        %s\n"
 #ifdef TIMINGS
         "timings:     %s\n"
         "overhead:    %s\n"
+        "calibrate:   %s\n"
+        "sample:      %s\n"
+#ifdef CLOCK_CYCLES
+        "histogram:   %s\n"
 #endif
+#endif
+        "stats:       %s\n"
         "warnings:    %s\n"
+        "diagnostics: %s\n"
+        "diags-max:   %zu\n"
         "argc:        %zu\n",
         NAME(action),
         NNUL(input_file),
         NAME(input_type),
 #ifndef BUILTIN
         opts->cref_parser,
+        NNUL(autotune_cache),
 #endif
         sponge_su.sz,
         sponge_su.su,
+        opts->threads,
+        NAME(print_format),
         NOYES(semicolons),
+        html_cref_simd_name(
+            html_cref_simd_variant()),
 #ifdef TIMINGS
-        c, b,
+        c, b, a, d,
+#ifdef CLOCK_CYCLES
+        NAME(histogram),
 #endif
+#endif
+        NAME_(stats, stats_formats),
         ARRAY(warnings),
+        NAME_(diagnostics, stats_formats),
+        opts->diagnostics_max,
         opts->argc);
 
 #undef ARRAY
 
 #ifdef TIMINGS
+    free(a);
     free(c);
 #endif
 
@@ -427,19 +681,125 @@ static const char*
 }
 #endif
 
+#ifndef BUILTIN
+
+// stev: the autotune cache file consists of lines
+// of form 'CPU\tBUILD\tNAME', where CPU is the model
+// name of a host's CPU, as obtained by the function
+// 'cpu_info_model_name', BUILD identifies the build
+// of the program -- the commit and the build flags
+// it was made of, and the set of parser modules
+// built along with it --, and NAME is the name of
+// the parser module found by '-A|--autotune' to
+// be the fastest on that CPU for that build
+
+#ifndef AUTOTUNE_BUILD
+#define AUTOTUNE_BUILD ""
+#endif
+
+static const char autotune_build[] =
+    AUTOTUNE_BUILD ";" CREF_PARSERS;
+
+// stev: returns the pointer past the prefix 'CPU\t'
+// of the given line -- and, if 'build' is not NULL,
+// past the prefix 'CPU\tBUILD\t' --, or NULL when
+// the line has no such prefix
+
+static const char* autotune_cache_match(
+    const char* line, const char* cpu,
+    const char* build)
+{
+    size_t l = strlen(cpu);
+
+    if (strncmp(line, cpu, l) || line[l] != '\t')
+        return NULL;
+    line += l + 1;
+
+    if (build == NULL)
+        return line;
+
+    l = strlen(build);
+    if (strncmp(line, build, l) || line[l] != '\t')
+        return NULL;
+    return line + l + 1;
+}
+
+static char* autotune_cache_default(void)
+{
+    const char* d;
+    char* s = NULL;
+    int r;
+
+    if ((d = getenv("XDG_CACHE_HOME")) && *d)
+        r = asprintf(&s, "%s/html-cref-autotune", d);
+    else
+    if ((d = getenv("HOME")) && *d)
+        r = asprintf(&s, "%s/.cache/html-cref-autotune", d);
+    else
+        return NULL;
+
+    return r < 0 ? NULL : s;
+}
+
+static char* autotune_cache_lookup(
+    const char* file, const char* cpu)
+{
+    char *b = NULL, *p = NULL;
+    const char* q;
+    size_t n = 0;
+    ssize_t r;
+    FILE* f;
+
+    if (!(f = fopen(file, "r")))
+        return NULL;
+
+    while ((r = getline(&b, &n, f)) > 0) {
+        if (b[r - 1] == '\n')
+            b[-- r] = 0;
+        if ((q = autotune_cache_match(
+                b, cpu, autotune_build)) && *q) {
+            p = strdup(q);
+            break;
+        }
+    }
+
+    free(b);
+    fclose(f);
+
+    return p;
+}
+
+static bool autotune_cache_valid_name(
+    const char* name)
+{
+    const char* p;
+
+    for (p = name; *p; p ++) {
+        if (!ISALNUM(*p) && *p != '-')
+            return false;
+    }
+    return p > name;
+}
+
+#endif // BUILTIN
+
 #ifdef TIMINGS
 
+#if defined(CLOCK_PERF)
+#define OVERHEADS_N_VALS 8
+#elif defined(CLOCK_CYCLES)
+#define OVERHEADS_N_VALS 4
+#else
+#define OVERHEADS_N_VALS 3
+#endif
+
 static size_t options_parse_overheads_optarg(
     const char* opt_name, const char* opt_arg,
     size_t* vals, size_t n_vals)
 {
     size_t r;
 
-#ifdef CLOCK_CYCLES
-    ASSERT(n_vals == 4);
-#else
-    ASSERT(n_vals == 3);
-#endif
+    ASSERT(n_vals == OVERHEADS_N_VALS);
 
     if (opt_arg == NULL) {
         memset(vals, 0,
@@ -458,7 +818,8 @@ static size_t options_parse_overheads_optarg(
 
 #ifdef CLOCK_CYCLES
     STATIC(clock_type_cycles == 3);
-    vals[3] = 0;
+    memset(vals + 3, 0,
+        SIZE_MUL(sizeof(*vals), n_vals - 3));
 #endif
 
     return clock_types_all;
@@ -468,11 +829,7 @@ static size_t options_parse_clock_overhead_optarg(
     size_t clock, const char* opt_name, const char* opt_arg,
     size_t* vals, size_t n_vals)
 {
-#ifdef CLOCK_CYCLES
-    ASSERT(n_vals == 4);
-#else
-    ASSERT(n_vals == 3);
-#endif
+    ASSERT(n_vals == OVERHEADS_N_VALS);
     ASSERT(clock < 3);
 
     vals[clock] = opt_arg != NULL
@@ -482,7 +839,8 @@ static size_t options_parse_clock_overhead_optarg(
 
 #ifdef CLOCK_CYCLES
     STATIC(clock_type_cycles == 3);
-    vals[3] = 0;
+    memset(vals + 3, 0,
+        SIZE_MUL(sizeof(*vals), n_vals - 3));
 #endif
 
     return CLOCK_BIT(clock);
@@ -493,10 +851,10 @@ static size_t options_parse_cycles_overhead_optarg(
     size_t clock, const char* opt_name, const char* opt_arg,
     size_t* vals, size_t n_vals)
 {
-    ASSERT(n_vals == 4);
+    ASSERT(n_vals == OVERHEADS_N_VALS);
     ASSERT(clock == 3);
 
-    memset(vals, 0, SIZE_MUL(sizeof(*vals), n_vals - 1));
+    memset(vals, 0, SIZE_MUL(sizeof(*vals), n_vals));
 
     vals[clock] = opt_arg != NULL
         ? options_parse_size_optarg(opt_name, opt_arg,
@@ -507,8 +865,161 @@ static size_t options_parse_cycles_overhead_optarg(
 }
 #endif // CLOCK_CYCLES
 
+#ifdef CLOCK_PERF
+static size_t options_parse_perf_overhead_optarg(
+    size_t clock, const char* opt_name, const char* opt_arg,
+    size_t* vals, size_t n_vals)
+{
+    ASSERT(n_vals == OVERHEADS_N_VALS);
+    ASSERT(clock > 3 && clock < n_vals);
+
+    STATIC(clock_type_cycles == 3);
+    memset(vals, 0, SIZE_MUL(sizeof(*vals), SZ(4)));
+
+    vals[clock] = opt_arg != NULL
+        ? options_parse_size_optarg(opt_name, opt_arg,
+            0, 100000)
+        : 0;
+
+    return CLOCK_BIT(clock);
+}
+#endif // CLOCK_PERF
+
+// stev: an overhead option argument 'auto' asks for
+// the overhead to be calibrated in-process; in that
+// case the option is parsed as if given no argument
+
+static const char* options_auto_optarg(
+    const char* opt_arg, bool* is_auto)
+{
+    *is_auto = opt_arg != NULL &&
+        !strcmp(opt_arg, "auto");
+    return *is_auto ? NULL : opt_arg;
+}
+
+#ifdef CLOCK_CYCLES
+
+// $ print total length|gen-func -f options_lookup_histogram -r options_histogram_t -Pf -q \!strcmp|adjust-func
+
+static bool options_lookup_histogram(
+    const char* n, enum options_histogram_t* t)
+{
+    // pattern: length|total
+    switch (*n ++) {
+    case 'l':
+        if (!strcmp(n, "ength")) {
+            *t = options_histogram_length;
+            return true;
+        }
+        return false;
+    case 't':
+        if (!strcmp(n, "otal")) {
+            *t = options_histogram_total;
+            return true;
+        }
+    }
+    return false;
+}
+
+static enum options_histogram_t
+    options_parse_histogram_optarg(
+        const char* opt_name, const char* opt_arg)
+{
+    enum options_histogram_t r;
+
+    if (opt_arg == NULL)
+        return options_histogram_total;
+
+    if (!options_lookup_histogram(opt_arg, &r))
+        options_invalid_opt_arg(opt_name, opt_arg);
+
+    return r;
+}
+
+#endif // CLOCK_CYCLES
+
 #endif // TIMINGS
 
+// $ print json text|gen-func -f options_lookup_stats -r options_stats_t -Pf -q \!strcmp|adjust-func
+
+static bool options_lookup_stats(
+    const char* n, enum options_stats_t* t)
+{
+    // pattern: json|text
+    switch (*n ++) {
+    case 'j':
+        if (!strcmp(n, "son")) {
+            *t = options_stats_json;
+            return true;
+        }
+        return false;
+    case 't':
+        if (!strcmp(n, "ext")) {
+            *t = options_stats_text;
+            return true;
+        }
+    }
+    return false;
+}
+
+static enum options_stats_t
+    options_parse_stats_optarg(
+        const char* opt_name, const char* opt_arg)
+{
+    enum options_stats_t r;
+
+    if (opt_arg == NULL)
+        return options_stats_text;
+
+    if (!options_lookup_stats(opt_arg, &r))
+        options_invalid_opt_arg(opt_name, opt_arg);
+
+    return r;
+}
+
+// $ print text tsv binary|gen-func -f options_lookup_print_format -r options_print_format_t -Pf -q \!strcmp|adjust-func
+
+static bool options_lookup_print_format(
+    const char* n, enum options_print_format_t* t)
+{
+    // pattern: binary|t(ext|sv)
+    switch (*n ++) {
+    case 'b':
+        if (!strcmp(n, "inary")) {
+            *t = options_print_format_binary;
+            return true;
+        }
+        return false;
+    case 't':
+        switch (*n ++) {
+        case 'e':
+            if (!strcmp(n, "xt")) {
+                *t = options_print_format_text;
+                return true;
+            }
+            return false;
+        case 's':
+            if (!strcmp(n, "v")) {
+                *t = options_print_format_tsv;
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+static enum options_print_format_t
+    options_parse_print_format_optarg(
+        const char* opt_name, const char* opt_arg)
+{
+    enum options_print_format_t r;
+
+    if (!options_lookup_print_format(opt_arg, &r))
+        options_invalid_opt_arg(opt_name, opt_arg);
+
+    return r;
+}
+
 static const struct options_t* options(
     int argc, char* argv[])
 {
@@ -516,15 +1027,26 @@ static const struct options_t* options(
         .action      = options_subst_cref_action,
         .input_type  = options_input_type_liner,
 #ifndef BUILTIN
-        .cref_parser = "etrie",
+        .cref_parser = options_cref_parser_default,
 #endif
         .sponge_max  = MB(5),
+        .threads     = 1,
+        .diagnostics_max = 100,
+#ifdef TIMINGS
+        .sample      = 1,
+#endif
     };
 
     enum {
         // stev: actions:
         subst_cref_act    = 'S',
         print_cref_act    = 'P',
+        validate_cref_act = 'V',
+        encode_cref_act   = 'E',
+        escape_cref_act   = 'X',
+#ifndef BUILTIN
+        autotune_act      = 'A',
+#endif
 
         // stev: options:
         input_file_opt    = 'f',
@@ -533,6 +1055,7 @@ static const struct options_t* options(
         cref_parser_opt   = 'p',
 #endif
         sponge_max_opt    = 's',
+        threads_opt       = 'j',
         semicolons_opt    = 'e',
 #ifdef TIMINGS
         timings_opt       = 'm',
@@ -547,24 +1070,55 @@ static const struct options_t* options(
 
         warnings_opt,
         no_semicolons_opt,
+#ifndef BUILTIN
+        autotune_cache_opt,
+#endif
 #ifdef TIMINGS
         real_timings_opt,
         process_timings_opt,
         thread_timings_opt,
         no_timings_opt,
+#ifdef CLOCK_PERF
+        instructions_opt,
+        branch_misses_opt,
+        icache_misses_opt,
+        cache_misses_opt,
+#endif
+        sample_opt,
+        random_sample_opt,
+        no_sample_opt,
+#ifdef CLOCK_CYCLES
+        histogram_opt,
+        no_histogram_opt,
+#endif
 #endif
+        stats_opt,
+        no_stats_opt,
         no_warnings_opt,
+        diagnostics_opt,
+        diagnostics_max_opt,
+        no_diagnostics_opt,
+        print_format_opt,
     };
 
     static const struct option longs[] = {
         { "subst-cref",      0,       0, subst_cref_act },
         { "print-cref",      0,       0, print_cref_act },
+        { "validate-cref",   0,       0, validate_cref_act },
+        { "encode-cref",     0,       0, encode_cref_act },
+        { "escape-cref",     0,       0, escape_cref_act },
+#ifndef BUILTIN
+        { "autotune",        0,       0, autotune_act },
+#endif
         { "input-file",      1,       0, input_file_opt },
         { "input-type",      1,       0, input_type_opt },
 #ifndef BUILTIN
         { "cref-parser",     1,       0, cref_parser_opt },
+        { "autotune-cache",  1,       0, autotune_cache_opt },
 #endif
         { "sponge-max",      1,       0, sponge_max_opt },
+        { "threads",         1,       0, threads_opt },
+        { "print-format",    1,       0, print_format_opt },
         { "semicolons",      0,       0, semicolons_opt },
         { "no-semicolons",   0,       0, no_semicolons_opt },
 #ifdef TIMINGS
@@ -577,18 +1131,36 @@ static const struct options_t* options(
         { "clock-cycles",    2,       0, clock_cycles_opt },
         { "cycles",          2,       0, clock_cycles_opt },
 #endif
+#ifdef CLOCK_PERF
+        { "instructions",    2,       0, instructions_opt },
+        { "branch-misses",   2,       0, branch_misses_opt },
+        { "icache-misses",   2,       0, icache_misses_opt },
+        { "cache-misses",    2,       0, cache_misses_opt },
 #endif
+        { "sample",          1,       0, sample_opt },
+        { "random-sample",   1,       0, random_sample_opt },
+        { "no-sample",       0,       0, no_sample_opt },
+#ifdef CLOCK_CYCLES
+        { "histogram",       2,       0, histogram_opt },
+        { "no-histogram",    0,       0, no_histogram_opt },
+#endif
+#endif
+        { "stats",           2,       0, stats_opt },
+        { "no-stats",        0,       0, no_stats_opt },
         { "warnings",        0,       0, warnings_opt },
         { "warnings-only",   0,       0, warnings_only_opt },
         { "no-warnings",     0,       0, no_warnings_opt },
+        { "diagnostics",     2,       0, diagnostics_opt },
+        { "diagnostics-max", 1,       0, diagnostics_max_opt },
+        { "no-diagnostics",  0,       0, no_diagnostics_opt },
         { "dump-options",    0,       0, dump_opt },
         { "version",         0,       0, version_opt },
         { "help",            0, &optopt, help_opt },
         { 0,                 0,       0, 0 }
     };
-    static const char shorts[] = ":" "PS" "ef:s:t:w"
+    static const char shorts[] = ":" "EPSVX" "ef:j:s:t:w"
 #ifndef BUILTIN
-        "p:"
+        "Ap:"
 #endif
 #ifdef TIMINGS
         "m:"
@@ -602,12 +1174,19 @@ static const struct options_t* options(
         bits_t dump: 1;
         bits_t usage: 1;
         bits_t version: 1;
+#ifndef BUILTIN
+        bits_t cref_parser: 1;
+        bits_t autotune_cache: 1;
+#endif
     };
     struct bits_opts_t bits = {
         .dump    = false,
         .usage   = false,
         .version = false
     };
+#ifdef TIMINGS
+    bool a;
+#endif
     int opt;
 
 #define argv_optind()                      \
@@ -624,6 +1203,21 @@ static const struct options_t* options(
         (char) optopt;                  \
     })
 
+#ifdef TIMINGS
+#define auto_optarg() \
+    options_auto_optarg(optarg, &a)
+// stev: 'calibrate' follows 'timings' and
+// is to be updated after it, in each case
+#define calibrate_types(t)                \
+    do {                                  \
+        if (a)                            \
+            opts.calibrate |= (t);        \
+        else                              \
+            opts.calibrate &= ~(t);       \
+        opts.calibrate &= opts.timings;   \
+    } while (0)
+#endif
+
 #define missing_opt_arg_str(n) \
     error("argument for option '%s' not found", n)
 #define missing_opt_arg_ch(n) \
@@ -646,6 +1240,20 @@ static const struct options_t* options(
         case print_cref_act:
             opts.action = options_print_cref_action;
             break;
+        case validate_cref_act:
+            opts.action = options_validate_cref_action;
+            break;
+        case encode_cref_act:
+            opts.action = options_encode_cref_action;
+            break;
+        case escape_cref_act:
+            opts.action = options_escape_cref_action;
+            break;
+#ifndef BUILTIN
+        case autotune_act:
+            opts.action = options_autotune_action;
+            break;
+#endif
         case input_file_opt:
             opts.input_file = options_parse_file_optarg(
                 "input-file", optarg);
@@ -658,12 +1266,27 @@ static const struct options_t* options(
         case cref_parser_opt:
             opts.cref_parser = options_parse_cref_parser_optarg(
                 "cref-parser", optarg);
+            bits.cref_parser = true;
+            break;
+        case autotune_cache_opt:
+            opts.autotune_cache = strcmp(optarg, "-")
+                ? optarg : NULL;
+            bits.autotune_cache = true;
             break;
 #endif
         case sponge_max_opt:
             opts.sponge_max = options_parse_su_size_optarg(
                 "sponge-max", optarg, 1, MB(10));
             break;
+        case threads_opt:
+            opts.threads = options_parse_size_optarg(
+                "threads", optarg, 1,
+                options_threads_max);
+            break;
+        case print_format_opt:
+            opts.print_format = options_parse_print_format_optarg(
+                "print-format", optarg);
+            break;
         case semicolons_opt:
             opts.semicolons = true;
             break;
@@ -673,44 +1296,104 @@ static const struct options_t* options(
 #ifdef TIMINGS
         case timings_opt:
             opts.timings = options_parse_overheads_optarg(
-                "timings", optarg, opts.overhead,
+                "timings", auto_optarg(), opts.overhead,
                 ARRAY_SIZE(opts.overhead));
+            calibrate_types(clock_types_all);
             break;
         case real_timings_opt:
             opts.timings |= options_parse_clock_overhead_optarg(
-                clock_type_real, "real-timings", optarg,
+                clock_type_real, "real-timings", auto_optarg(),
                 opts.overhead, ARRAY_SIZE(opts.overhead));
 #ifdef CLOCK_CYCLES
             opts.timings &= ~CLOCK_TYPE(cycles);
 #endif
+#ifdef CLOCK_PERF
+            opts.timings &= ~clock_types_perf;
+#endif
+            calibrate_types(CLOCK_TYPE(real));
             break;
         case process_timings_opt:
             opts.timings |= options_parse_clock_overhead_optarg(
-                clock_type_process, "process-timings", optarg,
+                clock_type_process, "process-timings", auto_optarg(),
                 opts.overhead, ARRAY_SIZE(opts.overhead));
 #ifdef CLOCK_CYCLES
             opts.timings &= ~CLOCK_TYPE(cycles);
 #endif
+#ifdef CLOCK_PERF
+            opts.timings &= ~clock_types_perf;
+#endif
+            calibrate_types(CLOCK_TYPE(process));
             break;
         case thread_timings_opt:
             opts.timings |= options_parse_clock_overhead_optarg(
-                clock_type_thread, "thread-timings", optarg,
+                clock_type_thread, "thread-timings", auto_optarg(),
                 opts.overhead, ARRAY_SIZE(opts.overhead));
 #ifdef CLOCK_CYCLES
             opts.timings &= ~CLOCK_TYPE(cycles);
 #endif
+#ifdef CLOCK_PERF
+            opts.timings &= ~clock_types_perf;
+#endif
+            calibrate_types(CLOCK_TYPE(thread));
             break;
 #ifdef CLOCK_CYCLES
         case clock_cycles_opt:
             opts.timings = options_parse_cycles_overhead_optarg(
-                clock_type_cycles, "clock-cycles", optarg,
+                clock_type_cycles, "clock-cycles", auto_optarg(),
                 opts.overhead, ARRAY_SIZE(opts.overhead));
+            calibrate_types(CLOCK_TYPE(cycles));
             break;
+#endif
+#ifdef CLOCK_PERF
+#undef  CASE
+#define CASE(n, s)                                               \
+        case n ## _opt:                                          \
+            opts.timings |= options_parse_perf_overhead_optarg(  \
+                clock_type_ ## n, s, auto_optarg(),              \
+                opts.overhead, ARRAY_SIZE(opts.overhead));       \
+            opts.timings &= clock_types_perf;                    \
+            calibrate_types(CLOCK_TYPE(n));                      \
+            break
+        CASE(instructions, "instructions");
+        CASE(branch_misses, "branch-misses");
+        CASE(icache_misses, "icache-misses");
+        CASE(cache_misses, "cache-misses");
 #endif
         case no_timings_opt:
             opts.timings = 0;
+            opts.calibrate = 0;
+            break;
+        case sample_opt:
+            opts.sample = options_parse_size_optarg(
+                "sample", optarg, 1, 1000000);
+            opts.random_sample = false;
+            break;
+        case random_sample_opt:
+            opts.sample = options_parse_size_optarg(
+                "random-sample", optarg, 1, 1000000);
+            opts.random_sample = true;
+            break;
+        case no_sample_opt:
+            opts.sample = 1;
+            opts.random_sample = false;
             break;
+#ifdef CLOCK_CYCLES
+        case histogram_opt:
+            opts.histogram = options_parse_histogram_optarg(
+                "histogram", optarg);
+            break;
+        case no_histogram_opt:
+            opts.histogram = options_histogram_none;
+            break;
+#endif
 #endif
+        case stats_opt:
+            opts.stats = options_parse_stats_optarg(
+                "stats", optarg);
+            break;
+        case no_stats_opt:
+            opts.stats = options_stats_none;
+            break;
         case warnings_only_opt:
             opts.warnings = 2;
             break;
@@ -720,6 +1403,17 @@ static const struct options_t* options(
         case no_warnings_opt:
             opts.warnings = 0;
             break;
+        case diagnostics_opt:
+            opts.diagnostics = options_parse_stats_optarg(
+                "diagnostics", optarg);
+            break;
+        case diagnostics_max_opt:
+            opts.diagnostics_max = options_parse_size_optarg(
+                "diagnostics-max", optarg, 1, 1000000);
+            break;
+        case no_diagnostics_opt:
+            opts.diagnostics = options_stats_none;
+            break;
         case dump_opt:
             bits.dump = true;
             break;
@@ -772,6 +1466,39 @@ static const struct options_t* options(
         opts.argc --;
     }
 
+#ifndef BUILTIN
+    if (!bits.autotune_cache)
+        opts.autotune_cache = autotune_cache_default();
+
+    // stev: when no parser was specified explicitly,
+    // pick the one that '-A|--autotune' found to be
+    // the fastest on the host's CPU for this build (if
+    // any such); that only for the actions which do
+    // parse char references -- '-E|--encode-cref' and
+    // '-X|--escape-cref' do not --; the CPU's model
+    // name is looked up only when a cache file exists
+    // at all
+    if (!bits.cref_parser &&
+        opts.autotune_cache != NULL &&
+        (opts.action == options_subst_cref_action ||
+         opts.action == options_print_cref_action ||
+         opts.action == options_validate_cref_action) &&
+        !access(opts.autotune_cache, R_OK)) {
+        char c[256], *n;
+
+        if (cpu_info_model_name(c, sizeof c) &&
+            (n = autotune_cache_lookup(
+                    opts.autotune_cache, c))) {
+            if (autotune_cache_valid_name(n)) {
+                opts.cref_parser = n;
+                opts.autotuned = true;
+            }
+            else
+                free(n);
+        }
+    }
+#endif
+
     if (bits.version)
         options_version();
     if (bits.dump)
@@ -784,6 +1511,50 @@ static const struct options_t* options(
         bits.usage)
         exit(0);
 
+#if defined(TIMINGS) && defined(CLOCK_CYCLES)
+    if (opts.histogram &&
+        !(opts.timings & CLOCK_TYPE(cycles)))
+        error("option '--histogram' requires "
+            "option '-c|--[clock-]cycles'");
+#endif
+
+    if (opts.diagnostics && !opts.warnings)
+        error("option '--diagnostics' requires "
+            "option '-w|--warnings[-only]'");
+
+    if (opts.print_format &&
+        opts.action != options_print_cref_action)
+        error("option '--print-format' requires "
+            "action '-P|--print-cref'");
+
+    if (opts.stats &&
+        opts.action != options_subst_cref_action)
+        error("option '--stats' requires "
+            "action '-S|--subst-cref'");
+
+    if (opts.threads > 1 &&
+        (opts.action != options_subst_cref_action ||
+         opts.input_type != options_input_type_sponge))
+        error("option '-j|--threads' requires action "
+            "'-S|--subst-cref' and input type 'sponge'");
+
+    // stev: the statistics are collected into one
+    // global structure, and so are the performance
+    // counters opened -- these count the events of
+    // the thread that opened them only
+    if (opts.threads > 1 && opts.stats)
+        error("option '-j|--threads' cannot be "
+            "combined with option '--stats'");
+    if (opts.threads > 1 && opts.diagnostics)
+        error("option '-j|--threads' cannot be "
+            "combined with option '--diagnostics'");
+#if defined(TIMINGS) && defined(CLOCK_PERF)
+    if (opts.threads > 1 &&
+        (opts.timings & clock_types_perf))
+        error("option '-j|--threads' cannot be "
+            "combined with performance counters");
+#endif
+
     if (opts.input_file != NULL &&
         !strcmp(opts.input_file, "-"))
         opts.input_file = NULL;
@@ -796,6 +1567,8 @@ enum process_cref_flags_t
     process_cref_strict_semis = 1U << 0,
     process_cref_warn_invalid = 1U << 1,
     process_cref_print_output = 1U << 2,
+    process_cref_collect_stats = 1U << 3,
+    process_cref_collect_diags = 1U << 4,
 };
 
 #define PROCESS_CREF_FLAGS_(n) \
@@ -813,44 +1586,412 @@ enum process_cref_flags_t
 #define FLAGS_HAS     PROCESS_CREF_FLAGS_HAS
 #define FLAGS_HAS_ONE PROCESS_CREF_FLAGS_HAS_ONE
 
-static void process_cref_warn(
-    const char* ptr, size_t len, bool subst,
-    enum process_cref_flags_t flags)
-{
-    enum { N = 2 * html_cref_max_name_len };
-    FILE* f = FLAGS_HAS(print_output)
-        ? stderr : stdout;
-    const char* q;
+#define STATS_ADD(n, v)                         \
+    do {                                        \
+        if (FLAGS_HAS(collect_stats))           \
+            process_stats.n += (v);             \
+    } while (0)
 
-    if (subst) {
-        ASSERT(*ptr == '&');
-        ptr ++;
+#define OUTPUT(p, n)                            \
+    do {                                        \
+        if (FLAGS_HAS(print_output)) {          \
+            fwrite(p, 1, n, out);               \
+            STATS_ADD(bytes_out, n);            \
+        }                                       \
+    } while (0)
 
-        if (!len) {
-            q = ptr;
-            while (ISALNUM(*q))
-                q ++;
+// stev: the offsets that the parsers return are into
+// 'html_cref_table', unless the parser comes with its
+// own table -- by defining 'html_cref_NAME_get_table',
+// as 'mtrie' does, of which table is read from its
+// index file at load time
 
-            len = PTR_DIFF(q, ptr);
-            ASSERT(len > 0);
+typedef
+    const uchar_t* (*process_table_func_t)(size_t*);
 
-            if (len > N)
-                len = N;
-        }
-    }
+static const uchar_t* process_table = html_cref_table;
+static size_t process_table_size;
 
+#ifdef BUILTIN
+#define PROCESS_GET_TABLE_(n) html_cref_ ## n ## _get_table
+#define PROCESS_GET_TABLE(n)  PROCESS_GET_TABLE_(n)
+
+const uchar_t* PROCESS_GET_TABLE(BUILTIN)(size_t*)
+    __attribute__ ((weak));
+
+#define PROCESS_GET_ERROR_(n) html_cref_ ## n ## _get_error
+#define PROCESS_GET_ERROR(n)  PROCESS_GET_ERROR_(n)
+
+const char* PROCESS_GET_ERROR(BUILTIN)(void)
+    __attribute__ ((weak));
+#endif
+
+static void process_table_init(
+    process_table_func_t func)
+{
+    process_table_size = html_cref_table_size;
+    if (func != NULL) {
+        process_table = func(&process_table_size);
+        ASSERT(process_table != NULL);
+    }
+}
+
+// stev: the named char references are counted by
+// their offsets in 'process_table'; the names are
+// not stored in the table, thus are copied from the
+// input upon the first occurrence of each of them
+
+struct process_stats_t
+{
+    size_t  bytes_in;
+    size_t  bytes_out;
+    size_t  named;
+    size_t  legacy;
+    size_t  decimal;
+    size_t  hex;
+    size_t  invalid;
+    size_t* counts;
+    char**  names;
+};
+
+static struct process_stats_t process_stats;
+
+// stev: 'process_file' is the stream on which the
+// calling thread prints out its output -- or, by
+// case, its warnings --; NULL stands for stdout,
+// the stream of the main thread
+
+static __thread FILE* process_file = NULL;
+
+#define PROCESS_FILE() \
+    (process_file ? process_file : stdout)
+
+static void process_stats_init(void)
+{
+    process_stats.counts = calloc(
+        process_table_size,
+        sizeof(*process_stats.counts));
+    ASSERT(process_stats.counts != NULL);
+
+    process_stats.names = calloc(
+        process_table_size,
+        sizeof(*process_stats.names));
+    ASSERT(process_stats.names != NULL);
+}
+
+static void process_stats_done(void)
+{
+    size_t i;
+
+    for (i = 0; i < process_table_size; i ++)
+        free(process_stats.names[i]);
+    free(process_stats.names);
+    free(process_stats.counts);
+}
+
+static inline void process_stats_add_name(
+    size_t index, const char* name, size_t len)
+{
+    ASSERT(index < process_table_size);
+
+    if (process_stats.counts[index] ++ == 0) {
+        process_stats.names[index] =
+            strndup(name, len);
+        ASSERT(process_stats.names[index] != NULL);
+    }
+}
+
+// stev: the diagnostics are the warnings collected
+// in memory, deduplicated by the text of the char
+// reference; 'slots' is an open addressing hash
+// table of which non-zero elements are indices plus
+// one in 'entries' -- that is at most half full --;
+// once 'max' entries were collected, the warnings
+// of texts not yet seen are counted as suppressed
+
+struct process_diag_t
+{
+    char*  text;
+    size_t len;
+    size_t count;
+    size_t offset;
+    size_t line;
+    size_t column;
+};
+
+struct process_diags_t
+{
+    struct process_diag_t*
+            entries;
+    size_t* slots;
+    size_t  mask;
+    size_t  size;
+    size_t  max;
+    size_t  total;
+    size_t  suppressed;
+
+    // stev: the location of the warnings is tracked
+    // incrementally: 'scan' is the position in the
+    // buffer being processed up to which the line
+    // ends were counted -- 'line' is the number of
+    // the line that contains 'scan', which starts
+    // at the input offset 'line_start' --; 'base'
+    // is the input offset of the buffer 'buf'
+    const char* buf;
+    const char* scan;
+    size_t  base;
+    size_t  line;
+    size_t  line_start;
+};
+
+static struct process_diags_t process_diags;
+
+static void process_diags_init(size_t max)
+{
+    size_t n = 2;
+
+    ASSERT(max > 0);
+    while (n < 2 * max)
+        n *= 2;
+
+    memset(&process_diags, 0,
+        sizeof(process_diags));
+
+    process_diags.entries = malloc(
+        max * sizeof(*process_diags.entries));
+    ASSERT(process_diags.entries != NULL);
+
+    process_diags.slots = calloc(
+        n, sizeof(*process_diags.slots));
+    ASSERT(process_diags.slots != NULL);
+
+    process_diags.mask = n - 1;
+    process_diags.max = max;
+    process_diags.line = 1;
+}
+
+static void process_diags_done(void)
+{
+    size_t i;
+
+    for (i = 0; i < process_diags.size; i ++)
+        free(process_diags.entries[i].text);
+    free(process_diags.entries);
+    free(process_diags.slots);
+}
+
+// stev: the line ends of the buffers of the action
+// '-P|--print-cref' are replaced by NUL chars prior
+// to be looked up, hence 'eol'
+
+static void process_diags_scan(
+    const char* ptr, char eol)
+{
+    struct process_diags_t* d = &process_diags;
+    const char* p;
+
+    ASSERT(d->scan != NULL);
+    ASSERT(d->scan <= ptr);
+
+    while ((p = memchr(d->scan, eol,
+                PTR_DIFF(ptr, d->scan)))) {
+        d->scan = p + 1;
+        d->line_start = d->base +
+            PTR_DIFF(d->scan, d->buf);
+        d->line ++;
+    }
+    d->scan = ptr;
+}
+
+static inline void process_diags_buf_init(
+    const char* buf)
+{
+    process_diags.buf = buf;
+    process_diags.scan = buf;
+}
+
+static inline void process_diags_buf_done(
+    size_t len, char eol)
+{
+    process_diags_scan(
+        process_diags.buf + len, eol);
+    process_diags.base += len;
+    process_diags.buf = NULL;
+    process_diags.scan = NULL;
+}
+
+static size_t process_diags_hash(
+    const char* ptr, size_t len)
+{
+    // stev: FNV-1a
+    size_t h = 14695981039346656037UL;
+
+    while (len --) {
+        h ^= (uchar_t) *ptr ++;
+        h *= 1099511628211UL;
+    }
+    return h;
+}
+
+static void process_diags_add(
+    const char* pos, const char* ptr,
+    size_t len, char eol)
+{
+    struct process_diags_t* d = &process_diags;
+    struct process_diag_t* e;
+    size_t h, k;
+
+    STATIC(sizeof(size_t) == 8);
+
+    d->total ++;
+
+    h = process_diags_hash(ptr, len);
+    for (k = h & d->mask; d->slots[k];
+         k = (k + 1) & d->mask) {
+        e = d->entries + d->slots[k] - 1;
+        if (e->len == len &&
+            !memcmp(e->text, ptr, len)) {
+            e->count ++;
+            return;
+        }
+    }
+
+    if (d->size >= d->max) {
+        d->suppressed ++;
+        return;
+    }
+
+    process_diags_scan(pos, eol);
+
+    e = d->entries + d->size;
+    e->text = strndup(ptr, len);
+    ASSERT(e->text != NULL);
+    e->len = len;
+    e->count = 1;
+    e->offset = d->base + PTR_DIFF(pos, d->buf);
+    e->line = d->line;
+    e->column = e->offset - d->line_start + 1;
+
+    d->slots[k] = ++ d->size;
+}
+
+static void process_diags_print_json_string(
+    FILE* file, const char* ptr, size_t len)
+{
+    fputc('"', file);
+    while (len --) {
+        uchar_t c = *ptr ++;
+
+        if (c == '"' || c == '\\')
+            fprintf(file, "\\%c", c);
+        else
+        if (c < 0x20 || c >= 0x7f)
+            fprintf(file, "\\u%04x", c);
+        else
+            fputc(c, file);
+    }
+    fputc('"', file);
+}
+
+// stev: the diagnostics are printed out in the
+// order of their first occurrence in the input
+
+static void process_diags_print(
+    enum options_stats_t format, FILE* file)
+{
+    const struct process_diags_t* d = &process_diags;
+    const bool j = format == options_stats_json;
+    const struct process_diag_t *p, *e;
+
+    for (p = d->entries,
+         e = p + d->size;
+         p < e;
+         p ++) {
+        if (j) {
+            fputs("{\"ref\":", file);
+            process_diags_print_json_string(
+                file, p->text, p->len);
+            fprintf(file,
+                ",\"offset\":%zu"
+                ",\"line\":%zu"
+                ",\"column\":%zu"
+                ",\"count\":%zu}\n",
+                p->offset, p->line,
+                p->column, p->count);
+        }
+        else {
+            fprintf(file,
+                "%s: warning: %zu:%zu: invalid char "
+                "reference '", program, p->line,
+                p->column);
+            pretty_print_string(file,
+                PTR_UCHAR_CAST(p->text),
+                p->len, 0);
+            fprintf(file,
+                "' (offset %zu, %zu time%s)\n",
+                p->offset, p->count,
+                p->count > 1 ? "s" : "");
+        }
+    }
+
+    if (j)
+        fprintf(file,
+            "{\"total\":%zu"
+            ",\"distinct\":%zu"
+            ",\"suppressed\":%zu}\n",
+            d->total, d->size, d->suppressed);
+    else
+        fprintf(file,
+            "%s: warning: %zu invalid char reference(s): "
+            "%zu distinct, %zu suppressed\n",
+            program, d->total, d->size, d->suppressed);
+}
+
+static void process_cref_warn(
+    const char* ptr, size_t len, bool subst,
+    enum process_cref_flags_t flags)
+{
+    enum { N = 2 * html_cref_max_name_len };
+    FILE* f = FLAGS_HAS(print_output)
+        ? stderr : PROCESS_FILE();
+    const char* b = ptr;
+    const char* q;
+
+    if (subst) {
+        ASSERT(*ptr == '&');
+        ptr ++;
+
+        // stev: scan no further than printed, for
+        // the cost of a warning to not grow with
+        // the length of the alphanumeric run
+        if (!len) {
+            q = ptr;
+            while (ISALNUM(*q) && PTR_DIFF(q, ptr) < N)
+                q ++;
+
+            len = PTR_DIFF(q, ptr);
+            ASSERT(len > 0);
+        }
+    }
+
+    if (FLAGS_HAS(collect_diags)) {
+        process_diags_add(
+            b, ptr, len, subst ? '\n' : 0);
+        return;
+    }
+
+    // stev: the warnings of concurrent threads
+    // are not to interleave on stderr
+    flockfile(f);
     fprintf(
         f, "%s: warning: invalid char reference '",
         program);
     pretty_print_string(
         f, PTR_UCHAR_CAST_CONST(ptr), len, 0);
     fputs("'\n", f);
+    funlockfile(f);
 }
 
-#ifdef TIMINGS
-static size_t process_cref_count = 0;
-#endif
-
 #ifndef BUILTIN
 typedef
     int (*process_cref_func_t)(const char*);
@@ -869,6 +2010,7 @@ static void process_subst_cref(
 {
     const size_t mask = SZ(1) << 7;
     const char *p = buf, *q;
+    FILE* out = PROCESS_FILE();
     size_t l = len, d;
 
     STATIC(CHAR_BIT == 8);
@@ -881,13 +2023,19 @@ static void process_subst_cref(
 
     ASSERT(buf[len] == 0);
 
-    while ((q = memchr(p, '&', l))) {
+    STATS_ADD(bytes_in, len);
+
+    if (FLAGS_HAS(collect_diags))
+        process_diags_buf_init(buf);
+
+    while ((q = html_cref_simd_find_amp(p, l))) {
         d = PTR_DIFF(q, p);
-        if (FLAGS_HAS(print_output))
-            fwrite(p, 1, d, stdout);
+        OUTPUT(p, d);
         p += d;
         l -= d;
 
+        HTML_CREF_PROBE2(ref_start, q, PTR_DIFF(q, buf));
+
         if (q[1] == '#') {
             code_point_t c;
             utf8_t u;
@@ -902,15 +2050,21 @@ static void process_subst_cref(
                 if (FLAGS_HAS(warn_invalid))
                     process_cref_warn(
                         p, d, true, flags);
-                if (FLAGS_HAS(print_output))
-                    fwrite(p, 1, d, stdout);
+                OUTPUT(p, d);
+                STATS_ADD(invalid, 1);
+                HTML_CREF_PROBE2(ref_invalid, p, d);
             }
             else {
+                HTML_CREF_PROBE1(ref_numeric, c);
+
                 n = html_cref_unicode_encode_utf8(c, u);
                 ASSERT(n < 5);
 
-                if (FLAGS_HAS(print_output))
-                    fwrite(u, 1, n, stdout);
+                OUTPUT(u, n);
+                if (p[2] == 'x' || p[2] == 'X')
+                    STATS_ADD(hex, 1);
+                else
+                    STATS_ADD(decimal, 1);
                 q ++;
                 d ++;
             }
@@ -922,21 +2076,23 @@ static void process_subst_cref(
             bool b;
             int i;
 
-#ifdef TIMINGS
-            process_cref_count ++;
-#endif
-            if ((i = process_cref(q + 1)) < 0) {
+            HTML_CREF_PROBE1(parse_entry, q + 1);
+            i = process_cref(q + 1);
+            HTML_CREF_PROBE1(parse_return, i);
+
+            if (i < 0) {
                 if (FLAGS_HAS(warn_invalid))
                     process_cref_warn(
                         p, 0, true, flags);
-                if (FLAGS_HAS(print_output))
-                    fwrite(p, 1, 2, stdout);
+                OUTPUT(p, 2);
+                STATS_ADD(invalid, 1);
+                HTML_CREF_PROBE2(ref_invalid, p, 2);
                 q += 2;
             }
             else {
                 j = INT_AS_SIZE(i);
-                ASSERT(j < html_cref_table_size);
-                t = &html_cref_table[j];
+                ASSERT(j < process_table_size);
+                t = &process_table[j];
 
                 d = (*t & ~mask) + 1;
                 b = !FLAGS_HAS(strict_semis) &&
@@ -946,12 +2102,21 @@ static void process_subst_cref(
                     if (FLAGS_HAS(warn_invalid))
                         process_cref_warn(
                             p, 0, true, flags);
-                    if (FLAGS_HAS(print_output))
-                        fwrite(q, 1, d, stdout);
+                    OUTPUT(q, d);
+                    STATS_ADD(invalid, 1);
+                    HTML_CREF_PROBE2(ref_invalid, q, d);
                 }
                 else {
-                    if (FLAGS_HAS(print_output))
-                        fwrite(t + 2, 1, t[1], stdout);
+                    HTML_CREF_PROBE3(ref_resolved, q + 1, d - 1, j);
+
+                    OUTPUT(t + 2, t[1]);
+                    if (FLAGS_HAS(collect_stats)) {
+                        process_stats_add_name(
+                            j, q + 1, d - 1);
+                        process_stats.named ++;
+                        if (q[d] != ';')
+                            process_stats.legacy ++;
+                    }
                 }
 
                 q += d;
@@ -960,21 +2125,269 @@ static void process_subst_cref(
             d = PTR_DIFF(q, p);
         }
         else {
-            if (FLAGS_HAS(print_output))
-                fwrite(p, 1, 2, stdout);
+            // stev: an '&' ending the buffer is
+            // followed by the NUL terminator only
+            d = q[1] ? 2 : 1;
+            OUTPUT(p, d);
+            q += d;
+        }
+
+        ASSERT_SIZE_SUB_NO_OVERFLOW(l, d);
+        l -= d;
+        p = q;
+    }
+    OUTPUT(p, l);
+
+    if (FLAGS_HAS(collect_diags))
+        process_diags_buf_done(len, '\n');
+
+    HTML_CREF_PROBE2(buffer_done, buf, len);
+}
+
+// stev: the action '-V|--validate-cref' follows the
+// same path as '-S|--subst-cref', but, instead of
+// producing the output, it only accounts for its
+// size; the counters are accumulated in locals and
+// added to 'process_valid' at the end of each buffer
+
+struct process_valid_t
+{
+    size_t bytes_in;
+    size_t bytes_out;
+    size_t valid;
+    size_t invalid;
+    size_t legacy;
+};
+
+static struct process_valid_t process_valid;
+
+static void process_validate_cref(
+    char* buf, size_t len,
+#ifndef BUILTIN
+    process_cref_func_t process_cref,
+#endif
+    enum process_cref_flags_t flags)
+{
+    const size_t mask = SZ(1) << 7;
+    const char *p = buf, *q;
+    size_t l = len, d, o = 0;
+    size_t v = 0, w = 0, g = 0;
+
+    ASSERT(buf != NULL);
+    ASSERT(len > 0);
+
+    ASSERT(buf[len] == 0);
+
+    if (FLAGS_HAS(collect_diags))
+        process_diags_buf_init(buf);
+
+    while ((q = html_cref_simd_find_amp(p, l))) {
+        d = PTR_DIFF(q, p);
+        o += d;
+        p += d;
+        l -= d;
+
+        if (q[1] == '#') {
+            code_point_t c;
+
             q += 2;
-            d = 2;
+            if (!html_cref_unicode_parse_html(&q, &c) ||
+                *q != ';') {
+                d = PTR_DIFF(q, p);
+                if (FLAGS_HAS(warn_invalid))
+                    process_cref_warn(
+                        p, d, true, flags);
+                o += d;
+                w ++;
+            }
+            else {
+                // stev: the length of the UTF-8
+                // encoding of 'c' -- see function
+                // 'html_cref_unicode_encode_utf8'
+                o += 1 +
+                    (c >= 0x80) +
+                    (c >= 0x800) +
+                    (c >= 0x10000);
+                v ++;
+                q ++;
+                d = PTR_DIFF(q, p);
+            }
+        }
+        else
+        if (ISALNUM(q[1])) {
+            const uchar_t* t;
+            int i;
+
+            if ((i = process_cref(q + 1)) < 0) {
+                if (FLAGS_HAS(warn_invalid))
+                    process_cref_warn(
+                        p, 0, true, flags);
+                o += 2;
+                w ++;
+                q += 2;
+            }
+            else {
+                ASSERT(INT_AS_SIZE(i) < process_table_size);
+                t = &process_table[i];
+
+                d = (*t & ~mask) + 1;
+
+                if (q[d] == ';') {
+                    o += t[1];
+                    v ++;
+                    q ++;
+                }
+                else
+                if (!FLAGS_HAS(strict_semis) &&
+                    (*t & mask)) {
+                    o += t[1];
+                    v ++;
+                    g ++;
+                }
+                else {
+                    if (FLAGS_HAS(warn_invalid))
+                        process_cref_warn(
+                            p, 0, true, flags);
+                    o += d;
+                    w ++;
+                }
+                q += d;
+            }
+            d = PTR_DIFF(q, p);
+        }
+        else {
+            d = q[1] ? 2 : 1;
+            o += d;
+            q += d;
         }
 
         ASSERT_SIZE_SUB_NO_OVERFLOW(l, d);
         l -= d;
         p = q;
     }
-    if (FLAGS_HAS(print_output))
-        fwrite(p, 1, l, stdout);
+    o += l;
+
+    if (FLAGS_HAS(collect_diags))
+        process_diags_buf_done(len, '\n');
+
+    process_valid.bytes_in += len;
+    process_valid.bytes_out += o;
+    process_valid.valid += v;
+    process_valid.invalid += w;
+    process_valid.legacy += g;
+}
+
+static void process_valid_print(void)
+{
+    fprintf(stdout,
+        "bytes-in:  %zu\n"
+        "bytes-out: %zu\n"
+        "valid:     %zu\n"
+        "invalid:   %zu\n"
+        "legacy:    %zu\n",
+        process_valid.bytes_in,
+        process_valid.bytes_out,
+        process_valid.valid,
+        process_valid.invalid,
+        process_valid.legacy);
+}
+
+// stev: the two code point sequences that have names
+// may start with an ASCII char -- e.g. '<' followed
+// by U+20D2 is 'nvlt' --, thus upon a non-ASCII char
+// the char preceding it is looked up together with
+// it, unless that char was already written out
+
+static void process_encode_cref(
+    char* buf, size_t len,
+#ifndef BUILTIN
+    process_cref_func_t process_cref UNUSED,
+#endif
+    enum process_cref_flags_t flags UNUSED)
+{
+    const struct html_cref_encode_entry_t* r;
+    const char *p = buf, *q, *e = buf + len;
+    FILE* out = PROCESS_FILE();
+    code_point_t c, d;
+    size_t n, m;
+
+    ASSERT(buf != NULL);
+    ASSERT(len > 0);
+
+    while ((q = html_cref_simd_find_encode(
+                p, PTR_DIFF(e, p)))) {
+        n = html_cref_unicode_decode_utf8(
+                q, PTR_DIFF(e, q), &c);
+        if (n == 0) {
+            fwrite(p, 1, PTR_DIFF(q, p), out);
+            fputs("&#xFFFD;", out);
+            p = q + 1;
+            continue;
+        }
+
+        if (q > p && c >= 0x80 &&
+            (r = html_cref_encode_lookup(
+                    (uchar_t) q[-1], c)) &&
+            r->code[1] == c) {
+            fwrite(p, 1, PTR_DIFF(q, p) - 1, out);
+            m = 0;
+        }
+        else {
+            m = html_cref_unicode_decode_utf8(
+                    q + n, PTR_DIFF(e, q + n), &d);
+            r = html_cref_encode_lookup(c, m ? d : 0);
+            fwrite(p, 1, PTR_DIFF(q, p), out);
+        }
+
+        if (r == NULL)
+            fprintf(out, "&#x%X;", c);
+        else {
+            fputc('&', out);
+            fwrite(r->name, 1, r->len, out);
+            fputc(';', out);
+        }
+
+        p = q + n;
+        if (r != NULL && r->code[1] && m)
+            p += m;
+    }
+    fwrite(p, 1, PTR_DIFF(e, p), out);
+}
+
+// stev: the input is escaped by chunks, such that the
+// escaped text of each fits in a buffer on the stack;
+// the chunks that need no escaping at all are written
+// out as they are, with no copy
+
+enum { process_escape_chunk = 4096 };
+
+static void process_escape_cref(
+    char* buf, size_t len,
+#ifndef BUILTIN
+    process_cref_func_t process_cref UNUSED,
+#endif
+    enum process_cref_flags_t flags UNUSED)
+{
+    char b[process_escape_chunk * html_cref_escape_max];
+    const char *p = buf, *q, *e = buf + len;
+    FILE* out = PROCESS_FILE();
+    size_t n, l;
+
+    ASSERT(buf != NULL);
+    ASSERT(len > 0);
+
+    for (; p < e; p += n) {
+        n = PTR_DIFF(e, p);
+        if (n > process_escape_chunk)
+            n = process_escape_chunk;
+
+        q = html_cref_escape(p, n, b, &l);
+        fwrite(q, 1, l, out);
+    }
 }
 
 static inline void pretty_print_cref(
+    FILE* file,
     const uchar_t* ptr,
     size_t len)
 {
@@ -988,12 +2401,179 @@ static inline void pretty_print_cref(
          p < e;
          p ++) {
         if (ISASCII(*p))
-            pretty_print_char(stdout, *p, 0);
+            pretty_print_char(file, *p, 0);
         else
-            fprintf(stdout, "\\%03o", *p);
+            fprintf(file, "\\%03o", *p);
+    }
+}
+
+// stev: the output of the action '-P|--print-cref'
+// is made of the names found followed by the forms
+// of their table entries; the forms of all entries
+// are made at once, upon initialization, and stored
+// one after the other in 'forms', in the order of
+// the entries in 'process_table'; 'offs' maps the
+// offset of each entry to the offset of its form,
+// such that the form of an entry ends where the one
+// of the next entry begins; the output is gathered
+// in 'buf' -- in place of the buffer of stdout --,
+// which is written out by 'write(2)' when full and
+// upon the end of the input
+
+struct process_print_t
+{
+    enum options_print_format_t
+            format;
+    char*   forms;
+    size_t* offs;
+    size_t  len;
+    char    buf[SZ(1) << 16];
+};
+
+static struct process_print_t process_print;
+
+static void process_print_entry(
+    FILE* file, const uchar_t* entry,
+    enum options_print_format_t format)
+{
+    const size_t mask = SZ(1) << 7;
+    const uchar_t* t = entry;
+    const uchar_t *p, *e;
+    code_point_t c;
+    size_t n;
+    bool b;
+
+    b = *t & mask;
+
+    switch (format) {
+    case options_print_format_text:
+        fputc(' ', file);
+        pretty_print_cref(file, t + 2, t[1]);
+        if (b) fputs(" *", file);
+        fputc('\n', file);
+        break;
+    case options_print_format_tsv:
+        for (p = t + 2,
+             e = p + t[1];
+             p < e;
+             p += n) {
+            n = html_cref_unicode_decode_utf8(
+                    PTR_CHAR_CAST_CONST(p),
+                    PTR_DIFF(e, p), &c);
+            ASSERT(n > 0);
+            fprintf(file, "%sU+%04X",
+                p > t + 2 ? " " : "\t", c);
+        }
+        fprintf(file, "\t%d\n", b);
+        break;
+    case options_print_format_binary:
+        fwrite(t + 1, 1, t[1] + 1U, file);
+        fputc(b, file);
+        break;
+    default:
+        UNEXPECT_VAR("%d", format);
     }
 }
 
+static void process_print_init(
+    enum options_print_format_t format)
+{
+    const size_t m = process_table_size;
+    size_t i, k, n = 0;
+    FILE* f;
+    long l;
+
+    process_print.format = format;
+    process_print.offs = malloc(
+        SIZE_MUL(SIZE_INC(m),
+            sizeof(*process_print.offs)));
+    ASSERT(process_print.offs != NULL);
+    process_print.forms = NULL;
+
+    f = open_memstream(&process_print.forms, &n);
+    if (f == NULL)
+        error("open_memstream failed: %s",
+            strerror(errno));
+
+    for (i = 0; i < m; i = k) {
+        k = i + process_table[i + 1] + 2;
+        ASSERT(k <= m);
+
+        l = ftell(f);
+        process_print.offs[i] = INT_AS_SIZE(l);
+        process_print_entry(f, process_table + i, format);
+    }
+    l = ftell(f);
+    process_print.offs[m] = INT_AS_SIZE(l);
+
+    fclose(f);
+    ASSERT(process_print.forms != NULL);
+
+    // stev: nothing written on stdout so far
+    // is to be written out after the output
+    fflush(stdout);
+    process_print.len = 0;
+}
+
+static void process_print_flush(void)
+{
+    const char* p = process_print.buf;
+    size_t n = process_print.len;
+    ssize_t r;
+
+    while (n > 0) {
+        if ((r = write(STDOUT_FILENO, p, n)) < 0) {
+            if (errno == EINTR)
+                continue;
+            error("write failed: %s",
+                strerror(errno));
+        }
+        p += r;
+        n -= INT_AS_SIZE(r);
+    }
+    process_print.len = 0;
+}
+
+static void process_print_done(void)
+{
+    process_print_flush();
+
+    free(process_print.forms);
+    free(process_print.offs);
+}
+
+static inline void process_print_put(
+    const void* ptr, size_t len)
+{
+    struct process_print_t* p = &process_print;
+
+    // stev: a form is no longer than a
+    // small fraction of 'buf', and so is
+    // a name, which the lookup function
+    // has found in 'process_table'
+    ASSERT(len <= sizeof(p->buf));
+
+    if (len > sizeof(p->buf) - p->len)
+        process_print_flush();
+    memcpy(p->buf + p->len, ptr, len);
+    p->len += len;
+}
+
+static inline void process_print_write(
+    const uchar_t* entry, size_t index,
+    const char* name, size_t len)
+{
+    const size_t* o = process_print.offs + index;
+    uchar_t c = len;
+
+    if (process_print.format ==
+            options_print_format_binary)
+        process_print_put(&c, 1);
+    process_print_put(name, len);
+    process_print_put(process_print.forms + *o,
+        o[entry[1] + 2] - *o);
+}
+
 #ifdef BUILTIN
 #undef  PROCESS_CREF_
 #define PROCESS_CREF_(n) html_cref_ ## n ## _lookup
@@ -1022,12 +2602,15 @@ static void process_print_cref(
     e = buf + len;
     ASSERT(*e == 0);
 
+    if (FLAGS_HAS(collect_diags))
+        process_diags_buf_init(buf);
+
     do {
         // stev: the module functions
         // 'html_cref_*_lookup*' need
         // their input argument to be
         // NUL-terminated
-        if ((q = strchr(p, '\n')))
+        if ((q = memchr(p, '\n', PTR_DIFF(e, p))))
             *q = 0;
         else
             q = e;
@@ -1042,22 +2625,21 @@ static void process_print_cref(
         }
         else {
             j = INT_AS_SIZE(i);
-            ASSERT(j < html_cref_table_size);
-            t = &html_cref_table[j];
+            ASSERT(j < process_table_size);
+            t = &process_table[j];
 
             if ((*t & ~mask) != d)
                 goto not_found;
 
-            if (FLAGS_HAS(print_output)) {
-                fprintf(stdout, "%s ", p);
-                pretty_print_cref(t + 2, t[1]);
-                if (*t & mask) fputs(" *", stdout);
-                fputc('\n', stdout);
-            }
+            if (FLAGS_HAS(print_output))
+                process_print_write(t, j, p, d);
         }
 
         if (q < e) q ++;
     } while ((p = q) < e);
+
+    if (FLAGS_HAS(collect_diags))
+        process_diags_buf_done(len, 0);
 }
 
 #undef FLAGS_HAS_ONE
@@ -1139,52 +2721,225 @@ static bool input_liner_process(
 #define input_sponge_init file_buf_init
 #define input_sponge_done file_buf_done
 
-#undef  CASE
-#define CASE(n) [file_buf_error_file_ ## n] = #n
+#undef  CASE
+#define CASE(n) [file_buf_error_file_ ## n] = #n
+
+static void input_sponge_error(
+    const struct input_sponge_t* input)
+    NORETURN;
+
+static void input_sponge_error(
+    const struct input_sponge_t* input)
+{
+    static const char* const types[] = {
+        CASE(open),
+        CASE(stat),
+        CASE(read),
+        CASE(close),
+    };
+    const char* t = ARRAY_NULL_ELEM(types,
+        input->error_info.type);
+
+    ASSERT(t != NULL);
+
+    error("%s: %s error: %s",
+        input->file_name
+        ? input->file_name : stdin_name,
+        t, strerror(input->error_info.sys_error));
+}
+
+static bool input_sponge_process(
+    struct input_sponge_t* input,
+    process_buf_func_t process_buf,
+#ifndef BUILTIN
+    process_cref_func_t process_cref,
+#endif
+    enum process_cref_flags_t flags)
+{
+    if (input->error_info.type !=
+            file_buf_error_none)
+        input_sponge_error(input);
+
+    process_buf(
+        PTR_CHAR_CAST(input->ptr),
+        input->size,
+#ifndef BUILTIN
+        process_cref,
+#endif
+        flags);
+
+    return true;
+}
+
+#ifdef TIMINGS
+static size_t timings_thread_start(void);
+static void timings_thread_done(size_t index);
+#endif
+
+// stev: the input of type 'threads' is a sponge input
+// of which buffer gets split in at most 'n_threads'
+// chunks at new-line boundaries: each chunk but the
+// last one ends right before a new-line char, which
+// gets replaced by the NUL terminator the parsers
+// need -- no char reference spans over new-lines --;
+// each chunk is substituted on its own thread into
+// its own memory stream; these streams are written
+// out in order on stdout, each followed by the new-
+// line char that was replaced
+
+struct input_threads_t
+{
+    struct input_sponge_t sponge;
+    size_t                n_threads;
+};
+
+struct input_thread_t
+{
+    pthread_t           id;
+    char*               buf;
+    size_t              len;
+    char*               out;
+    size_t              size;
+    process_buf_func_t  process_buf;
+#ifndef BUILTIN
+    process_cref_func_t process_cref;
+#endif
+    enum process_cref_flags_t
+                        flags;
+};
+
+static void input_threads_init(
+    struct input_threads_t* input,
+    const char* file_name,
+    size_t max_size,
+    size_t n_threads)
+{
+    ASSERT(n_threads > 0);
+    ASSERT(n_threads <= options_threads_max);
+
+    input_sponge_init(&input->sponge,
+        file_name, max_size);
+    input->n_threads = n_threads;
+}
+
+static void input_threads_done(
+    struct input_threads_t* input)
+{
+    input_sponge_done(&input->sponge);
+}
+
+static size_t input_threads_split(
+    char* buf, size_t size,
+    struct input_thread_t* threads,
+    size_t n_threads)
+{
+    char *p = buf, *e = buf + size, *q;
+    size_t k = 0;
+
+    while (k + 1 < n_threads) {
+        q = buf + size * (k + 1) / n_threads;
+        if (q < p)
+            q = p;
+
+        q = memchr(q, '\n', PTR_DIFF(e, q));
+        if (q == NULL)
+            break;
+        *q = 0;
+
+        threads[k].buf = p;
+        threads[k ++].len = PTR_DIFF(q, p);
+        p = q + 1;
+    }
+
+    threads[k].buf = p;
+    threads[k ++].len = PTR_DIFF(e, p);
+
+    return k;
+}
+
+static void* input_thread_run(void* arg)
+{
+    struct input_thread_t* t = arg;
+#ifdef TIMINGS
+    size_t i = timings_thread_start();
+#endif
+
+    process_file = open_memstream(
+        &t->out, &t->size);
+    if (process_file == NULL)
+        error("open_memstream failed: %s",
+            strerror(errno));
 
-static void input_sponge_error(
-    const struct input_sponge_t* input)
-    NORETURN;
+    if (t->len)
+        t->process_buf(t->buf, t->len,
+#ifndef BUILTIN
+            t->process_cref,
+#endif
+            t->flags);
 
-static void input_sponge_error(
-    const struct input_sponge_t* input)
-{
-    static const char* const types[] = {
-        CASE(open),
-        CASE(stat),
-        CASE(read),
-        CASE(close),
-    };
-    const char* t = ARRAY_NULL_ELEM(types,
-        input->error_info.type);
+    if (fclose(process_file))
+        error("closing memory stream failed: %s",
+            strerror(errno));
+    process_file = NULL;
 
-    ASSERT(t != NULL);
+#ifdef TIMINGS
+    timings_thread_done(i);
+#endif
 
-    error("%s: %s error: %s",
-        input->file_name
-        ? input->file_name : stdin_name,
-        t, strerror(input->error_info.sys_error));
+    return NULL;
 }
 
-static bool input_sponge_process(
-    struct input_sponge_t* input,
+static bool input_threads_process(
+    struct input_threads_t* input,
     process_buf_func_t process_buf,
 #ifndef BUILTIN
     process_cref_func_t process_cref,
 #endif
     enum process_cref_flags_t flags)
 {
-    if (input->error_info.type !=
+    struct input_thread_t t[options_threads_max];
+    size_t i, n;
+    int r;
+
+    if (input->sponge.error_info.type !=
             file_buf_error_none)
-        input_sponge_error(input);
+        input_sponge_error(&input->sponge);
 
-    process_buf(
-        PTR_CHAR_CAST(input->ptr),
-        input->size,
+    if (input->sponge.size == 0)
+        return true;
+
+    n = input_threads_split(
+            PTR_CHAR_CAST(input->sponge.ptr),
+            input->sponge.size, t,
+            input->n_threads);
+    ASSERT(n <= input->n_threads);
+
+    for (i = 0; i < n; i ++) {
+        t[i].out = NULL;
+        t[i].size = 0;
+        t[i].process_buf = process_buf;
 #ifndef BUILTIN
-        process_cref,
+        t[i].process_cref = process_cref;
 #endif
-        flags);
+        t[i].flags = flags;
+
+        if ((r = pthread_create(&t[i].id, NULL,
+                    input_thread_run, &t[i])))
+            error("pthread_create failed: %s",
+                strerror(r));
+    }
+
+    for (i = 0; i < n; i ++) {
+        if ((r = pthread_join(t[i].id, NULL)))
+            error("pthread_join failed: %s",
+                strerror(r));
+
+        fwrite(t[i].out, 1, t[i].size, stdout);
+        if (i + 1 < n &&
+            (flags & process_cref_print_output))
+            fputc('\n', stdout);
+        free(t[i].out);
+    }
 
     return true;
 }
@@ -1204,6 +2959,7 @@ struct input_t
     union {
         struct input_liner_t  liner;
         struct input_sponge_t sponge;
+        struct input_threads_t threads;
     };
 
     void                *impl;
@@ -1236,7 +2992,11 @@ static void input_init(
         INPUT_INIT(liner);
         break;
     case options_input_type_sponge:
-        INPUT_INIT(sponge, opts->sponge_max);
+        if (opts->threads > 1)
+            INPUT_INIT(threads, opts->sponge_max,
+                opts->threads);
+        else
+            INPUT_INIT(sponge, opts->sponge_max);
         break;
     default:
         UNEXPECT_VAR("%d", opts->input_type);
@@ -1270,6 +3030,8 @@ static bool input_process(
 
 typedef
     size_t (*get_version_func_t)(void);
+typedef
+    const char* (*get_error_func_t)(void);
 
 struct module_lib_funcs_t
 {
@@ -1299,6 +3061,14 @@ module_lib_entries[] = {
 #endif
 };
 
+static const struct dyn_lib_def_t
+module_lib_def = {
+    .ver_major = HTML_CREF_VERSION_MAJOR,
+    .ver_minor = HTML_CREF_VERSION_MINOR,
+    .n_entries = ARRAY_SIZE(module_lib_entries),
+    .entries = module_lib_entries,
+};
+
 #undef  CASE
 #define CASE(n) case dyn_lib_error_ ## n
 
@@ -1379,6 +3149,57 @@ static char* module_lib_make_name(
     return s;
 }
 
+// stev: 'html_cref_NAME_get_table' and the function
+// 'html_cref_NAME_get_error' are not entries of the
+// 'module_lib_def', since only some modules define
+// them
+
+static void* module_lib_get_sym(
+    struct module_lib_t* lib,
+    const char* name, const char* sym)
+{
+    char* n = NULL;
+    void* f;
+
+    if (asprintf(&n, "html_cref_%s_%s",
+            name, sym) < 0)
+        error("asprintf failed");
+
+    dlerror();
+    f = dlsym(lib->sobj, n);
+    dlerror();
+
+    free(n);
+    return f;
+}
+
+static process_table_func_t
+    module_lib_get_table(
+        struct module_lib_t* lib,
+        const char* name)
+{
+    return (process_table_func_t)
+        module_lib_get_sym(lib,
+            name, "get_table");
+}
+
+// stev: a module which got loaded may yet have failed
+// initializing itself -- as 'mtrie' does when its index
+// file is missing or invalid --; the error is reported
+// by 'html_cref_NAME_get_error'
+
+static const char* module_lib_get_error(
+    struct module_lib_t* lib,
+    const char* name)
+{
+    get_error_func_t f;
+
+    f = (get_error_func_t)
+        module_lib_get_sym(lib, name, "get_error");
+
+    return f != NULL ? f() : NULL;
+}
+
 #ifndef TIMINGS
 #define LOOKUP(l) (l.lookup)
 #define PARSE(l)  (l.parse)
@@ -1392,66 +3213,482 @@ static char* module_lib_make_name(
 #define NONE(n) \
     ({ UNEXPECT_VAR("%d", n); NULL; })
 
+static void module_lib_done(
+    struct module_lib_t* lib)
+{
+    free(CONST_CAST(lib->lib_name, char));
+    dyn_lib_done(lib);
+}
+
+// stev: unlike 'module_lib_load' below, do not fail
+// when the module cannot be loaded, but warn about it
+
+static bool module_lib_try_load(
+    struct module_lib_t* lib, const char* name,
+    struct module_lib_funcs_t* funcs)
+{
+    struct dyn_lib_error_info_t e;
+    char *m = NULL, *n;
+
+    n = module_lib_make_name(name);
+    ASSERT(n != NULL);
+
+    if (dyn_lib_init(lib, n, &module_lib_def, funcs, &e, &m)) {
+        const char* r;
+
+        if (!(r = module_lib_get_error(lib, name)))
+            return true;
+
+        fprintf(stderr, "%s: warning: %s: module error: %s\n",
+            program, lib->lib_name, r);
+        module_lib_done(lib);
+        return false;
+    }
+
+    fprintf(stderr, "%s: warning: %s: module lib error: ",
+        program, lib->lib_name);
+    module_lib_print_error_desc(&e, stderr);
+    if (m != NULL)
+        fprintf(stderr, ": %s\n", m);
+    else
+        fputc('\n', stderr);
+
+    free(m);
+    module_lib_done(lib);
+
+    return false;
+}
+
+// stev: a parser module picked from the autotune cache
+// may since have been removed, or rebuilt such that it
+// does not load anymore; instead of failing each run
+// that did not specify a parser, warn about it and
+// fall back to the default parser; '*name' is set to
+// the name of the parser module actually loaded
+
 static process_cref_func_t
     module_lib_load(
         struct module_lib_t* lib,
-        const struct options_t* opts)
+        const struct options_t* opts,
+        const char** name)
 {
-    static const struct dyn_lib_def_t def = {
-        .ver_major = HTML_CREF_VERSION_MAJOR,
-        .ver_minor = HTML_CREF_VERSION_MINOR,
-        .n_entries = ARRAY_SIZE(module_lib_entries),
-        .entries = module_lib_entries,
-    };
     struct dyn_lib_error_info_t e;
     struct module_lib_funcs_t l;
     char *m = NULL, *n;
+    const char* r;
 
-    n = module_lib_make_name(opts->cref_parser);
-    ASSERT(n != NULL);
+    *name = opts->cref_parser;
+
+    if (!opts->autotuned ||
+        !module_lib_try_load(lib, *name, &l)) {
+        if (opts->autotuned) {
+            fprintf(stderr, "%s: warning: falling back "
+                "to parser '%s'\n", program,
+                options_cref_parser_default);
+            *name = options_cref_parser_default;
+        }
+
+        n = module_lib_make_name(*name);
+        ASSERT(n != NULL);
 
-    if (!dyn_lib_init(lib, n, &def, &l, &e, &m))
-        module_lib_error(lib, &e, m);
-    ASSERT(m == NULL);
+        if (!dyn_lib_init(lib, n, &module_lib_def, &l, &e, &m))
+            module_lib_error(lib, &e, m);
+        ASSERT(m == NULL);
+
+        if ((r = module_lib_get_error(lib, *name)))
+            error("%s: module error: %s", lib->lib_name, r);
+    }
 
     return
         opts->action == options_print_cref_action
       ? LOOKUP(l)
-      : opts->action == options_subst_cref_action
+      : opts->action == options_subst_cref_action ||
+        opts->action == options_validate_cref_action ||
+        opts->action == options_encode_cref_action ||
+        opts->action == options_escape_cref_action
       ? PARSE(l)
       : NONE(opts->action);
 }
 
-static void module_lib_done(
-    struct module_lib_t* lib)
+#ifndef CREF_PARSERS
+#error CREF_PARSERS is not defined
+#endif
+
+// stev: the builtin sample text on which '-A|--autotune'
+// is timing the parser modules when no input file was
+// given; it mixes the most frequent named references of
+// common HTML text with a few legacy ones -- those that
+// are not terminated by semicolon -- and a few that are
+// not valid at all
+
+static const char autotune_sample[] =
+"Fish &amp; Chips &mdash; &quot;Caf&eacute; de l&rsquo;Op&eacute;ra&quot; "
+"&copy; 2019 &middot; All rights reserved&reg; &lt;b&gt;bold&lt;/b&gt; "
+"&nbsp;&nbsp;&laquo; Prev &bull; Next &raquo; &hellip; 5&nbsp;&times;&nbsp;3 "
+"&ndash; 10&deg;C &plusmn; 0.5&deg; &ldquo;quoted&rdquo; &lsquo;single&rsquo; "
+"&euro;100 &pound;80 &yen;9000 &cent;5 &sect;12 &para;3 &trade; &dagger; "
+"&frac12; &frac14; &frac34; &sup2; &micro;s &alpha;&beta;&gamma;&delta; "
+"&larr; &rarr; &uarr; &darr; &harr; &hearts; &spades; &clubs; &diams; "
+"&Auml;rger &ouml;ffnen &uuml;ber &szlig; &ntilde; &ccedil; &aacute; "
+"&iacute; &oacute; &uacute; &agrave; &egrave; &ecirc; &acirc; &ocirc; "
+"&apos;x&apos; &amp &lt &gt &quot &copy &reg &nbsp &notin; &noti; &ampx "
+"&le; &ge; &ne; &asymp; &infin; &sum; &prod; &radic; &int; &part; "
+"&NotNestedGreaterGreater; &CounterClockwiseContourIntegral; "
+"&zwnj; &zwj; &lrm; &rlm; &shy; &thinsp; &ensp; &emsp; &bdquo; &sbquo; "
+"&foo; &bar; &amq; &ltx; &Aacut; &x; &AMP; &LT; &GT; &QUOT; &COPY; ";
+
+static uint64_t autotune_time_now(void)
 {
-    free(CONST_CAST(lib->lib_name, char));
-    dyn_lib_done(lib);
+    struct timespec t;
+
+    if (clock_gettime(CLOCK_MONOTONIC, &t))
+        error("clock_gettime failed: %s",
+            strerror(errno));
+
+    return (uint64_t) t.tv_sec * 1000000000 +
+           (uint64_t) t.tv_nsec;
+}
+
+static volatile int autotune_sink;
+
+// stev: the time spent by 'func' per char reference
+// is the best of a number of rounds, each of which
+// parses all the references in 'refs' as many times
+// as needed for processing at least 'min_refs' refs
+
+static double autotune_time(
+    process_cref_func_t func,
+    const struct html_cref_refs_t* refs)
+{
+    enum {
+        n_rounds = 11,
+        min_refs = 1 << 17
+    };
+    const char **p, **e = refs->ptr + refs->size;
+    uint64_t b = UINT64_MAX, t;
+    size_t i, k, n;
+    int s = 0;
+
+    ASSERT(refs->size > 0);
+    n = (min_refs + refs->size - 1) / refs->size;
+
+    // stev: warm up caches and branch predictors
+    for (p = refs->ptr; p < e; p ++)
+        s += func(*p);
+
+    for (k = 0; k < n_rounds; k ++) {
+        t = autotune_time_now();
+        for (i = 0; i < n; i ++) {
+            for (p = refs->ptr; p < e; p ++)
+                s += func(*p);
+        }
+        t = autotune_time_now() - t;
+        if (b > t)
+            b = t;
+    }
+    autotune_sink = s;
+
+    return (double) b / ((double) n * refs->size);
+}
+
+static void autotune_cache_store(
+    const char* file, const char* cpu,
+    const char* name)
+{
+    char *b = NULL, *t = NULL;
+    FILE *f, *g;
+    size_t n = 0;
+    ssize_t r;
+    int e;
+
+    // stev: when creating the default cache file,
+    // its directory -- and any of the directories
+    // above it -- may not have been created yet
+    if ((b = strrchr(file, '/')) && b > file) {
+        char *d = strndup(file, PTR_DIFF(b, file)), *q;
+        ASSERT(d != NULL);
+        for (q = d + 1; ; q ++) {
+            if (*q && *q != '/')
+                continue;
+            e = *q;
+            *q = 0;
+            if (mkdir(d, 0755) && errno != EEXIST)
+                error("%s: mkdir failed: %s", d,
+                    strerror(errno));
+            if (!(*q = e))
+                break;
+        }
+        free(d);
+    }
+    b = NULL;
+
+    if (asprintf(&t, "%s.%d", file, (int) getpid()) < 0)
+        error("asprintf failed");
+    if (!(g = fopen(t, "w")))
+        error("%s: fopen failed: %s", t,
+            strerror(errno));
+
+    // stev: retain the entries of other CPUs; those
+    // of this CPU made by other builds are stale
+    if ((f = fopen(file, "r"))) {
+        while ((r = getline(&b, &n, f)) > 0) {
+            if (autotune_cache_match(b, cpu, NULL))
+                continue;
+            fputs(b, g);
+            if (b[r - 1] != '\n')
+                fputc('\n', g);
+        }
+        fclose(f);
+    }
+    else
+    if ((e = errno) != ENOENT)
+        error("%s: fopen failed: %s", file,
+            strerror(e));
+
+    fprintf(g, "%s\t%s\t%s\n", cpu, autotune_build, name);
+
+    if (fclose(g))
+        error("%s: fclose failed: %s", t,
+            strerror(errno));
+    if (rename(t, file))
+        error("%s: rename failed: %s", file,
+            strerror(errno));
+
+    free(b);
+    free(t);
+}
+
+static bool autotune(
+    const struct options_t* opts)
+{
+    const char* w = NULL, *p, *q;
+    struct html_cref_refs_t refs;
+    struct input_sponge_t buf;
+    double b = 0, t;
+    char c[256];
+
+    if (opts->input_file != NULL) {
+        input_sponge_init(&buf, opts->input_file,
+            opts->sponge_max);
+        if (buf.error_info.type !=
+                file_buf_error_none)
+            input_sponge_error(&buf);
+        html_cref_refs_init(&refs,
+            PTR_CHAR_CAST(buf.ptr), buf.size);
+    }
+    else
+        html_cref_refs_init(&refs, autotune_sample,
+            sizeof(autotune_sample) - 1);
+
+    if (refs.size == 0)
+        error("%s: no named char references found",
+            opts->input_file);
+
+    for (p = CREF_PARSERS; *p; p = q) {
+        struct module_lib_funcs_t l;
+        struct module_lib_t lib;
+        char* n;
+
+        for (; *p == ' '; p ++);
+        for (q = p; *q && *q != ' '; q ++);
+        if (q == p)
+            continue;
+
+        n = strndup(p, PTR_DIFF(q, p));
+        ASSERT(n != NULL);
+
+        if (module_lib_try_load(&lib, n, &l)) {
+            t = autotune_time(l.parse, &refs);
+            fprintf(stdout, "%-8s %8.2f ns/ref\n", n, t);
+
+            if (w == NULL || b > t) {
+                free(CONST_CAST(w, char));
+                w = strdup(n);
+                b = t;
+            }
+            module_lib_done(&lib);
+        }
+        free(n);
+    }
+
+    html_cref_refs_done(&refs);
+    if (opts->input_file != NULL)
+        input_sponge_done(&buf);
+
+    if (w == NULL)
+        error("no parser module could be loaded");
+
+    if (!cpu_info_model_name(c, sizeof c))
+        strcpy(c, "unknown");
+
+    fprintf(stdout, "%s: fastest parser on '%s': %s\n",
+        program, c, w);
+
+    if (opts->autotune_cache != NULL)
+        autotune_cache_store(
+            opts->autotune_cache, c, w);
+
+    free(CONST_CAST(w, char));
+
+    return true;
 }
 
 #endif // BUILTIN
 
 #ifdef TIMINGS
-struct clocks_t clocks;
+HTML_CREF_TLS struct clocks_t clocks;
+
+HTML_CREF_TLS struct clocks_sampler_t clocks_sampler = {
+    .period = 1
+};
+
+#ifdef CLOCK_CYCLES
+HTML_CREF_TLS struct clocks_hist_t clocks_hist;
+#endif
+
+#ifdef CLOCK_PERF
+struct clocks_perf_t clocks_perf = {
+    .fd = -1
+};
+#endif
+
+static struct clocks_calib_t timings_calib[2];
+
+// stev: the worker threads of '-j|--threads' time
+// their calls into their own thread-local 'clocks',
+// 'clocks_sampler' and 'clocks_hist'; each thread
+// registers itself upon start, getting a record in
+// 'timings_threads', and, upon end, copies its own
+// accumulators into that record; the main thread,
+// after having joined all workers, merges in their
+// records into its own accumulators
+
+struct timings_thread_t
+{
+    struct clocks_t         clocks;
+    struct clocks_sampler_t sampler;
+#ifdef CLOCK_CYCLES
+    struct clocks_hist_t    hist;
+#endif
+    double                  errors[clock_n_types];
+};
+
+static struct
+{
+    pthread_mutex_t         lock;
+    const struct options_t* opts;
+    clock_types_t           types;
+    size_t                  n_threads;
+    struct timings_thread_t threads[options_threads_max];
+} timings_threads = {
+    .lock = PTHREAD_MUTEX_INITIALIZER
+};
+
+static void timings_thread_init(
+    const struct options_t* opts,
+    clock_types_t types)
+{
+    clocks_init(&clocks, types);
+    clocks_sampler_init(&clocks_sampler,
+        opts->sample, opts->random_sample);
+#ifdef CLOCK_CYCLES
+    if (opts->histogram)
+        clocks_hist_init(&clocks_hist,
+            opts->histogram ==
+            options_histogram_length
+            ? (size_t) html_cref_max_name_len + 2
+            : 1);
+#endif
+}
 
 static void timings_init(
     const struct options_t* opts)
 {
-    clocks_init(&clocks, opts->timings);
+    clock_types_t t = opts->timings;
+
+#ifdef CLOCK_PERF
+    if (t & clock_types_perf)
+        t = clocks_perf_init(t);
+#endif
+    if (opts->calibrate)
+        clocks_calibrate(&timings_calib[0],
+            t, t & opts->calibrate);
+    timings_thread_init(opts, t);
+
+    timings_threads.opts = opts;
+    timings_threads.types = t;
+}
+
+static size_t timings_thread_start(void)
+{
+    size_t i;
+
+    if (timings_threads.opts == NULL)
+        return 0;
+
+    pthread_mutex_lock(&timings_threads.lock);
+    i = timings_threads.n_threads ++;
+    pthread_mutex_unlock(&timings_threads.lock);
+
+    ASSERT(i < options_threads_max);
+
+    timings_thread_init(
+        timings_threads.opts,
+        timings_threads.types);
+
+    return i;
+}
+
+// stev: no locking is needed here: each record
+// is written by its own thread only, and is read
+// by the main thread only after having joined it
+
+static void timings_thread_done(size_t index)
+{
+    struct timings_thread_t* t;
+
+    if (timings_threads.opts == NULL)
+        return;
+
+    ASSERT(index < timings_threads.n_threads);
+    t = &timings_threads.threads[index];
+
+    t->clocks = clocks;
+    t->sampler = clocks_sampler;
+#ifdef CLOCK_CYCLES
+    t->hist = clocks_hist;
+#endif
+}
+
+static double timings_errors[clock_n_types];
+
+static void timings_adjust_clocks(
+    struct clocks_t* timings,
+    const struct clocks_sampler_t* sampler,
+    const struct clocks_t* overhead,
+    clock_types_t calibrated,
+    double* errors)
+{
+    clocks_sampler_errors(
+        sampler, timings, errors);
+    // stev: only the calls sampled were timed,
+    // thus only these have incurred the overhead
+    clocks_adjust(
+        timings, overhead, calibrated,
+        sampler->n_samples);
+    clocks_sampler_scale(
+        sampler, timings);
 }
 
 static void timings_adjust(
     const struct options_t* opts)
 {
     struct clocks_t o;
+    size_t i;
 
-#ifdef CLOCK_CYCLES
     STATIC(
-        ARRAY_SIZE(opts->overhead) == 4);
-#else
-    STATIC(
-        ARRAY_SIZE(opts->overhead) == 3);
-#endif
+        ARRAY_SIZE(opts->overhead) ==
+        OVERHEADS_N_VALS);
     STATIC(
         SIZE_MAX <= CLOCKS_TIME_MAX);
 
@@ -1462,19 +3699,241 @@ static void timings_adjust(
 #ifdef CLOCK_CYCLES
     o.cycles = opts->overhead[3];
 #endif
+#ifdef CLOCK_PERF
+    o.instructions = opts->overhead[4];
+    o.branch_misses = opts->overhead[5];
+    o.icache_misses = opts->overhead[6];
+    o.cache_misses = opts->overhead[7];
+#endif
 
-    clocks_adjust(
-        &clocks, &o, process_cref_count);
+    if (opts->calibrate) {
+        clocks_calibrate(&timings_calib[1],
+            timings_calib[0].median.types,
+            timings_calib[0].types);
+        clocks_calib_check(
+            &timings_calib[0],
+            &timings_calib[1]);
+        clocks_calib_apply(
+            &timings_calib[0], &o);
+    }
+
+    if (timings_threads.n_threads == 0) {
+        timings_adjust_clocks(
+            &clocks, &clocks_sampler,
+            &o, timings_calib[0].types,
+            timings_errors);
+        return;
+    }
+
+    // stev: the accumulators of the main thread
+    // are empty: it didn't parse anything itself
+    for (i = 0; i < timings_threads.n_threads; i ++) {
+        struct timings_thread_t* t =
+            &timings_threads.threads[i];
+
+        timings_adjust_clocks(
+            &t->clocks, &t->sampler,
+            &o, timings_calib[0].types,
+            t->errors);
+        clocks_merge(
+            &clocks, timings_errors,
+            &t->clocks, t->errors);
+#ifdef CLOCK_CYCLES
+        if (opts->histogram) {
+            clocks_hist_merge(
+                &clocks_hist, &t->hist);
+            clocks_hist_done(&t->hist);
+        }
+#endif
+    }
+}
+
+#ifdef CLOCK_CYCLES
+// stev: the histogram rows are printed out as lines
+// 'cycles-histogram: ...' or, by case, as lines
+// 'cycles-histogram-LEN: ...', where LEN is the
+// length of the names counted by the row; the last
+// row, of names longer than 'html_cref_max_name_len',
+// is printed out as 'cycles-histogram-LEN+: ...'
+
+static void timings_print_hist(
+    const struct options_t* opts)
+{
+    const size_t n = clocks_hist.n_rows;
+    clock_cycles_t o;
+    char b[48];
+    size_t i;
+
+    o = opts->calibrate & CLOCK_TYPE(cycles)
+        ? timings_calib[0].median.cycles
+        : opts->overhead[clock_type_cycles];
+
+    for (i = 0; i < n; i ++) {
+        if (n == 1)
+            snprintf(b, sizeof b, "cycles-histogram");
+        else
+            snprintf(b, sizeof b, "cycles-histogram-%zu%s",
+                i, i + 1 < n ? "" : "+");
+        clocks_hist_print(&clocks_hist, i, b,
+            o, stderr);
+    }
 }
+#endif
+
+// stev: with more than one worker thread, the
+// timings of each of them are printed out first,
+// as lines 'CLOCK-timings-NUM: ...', where NUM is
+// the index of the thread in registration order,
+// starting from 1; the lines 'CLOCK-timings: ...'
+// are the sums of those; note that the process
+// clock counts the CPU time of all threads of the
+// process, thus it isn't of much use per thread
 
-static void timings_print(void)
+static void timings_print(
+    const struct options_t* opts)
 {
+    char b[32];
+    size_t i;
+
+    for (i = 0; i < timings_threads.n_threads &&
+            timings_threads.n_threads > 1; i ++) {
+        snprintf(b, sizeof b, "timings-%zu", i + 1);
+        clocks_print(
+            &timings_threads.threads[i].clocks,
+            opts->sample > 1
+            ? timings_threads.threads[i].errors
+            : NULL,
+            b, 15, stderr);
+    }
     clocks_print(
-        &clocks, "timings", 15,
-        stderr);
+        &clocks, opts->sample > 1
+        ? timings_errors : NULL,
+        "timings", 15, stderr);
+    if (opts->calibrate)
+        clocks_calib_print(
+            &timings_calib[0],
+            &timings_calib[1],
+            "overhead", 15, stderr);
+#ifdef CLOCK_CYCLES
+    if (opts->histogram) {
+        timings_print_hist(opts);
+        clocks_hist_done(&clocks_hist);
+    }
+#endif
 }
 #endif // TIMINGS
 
+static int process_stats_compare(
+    const void* a, const void* b)
+{
+    size_t i = *(const size_t*) a;
+    size_t j = *(const size_t*) b;
+    size_t x = process_stats.counts[i];
+    size_t y = process_stats.counts[j];
+
+    if (x != y)
+        return (x < y) - (x > y);
+
+    return strcmp(
+        process_stats.names[i],
+        process_stats.names[j]);
+}
+
+// stev: the names are printed out by decreasing
+// counts, then by name, just as the lines of the
+// file 'html-cref-freqs.txt' are; when the format
+// is 'text', the other figures are printed out as
+// comment lines, such that the output as a whole
+// is usable as input of the corpus generator
+
+static void process_stats_print(
+    enum options_stats_t format,
+    const struct timespec* start,
+    const struct timespec* end)
+{
+    const struct process_stats_t* s = &process_stats;
+    const bool j = format == options_stats_json;
+    size_t *a, i, n = 0, r;
+    struct rusage u;
+    double t, d, m;
+
+    a = malloc(process_table_size * sizeof(*a));
+    ASSERT(a != NULL);
+
+    for (i = 0; i < process_table_size; i ++)
+        if (s->counts[i])
+            a[n ++] = i;
+    qsort(a, n, sizeof(*a), process_stats_compare);
+
+    if (getrusage(RUSAGE_SELF, &u))
+        error("getrusage failed: %s", strerror(errno));
+
+    t = (end->tv_sec - start->tv_sec) +
+        (end->tv_nsec - start->tv_nsec) / 1e9;
+    r = s->named + s->decimal + s->hex + s->invalid;
+    d = s->bytes_in ? 1000.0 * r / s->bytes_in : 0;
+    m = t > 0 ? s->bytes_in / t / 1e6 : 0;
+
+    fprintf(stderr, j
+        ? "{\"bytes_in\":%zu"
+          ",\"bytes_out\":%zu"
+          ",\"named\":%zu"
+          ",\"legacy\":%zu"
+          ",\"decimal\":%zu"
+          ",\"hex\":%zu"
+          ",\"invalid\":%zu"
+          ",\"density\":%.2f"
+          ",\"wall_time\":%.6f"
+          ",\"throughput\":%.2f"
+          ",\"peak_rss\":%ld"
+        : "# bytes-in:   %zu\n"
+          "# bytes-out:  %zu\n"
+          "# named:      %zu\n"
+          "# legacy:     %zu\n"
+          "# decimal:    %zu\n"
+          "# hex:        %zu\n"
+          "# invalid:    %zu\n"
+          "# density:    %.2f refs per 1000 bytes\n"
+          "# wall-time:  %.6f s\n"
+          "# throughput: %.2f MB/s\n"
+          "# peak-rss:   %ld KB\n",
+        s->bytes_in,
+        s->bytes_out,
+        s->named,
+        s->legacy,
+        s->decimal,
+        s->hex,
+        s->invalid,
+        d, t, m,
+        u.ru_maxrss);
+
+    // stev: the diagnostics are collected
+    // by option '--diagnostics' only
+    if (process_diags.entries != NULL)
+        fprintf(stderr, j
+            ? ",\"distinct\":%zu"
+              ",\"suppressed\":%zu"
+            : "# distinct:   %zu\n"
+              "# suppressed: %zu\n",
+            process_diags.size,
+            process_diags.suppressed);
+
+    if (j)
+        fputs(",\"names\":{", stderr);
+
+    for (i = 0; i < n; i ++)
+        fprintf(stderr, j
+            ? "%s\"%s\":%zu" : "%s%s %zu\n",
+            j && i ? "," : "",
+            s->names[a[i]],
+            s->counts[a[i]]);
+
+    if (j)
+        fputs("}}\n", stderr);
+
+    free(a);
+}
+
 int main(int argc, char* argv[])
 {
 #undef  CASE
@@ -1483,7 +3942,10 @@ int main(int argc, char* argv[])
      process_ ## n ## _cref
     static const process_buf_func_t funcs[] = {
         CASE(subst),
-        CASE(print)
+        CASE(print),
+        CASE(validate),
+        CASE(encode),
+        CASE(escape)
     };
 
     const struct options_t* opts =
@@ -1495,16 +3957,40 @@ int main(int argc, char* argv[])
     process_buf_func_t buf_func;
 #ifndef BUILTIN
     struct module_lib_t lib;
+    const char* n;
+#else
+    const char* e;
 #endif
+    struct timespec t[2];
     struct input_t input;
     bool r;
 
+#ifndef BUILTIN
+    if (opts->action == options_autotune_action)
+        return !autotune(opts);
+#endif
+
     buf_func = ARRAY_NULL_ELEM(funcs, opts->action);
     ASSERT(buf_func != NULL);
 
+    // stev: have the SIMD variant selected -- and
+    // its warnings printed out, if any -- before
+    // starting the worker threads of '-j|--threads'
+    html_cref_simd_variant();
+
 #ifndef BUILTIN
-    cref_func = module_lib_load(&lib, opts);
+    cref_func = module_lib_load(&lib, opts, &n);
     ASSERT(cref_func != NULL);
+
+    process_table_init(
+        module_lib_get_table(&lib, n));
+#else
+    if (PROCESS_GET_ERROR(BUILTIN) != NULL &&
+        (e = PROCESS_GET_ERROR(BUILTIN)()))
+        error("%s", e);
+
+    process_table_init(
+        PROCESS_GET_TABLE(BUILTIN));
 #endif
 
     if (opts->semicolons)
@@ -1519,6 +4005,22 @@ int main(int argc, char* argv[])
         timings_init(opts);
 #endif
 
+    if (opts->action == options_print_cref_action)
+        process_print_init(opts->print_format);
+    if (opts->action == options_encode_cref_action)
+        html_cref_encode_init();
+
+    if (opts->diagnostics) {
+        flags |= process_cref_collect_diags;
+        process_diags_init(opts->diagnostics_max);
+    }
+
+    if (opts->stats) {
+        flags |= process_cref_collect_stats;
+        process_stats_init();
+        clock_gettime(CLOCK_MONOTONIC, &t[0]);
+    }
+
     input_init(&input, opts);
     r = input_process(&input,
             buf_func,
@@ -1528,10 +4030,38 @@ int main(int argc, char* argv[])
             flags);
     input_done(&input);
 
+    if (opts->action == options_print_cref_action)
+        process_print_done();
+    if (opts->action == options_encode_cref_action)
+        html_cref_encode_done();
+
+    if (opts->diagnostics)
+        process_diags_print(opts->diagnostics,
+            opts->warnings < 2 ? stderr : stdout);
+
+    if (opts->action == options_validate_cref_action) {
+        if (opts->warnings < 2)
+            process_valid_print();
+        r = r && !process_valid.invalid;
+    }
+
+    if (opts->stats) {
+        clock_gettime(CLOCK_MONOTONIC, &t[1]);
+        process_stats_print(
+            opts->stats, &t[0], &t[1]);
+        process_stats_done();
+    }
+
+    if (opts->diagnostics)
+        process_diags_done();
+
 #ifdef TIMINGS
     if (opts->timings) {
         timings_adjust(opts);
-        timings_print();
+        timings_print(opts);
+#ifdef CLOCK_PERF
+        clocks_perf_done();
+#endif
     }
 #endif
 
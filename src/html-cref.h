@@ -18,7 +18,7 @@
 #ifndef __HTML_CREF_H
 #define __HTML_CREF_H
 
-#ifdef HTML_CREF_MODULE
+#if defined(HTML_CREF_MODULE) || defined(BUILTIN)
 #include <stdbool.h>
 #endif
 
@@ -47,30 +47,90 @@
 
 #include "clocks.h"
 
-extern MODULE_API struct clocks_t clocks;
-
-#define HTML_CREF_FUNC_DEF(t, n) \
-int html_cref_ ## t ##           \
-             _ ## n ## 2(        \
-    const char* p)               \
-{                                \
-    struct clocks_t c;           \
-    struct ntime_t s;            \
-    int r;                       \
-                                 \
-    ntime_init(&s,               \
-        clocks.types);           \
-    r = html_cref_ ## t ##       \
-                 _ ## n(p);      \
-    c = ntime_clocks(&s);        \
-    clocks_add(&clocks, &c);     \
-                                 \
-    return r;                    \
+// stev: the timing accumulators are thread-local, for
+// each thread parsing char references to time its own
+// calls without any synchronization; being defined by
+// the main program, the accumulators reside in the
+// static TLS block, thus the parser modules too are
+// able to use the 'initial-exec' model for accessing
+// them, i.e. without calling '__tls_get_addr'
+
+#define HTML_CREF_TLS \
+    __thread __attribute__((tls_model("initial-exec")))
+
+extern MODULE_API HTML_CREF_TLS struct clocks_t clocks;
+extern MODULE_API HTML_CREF_TLS struct clocks_sampler_t clocks_sampler;
+
+#ifdef CLOCK_CYCLES
+extern MODULE_API HTML_CREF_TLS struct clocks_hist_t clocks_hist;
+
+// stev: when 'clocks_hist' has more than one row,
+// the rows are indexed by the lengths of the names
+// parsed -- i.e. the lengths of the runs of ASCII
+// alphanumerics they start with --, the last row
+// counting all names of larger length
+
+static inline size_t html_cref_hist_row(
+    const char* p)
+{
+    const size_t m = clocks_hist.n_rows - 1;
+    size_t n = 0;
+    char c;
+
+    while (n < m &&
+        (c = p[n],
+         (c >= '0' && c <= '9') ||
+         (c >= 'A' && c <= 'Z') ||
+         (c >= 'a' && c <= 'z')))
+        n ++;
+
+    return n;
+}
+
+#define HTML_CREF_HIST_ADD(p, c)              \
+    do {                                      \
+        if (clocks_hist.n_rows)               \
+            clocks_hist_add(&clocks_hist,     \
+                html_cref_hist_row(p),        \
+                (c).cycles);                  \
+    } while (0)
+#else
+#define HTML_CREF_HIST_ADD(p, c)
+#endif
+
+#define HTML_CREF_FUNC_DEF(t, n)      \
+int html_cref_ ## t ##                \
+             _ ## n ## 2(             \
+    const char* p)                    \
+{                                     \
+    struct clocks_t c;                \
+    struct ntime_t s;                 \
+    int r;                            \
+                                      \
+    if (!clocks_sampler_next(         \
+            &clocks_sampler))         \
+        return html_cref_ ## t ##     \
+                    _ ## n(p);        \
+                                      \
+    ntime_init(&s,                    \
+        clocks.types);                \
+    r = html_cref_ ## t ##            \
+                 _ ## n(p);           \
+    c = ntime_clocks(&s);             \
+    clocks_add_sample(&clocks,        \
+        &clocks_sampler, &c);         \
+    HTML_CREF_HIST_ADD(p, c);         \
+                                      \
+    return r;                         \
 }
 
 #endif // TIMINGS
 
-#ifdef HTML_CREF_MODULE
+// stev: 'prefix' is needed by the parser modules, be
+// they built as shared libraries or built into the main
+// program by 'make BUILTIN=...'
+
+#if defined(HTML_CREF_MODULE) || defined(BUILTIN)
 
 static inline bool prefix(
     const char* p, const char* q)
@@ -80,7 +140,7 @@ static inline bool prefix(
     return *p == 0;
 }
 
-#endif // HTML_CREF_MODULE
+#endif // HTML_CREF_MODULE || BUILTIN
 
 enum {
     // $ html-cref-gen --cref-names-min-max
@@ -341,8 +341,9 @@ html-cref-gen()
     local self="html-cref-gen"
     local json="html-mathml.json"
     local over="html-cref-overrides.txt"
-    local gent="@(sub|map)-table"
-    local genx="@($gent|func|re2c-def|cref-overrides)"
+    local freq="html-cref-freqs.txt"
+    local gent="@(sub|map|names)-table"
+    local genx="@($gent|func|re2c-def|vcmp-table|ftrie-func|cref-overrides)"
     local geno="gen-$genx"
 
     local x="eval"
@@ -350,14 +351,19 @@ html-cref-gen()
                     #   N: print out HTML char refs names table (--cref-names)|
                     #   O: print out HTML char refs names with optional semicolon (--cref-names-semicolon)|
                     #   M: compute HTML char cref names' min and max length (--cref-names-min-max)|
+                    #   H: compute the frequency histogram of the HTML char ref names found in the text read from stdin (--cref-histogram)|
                     #   S: print out HTML char refs substitution table (default) (--cref-subst)|
                     #   G: generate SUB table (--gen-sub-table)|
                     #   G: generate MAP table (--gen-map-table)|
+                    #   G: generate names table (--gen-names-table)|
                     #   G: generate RE2C def text (--gen-re2c-def)|
                     #   G: generate trie lookup/parse function (--gen-func)|
+                    #   G: generate vcmp bucket and candidate tables (--gen-vcmp-table)|
+                    #   G: generate frequency-ordered trie parse function (--gen-ftrie-func)|
                     #   G: generate char ref overrides table (--gen-cref-overrides)
     local a=""      # when action is `-G|--gen-func' do not adjust the generated trie function (--no-adjust-func)
     local e=""      # when action is `-G|--gen-func' pass `-Pe' to 'gen-func' instead of `-Pf' (--expanded-path)
+    local f="+"     # input HTML char ref names frequency histogram file when action is `-G|--gen-ftrie-func' (default: `html-cref-freqs.txt') (--cref-freqs=FILE)
     local h=""      # when action is `-G|--gen-*' generate a heading comment text (--heading[-comment])
     local i=""      # when action is `-G|--gen-func' generate code that uses indexed access into the input string instead of pointer arithmetic (--indexed-access)
     local j="+"     # input HTML mathml JSON file (default: `html-mathml.json') (--mathml-json=FILE)
@@ -373,7 +379,7 @@ html-cref-gen()
     local opt
     local OPT
     local OPTN
-    local opts=":adeG:hij:lmMnNo:OsSwx-:"
+    local opts=":adef:G:hHij:lmMnNo:OsSwx-:"
     local OPTARG
     local OPTERR=0
     local OPTIND=1
@@ -388,10 +394,14 @@ html-cref-gen()
                 opt='a' ;;
             expanded-path)
                 opt='e' ;;
+            cref-freqs)
+                opt='f' ;;
             $geno)
                 opt='G' ;;
             heading|heading-comment)
                 opt='h' ;;
+            cref-histogram)
+                opt='H' ;;
             indexed-access)
                 opt='i' ;;
             mathml-json)
@@ -432,13 +442,13 @@ html-cref-gen()
                 ;;
             x)	x="eval"
                 ;;
-            [NMOS])
+            [HNMOS])
                 optactarg
                 ;;
             [aehilmnsw])
                 optopt
                 ;;
-            [jo])
+            [fjo])
                 optarg
                 ;;
             G)	[[ -n "$OPT" || "$OPTARG" == $genx ]] || {
@@ -468,6 +478,18 @@ html-cref-gen()
     done
     shift $((OPTIND - 1))
 
+    [ "$act$arg" == 'Gftrie-func' ] && {
+        [ "$f" == '+' ] && f="$freq"
+        if [ -z "$f" ]; then
+            error "char ref names frequency histogram file name is null"
+            return 1
+        elif [ ! -f "$f" ]; then
+            error "char ref names frequency histogram file '$f' not found"
+            return 1
+        fi
+        quote f
+    }
+
     if [ "$act$arg" != 'Gcref-overrides' ]; then
         [ "$j" == '+' ] && j="$json"
         if [ -z "$j" ]; then
@@ -616,6 +638,36 @@ awk -F '\n' -f gen-func-adjust.awk"
         c2+=' -v map_only=1'
         [ -z "$a" ] &&
         c2+=" -v map=$o3"
+    elif [ "$act$arg" == 'Gvcmp-table' ]; then
+        local j2
+        [ "$j" != "$json" ] && j2=" -j $j"
+
+        c2="\
+paste -d' ' \\
+<($self --cref-names$j2) \\
+<($self --gen-map-table$j2|cut -d' ' -f2)|
+awk -f gen-vcmp-table.awk"
+    elif [ "$act$arg" == 'Gftrie-func' ]; then
+        local j2
+        [ "$j" != "$json" ] && j2=" -j $j"
+
+        c2="\
+paste -d' ' \\
+<($self --cref-names$j2) \\
+<($self --gen-map-table$j2|cut -d' ' -f2)|
+awk -f gen-ftrie-func.awk -v freqs=$f"
+    elif [ "$act" == 'H' ]; then
+        local j2
+        [ "$j" != "$json" ] && j2=" -j $j"
+
+        # stev: the names of the legacy char refs that are
+        # not terminated by semicolon are not counted in
+        c2="\
+join -t' ' \\
+<($self --cref-names$j2|sort) \\
+<(grep -Eo '&[0-9A-Za-z]+;'|sed -r 's/^&//;s/;$//'|sort|uniq -c|
+awk '{ print \$2, \$1 }'|sort -k1,1)|
+sort -k2,2nr -k1,1"
     elif [ "$act$arg" == 'Gcref-overrides' ]; then
         c2="\
 awk '{ printf(\"\t[0x%02x] = 0x%04x,\n\", strtonum(\$1) - 0x80, strtonum(\$2)) }' \\
@@ -644,6 +696,8 @@ $o"
         h+=' --static-func'
         [ -z "$a" -a -n "$w" ] &&
         h+=' --wide-code'
+        [ "$arg" == 'ftrie-func' -a "$f" != "$freq" ] &&
+        h+=" --cref-freqs=$f"
         [ -n "$o2" ] &&
         h+=" -- $o2"
 
@@ -665,15 +719,349 @@ echo
     $x "$c2"
 }
 
+html-cref-corpus()
+{
+    local self="html-cref-corpus"
+    local json="html-mathml.json"
+    local freq="html-cref-freqs.txt"
+    local prel='web dense numeric uniform alnum near-miss digits'
+    local preo="@(${prel// /|})"
+    local defp='web'
+
+    local x="eval"
+    local p="+"     # preset of the corpus parameters below: 'web', 'dense', 'numeric' or 'uniform' (default: 'web'); the options given explicitly override the respective preset parameters; 'web' is modeled after common web pages, 'dense' has a char ref about each 10 chars, 'numeric' is made mostly of numeric char refs and 'uniform' is made of named char refs only, uniformly distributed and not separated by any text, just as the test file of Html-Cref's README; the adversarial presets 'alnum', 'near-miss' and 'digits' produce pathological inputs instead: long alphanumeric runs following '&', prefixes of the longest names that are not valid names, respectively long runs of digits following '&#' or '&#x' -- these ignore all the options below except '-n|--refs' and '-s|--seed' (--preset=NAME)
+    local n="+"     # number of char refs to generate (default: 100000, or 10000 for the adversarial presets) (--refs=NUM)
+    local z="+"     # exponent of the Zipf distribution of the named char refs, given as percentage: e.g. 110 stands for 1.1; 0 means uniform distribution (--zipf=NUM)
+    local r="+"     # density of the char refs: number of char refs per 1000 chars of output (--density=NUM)
+    local m="+"     # percentage of numeric char refs (--numeric=NUM)
+    local h="+"     # percentage of hexadecimal numeric char refs among the numeric ones (--hex=NUM)
+    local i="+"     # percentage of invalid named char refs (--invalid=NUM)
+    local l="+"     # percentage of legacy named char refs not terminated by semicolon (--legacy=NUM)
+    local u="+"     # percentage of URLs containing bare ampersands, taking place of char refs (--urls=NUM)
+    local s="+"     # seed of the pseudo-random number generator (default: 1) (--seed=NUM)
+    local f="+"     # input HTML char ref names frequency histogram file (default: `html-cref-freqs.txt') (--cref-freqs=FILE)
+    local j="+"     # input HTML mathml JSON file (default: `html-mathml.json') (--mathml-json=FILE)
+
+    local opt
+    local OPT
+    local OPTN
+    local opts=":df:h:i:j:l:m:n:p:r:s:u:xz:-:"
+    local OPTARG
+    local OPTERR=0
+    local OPTIND=1
+    while getopts "$opts" opt; do
+        # discriminate long options
+        optlong
+
+        # translate long options to short ones
+        test -n "$OPT" &&
+        case "$OPT" in
+            cref-freqs)
+                opt='f' ;;
+            hex)
+                opt='h' ;;
+            invalid)
+                opt='i' ;;
+            mathml-json)
+                opt='j' ;;
+            legacy)
+                opt='l' ;;
+            numeric)
+                opt='m' ;;
+            refs)
+                opt='n' ;;
+            preset)
+                opt='p' ;;
+            density)
+                opt='r' ;;
+            seed)
+                opt='s' ;;
+            urls)
+                opt='u' ;;
+            zipf)
+                opt='z' ;;
+            *)	error --long -o
+                return 1
+                ;;
+        esac
+
+        # check long option argument
+        optlongchkarg ||
+        return 1
+
+        # handle short options
+        case "$opt" in
+            d)	x="echo"
+                ;;
+            x)	x="eval"
+                ;;
+            [fj])
+                optarg
+                ;;
+            [hilmnrsuz])
+                [[ "$OPTARG" == +([0-9]) ]] || {
+                    error --long -i
+                    return 1
+                }
+                optarg
+                ;;
+            p)	[[ "$OPTARG" == $preo ]] || {
+                    error --long -i
+                    return 1
+                }
+                optarg
+                ;;
+            *)	error --long -g
+                return 1
+                ;;
+        esac
+    done
+    shift $((OPTIND - 1))
+
+    [ "$p" == '+' ] && p="$defp"
+
+    # stev: the parameters of the presets are, in order:
+    # zipf, density, numeric, hex, invalid, legacy, urls
+    local a
+    local v
+    case "$p" in
+        web)
+            a=(110 8 5 30 1 2 10) ;;
+        dense)
+            a=(100 100 10 50 2 2 2) ;;
+        numeric)
+            a=(100 50 90 50 1 0 0) ;;
+        uniform)
+            a=(0 1000 0 0 0 0 0) ;;
+        alnum|near-miss|digits)
+            a=(0 1000 0 0 0 0 0)
+            v="$p"
+            ;;
+        *)  error "internal: unexpected preset '$p'"
+            return 1
+            ;;
+    esac
+    [ "$z" == '+' ] && z="${a[0]}"
+    [ "$r" == '+' ] && r="${a[1]}"
+    [ "$m" == '+' ] && m="${a[2]}"
+    [ "$h" == '+' ] && h="${a[3]}"
+    [ "$i" == '+' ] && i="${a[4]}"
+    [ "$l" == '+' ] && l="${a[5]}"
+    [ "$u" == '+' ] && u="${a[6]}"
+    [ "$n" == '+' -a -z "$v" ] && n='100000'
+    [ "$n" == '+' ] && n='10000'
+    [ "$s" == '+' ] && s='1'
+
+    [ "$r" -eq 0 ] && {
+        error "density of char refs cannot be 0"
+        return 1
+    }
+    [ "$((m + i + u))" -le 100 ] || {
+        error "sum of percentages of numeric, invalid and URLs exceeds 100"
+        return 1
+    }
+
+    [ "$f" == '+' ] && f="$freq"
+    if [ -z "$f" ]; then
+        error "char ref names frequency histogram file name is null"
+        return 1
+    elif [ ! -f "$f" ]; then
+        error "char ref names frequency histogram file '$f' not found"
+        return 1
+    fi
+    quote f
+
+    [ "$j" == '+' ] && j="$json"
+    if [ -z "$j" ]; then
+        error "mathml JSON file name is null"
+        return 1
+    elif [ ! -f "$j" ]; then
+        error "mathml JSON file '$j' not found"
+        return 1
+    fi
+    quote j
+
+    local j2
+    [ "$j" != "$json" ] && j2=" -j $j"
+
+    # stev: need not quote the numbers below
+    local c="\
+awk -f gen-corpus.awk \\
+-v freqs=$f \\
+-v legacies=<(html-cref-gen --cref-names-semicolon$j2) \\
+-v seed=$s \\
+-v refs=$n \\
+-v zipf=$z \\
+-v density=$r \\
+-v numeric=$m \\
+-v hex=$h \\
+-v invalid=$i \\
+-v legacy=$l \\
+-v urls=$u \\
+-v adversary=$v \\
+<(html-cref-gen --cref-names$j2)"
+
+    $x "$c"
+}
+
+html-cref-worst-case()
+{
+    local self="html-cref-worst-case"
+    local advl='alnum near-miss digits'
+    local advo="${advl// /|}"
+    local advs="@($advo)*(,@($advo))"
+
+    local x="eval"
+    local a="+"     # comma-separated list of the adversarial corpora to run the benchmark on, of 'alnum', 'near-miss' and 'digits' (default: '+', i.e. all); the corpora are generated by 'html-cref-corpus' with the homonymous presets, unless already existing in the output directory (--adversaries=LIST)
+    local b="+"     # the typical corpus relative to which the throughput ratios are computed (default: '+', i.e. the 'web' preset corpus generated by 'html-cref-corpus' in the output directory) (--baseline=FILE)
+    local f=""      # force regenerating the corpora even if already existing in the output directory (--force)
+    local n="+"     # number of timed passes of 'html-cref-bench' over each corpus (default: 11) (--iterations=NUM)
+    local o="+"     # output directory of the generated corpora (default: `../test') (--output-dir=DIR)
+    local p="+"     # comma-separated list of parser modules to benchmark (default: '+', i.e. all) (--cref-parsers=LIST)
+    local r="+"     # minimum throughput ratio, as percentage of the throughput of the baseline corpus, below which the check fails (default: 10) (--min-ratio=NUM)
+
+    local opt
+    local OPT
+    local OPTN
+    local opts=":a:b:dfn:o:p:r:x-:"
+    local OPTARG
+    local OPTERR=0
+    local OPTIND=1
+    while getopts "$opts" opt; do
+        # discriminate long options
+        optlong
+
+        # translate long options to short ones
+        test -n "$OPT" &&
+        case "$OPT" in
+            adversaries)
+                opt='a' ;;
+            baseline)
+                opt='b' ;;
+            force)
+                opt='f' ;;
+            iterations)
+                opt='n' ;;
+            output-dir)
+                opt='o' ;;
+            cref-parsers)
+                opt='p' ;;
+            min-ratio)
+                opt='r' ;;
+            *)	error --long -o
+                return 1
+                ;;
+        esac
+
+        # check long option argument
+        [[ "$opt" == [f] ]] ||
+        optlongchkarg ||
+        return 1
+
+        # handle short options
+        case "$opt" in
+            d)	x="echo"
+                ;;
+            x)	x="eval"
+                ;;
+            f)	optopt
+                ;;
+            a)	[[ "$OPTARG" == $advs ]] || {
+                    error --long -i
+                    return 1
+                }
+                optarg
+                ;;
+            [bop])
+                optarg
+                ;;
+            [nr])
+                [[ "$OPTARG" == +([0-9]) ]] || {
+                    error --long -i
+                    return 1
+                }
+                optarg
+                ;;
+            *)	error --long -g
+                return 1
+                ;;
+        esac
+    done
+    shift $((OPTIND - 1))
+
+    [ "$a" == '+' ] && a="$advl"
+    a="${a//,/ }"
+    [ "$n" == '+' ] && n='11'
+    [ "$o" == '+' ] && o='../test'
+    [ "$r" == '+' ] && r='10'
+
+    [ "$n" -gt 0 ] || {
+        error "number of iterations cannot be 0"
+        return 1
+    }
+    [ "$r" -gt 0 -a "$r" -le 100 ] || {
+        error "minimum throughput ratio must be in range [1, 100]"
+        return 1
+    }
+
+    [ -d "$o" ] || {
+        error "output directory '$o' not found"
+        return 1
+    }
+
+    local g
+    if [ "$b" == '+' ]; then
+        g="web"
+    elif [ ! -f "$b" ]; then
+        error "baseline corpus file '$b' not found"
+        return 1
+    else
+        quote b
+    fi
+    quote o
+    [ -n "$g" ] && b="$o/corpus-$g.txt"
+
+    [ "$p" == '+' ] && p=''
+
+    # stev: need not quote $k below
+    local c
+    local k
+    for k in $g $a; do
+        c+=${c:+$'\n'}"\
+[ -n \"$f\" -o ! -f $o/corpus-$k.txt ] && {
+    html-cref-corpus -p $k > $o/corpus-$k.txt || {
+        rm -f $o/corpus-$k.txt
+        return 1
+    }
+}"
+    done
+
+    # stev: need not quote $k, $n, $r and $p below
+    c+="
+local s=0
+for k in $a; do
+    echo \"\$k:\"
+    LD_LIBRARY_PATH=. \\
+    ./html-cref-bench -n $n ${p:+-p $p }-b $b -r $r $o/corpus-\$k.txt ||
+    s=1
+done
+return \$s"
+
+    $x "$c"
+}
+
 html-cref-test()
 {
     local self="html-cref-test"
-    local tstl='itrie etrie wtrie ietrie iwtrie bre2c re2c trie'
+    local tstl='itrie etrie wtrie ietrie iwtrie bre2c re2c trie vcmp ftrie mtrie'
     local tsto="${tstl// /|}"
     local tsts="@($tsto)*(,@($tsto))"
     local timc='real process thread'
     local timo="@(${timc// /|})?(-timings)"
     local timx='^[0-9]+(,[0-9]+){2}$'
+    local perc='instructions branch-misses icache-misses cache-misses'
+    local pero="@(${perc// /|})"
+    local perx='^[0-9]+(,[0-9]+){3}$'
     local defP='etrie'
     local defr='100'
     local defs='5'
@@ -683,15 +1071,17 @@ html-cref-test()
     local act="T"   # actions: \
                     #   N: print out the names of known HTML char ref parsers (--names)|
                     #   T: test named HTML char ref parsers; NAMES is a comma-separated list of HTML char ref parser names (default: '+', i.e. all)  (--test-set[=NAMES])|
-                    #   P: process percents relative to the specified HTML char ref parser (default: '+' , i.e. 'etrie') (--percents[=NAME])
+                    #   P: process percents relative to the specified HTML char ref parser (default: '+' , i.e. 'etrie') (--percents[=NAME])|
+                    #   G: process the gain percents of the input timings table relative to the given timings table FILE; the input table is supposed to be obtained from binaries built with PGO=yes, while FILE from binaries built without PGO (--pgo-gain=FILE)
     local f=""      # force overwriting the output timings file if that already exists when action is `-T|--test-set' (--overwrite)
     local g=""      # group by names and sum up timings of input table when action is `-P|--percents' (--group)
-    local i=""      # input test file when action is `-T|--test-set' or input timings file when action is `-P|--percents' (--input=FILE)
+    local i=""      # input test file when action is `-T|--test-set' or input timings file when action is `-P|--percents' or `-G|--pgo-gain' (--input=FILE)
     local o="-"     # output timings file when action is `-T|--test-set'; '-' means to not generate such file at all (default); '+[SUFFIX]' stands for computing a name based on the input test file name: replace FILE's shortest `.' suffix with `.output[.SUFFIX]'; note that regardless of the argument these options have, the timings table is printed out on stdout (--output=FILE)
     local r="+"     # number of times to repeat the 'html-cref' command (default: 100) (--repeat=NUM)
-    local m="+"     # pass `-m|--timings[=NUM,NUM,NUM]' or, by case, `--{real,process,thread}-timings[=NUM]' to 'html-cref'; the default NUM is '+', i.e. query that number from 'clocks' (--timings[=NUM,NUM,NUM]|--real[-timings][=NUM]|--process[-timings][=NUM]|--thread[-timings][=NUM])
-    local c=""      # pass `-c|--clock-cycles[=NUM]' to 'html-cref' (default do not); the default NUM is '+', i.e. query that number from 'clocks' (--[clock-]cycles[=NUM])
-    local s="+"     # sort or not the output table by the named timings column when action is `-P|--percents'; for sorting, NAME can be either 'real', 'process', 'thread' or 'cycles'; for not sorting the table at all, NAME must be '-' (default is sorting by '+', i.e. by 'thread') (--sort=NAME|--no-sort)
+    local m="+"     # pass `-m|--timings[=NUM,NUM,NUM]' or, by case, `--{real,process,thread}-timings[=NUM]' to 'html-cref'; the default NUM is '+', i.e. query that number from 'clocks'; NUM can also be 'auto', i.e. let 'html-cref' calibrate that number by itself (--timings[=NUM,NUM,NUM]|--real[-timings][=NUM]|--process[-timings][=NUM]|--thread[-timings][=NUM])
+    local c=""      # pass `-c|--clock-cycles[=NUM]' to 'html-cref' (default do not); the default NUM is '+', i.e. query that number from 'clocks'; NUM can also be 'auto', i.e. let 'html-cref' calibrate that number by itself (--[clock-]cycles[=NUM])
+    local e=""      # pass `--{instructions,branch-misses,icache-misses,cache-misses}[=NUM]' to 'html-cref' (default do not); `-e|--perf-counters' stands for all four of them; the default NUM is '+', i.e. query that number from 'clocks'; NUM can also be 'auto', i.e. let 'html-cref' calibrate that number by itself (--perf-counters[=NUM,NUM,NUM,NUM]|--instructions[=NUM]|--branch-misses[=NUM]|--icache-misses[=NUM]|--cache-misses[=NUM])
+    local s="+"     # sort or not the output table by the named timings column when action is `-P|--percents'; for sorting, NAME can be either 'real', 'process', 'thread', 'cycles', 'instructions', 'branch-misses', 'icache-misses' or 'cache-misses'; for not sorting the table at all, NAME must be '-' (default is sorting by '+', i.e. by 'thread') (--sort=NAME|--no-sort)
     local w="+"     # width of timings columns' integral part when action is `-T|--test-set' (default: 9) (--width=NUM)
 
     local arg='+'   # action argument
@@ -699,7 +1089,7 @@ html-cref-test()
     local opt
     local OPT
     local OPTN
-    local opts=":c:dfgi:m:No:P:r:s:T:w:x-:"
+    local opts=":c:de:fG:gi:m:No:P:r:s:T:w:x-:"
     local OPTARG
     local OPTERR=0
     local OPTIND=1
@@ -712,12 +1102,16 @@ html-cref-test()
         case "$OPT" in
             cycles|clock-cycles)
                 opt='c' ;;
+            perf-counters|$pero)
+                opt='e' ;;
             overwrite)
                 opt='f' ;;
             input)
                 opt='i' ;;
             group)
                 opt='g' ;;
+            pgo-gain)
+                opt='G' ;;
             timings|$timo)
                 opt='m' ;;
             names)
@@ -740,7 +1134,7 @@ html-cref-test()
         esac
 
         # check long option argument
-        [[ "$opt" == [cmPsT] ]] ||
+        [[ "$opt" == [cemPsT] ]] ||
         optlongchkarg ||
         return 1
 
@@ -750,7 +1144,7 @@ html-cref-test()
                 ;;
             x)	x="eval"
                 ;;
-            [N])
+            [GN])
                 optactarg
                 ;;
             [fg])
@@ -762,7 +1156,7 @@ html-cref-test()
             c)	#!!! echo >&2 "!!! OPT='$OPT' OPTN='$OPTN' OPTARG='$OPTARG'"
                 case "$OPT" in
                     "")
-                        if [[ "$OPTARG" =~ ^\+$|^[0-9]+$ ]]; then
+                        if [[ "$OPTARG" =~ ^\+$|^auto$|^[0-9]+$ ]]; then
                             c="$OPTARG"
                         else
                             error --long -i
@@ -770,7 +1164,7 @@ html-cref-test()
                         fi
                         ;;
                     ?(clocks-)cycles)
-                        [[ -z "$OPTN" || "$OPTARG" =~ ^\+$|^[0-9]+$ ]] || {
+                        [[ -z "$OPTN" || "$OPTARG" =~ ^\+$|^auto$|^[0-9]+$ ]] || {
                             error --long -i
                             return 1
                         }
@@ -781,22 +1175,54 @@ html-cref-test()
                         ;;
                 esac
                 m=(- - -) # stev: reset $m
+                e='' # stev: reset $e
+                ;;
+            e)	#!!! echo >&2 "!!! OPT='$OPT' OPTN='$OPTN' OPTARG='$OPTARG'"
+                case "$OPT" in
+                    ""|perf-counters)
+                        if [[ "$OPTARG" =~ $perx ]]; then
+                            e=(${OPTARG//,/ })
+                        elif [[ "$OPTARG" == @(+|auto) || \
+                                -n "$OPT" && -z "$OPTN" ]]; then
+                            e="${OPTARG:-+}"
+                        else
+                            error --long -i
+                            return 1
+                        fi
+                        ;;
+                    $pero)
+                        [[ -z "$OPTN" || "$OPTARG" =~ ^\+$|^auto$|^[0-9]+$ ]] || {
+                            error --long -i
+                            return 1
+                        }
+                        [ "${#e[@]}" -ne 4 ] && e=(- - - -)
+                        [ "$OPT" == 'instructions' ] && e[0]="${OPTARG:-+}"
+                        [ "$OPT" == 'branch-misses' ] && e[1]="${OPTARG:-+}"
+                        [ "$OPT" == 'icache-misses' ] && e[2]="${OPTARG:-+}"
+                        [ "$OPT" == 'cache-misses' ] && e[3]="${OPTARG:-+}"
+                        ;;
+                    *)	error "internal: unexpected OPT='$OPT'"
+                        return 1
+                        ;;
+                esac
+                m=(- - -) # stev: reset $m
+                c='' # stev: reset $c
                 ;;
             m)	#!!! echo >&2 "!!! OPT='$OPT' OPTN='$OPTN' OPTARG='$OPTARG'"
                 case "$OPT" in
                     ""|timings)
                         if [[ "$OPTARG" == $timx ]]; then
                             m=(${OPTARG//,/ })
-                        elif [[ "$OPTARG" == '+' || \
+                        elif [[ "$OPTARG" == @(+|auto) || \
                                 -n "$OPT" && -z "$OPTN" ]]; then
-                            m='+'
+                            m="${OPTARG:-+}"
                         else
                             error --long -i
                             return 1
                         fi
                         ;;
                     $timo)
-                        [[ -z "$OPTN" || "$OPTARG" =~ ^\+$|^[0-9]+$ ]] || {
+                        [[ -z "$OPTN" || "$OPTARG" =~ ^\+$|^auto$|^[0-9]+$ ]] || {
                             error --long -i
                             return 1
                         }
@@ -810,6 +1236,7 @@ html-cref-test()
                         ;;
                 esac
                 c='' # stev: reset $c
+                e='' # stev: reset $e
                 ;;
             P)	#!!! echo >&2 "!!! OPT='$OPT' OPTN='$OPTN' OPTARG='$OPTARG'"
                 if [ -n "$OPT" -a -z "$OPTN" ]; then
@@ -841,6 +1268,14 @@ html-cref-test()
                             s=5 ;;
                         cycles)
                             s=6 ;;
+                        instructions)
+                            s=7 ;;
+                        branch-misses)
+                            s=8 ;;
+                        icache-misses)
+                            s=9 ;;
+                        cache-misses)
+                            s=10 ;;
                         -)	s=''
                             ;;
                         *)	error --long -i
@@ -889,6 +1324,15 @@ html-cref-test()
             return 1
         fi
     }
+    [ "$act" == 'G' ] && {
+        if [ -z "$i" -o "$i" == '-' ]; then
+            error "input timings file not given"
+            return 1
+        elif [ ! -f "$arg" ]; then
+            error "timings file '$arg' not found"
+            [ "$x" == 'eval' ] && return 1
+        fi
+    }
     [ "$i" == '-' ] && i=''
     [ -n "$i" -a ! -f "$i" ] && {
         error "input file '$i' not found"
@@ -907,7 +1351,7 @@ html-cref-test()
     if [ "$s" == '+' ]; then
         s="$defs"
     elif [ -n "$s" ] && \
-         [ "$s" -lt 3 -o "$s" -gt 6 ]; then
+         [ "$s" -lt 3 -o "$s" -gt 10 ]; then
         error "internal: unexpected s='$s'"
         return 1
     fi
@@ -969,14 +1413,25 @@ html-cref-test()
             return 1
         }
     }
+    [ "$act" == 'T' -a -n "$e" ] && {
+        { ./html-cref --help|grep -Fqe '--instructions'; } || {
+            error "'html-cref' wasn't built with PERF=yes"
+            return 1
+        }
+    }
 
     local y=3
     [ "$act" == 'T' ] && {
         { ./clocks --help|grep -Fqwe 'cycles'; } && (( y++ ))
-        [ -z "$c" -o "$y" -eq 4 ] || {
+        { ./clocks --help|grep -Fqwe 'instructions'; } && y=8
+        [ -z "$c" -o "$y" -ge 4 ] || {
             error "'clocks' wasn't built with CYCLES=yes"
             return 1
         }
+        [ -z "$e" -o "$y" -eq 8 ] || {
+            error "'clocks' wasn't built with PERF=yes"
+            return 1
+        }
     }
 
     local c2
@@ -986,22 +1441,31 @@ html-cref-test()
     local m2
     local k
 
-    # stev: normalize $m
+    # stev: normalize $m and $e
     [ "${#m[@]}" -eq 1 ] && m=($m $m $m)
-
-    [[ -z "$c" && "${m[@]}" != '- - -' ||
-       -n "$c" && "${m[@]}" == '- - -' ]] || {
-        error "internal: unexpected m=(${m[@]}) and c='$c'"
+    [ -z "$e" ] && e=(- - - -)
+    [ "${#e[@]}" -eq 1 ] && e=($e $e $e $e)
+
+    k=0
+    [ "${m[*]}" != '- - -' ] && (( k++ ))
+    [ -n "$c" ] && (( k++ ))
+    [ "${e[*]}" != '- - - -' ] && (( k++ ))
+    [ "$k" -eq 1 ] || {
+        error "internal: unexpected m=(${m[@]}), c='$c' and e=(${e[@]})"
         return 1
     }
     m[3]="${c:--}"
+    m+=("${e[@]}")
+
+    # stev: $e is not empty iff counters were asked for
+    [ "${e[*]}" == '- - - -' ] && e=''
 
     [ "$act" == 'T' ] &&
-    a=(real process thread cycles)
+    a=(real process thread cycles $perc)
 
     [[ "$act" == 'T' && "${m[@]}" =~ \+ ]] && {
         a2=''
-        for ((k=0; k<4; k++)); do
+        for ((k=0; k<8; k++)); do
             [ "${m[$k]}" == '-' ] &&
             continue
             a2+="${a2:+ }${a[$k]}"
@@ -1012,7 +1476,7 @@ html-cref-test()
 
         if [ "$x" == 'echo' ]; then
             echo "$c2"
-            m2=(1 2 3 4)
+            m2=(1 2 3 4 5 6 7 8)
         else
             m2=($(set -o pipefail && eval "$c2")) &&
             [[ "${#m2[@]}" -eq $y ]] || {
@@ -1025,13 +1489,16 @@ html-cref-test()
     }
     [ "$act" == 'T' ] && {
         a2=''
-        for ((k=0; k<4; k++)); do
+        for ((k=0; k<8; k++)); do
             [ "${m[$k]}" == '-' ] &&
             continue
-            a2+="${a2:+ }--${a[$k]}="
-            [ "${m[$k]}" == '+' ] &&
-            a2+="${m2[$k]}" ||
-            a2+="${m[$k]}"
+            a2+="${a2:+ }--${a[$k]}"
+            # stev: 'clocks' prints out '-' for the
+            # counters not available on the host
+            [ "${m[$k]}" != '+' ] &&
+            a2+="=${m[$k]}" ||
+            [ "${m2[$k]}" == '-' ] ||
+            a2+="=${m2[$k]}"
         done
         if [ -z "$a2" ]; then
             [ -z "$c" ] &&
@@ -1048,15 +1515,22 @@ html-cref-test()
                 C["real"] = 1
                 C["process"] = 2
                 C["thread"] = 3'
+        [ -n "$c" -o -n "$e" ] && a+='
+                C["cycles"] = 4'
+        [ -n "$e" ] && a+='
+                C["instructions"] = 5
+                C["branch-misses"] = 6
+                C["icache-misses"] = 7
+                C["cache-misses"] = 8
+                N = 8'
         [ -n "$c" ] && a+='
-                C["cycles"] = 4
                 N = 4'
-        [ -z "$c" ] && a+='
+        [ -z "$c" -a -z "$e" ] && a+='
                 N = 3'
         a+='
             }
             {
-                if (!match($0, /^('"${timc// /|}${c:+|cycles}"')-timings:[ \t]*([^ \t]+)[ \t]*$/, a))
+                if (!match($0, /^('"${timc// /|}${c:+|cycles}${e:+|${perc// /|}}"')-timings:[ \t]*([^ \t]+)([ \t]+\+-[ \t]+[^ \t]+)?[ \t]*$/, a))
                     print $0 > "/dev/stderr"
                 else {
                     i = C[a[1]]
@@ -1073,10 +1547,12 @@ html-cref-test()
             }'
 
         (( w += 3 ))
-        [ -z "$c" ] && a2='
+        [ -z "$c" -a -z "$e" ] && a2='
             BEGIN { N = 3 }'
         [ -n "$c" ] && a2='
             BEGIN { N = 4 }'
+        [ -n "$e" ] && a2='
+            BEGIN { N = 8 }'
         a2+='
             function mean(i)
             {
@@ -1218,6 +1694,48 @@ $i}"
 sort -k${s}g,$s"
         [ -z "$s" -a -n "$g" ] && c2+='|
 sort -k1,1'
+    elif [ "$act" == 'G' ]; then
+        a='
+            function gain(t, v,	r)
+            {
+                if (t != "-" && v != "-" && t) {
+                    r = sprintf("%.2f", (t - v) / t * 100)
+                    return r == "-0.00" ? substr(r, 2) : r
+                }
+                return "-"
+            }
+            FNR == NR {
+                for (j = 3; j <= NF; j ++)
+                    R[$1, j] = $j
+                next
+            }
+            {
+                L[++ N] = $0
+
+                for (i = 1; i < 3; i ++) {
+                    l = length($i)
+                    if (W[i] < l)
+                        W[i] = l
+                }
+            }
+            END {
+                W[1] ++
+
+                for (i = 1; i <= N; i ++) {
+                    n = split(L[i], A)
+                    for (j = 1; j < 3; j ++)
+                        printf("%-*s", W[j], A[j])
+                    for (j = 3; j <= n; j ++)
+                        printf(" %6s", (A[1], j) in R \
+                            ? gain(R[A[1], j], A[j]) : "-")
+                    printf("\n")
+                }
+            }'
+
+        # stev: need not quote $arg and $i below
+        c2="\
+awk '$a' \
+$arg $i"
     else
         error "internal: unexpected act='$act'"
         return 1
@@ -0,0 +1,58 @@
+#!/bin/bash
+
+# Copyright (C) 2019  Stefan Vargyas
+# 
+# This file is part of Html-Cref.
+# 
+# Html-Cref is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+# 
+# Html-Cref is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+# 
+# You should have received a copy of the GNU General Public License
+# along with Html-Cref.  If not, see <http://www.gnu.org/licenses/>.
+
+#
+# File generated by a command like:
+# $ html-cref-gentest -C modules:autotune
+#
+
+[[ "$1" =~ ^-u[0-9]+$ ]] &&
+u="${1:2}" ||
+u=""
+
+diff -u$u -L autotune.old <(echo \
+'$ shopt -s extglob
+$ . test-funcs.sh
+$ autotune-cache
+etrie
+$ autotune-fallback
+etrie
+etrie
+etrie
+html-cref: warning: html-cref-none.so: module lib error: failed loading library
+html-cref: warning: falling back to parser '\''etrie'\''
+a & b'
+) -L autotune.new <(
+echo '$ shopt -s extglob'
+shopt -s extglob 2>&1 ||
+echo 'command failed: shopt -s extglob'
+
+echo '$ . test-funcs.sh'
+. test-funcs.sh 2>&1 ||
+echo 'command failed: . test-funcs.sh'
+
+echo '$ autotune-cache'
+autotune-cache 2>&1 ||
+echo 'command failed: autotune-cache'
+
+echo '$ autotune-fallback'
+autotune-fallback 2>&1 ||
+echo 'command failed: autotune-fallback'
+)
+
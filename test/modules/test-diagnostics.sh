@@ -0,0 +1,102 @@
+#!/bin/bash
+
+# Copyright (C) 2019  Stefan Vargyas
+# 
+# This file is part of Html-Cref.
+# 
+# Html-Cref is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+# 
+# Html-Cref is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+# 
+# You should have received a copy of the GNU General Public License
+# along with Html-Cref.  If not, see <http://www.gnu.org/licenses/>.
+
+#
+# File generated by a command like:
+# $ html-cref-gentest -C modules:diagnostics
+#
+
+[[ "$1" =~ ^-u[0-9]+$ ]] &&
+u="${1:2}" ||
+u=""
+
+diff -u$u -L diagnostics.old <(echo \
+'$ shopt -s extglob
+$ . test-funcs.sh
+$ html-cref --diagnostics < /dev/null
+html-cref: error: option '\''--diagnostics'\'' requires option '\''-w|--warnings[-only]'\''
+command failed: html-cref --diagnostics < /dev/null
+$ html-cref -w --diagnostics-max=0 < /dev/null
+html-cref: error: illegal argument for '\''diagnostics-max'\'' option: '\''0'\''
+command failed: html-cref -w --diagnostics-max=0 < /dev/null
+$ printf '\''a &bogus; b &bogus;\nc &nope; &#xD800;\n&bogus;\n'\''|html-cref -w --diagnostics
+html-cref: warning: 1:3: invalid char reference '\''bogus'\'' (offset 2, 3 times)
+html-cref: warning: 2:3: invalid char reference '\''nope'\'' (offset 22, 1 time)
+html-cref: warning: 2:10: invalid char reference '\''#xD800;'\'' (offset 29, 1 time)
+html-cref: warning: 5 invalid char reference(s): 3 distinct, 0 suppressed
+$ printf '\''a &bogus; b &bogus;\nc &nope; &#xD800;\n&bogus;\n'\''|html-cref -t liner -w --diagnostics
+html-cref: warning: 1:3: invalid char reference '\''bogus'\'' (offset 2, 3 times)
+html-cref: warning: 2:3: invalid char reference '\''nope'\'' (offset 22, 1 time)
+html-cref: warning: 2:10: invalid char reference '\''#xD800;'\'' (offset 29, 1 time)
+html-cref: warning: 5 invalid char reference(s): 3 distinct, 0 suppressed
+$ printf '\''a &bogus; b &bogus;\nc &nope; &#xD800;\n&bogus;\n'\''|html-cref -w --diagnostics=json
+{"ref":"bogus","offset":2,"line":1,"column":3,"count":3}
+{"ref":"nope","offset":22,"line":2,"column":3,"count":1}
+{"ref":"#xD800;","offset":29,"line":2,"column":10,"count":1}
+{"total":5,"distinct":3,"suppressed":0}
+$ printf '\''a &bogus; b &bogus;\nc &nope; &#xD800;\n&bogus;\n'\''|html-cref -w --diagnostics=json --diagnostics-max=1
+{"ref":"bogus","offset":2,"line":1,"column":3,"count":3}
+{"total":5,"distinct":1,"suppressed":2}
+$ printf '\''a &bogus; b &bogus;\nc &nope; &#xD800;\n&bogus;\n'\''|{ html-cref -S --warnings --diagnostics --diagnostics-max=2 >/dev/null; }
+html-cref: warning: 1:3: invalid char reference '\''bogus'\'' (offset 2, 3 times)
+html-cref: warning: 2:3: invalid char reference '\''nope'\'' (offset 22, 1 time)
+html-cref: warning: 5 invalid char reference(s): 2 distinct, 1 suppressed
+$ printf '\''a &bogus; b &bogus;\nc &nope; &#xD800;\n&bogus;\n'\''|html-cref -S --warnings --diagnostics 2>/dev/null|cmp - <(printf '\''a &bogus; b &bogus;\nc &nope; &#xD800;\n&bogus;\n'\'')'
+) -L diagnostics.new <(
+echo '$ shopt -s extglob'
+shopt -s extglob 2>&1 ||
+echo 'command failed: shopt -s extglob'
+
+echo '$ . test-funcs.sh'
+. test-funcs.sh 2>&1 ||
+echo 'command failed: . test-funcs.sh'
+
+echo '$ html-cref --diagnostics < /dev/null'
+html-cref --diagnostics < /dev/null 2>&1 ||
+echo 'command failed: html-cref --diagnostics < /dev/null'
+
+echo '$ html-cref -w --diagnostics-max=0 < /dev/null'
+html-cref -w --diagnostics-max=0 < /dev/null 2>&1 ||
+echo 'command failed: html-cref -w --diagnostics-max=0 < /dev/null'
+
+echo '$ printf '\''a &bogus; b &bogus;\nc &nope; &#xD800;\n&bogus;\n'\''|html-cref -w --diagnostics'
+printf 'a &bogus; b &bogus;\nc &nope; &#xD800;\n&bogus;\n'|html-cref -w --diagnostics 2>&1 ||
+echo 'command failed: printf '\''a &bogus; b &bogus;\nc &nope; &#xD800;\n&bogus;\n'\''|html-cref -w --diagnostics'
+
+echo '$ printf '\''a &bogus; b &bogus;\nc &nope; &#xD800;\n&bogus;\n'\''|html-cref -t liner -w --diagnostics'
+printf 'a &bogus; b &bogus;\nc &nope; &#xD800;\n&bogus;\n'|html-cref -t liner -w --diagnostics 2>&1 ||
+echo 'command failed: printf '\''a &bogus; b &bogus;\nc &nope; &#xD800;\n&bogus;\n'\''|html-cref -t liner -w --diagnostics'
+
+echo '$ printf '\''a &bogus; b &bogus;\nc &nope; &#xD800;\n&bogus;\n'\''|html-cref -w --diagnostics=json'
+printf 'a &bogus; b &bogus;\nc &nope; &#xD800;\n&bogus;\n'|html-cref -w --diagnostics=json 2>&1 ||
+echo 'command failed: printf '\''a &bogus; b &bogus;\nc &nope; &#xD800;\n&bogus;\n'\''|html-cref -w --diagnostics=json'
+
+echo '$ printf '\''a &bogus; b &bogus;\nc &nope; &#xD800;\n&bogus;\n'\''|html-cref -w --diagnostics=json --diagnostics-max=1'
+printf 'a &bogus; b &bogus;\nc &nope; &#xD800;\n&bogus;\n'|html-cref -w --diagnostics=json --diagnostics-max=1 2>&1 ||
+echo 'command failed: printf '\''a &bogus; b &bogus;\nc &nope; &#xD800;\n&bogus;\n'\''|html-cref -w --diagnostics=json --diagnostics-max=1'
+
+echo '$ printf '\''a &bogus; b &bogus;\nc &nope; &#xD800;\n&bogus;\n'\''|{ html-cref -S --warnings --diagnostics --diagnostics-max=2 >/dev/null; }'
+printf 'a &bogus; b &bogus;\nc &nope; &#xD800;\n&bogus;\n'|{ html-cref -S --warnings --diagnostics --diagnostics-max=2 >/dev/null; } 2>&1 ||
+echo 'command failed: printf '\''a &bogus; b &bogus;\nc &nope; &#xD800;\n&bogus;\n'\''|{ html-cref -S --warnings --diagnostics --diagnostics-max=2 >/dev/null; }'
+
+echo '$ printf '\''a &bogus; b &bogus;\nc &nope; &#xD800;\n&bogus;\n'\''|html-cref -S --warnings --diagnostics 2>/dev/null|cmp - <(printf '\''a &bogus; b &bogus;\nc &nope; &#xD800;\n&bogus;\n'\'')'
+printf 'a &bogus; b &bogus;\nc &nope; &#xD800;\n&bogus;\n'|html-cref -S --warnings --diagnostics 2>/dev/null|cmp - <(printf 'a &bogus; b &bogus;\nc &nope; &#xD800;\n&bogus;\n') 2>&1 ||
+echo 'command failed: printf '\''a &bogus; b &bogus;\nc &nope; &#xD800;\n&bogus;\n'\''|html-cref -S --warnings --diagnostics 2>/dev/null|cmp - <(printf '\''a &bogus; b &bogus;\nc &nope; &#xD800;\n&bogus;\n'\'')'
+)
+
@@ -0,0 +1,63 @@
+#!/bin/bash
+
+# Copyright (C) 2019  Stefan Vargyas
+# 
+# This file is part of Html-Cref.
+# 
+# Html-Cref is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+# 
+# Html-Cref is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+# 
+# You should have received a copy of the GNU General Public License
+# along with Html-Cref.  If not, see <http://www.gnu.org/licenses/>.
+
+#
+# File generated by a command like:
+# $ html-cref-gentest -C modules:encode
+#
+
+[[ "$1" =~ ^-u[0-9]+$ ]] &&
+u="${1:2}" ||
+u=""
+
+diff -u$u -L encode.old <(echo \
+'$ shopt -s extglob
+$ . test-funcs.sh
+$ printf '\''&nvlt;|&acE;|&nesim;|&lt;|&amp;|&fjlig;|&ThickSpace;\n'\''|html-cref -S|html-cref -E
+&nvlt;|&acE;|&nesim;|<|&amp;|fj|&ThickSpace;
+$ printf '\''a\xff b\x80 c\xc0\xaf d\n'\''|html-cref -E
+a&#xFFFD; b&#xFFFD; c&#xFFFD;&#xFFFD; d
+$ encode-round-trip
+$ encode-round-trip -t liner'
+) -L encode.new <(
+echo '$ shopt -s extglob'
+shopt -s extglob 2>&1 ||
+echo 'command failed: shopt -s extglob'
+
+echo '$ . test-funcs.sh'
+. test-funcs.sh 2>&1 ||
+echo 'command failed: . test-funcs.sh'
+
+echo '$ printf '\''&nvlt;|&acE;|&nesim;|&lt;|&amp;|&fjlig;|&ThickSpace;\n'\''|html-cref -S|html-cref -E'
+printf '&nvlt;|&acE;|&nesim;|&lt;|&amp;|&fjlig;|&ThickSpace;\n'|html-cref -S|html-cref -E 2>&1 ||
+echo 'command failed: printf '\''&nvlt;|&acE;|&nesim;|&lt;|&amp;|&fjlig;|&ThickSpace;\n'\''|html-cref -S|html-cref -E'
+
+echo '$ printf '\''a\xff b\x80 c\xc0\xaf d\n'\''|html-cref -E'
+printf 'a\xff b\x80 c\xc0\xaf d\n'|html-cref -E 2>&1 ||
+echo 'command failed: printf '\''a\xff b\x80 c\xc0\xaf d\n'\''|html-cref -E'
+
+echo '$ encode-round-trip'
+encode-round-trip 2>&1 ||
+echo 'command failed: encode-round-trip'
+
+echo '$ encode-round-trip -t liner'
+encode-round-trip -t liner 2>&1 ||
+echo 'command failed: encode-round-trip -t liner'
+)
+
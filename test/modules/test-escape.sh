@@ -0,0 +1,64 @@
+#!/bin/bash
+
+# Copyright (C) 2019  Stefan Vargyas
+# 
+# This file is part of Html-Cref.
+# 
+# Html-Cref is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+# 
+# Html-Cref is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+# 
+# You should have received a copy of the GNU General Public License
+# along with Html-Cref.  If not, see <http://www.gnu.org/licenses/>.
+
+#
+# File generated by a command like:
+# $ html-cref-gentest -C modules:escape
+#
+
+[[ "$1" =~ ^-u[0-9]+$ ]] &&
+u="${1:2}" ||
+u=""
+
+diff -u$u -L escape.old <(echo \
+'$ shopt -s extglob
+$ . test-funcs.sh
+$ printf '\''a&b<c>d"e\x27f\n'\''|html-cref -X
+a&amp;b&lt;c&gt;d&quot;e&#39;f
+$ printf '\''&&<<>>""\x27\x27\n'\''|html-cref -X
+&amp;&amp;&lt;&lt;&gt;&gt;&quot;&quot;&#39;&#39;
+$ printf '\''no escaping: \303\251 \342\202\254\n'\''|html-cref -X
+no escaping: é €
+$ test-escape'
+) -L escape.new <(
+echo '$ shopt -s extglob'
+shopt -s extglob 2>&1 ||
+echo 'command failed: shopt -s extglob'
+
+echo '$ . test-funcs.sh'
+. test-funcs.sh 2>&1 ||
+echo 'command failed: . test-funcs.sh'
+
+echo '$ printf '\''a&b<c>d"e\x27f\n'\''|html-cref -X'
+printf 'a&b<c>d"e\x27f\n'|html-cref -X 2>&1 ||
+echo 'command failed: printf '\''a&b<c>d"e\x27f\n'\''|html-cref -X'
+
+echo '$ printf '\''&&<<>>""\x27\x27\n'\''|html-cref -X'
+printf '&&<<>>""\x27\x27\n'|html-cref -X 2>&1 ||
+echo 'command failed: printf '\''&&<<>>""\x27\x27\n'\''|html-cref -X'
+
+echo '$ printf '\''no escaping: \303\251 \342\202\254\n'\''|html-cref -X'
+printf 'no escaping: \303\251 \342\202\254\n'|html-cref -X 2>&1 ||
+echo 'command failed: printf '\''no escaping: \303\251 \342\202\254\n'\''|html-cref -X'
+
+echo '$ test-escape'
+test-escape 2>&1 ||
+echo 'command failed: test-escape'
+)
+
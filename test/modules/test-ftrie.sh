@@ -0,0 +1,66 @@
+#!/bin/bash
+
+# Copyright (C) 2019  Stefan Vargyas
+# 
+# This file is part of Html-Cref.
+# 
+# Html-Cref is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+# 
+# Html-Cref is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+# 
+# You should have received a copy of the GNU General Public License
+# along with Html-Cref.  If not, see <http://www.gnu.org/licenses/>.
+
+#
+# File generated by a command like:
+# $ html-cref-gentest -C modules:ftrie
+#
+
+[[ "$1" =~ ^-u[0-9]+$ ]] &&
+u="${1:2}" ||
+u=""
+
+diff -u$u -L ftrie.old <(echo \
+'$ shopt -s extglob
+$ . test-funcs.sh
+$ validate-names ftrie
+$ validate-names -r ftrie
+$ validate-strict-prefixes ftrie
+$ validate-strict-prefixes -r ftrie
+$ test-crefs ftrie'
+) -L ftrie.new <(
+echo '$ shopt -s extglob'
+shopt -s extglob 2>&1 ||
+echo 'command failed: shopt -s extglob'
+
+echo '$ . test-funcs.sh'
+. test-funcs.sh 2>&1 ||
+echo 'command failed: . test-funcs.sh'
+
+echo '$ validate-names ftrie'
+validate-names ftrie 2>&1 ||
+echo 'command failed: validate-names ftrie'
+
+echo '$ validate-names -r ftrie'
+validate-names -r ftrie 2>&1 ||
+echo 'command failed: validate-names -r ftrie'
+
+echo '$ validate-strict-prefixes ftrie'
+validate-strict-prefixes ftrie 2>&1 ||
+echo 'command failed: validate-strict-prefixes ftrie'
+
+echo '$ validate-strict-prefixes -r ftrie'
+validate-strict-prefixes -r ftrie 2>&1 ||
+echo 'command failed: validate-strict-prefixes -r ftrie'
+
+echo '$ test-crefs ftrie'
+test-crefs ftrie 2>&1 ||
+echo 'command failed: test-crefs ftrie'
+)
+
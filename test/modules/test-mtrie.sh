@@ -0,0 +1,73 @@
+#!/bin/bash
+
+# Copyright (C) 2019  Stefan Vargyas
+# 
+# This file is part of Html-Cref.
+# 
+# Html-Cref is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+# 
+# Html-Cref is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+# 
+# You should have received a copy of the GNU General Public License
+# along with Html-Cref.  If not, see <http://www.gnu.org/licenses/>.
+
+#
+# File generated by a command like:
+# $ html-cref-gentest -C modules:mtrie
+#
+
+[[ "$1" =~ ^-u[0-9]+$ ]] &&
+u="${1:2}" ||
+u=""
+
+diff -u$u -L mtrie.old <(echo \
+'$ shopt -s extglob
+$ . test-funcs.sh
+$ validate-names mtrie
+$ validate-names -r mtrie
+$ validate-strict-prefixes mtrie
+$ validate-strict-prefixes -r mtrie
+$ test-crefs mtrie
+$ HTML_CREF_INDEX=/dev/null html-cref -p mtrie < /dev/null
+html-cref: error: html-cref-mtrie.so: module error: /dev/null: invalid file size
+command failed: HTML_CREF_INDEX=/dev/null html-cref -p mtrie < /dev/null'
+) -L mtrie.new <(
+echo '$ shopt -s extglob'
+shopt -s extglob 2>&1 ||
+echo 'command failed: shopt -s extglob'
+
+echo '$ . test-funcs.sh'
+. test-funcs.sh 2>&1 ||
+echo 'command failed: . test-funcs.sh'
+
+echo '$ validate-names mtrie'
+validate-names mtrie 2>&1 ||
+echo 'command failed: validate-names mtrie'
+
+echo '$ validate-names -r mtrie'
+validate-names -r mtrie 2>&1 ||
+echo 'command failed: validate-names -r mtrie'
+
+echo '$ validate-strict-prefixes mtrie'
+validate-strict-prefixes mtrie 2>&1 ||
+echo 'command failed: validate-strict-prefixes mtrie'
+
+echo '$ validate-strict-prefixes -r mtrie'
+validate-strict-prefixes -r mtrie 2>&1 ||
+echo 'command failed: validate-strict-prefixes -r mtrie'
+
+echo '$ test-crefs mtrie'
+test-crefs mtrie 2>&1 ||
+echo 'command failed: test-crefs mtrie'
+
+echo '$ HTML_CREF_INDEX=/dev/null html-cref -p mtrie < /dev/null'
+HTML_CREF_INDEX=/dev/null html-cref -p mtrie < /dev/null 2>&1 ||
+echo 'command failed: HTML_CREF_INDEX=/dev/null html-cref -p mtrie < /dev/null'
+)
+
@@ -0,0 +1,84 @@
+#!/bin/bash
+
+# Copyright (C) 2019  Stefan Vargyas
+# 
+# This file is part of Html-Cref.
+# 
+# Html-Cref is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+# 
+# Html-Cref is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+# 
+# You should have received a copy of the GNU General Public License
+# along with Html-Cref.  If not, see <http://www.gnu.org/licenses/>.
+
+#
+# File generated by a command like:
+# $ html-cref-gentest -C modules:print
+#
+
+[[ "$1" =~ ^-u[0-9]+$ ]] &&
+u="${1:2}" ||
+u=""
+
+diff -u$u -L print.old <(echo \
+'$ shopt -s extglob
+$ . test-funcs.sh
+$ printf '\''amp\nnvlt\nAElig\nfoo\nfjlig\n'\''|html-cref -P
+amp & *
+nvlt <\342\203\222
+AElig \303\206 *
+fjlig fj
+$ printf '\''amp\nnvlt\nAElig\nfoo\nfjlig\n'\''|html-cref -P --print-format=tsv
+amp	U+0026	1
+nvlt	U+003C U+20D2	0
+AElig	U+00C6	1
+fjlig	U+0066 U+006A	0
+$ printf '\''amp\nnvlt\nAElig\nfoo\nfjlig\n'\''|html-cref -P --print-format=binary|od -An -tx1
+ 03 61 6d 70 01 26 01 04 6e 76 6c 74 04 3c e2 83
+ 92 00 05 41 45 6c 69 67 02 c3 86 01 05 66 6a 6c
+ 69 67 02 66 6a 00
+$ html-cref -P --print-format=tsv < html-cref-names.txt|wc -l
+2125
+$ html-cref -P --print-format=binary < html-cref-names.txt|wc -c
+26595
+$ diff <(html-cref -P --print-format=tsv < html-cref-names.txt) <(html-cref -t liner -P --print-format=tsv < html-cref-names.txt)'
+) -L print.new <(
+echo '$ shopt -s extglob'
+shopt -s extglob 2>&1 ||
+echo 'command failed: shopt -s extglob'
+
+echo '$ . test-funcs.sh'
+. test-funcs.sh 2>&1 ||
+echo 'command failed: . test-funcs.sh'
+
+echo '$ printf '\''amp\nnvlt\nAElig\nfoo\nfjlig\n'\''|html-cref -P'
+printf 'amp\nnvlt\nAElig\nfoo\nfjlig\n'|html-cref -P 2>&1 ||
+echo 'command failed: printf '\''amp\nnvlt\nAElig\nfoo\nfjlig\n'\''|html-cref -P'
+
+echo '$ printf '\''amp\nnvlt\nAElig\nfoo\nfjlig\n'\''|html-cref -P --print-format=tsv'
+printf 'amp\nnvlt\nAElig\nfoo\nfjlig\n'|html-cref -P --print-format=tsv 2>&1 ||
+echo 'command failed: printf '\''amp\nnvlt\nAElig\nfoo\nfjlig\n'\''|html-cref -P --print-format=tsv'
+
+echo '$ printf '\''amp\nnvlt\nAElig\nfoo\nfjlig\n'\''|html-cref -P --print-format=binary|od -An -tx1'
+printf 'amp\nnvlt\nAElig\nfoo\nfjlig\n'|html-cref -P --print-format=binary|od -An -tx1 2>&1 ||
+echo 'command failed: printf '\''amp\nnvlt\nAElig\nfoo\nfjlig\n'\''|html-cref -P --print-format=binary|od -An -tx1'
+
+echo '$ html-cref -P --print-format=tsv < html-cref-names.txt|wc -l'
+html-cref -P --print-format=tsv < html-cref-names.txt|wc -l 2>&1 ||
+echo 'command failed: html-cref -P --print-format=tsv < html-cref-names.txt|wc -l'
+
+echo '$ html-cref -P --print-format=binary < html-cref-names.txt|wc -c'
+html-cref -P --print-format=binary < html-cref-names.txt|wc -c 2>&1 ||
+echo 'command failed: html-cref -P --print-format=binary < html-cref-names.txt|wc -c'
+
+echo '$ diff <(html-cref -P --print-format=tsv < html-cref-names.txt) <(html-cref -t liner -P --print-format=tsv < html-cref-names.txt)'
+diff <(html-cref -P --print-format=tsv < html-cref-names.txt) <(html-cref -t liner -P --print-format=tsv < html-cref-names.txt) 2>&1 ||
+echo 'command failed: diff <(html-cref -P --print-format=tsv < html-cref-names.txt) <(html-cref -t liner -P --print-format=tsv < html-cref-names.txt)'
+)
+
@@ -0,0 +1,56 @@
+#!/bin/bash
+
+# Copyright (C) 2019  Stefan Vargyas
+# 
+# This file is part of Html-Cref.
+# 
+# Html-Cref is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+# 
+# Html-Cref is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+# 
+# You should have received a copy of the GNU General Public License
+# along with Html-Cref.  If not, see <http://www.gnu.org/licenses/>.
+
+#
+# File generated by a command like:
+# $ html-cref-gentest -C modules:sampling
+#
+
+[[ "$1" =~ ^-u[0-9]+$ ]] &&
+u="${1:2}" ||
+u=""
+
+diff -u$u -L sampling.old <(echo \
+'$ shopt -s extglob
+$ . test-funcs.sh
+$ sample-options
+$ sample-timings
+$ sample-timings -t liner'
+) -L sampling.new <(
+echo '$ shopt -s extglob'
+shopt -s extglob 2>&1 ||
+echo 'command failed: shopt -s extglob'
+
+echo '$ . test-funcs.sh'
+. test-funcs.sh 2>&1 ||
+echo 'command failed: . test-funcs.sh'
+
+echo '$ sample-options'
+sample-options 2>&1 ||
+echo 'command failed: sample-options'
+
+echo '$ sample-timings'
+sample-timings 2>&1 ||
+echo 'command failed: sample-timings'
+
+echo '$ sample-timings -t liner'
+sample-timings -t liner 2>&1 ||
+echo 'command failed: sample-timings -t liner'
+)
+
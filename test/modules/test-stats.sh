@@ -0,0 +1,118 @@
+#!/bin/bash
+
+# Copyright (C) 2019  Stefan Vargyas
+# 
+# This file is part of Html-Cref.
+# 
+# Html-Cref is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+# 
+# Html-Cref is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+# 
+# You should have received a copy of the GNU General Public License
+# along with Html-Cref.  If not, see <http://www.gnu.org/licenses/>.
+
+#
+# File generated by a command like:
+# $ html-cref-gentest -C modules:stats
+#
+
+[[ "$1" =~ ^-u[0-9]+$ ]] &&
+u="${1:2}" ||
+u=""
+
+diff -u$u -L stats.old <(echo \
+'$ shopt -s extglob
+$ . test-funcs.sh
+$ html-cref -P --stats < /dev/null
+html-cref: error: option '\''--stats'\'' requires action '\''-S|--subst-cref'\''
+command failed: html-cref -P --stats < /dev/null
+$ html-cref -S --stats=xml < /dev/null
+html-cref: error: invalid argument for '\''stats'\'' option: '\''xml'\''
+command failed: html-cref -S --stats=xml < /dev/null
+$ printf '\''a &amp; &lt; &amp &bogus; &#65; &#x42; &amp;\n'\''|stats --stats
+# bytes-in:   45
+# bytes-out:  22
+# named:      4
+# legacy:     1
+# decimal:    1
+# hex:        1
+# invalid:    1
+# density:    155.56 refs per 1000 bytes
+amp 3
+lt 1
+$ printf '\''a &amp; &lt; &amp &bogus; &#65; &#x42; &amp;\n'\''|stats --stats -t liner
+# bytes-in:   45
+# bytes-out:  22
+# named:      4
+# legacy:     1
+# decimal:    1
+# hex:        1
+# invalid:    1
+# density:    155.56 refs per 1000 bytes
+amp 3
+lt 1
+$ printf '\''a &amp; &lt; &amp &bogus; &#65; &#x42; &amp;\n'\''|stats --stats=json
+{"bytes_in":45,"bytes_out":22,"named":4,"legacy":1,"decimal":1,"hex":1,"invalid":1,"density":155.56,"names":{"amp":3,"lt":1}}
+$ printf '\''a &amp; &lt; &amp &bogus; &#65; &#x42; &amp;\n'\''|stats --stats --warnings --diagnostics
+html-cref: warning: 1:19: invalid char reference '\''bogus'\'' (offset 18, 1 time)
+html-cref: warning: 1 invalid char reference(s): 1 distinct, 0 suppressed
+# bytes-in:   45
+# bytes-out:  22
+# named:      4
+# legacy:     1
+# decimal:    1
+# hex:        1
+# invalid:    1
+# density:    155.56 refs per 1000 bytes
+# distinct:   1
+# suppressed: 0
+amp 3
+lt 1
+$ stats-corpus
+amp
+lt
+gt'
+) -L stats.new <(
+echo '$ shopt -s extglob'
+shopt -s extglob 2>&1 ||
+echo 'command failed: shopt -s extglob'
+
+echo '$ . test-funcs.sh'
+. test-funcs.sh 2>&1 ||
+echo 'command failed: . test-funcs.sh'
+
+echo '$ html-cref -P --stats < /dev/null'
+html-cref -P --stats < /dev/null 2>&1 ||
+echo 'command failed: html-cref -P --stats < /dev/null'
+
+echo '$ html-cref -S --stats=xml < /dev/null'
+html-cref -S --stats=xml < /dev/null 2>&1 ||
+echo 'command failed: html-cref -S --stats=xml < /dev/null'
+
+echo '$ printf '\''a &amp; &lt; &amp &bogus; &#65; &#x42; &amp;\n'\''|stats --stats'
+printf 'a &amp; &lt; &amp &bogus; &#65; &#x42; &amp;\n'|stats --stats 2>&1 ||
+echo 'command failed: printf '\''a &amp; &lt; &amp &bogus; &#65; &#x42; &amp;\n'\''|stats --stats'
+
+echo '$ printf '\''a &amp; &lt; &amp &bogus; &#65; &#x42; &amp;\n'\''|stats --stats -t liner'
+printf 'a &amp; &lt; &amp &bogus; &#65; &#x42; &amp;\n'|stats --stats -t liner 2>&1 ||
+echo 'command failed: printf '\''a &amp; &lt; &amp &bogus; &#65; &#x42; &amp;\n'\''|stats --stats -t liner'
+
+echo '$ printf '\''a &amp; &lt; &amp &bogus; &#65; &#x42; &amp;\n'\''|stats --stats=json'
+printf 'a &amp; &lt; &amp &bogus; &#65; &#x42; &amp;\n'|stats --stats=json 2>&1 ||
+echo 'command failed: printf '\''a &amp; &lt; &amp &bogus; &#65; &#x42; &amp;\n'\''|stats --stats=json'
+
+echo '$ printf '\''a &amp; &lt; &amp &bogus; &#65; &#x42; &amp;\n'\''|stats --stats --warnings --diagnostics'
+printf 'a &amp; &lt; &amp &bogus; &#65; &#x42; &amp;\n'|stats --stats --warnings --diagnostics 2>&1 ||
+echo 'command failed: printf '\''a &amp; &lt; &amp &bogus; &#65; &#x42; &amp;\n'\''|stats --stats --warnings --diagnostics'
+
+echo '$ stats-corpus'
+stats-corpus 2>&1 ||
+echo 'command failed: stats-corpus'
+)
+
@@ -0,0 +1,104 @@
+#!/bin/bash
+
+# Copyright (C) 2019  Stefan Vargyas
+# 
+# This file is part of Html-Cref.
+# 
+# Html-Cref is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+# 
+# Html-Cref is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+# 
+# You should have received a copy of the GNU General Public License
+# along with Html-Cref.  If not, see <http://www.gnu.org/licenses/>.
+
+#
+# File generated by a command like:
+# $ html-cref-gentest -C modules:subst
+#
+
+[[ "$1" =~ ^-u[0-9]+$ ]] &&
+u="${1:2}" ||
+u=""
+
+diff -u$u -L subst.old <(echo \
+'$ shopt -s extglob
+$ . test-funcs.sh
+$ printf '\''&'\''|html-cref -S; echo
+&
+$ printf '\''a &'\''|html-cref -S; echo
+a &
+$ printf '\''a &'\''|html-cref -t liner -S; echo
+a &
+$ printf '\''a &#'\''|html-cref -S; echo
+a &#
+$ printf '\''a &#x'\''|html-cref -S; echo
+a &#x
+$ printf '\''a &amp'\''|html-cref -S; echo
+a &
+$ printf '\''a &am'\''|html-cref -S; echo
+a &am
+$ printf '\''a &'\''|html-cref -V
+bytes-in:  3
+bytes-out: 3
+valid:     0
+invalid:   0
+legacy:    0
+$ alnum-run|html-cref -S -w
+html-cref: warning: invalid char reference '\''aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa'\''
+$ alnum-run|html-cref -S --warnings 2>/dev/null|cmp - <(alnum-run)'
+) -L subst.new <(
+echo '$ shopt -s extglob'
+shopt -s extglob 2>&1 ||
+echo 'command failed: shopt -s extglob'
+
+echo '$ . test-funcs.sh'
+. test-funcs.sh 2>&1 ||
+echo 'command failed: . test-funcs.sh'
+
+echo '$ printf '\''&'\''|html-cref -S; echo'
+printf '&'|html-cref -S; echo 2>&1 ||
+echo 'command failed: printf '\''&'\''|html-cref -S; echo'
+
+echo '$ printf '\''a &'\''|html-cref -S; echo'
+printf 'a &'|html-cref -S; echo 2>&1 ||
+echo 'command failed: printf '\''a &'\''|html-cref -S; echo'
+
+echo '$ printf '\''a &'\''|html-cref -t liner -S; echo'
+printf 'a &'|html-cref -t liner -S; echo 2>&1 ||
+echo 'command failed: printf '\''a &'\''|html-cref -t liner -S; echo'
+
+echo '$ printf '\''a &#'\''|html-cref -S; echo'
+printf 'a &#'|html-cref -S; echo 2>&1 ||
+echo 'command failed: printf '\''a &#'\''|html-cref -S; echo'
+
+echo '$ printf '\''a &#x'\''|html-cref -S; echo'
+printf 'a &#x'|html-cref -S; echo 2>&1 ||
+echo 'command failed: printf '\''a &#x'\''|html-cref -S; echo'
+
+echo '$ printf '\''a &amp'\''|html-cref -S; echo'
+printf 'a &amp'|html-cref -S; echo 2>&1 ||
+echo 'command failed: printf '\''a &amp'\''|html-cref -S; echo'
+
+echo '$ printf '\''a &am'\''|html-cref -S; echo'
+printf 'a &am'|html-cref -S; echo 2>&1 ||
+echo 'command failed: printf '\''a &am'\''|html-cref -S; echo'
+
+echo '$ printf '\''a &'\''|html-cref -V'
+printf 'a &'|html-cref -V 2>&1 ||
+echo 'command failed: printf '\''a &'\''|html-cref -V'
+
+echo '$ alnum-run|html-cref -S -w'
+alnum-run|html-cref -S -w 2>&1 ||
+echo 'command failed: alnum-run|html-cref -S -w'
+
+echo '$ alnum-run|html-cref -S --warnings 2>/dev/null|cmp - <(alnum-run)'
+alnum-run|html-cref -S --warnings 2>/dev/null|cmp - <(alnum-run) 2>&1 ||
+echo 'command failed: alnum-run|html-cref -S --warnings 2>/dev/null|cmp - <(alnum-run)'
+)
+
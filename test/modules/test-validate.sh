@@ -0,0 +1,84 @@
+#!/bin/bash
+
+# Copyright (C) 2019  Stefan Vargyas
+# 
+# This file is part of Html-Cref.
+# 
+# Html-Cref is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+# 
+# Html-Cref is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+# 
+# You should have received a copy of the GNU General Public License
+# along with Html-Cref.  If not, see <http://www.gnu.org/licenses/>.
+
+#
+# File generated by a command like:
+# $ html-cref-gentest -C modules:validate
+#
+
+[[ "$1" =~ ^-u[0-9]+$ ]] &&
+u="${1:2}" ||
+u=""
+
+diff -u$u -L validate.old <(echo \
+'$ shopt -s extglob
+$ . test-funcs.sh
+$ printf '\''x &amp; &lt &#65;\n'\''|html-cref -V
+bytes-in:  18
+bytes-out: 8
+valid:     3
+invalid:   0
+legacy:    1
+$ printf '\''x &ampy; &AMP; &#0; &#x110000; &#;\n'\''|html-cref -V
+bytes-in:  35
+bytes-out: 28
+valid:     2
+invalid:   3
+legacy:    1
+command failed: printf '\''x &ampy; &AMP; &#0; &#x110000; &#;\n'\''|html-cref -V
+$ printf '\''a &bogus; b\n'\''|html-cref -V --warnings
+html-cref: warning: invalid char reference '\''bogus'\''
+bytes-in:  12
+bytes-out: 12
+valid:     0
+invalid:   1
+legacy:    0
+command failed: printf '\''a &bogus; b\n'\''|html-cref -V --warnings
+$ validate-bytes-out
+$ validate-bytes-out -t liner'
+) -L validate.new <(
+echo '$ shopt -s extglob'
+shopt -s extglob 2>&1 ||
+echo 'command failed: shopt -s extglob'
+
+echo '$ . test-funcs.sh'
+. test-funcs.sh 2>&1 ||
+echo 'command failed: . test-funcs.sh'
+
+echo '$ printf '\''x &amp; &lt &#65;\n'\''|html-cref -V'
+printf 'x &amp; &lt &#65;\n'|html-cref -V 2>&1 ||
+echo 'command failed: printf '\''x &amp; &lt &#65;\n'\''|html-cref -V'
+
+echo '$ printf '\''x &ampy; &AMP; &#0; &#x110000; &#;\n'\''|html-cref -V'
+printf 'x &ampy; &AMP; &#0; &#x110000; &#;\n'|html-cref -V 2>&1 ||
+echo 'command failed: printf '\''x &ampy; &AMP; &#0; &#x110000; &#;\n'\''|html-cref -V'
+
+echo '$ printf '\''a &bogus; b\n'\''|html-cref -V --warnings'
+printf 'a &bogus; b\n'|html-cref -V --warnings 2>&1 ||
+echo 'command failed: printf '\''a &bogus; b\n'\''|html-cref -V --warnings'
+
+echo '$ validate-bytes-out'
+validate-bytes-out 2>&1 ||
+echo 'command failed: validate-bytes-out'
+
+echo '$ validate-bytes-out -t liner'
+validate-bytes-out -t liner 2>&1 ||
+echo 'command failed: validate-bytes-out -t liner'
+)
+
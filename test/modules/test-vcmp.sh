@@ -0,0 +1,78 @@
+#!/bin/bash
+
+# Copyright (C) 2019  Stefan Vargyas
+# 
+# This file is part of Html-Cref.
+# 
+# Html-Cref is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+# 
+# Html-Cref is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+# 
+# You should have received a copy of the GNU General Public License
+# along with Html-Cref.  If not, see <http://www.gnu.org/licenses/>.
+
+#
+# File generated by a command like:
+# $ html-cref-gentest -C modules:vcmp
+#
+
+[[ "$1" =~ ^-u[0-9]+$ ]] &&
+u="${1:2}" ||
+u=""
+
+diff -u$u -L vcmp.old <(echo \
+'$ shopt -s extglob
+$ . test-funcs.sh
+$ validate-names vcmp
+$ validate-names -r vcmp
+$ validate-strict-prefixes vcmp
+$ validate-strict-prefixes -r vcmp
+$ test-crefs vcmp
+$ test-simd vcmp
+$ test-simd-env vcmp
+html-cref: warning: invalid $HTML_CREF_SIMD '\''bogus'\'': using ...
+&'
+) -L vcmp.new <(
+echo '$ shopt -s extglob'
+shopt -s extglob 2>&1 ||
+echo 'command failed: shopt -s extglob'
+
+echo '$ . test-funcs.sh'
+. test-funcs.sh 2>&1 ||
+echo 'command failed: . test-funcs.sh'
+
+echo '$ validate-names vcmp'
+validate-names vcmp 2>&1 ||
+echo 'command failed: validate-names vcmp'
+
+echo '$ validate-names -r vcmp'
+validate-names -r vcmp 2>&1 ||
+echo 'command failed: validate-names -r vcmp'
+
+echo '$ validate-strict-prefixes vcmp'
+validate-strict-prefixes vcmp 2>&1 ||
+echo 'command failed: validate-strict-prefixes vcmp'
+
+echo '$ validate-strict-prefixes -r vcmp'
+validate-strict-prefixes -r vcmp 2>&1 ||
+echo 'command failed: validate-strict-prefixes -r vcmp'
+
+echo '$ test-crefs vcmp'
+test-crefs vcmp 2>&1 ||
+echo 'command failed: test-crefs vcmp'
+
+echo '$ test-simd vcmp'
+test-simd vcmp 2>&1 ||
+echo 'command failed: test-simd vcmp'
+
+echo '$ test-simd-env vcmp'
+test-simd-env vcmp 2>&1 ||
+echo 'command failed: test-simd-env vcmp'
+)
+
@@ -99,4 +99,387 @@ validate-strict-prefixes()
 test-crefs()
 { html-cref ${1:+-p "$1"} -S -w test-html-crefs.txt; }
 
+simd-input()
+{
+    names -r
+    strict-prefixes -r
+    cat test-html-crefs.txt
+}
+
+# stev: lines of all lengths up to 130 bytes -- thus
+# crossing the widths 16, 32 and 64 of the vectorized
+# kernels --, each having one of the chars that the
+# kernels are looking for at each of its positions
+
+simd-tails()
+{
+    awk 'BEGIN {
+        n = split("&amp; &lt < > \" \x27 \303\251 \342\202\254", C, / /)
+        for (l = 1; l <= 130; l ++) {
+            for (k = 0; k < l; k ++) {
+                c = C[1 + (l + k) % n]
+                s = ""
+                for (i = 0; i < k; i ++)
+                    s = s "a"
+                s = s c
+                for (i = k + length(c); i < l; i ++)
+                    s = s "b"
+                print s
+            }
+        }
+    }'
+}
+
+simd-variants()
+{
+    local d
+    local v
+
+    # stev: the variants up to the one detected are
+    # all supported by the host's CPU
+    d="$(HTML_CREF_SIMD= dump-option simd)"
+
+    for v in sse42 avx2 avx512; do
+        [[ "$d" == @(sse42|avx2|avx512) ]] || break
+        echo "$v"
+        [ "$v" == "$d" ] && break
+    done
+}
+
+test-simd()
+{
+    local v
+    local a
+
+    for v in $(simd-variants); do
+        for a in S E X; do
+            diff -u0 \
+-Lscalar <(simd-input|HTML_CREF_SIMD=scalar html-cref ${1:+-p "$1"} -$a) \
+-L$v <(simd-input|HTML_CREF_SIMD=$v html-cref ${1:+-p "$1"} -$a)
+            diff -u0 \
+-Lscalar <(simd-tails|HTML_CREF_SIMD=scalar html-cref ${1:+-p "$1"} -t liner -$a) \
+-L$v <(simd-tails|HTML_CREF_SIMD=$v html-cref ${1:+-p "$1"} -t liner -$a)
+        done
+    done
+}
+
+test-simd-env()
+{
+    echo '&amp;'|
+    HTML_CREF_SIMD=bogus html-cref ${1:+-p "$1"} -S 2>&1|
+    sed -r 's/(using )\x27[a-z0-9]+\x27$/\1.../'
+}
+
+dump-option()
+{
+    local o="$1"
+    shift
+
+    html-cref "$@" --dump-options|
+    sed -nr 's/^'"$o"':\s+//p'
+}
+
+autotune-cache()
+{
+    local d
+    local f
+    local r=0
+
+    d="$(mktemp -d)" || return 1
+    f="$d/a/b/html-cref-autotune"
+
+    # stev: the directories of the cache file are
+    # created as needed and the parser stored in it
+    # becomes the default one; a cache file that does
+    # not exist leaves the builtin default in place
+    html-cref -A --autotune-cache="$f" &>/dev/null &&
+    [ "$(wc -l < "$f")" -eq 1 ] &&
+    [ "$(cut -f3 "$f")" == "$(dump-option cref-parser --autotune-cache="$f")" ] ||
+    r=1
+
+    dump-option cref-parser --autotune-cache="$d/none"
+
+    rm -fr "$d"
+    return $r
+}
+
+# stev: the entry of the autotune cache is not used
+# by the actions that do not parse char references,
+# nor by builds other than the one which stored it;
+# a cached parser module that cannot be loaded gets
+# replaced by the default one, with a warning
+
+autotune-fallback()
+{
+    local d
+    local f
+
+    d="$(mktemp -d)" || return 1
+    f="$d/html-cref-autotune"
+
+    html-cref -A --autotune-cache="$f" &>/dev/null &&
+    dump-option cref-parser -E --autotune-cache="$f" &&
+    dump-option cref-parser -X --autotune-cache="$f" &&
+    sed -r 's/\t[^\t]*\t/\tother\t/' "$f" > "$f.b" &&
+    dump-option cref-parser --autotune-cache="$f.b" &&
+    sed -r 's/\t[^\t]*$/\tnone/' "$f" > "$f.n" &&
+    echo 'a &amp; b'|
+    html-cref --autotune-cache="$f.n" 2>&1|
+    sed -r 's/(library): .*/\1/'
+
+    rm -fr "$d"
+}
+
+timings-auto()
+{
+    local n
+
+    # stev: the timings options are built in only
+    # by 'make TIMINGS=yes' -- 'test-modules.sh' skips
+    # this function in other builds --; the calibration
+    # of the overheads must not make the timings underflow
+
+    n="$(simd-tails|
+        html-cref --timings=auto "$@" 2>&1 >/dev/null|
+        grep -c -- '-overhead: ')" &&
+    [ "$n" -gt 0 ]
+}
+
+validate-bytes-out()
+{
+    local f
+    local a
+    local b
+
+    # stev: the count of bytes of output printed by
+    # '-V' is exactly the one of the output of '-S'
+    for f in simd-input simd-tails 'cat test-html-crefs.txt'; do
+        a="$($f|html-cref "$@" -V|sed -nr 's/^bytes-out:\s+//p')"
+        b="$($f|html-cref "$@" -S|wc -c)"
+        [ "$a" == "$b" ] ||
+        echo "$f: bytes-out: $a != $b"
+    done
+}
+
+encode-round-trip()
+{
+    local d
 
+    d="$(mktemp)" || return 1
+
+    # stev: the text of each of the entries of the
+    # table, encoded by '-E', decodes back by '-S'
+    # to the very same text
+    sed 's/.*/\&&;/' html-cref-names.txt|
+    html-cref -S > "$d" &&
+    html-cref "$@" -E < "$d"|
+    html-cref -S|
+    diff -u0 -Lexpected "$d" -Lactual -
+
+    rm -f "$d"
+}
+
+escape-ref()
+{
+    sed 's/&/\&amp;/g;s/</\&lt;/g;s/>/\&gt;/g;s/"/\&quot;/g;s/'\''/\&#39;/g'
+}
+
+# stev: an input of which char at offset $1 is $2
+# -- if given, else no char needs escaping --, the
+# rest of it being made of chars that need no such
+# escaping; '-X' escapes its input by chunks of 4096
+# bytes, writing out as they are the chunks that need
+# no escaping
+
+escape-chunk()
+{
+    awk -v k="$1" -v c="$2" 'BEGIN {
+        s = ""
+        for (i = 0; i < k + 100; i ++)
+            s = s (i == k && c != "" ? c : i % 64 == 63 ? "\n" : "a")
+        print s
+    }'
+}
+
+test-escape()
+{
+    local v
+    local t
+    local k
+    local c
+
+    for v in scalar $(simd-variants); do
+        for t in sponge liner; do
+            diff -u0 \
+-Lexpected <(simd-tails|escape-ref) \
+-L$v-$t <(simd-tails|HTML_CREF_SIMD=$v html-cref -t $t -X)
+        done
+        for k in 4094 4095 4096 4097 8190 8191 8192 8193; do
+            for c in '' '&' '<' '>' '"' "'"; do
+                diff -u0 \
+-Lexpected <(escape-chunk $k "$c"|escape-ref) \
+-L$v-$k-"$c" <(escape-chunk $k "$c"|HTML_CREF_SIMD=$v html-cref -X)
+            done
+        done
+    done
+}
+
+# stev: an alphanumeric run of 1M chars following
+# an '&': the warning of '-w' is about its first
+# 2 * 31 chars only
+
+alnum-run()
+{
+    awk 'BEGIN {
+        s = "a"
+        for (i = 0; i < 20; i ++)
+            s = s s
+        printf("x &%s; y\n", s)
+    }'
+}
+
+# stev: the statistics of '--stats', less the
+# figures that vary from one run to another
+
+stats()
+{
+    html-cref -S "$@" 2>&1 >/dev/null|
+    sed -r \
+        -e '/^# (wall-time|throughput|peak-rss):/d' \
+        -e 's/,"wall_time":[^,]*,"throughput":[^,]*,"peak_rss":[^,]*//'
+}
+
+# stev: the names histogram of '--stats' is a
+# 'freqs' file of 'gen-corpus.awk': the names of
+# a corpus generated upon it are ranked by their
+# counts as they are in the histogram -- the names
+# not found in the histogram are ranked after
+
+stats-corpus()
+{
+    local f
+
+    f="$(mktemp)" || return 1
+
+    printf 'a &amp; &lt; &amp &bogus; &#65; &amp;\n'|
+    html-cref -S --stats 2> "$f" >/dev/null &&
+    printf 'amp\nlt\ngt\n'|
+    awk -f ../src/gen-corpus.awk \
+        -v freqs="$f" \
+        -v legacies=/dev/null \
+        -v seed=1 \
+        -v refs=1000 \
+        -v zipf=200 \
+        -v density=100 \
+        -v numeric=0 \
+        -v hex=0 \
+        -v invalid=0 \
+        -v legacy=0 \
+        -v urls=0|
+    html-cref -S --stats 2>&1 >/dev/null|
+    awk '!/^#/ { print $1 }'
+
+    rm -f "$f"
+}
+
+# stev: the options '--sample' and '--random-sample'
+# are built in only by 'make TIMINGS=yes'; 'test-modules.sh'
+# skips the functions below in other builds
+
+sample-options()
+{
+    diff -u0 -Lexpected -Lactual - <(
+        dump-option sample
+        dump-option sample --sample=16
+        dump-option sample --random-sample=16
+        dump-option sample --random-sample=16 --no-sample
+        dump-option sample --sample=1M 2>&1
+        html-cref --sample=0 < /dev/null 2>&1
+        html-cref --random-sample=1000001 < /dev/null 2>&1
+    ) <<'EOF2'
+1
+16
+random:16
+1
+html-cref: error: invalid argument for 'sample' option: '1M'
+html-cref: error: illegal argument for 'sample' option: '0'
+html-cref: error: illegal argument for 'random-sample' option: '1000001'
+EOF2
+}
+
+# stev: the totals of the timings are followed by
+# their standard errors when sampling the calls of
+# the parser, and only then
+
+sample-timings()
+{
+    local s
+    local p
+    local l
+
+    for s in --no-sample --sample=4 --random-sample=4; do
+        p='^real-timings: +[0-9]+'
+        [ "$s" != --no-sample ] && p+=' \+- [0-9]+'
+
+        l="$(simd-tails|
+            html-cref --real-timings $s "$@" 2>&1 >/dev/null)" &&
+        grep -Eqx "$p" <<< "$l" ||
+        return 1
+    done
+}
+
+# stev: the option '--histogram' is built in only by
+# 'make TIMINGS=yes CYCLES=yes'; 'test-modules.sh' skips
+# the functions below in other builds
+
+histogram-options()
+{
+    diff -u0 -Lexpected -Lactual - <(
+        dump-option histogram
+        dump-option histogram --histogram
+        dump-option histogram --histogram=length
+        dump-option histogram --histogram --no-histogram
+        html-cref --histogram=foo < /dev/null 2>&1
+        html-cref --histogram < /dev/null 2>&1
+    ) <<'EOF2'
+-
+total
+length
+-
+html-cref: error: invalid argument for 'histogram' option: 'foo'
+html-cref: error: option '--histogram' requires option '-c|--[clock-]cycles'
+EOF2
+}
+
+# stev: the histogram counts one call of the parser
+# per '&' of the input -- every $1-th one only when
+# sampling the calls --; the breakdown by lengths
+# sums up to the same count; the percentiles are
+# not decreasing
+
+histogram-counts()
+{
+    local n="${1:-1}"
+    local c
+
+    c="$(simd-tails|tr -cd '&'|wc -c)" &&
+    simd-tails|
+    html-cref --cycles --histogram --sample=$n 2>&1 >/dev/null|
+    grep -qx "cycles-histogram: count=$((c / n)) .*" &&
+    simd-tails|
+    html-cref --cycles --histogram=length --sample=$n 2>&1 >/dev/null|
+    awk -v c=$((c / n)) '
+        /^cycles-histogram-/ {
+            for (i = 2; i <= NF; i ++) {
+                split($i, a, "=")
+                v[i] = a[2] + 0
+            }
+            s += v[2]
+            for (i = 4; i <= NF; i ++)
+                if (v[i] < v[i - 1])
+                    exit 1
+        }
+        END {
+            exit s != c
+        }'
+}
@@ -43,6 +43,8 @@ echo >&2
 
 echo "test cases passed: ${r[0]}"
 echo "test cases failed: ${r[1]}"
+[ "${r[2]:-0}" -gt 0 ] &&
+echo "test cases skipped: ${r[2]}"
 
 exit $(( ${r[1]} != 0 ))
 